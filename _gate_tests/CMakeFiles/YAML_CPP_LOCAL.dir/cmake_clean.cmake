@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/YAML_CPP_LOCAL"
+  "CMakeFiles/YAML_CPP_LOCAL-complete"
+  "YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL-stamp/YAML_CPP_LOCAL-build"
+  "YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL-stamp/YAML_CPP_LOCAL-configure"
+  "YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL-stamp/YAML_CPP_LOCAL-download"
+  "YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL-stamp/YAML_CPP_LOCAL-install"
+  "YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL-stamp/YAML_CPP_LOCAL-mkdir"
+  "YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL-stamp/YAML_CPP_LOCAL-patch"
+  "YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL-stamp/YAML_CPP_LOCAL-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/YAML_CPP_LOCAL.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
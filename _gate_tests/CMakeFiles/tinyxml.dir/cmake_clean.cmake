@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tinyxml"
+  "CMakeFiles/tinyxml-complete"
+  "tinyxml-prefix/src/tinyxml-stamp/tinyxml-build"
+  "tinyxml-prefix/src/tinyxml-stamp/tinyxml-configure"
+  "tinyxml-prefix/src/tinyxml-stamp/tinyxml-download"
+  "tinyxml-prefix/src/tinyxml-stamp/tinyxml-install"
+  "tinyxml-prefix/src/tinyxml-stamp/tinyxml-mkdir"
+  "tinyxml-prefix/src/tinyxml-stamp/tinyxml-patch"
+  "tinyxml-prefix/src/tinyxml-stamp/tinyxml-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/tinyxml.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
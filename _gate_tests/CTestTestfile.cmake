@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_gate_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("src/core")
+subdirs("src/core_tests")
+subdirs("src/apps/ociocheck")
+subdirs("src/apps/ociobakelut")
+subdirs("src/pyglue")
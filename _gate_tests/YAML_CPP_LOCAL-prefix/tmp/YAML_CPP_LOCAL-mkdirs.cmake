@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL"
+  "/root/repo/_gate_tests/ext/build/yaml-cpp"
+  "/root/repo/_gate_tests/ext/dist"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/tmp"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL-stamp"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL-stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL-stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL-stamp${cfgdir}") # cfgdir has leading slash
+endif()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_gate_tests/tinyxml-prefix/src/tinyxml/tinystr.cpp" "CMakeFiles/tinyxml.dir/tinystr.cpp.o" "gcc" "CMakeFiles/tinyxml.dir/tinystr.cpp.o.d"
+  "/root/repo/_gate_tests/tinyxml-prefix/src/tinyxml/tinyxml.cpp" "CMakeFiles/tinyxml.dir/tinyxml.cpp.o" "gcc" "CMakeFiles/tinyxml.dir/tinyxml.cpp.o.d"
+  "/root/repo/_gate_tests/tinyxml-prefix/src/tinyxml/tinyxmlerror.cpp" "CMakeFiles/tinyxml.dir/tinyxmlerror.cpp.o" "gcc" "CMakeFiles/tinyxml.dir/tinyxmlerror.cpp.o.d"
+  "/root/repo/_gate_tests/tinyxml-prefix/src/tinyxml/tinyxmlparser.cpp" "CMakeFiles/tinyxml.dir/tinyxmlparser.cpp.o" "gcc" "CMakeFiles/tinyxml.dir/tinyxmlparser.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tinyxml.dir/tinystr.cpp.o"
+  "CMakeFiles/tinyxml.dir/tinystr.cpp.o.d"
+  "CMakeFiles/tinyxml.dir/tinyxml.cpp.o"
+  "CMakeFiles/tinyxml.dir/tinyxml.cpp.o.d"
+  "CMakeFiles/tinyxml.dir/tinyxmlerror.cpp.o"
+  "CMakeFiles/tinyxml.dir/tinyxmlerror.cpp.o.d"
+  "CMakeFiles/tinyxml.dir/tinyxmlparser.cpp.o"
+  "CMakeFiles/tinyxml.dir/tinyxmlparser.cpp.o.d"
+  "libtinyxml.a"
+  "libtinyxml.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tinyxml.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/debuggable"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/debuggable.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,45 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/aliasmanager.cpp" "CMakeFiles/yaml-cpp.dir/src/aliasmanager.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/aliasmanager.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/binary.cpp" "CMakeFiles/yaml-cpp.dir/src/binary.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/binary.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/contrib/graphbuilder.cpp" "CMakeFiles/yaml-cpp.dir/src/contrib/graphbuilder.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/contrib/graphbuilder.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/contrib/graphbuilderadapter.cpp" "CMakeFiles/yaml-cpp.dir/src/contrib/graphbuilderadapter.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/contrib/graphbuilderadapter.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/conversion.cpp" "CMakeFiles/yaml-cpp.dir/src/conversion.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/conversion.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/directives.cpp" "CMakeFiles/yaml-cpp.dir/src/directives.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/directives.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/emitfromevents.cpp" "CMakeFiles/yaml-cpp.dir/src/emitfromevents.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/emitfromevents.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/emitter.cpp" "CMakeFiles/yaml-cpp.dir/src/emitter.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/emitter.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/emitterstate.cpp" "CMakeFiles/yaml-cpp.dir/src/emitterstate.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/emitterstate.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/emitterutils.cpp" "CMakeFiles/yaml-cpp.dir/src/emitterutils.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/emitterutils.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/exp.cpp" "CMakeFiles/yaml-cpp.dir/src/exp.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/exp.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/iterator.cpp" "CMakeFiles/yaml-cpp.dir/src/iterator.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/iterator.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/node.cpp" "CMakeFiles/yaml-cpp.dir/src/node.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/node.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/nodebuilder.cpp" "CMakeFiles/yaml-cpp.dir/src/nodebuilder.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/nodebuilder.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/nodeownership.cpp" "CMakeFiles/yaml-cpp.dir/src/nodeownership.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/nodeownership.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/null.cpp" "CMakeFiles/yaml-cpp.dir/src/null.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/null.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/ostream.cpp" "CMakeFiles/yaml-cpp.dir/src/ostream.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/ostream.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/parser.cpp" "CMakeFiles/yaml-cpp.dir/src/parser.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/parser.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/regex.cpp" "CMakeFiles/yaml-cpp.dir/src/regex.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/regex.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/scanner.cpp" "CMakeFiles/yaml-cpp.dir/src/scanner.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/scanner.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/scanscalar.cpp" "CMakeFiles/yaml-cpp.dir/src/scanscalar.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/scanscalar.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/scantag.cpp" "CMakeFiles/yaml-cpp.dir/src/scantag.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/scantag.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/scantoken.cpp" "CMakeFiles/yaml-cpp.dir/src/scantoken.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/scantoken.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/simplekey.cpp" "CMakeFiles/yaml-cpp.dir/src/simplekey.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/simplekey.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/singledocparser.cpp" "CMakeFiles/yaml-cpp.dir/src/singledocparser.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/singledocparser.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/stream.cpp" "CMakeFiles/yaml-cpp.dir/src/stream.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/stream.cpp.o.d"
+  "/root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL/src/tag.cpp" "CMakeFiles/yaml-cpp.dir/src/tag.cpp.o" "gcc" "CMakeFiles/yaml-cpp.dir/src/tag.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
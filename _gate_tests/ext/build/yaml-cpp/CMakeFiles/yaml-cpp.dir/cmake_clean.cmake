@@ -0,0 +1,63 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/yaml-cpp.dir/src/aliasmanager.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/aliasmanager.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/binary.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/binary.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/contrib/graphbuilder.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/contrib/graphbuilder.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/contrib/graphbuilderadapter.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/contrib/graphbuilderadapter.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/conversion.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/conversion.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/directives.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/directives.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/emitfromevents.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/emitfromevents.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/emitter.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/emitter.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/emitterstate.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/emitterstate.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/emitterutils.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/emitterutils.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/exp.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/exp.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/iterator.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/iterator.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/node.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/node.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/nodebuilder.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/nodebuilder.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/nodeownership.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/nodeownership.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/null.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/null.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/ostream.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/ostream.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/parser.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/parser.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/regex.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/regex.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/scanner.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/scanner.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/scanscalar.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/scanscalar.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/scantag.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/scantag.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/scantoken.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/scantoken.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/simplekey.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/simplekey.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/singledocparser.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/singledocparser.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/stream.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/stream.cpp.o.d"
+  "CMakeFiles/yaml-cpp.dir/src/tag.cpp.o"
+  "CMakeFiles/yaml-cpp.dir/src/tag.cpp.o.d"
+  "libyaml-cpp.a"
+  "libyaml-cpp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yaml-cpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/_gate_tests/YAML_CPP_LOCAL-prefix/src/YAML_CPP_LOCAL
+# Build directory: /root/repo/_gate_tests/ext/build/yaml-cpp
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,14 @@
+#!/bin/sh
+OCIO_ROOT="/usr/local"
+OCIO_EXECROOT="/usr/local"
+
+# For OS X
+export DYLD_LIBRARY_PATH="${OCIO_EXECROOT}/lib:${DYLD_LIBRARY_PATH}"
+
+# For Linux
+export LD_LIBRARY_PATH="${OCIO_EXECROOT}/lib:${LD_LIBRARY_PATH}"
+
+export PATH="${OCIO_EXECROOT}/bin:${PATH}"
+export PYTHONPATH="${OCIO_EXECROOT}/lib/python3.11/site-packages:${PYTHONPATH}"
+export NUKE_PATH="${OCIO_EXECROOT}/lib/nuke:${NUKE_PATH}"
+export NUKE_PATH="${OCIO_ROOT}/share/nuke:${NUKE_PATH}";
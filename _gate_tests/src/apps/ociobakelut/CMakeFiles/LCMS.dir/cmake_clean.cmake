@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/LCMS"
+  "CMakeFiles/LCMS-complete"
+  "LCMS-prefix/src/LCMS-stamp/LCMS-build"
+  "LCMS-prefix/src/LCMS-stamp/LCMS-configure"
+  "LCMS-prefix/src/LCMS-stamp/LCMS-download"
+  "LCMS-prefix/src/LCMS-stamp/LCMS-install"
+  "LCMS-prefix/src/LCMS-stamp/LCMS-mkdir"
+  "LCMS-prefix/src/LCMS-stamp/LCMS-patch"
+  "LCMS-prefix/src/LCMS-stamp/LCMS-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/LCMS.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
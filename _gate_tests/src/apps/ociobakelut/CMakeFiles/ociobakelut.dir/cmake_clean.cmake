@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ociobakelut.dir/__/share/argparse.cpp.o"
+  "CMakeFiles/ociobakelut.dir/__/share/argparse.cpp.o.d"
+  "CMakeFiles/ociobakelut.dir/__/share/pystring.cpp.o"
+  "CMakeFiles/ociobakelut.dir/__/share/pystring.cpp.o.d"
+  "CMakeFiles/ociobakelut.dir/__/share/strutil.cpp.o"
+  "CMakeFiles/ociobakelut.dir/__/share/strutil.cpp.o.d"
+  "CMakeFiles/ociobakelut.dir/main.cpp.o"
+  "CMakeFiles/ociobakelut.dir/main.cpp.o.d"
+  "CMakeFiles/ociobakelut.dir/ocioicc.cpp.o"
+  "CMakeFiles/ociobakelut.dir/ocioicc.cpp.o.d"
+  "ociobakelut"
+  "ociobakelut.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ociobakelut.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/_gate_tests/src/apps/ociobakelut/LCMS-prefix/src/LCMS"
+  "/root/repo/_gate_tests/src/apps/ociobakelut/LCMS-prefix/src/LCMS-build"
+  "/root/repo/_gate_tests/src/apps/ociobakelut/LCMS-prefix"
+  "/root/repo/_gate_tests/src/apps/ociobakelut/LCMS-prefix/tmp"
+  "/root/repo/_gate_tests/src/apps/ociobakelut/LCMS-prefix/src/LCMS-stamp"
+  "/root/repo/_gate_tests/src/apps/ociobakelut/LCMS-prefix/src"
+  "/root/repo/_gate_tests/src/apps/ociobakelut/LCMS-prefix/src/LCMS-stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/_gate_tests/src/apps/ociobakelut/LCMS-prefix/src/LCMS-stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/_gate_tests/src/apps/ociobakelut/LCMS-prefix/src/LCMS-stamp${cfgdir}") # cfgdir has leading slash
+endif()
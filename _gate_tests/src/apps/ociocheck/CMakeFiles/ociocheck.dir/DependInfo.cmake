@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/apps/share/argparse.cpp" "src/apps/ociocheck/CMakeFiles/ociocheck.dir/__/share/argparse.cpp.o" "gcc" "src/apps/ociocheck/CMakeFiles/ociocheck.dir/__/share/argparse.cpp.o.d"
+  "/root/repo/src/apps/share/pystring.cpp" "src/apps/ociocheck/CMakeFiles/ociocheck.dir/__/share/pystring.cpp.o" "gcc" "src/apps/ociocheck/CMakeFiles/ociocheck.dir/__/share/pystring.cpp.o.d"
+  "/root/repo/src/apps/share/strutil.cpp" "src/apps/ociocheck/CMakeFiles/ociocheck.dir/__/share/strutil.cpp.o" "gcc" "src/apps/ociocheck/CMakeFiles/ociocheck.dir/__/share/strutil.cpp.o.d"
+  "/root/repo/src/apps/ociocheck/main.cpp" "src/apps/ociocheck/CMakeFiles/ociocheck.dir/main.cpp.o" "gcc" "src/apps/ociocheck/CMakeFiles/ociocheck.dir/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_tests/src/core/CMakeFiles/OpenColorIO.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ociocheck.dir/__/share/argparse.cpp.o"
+  "CMakeFiles/ociocheck.dir/__/share/argparse.cpp.o.d"
+  "CMakeFiles/ociocheck.dir/__/share/pystring.cpp.o"
+  "CMakeFiles/ociocheck.dir/__/share/pystring.cpp.o.d"
+  "CMakeFiles/ociocheck.dir/__/share/strutil.cpp.o"
+  "CMakeFiles/ociocheck.dir/__/share/strutil.cpp.o.d"
+  "CMakeFiles/ociocheck.dir/main.cpp.o"
+  "CMakeFiles/ociocheck.dir/main.cpp.o.d"
+  "ociocheck"
+  "ociocheck.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ociocheck.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
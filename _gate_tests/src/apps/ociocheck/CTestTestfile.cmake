@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/apps/ociocheck
+# Build directory: /root/repo/_gate_tests/src/apps/ociocheck
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
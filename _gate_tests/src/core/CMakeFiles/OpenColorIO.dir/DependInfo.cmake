@@ -0,0 +1,95 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/core/AllocationOp.cpp" "src/core/CMakeFiles/OpenColorIO.dir/AllocationOp.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/AllocationOp.cpp.o.d"
+  "/root/repo/src/core/AllocationTransform.cpp" "src/core/CMakeFiles/OpenColorIO.dir/AllocationTransform.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/AllocationTransform.cpp.o.d"
+  "/root/repo/src/core/Baker.cpp" "src/core/CMakeFiles/OpenColorIO.dir/Baker.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/Baker.cpp.o.d"
+  "/root/repo/src/core/BakingUtils.cpp" "src/core/CMakeFiles/OpenColorIO.dir/BakingUtils.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/BakingUtils.cpp.o.d"
+  "/root/repo/src/core/BitDepthUtils.cpp" "src/core/CMakeFiles/OpenColorIO.dir/BitDepthUtils.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/BitDepthUtils.cpp.o.d"
+  "/root/repo/src/core/CDLTransform.cpp" "src/core/CMakeFiles/OpenColorIO.dir/CDLTransform.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/CDLTransform.cpp.o.d"
+  "/root/repo/src/core/CPUInfo.cpp" "src/core/CMakeFiles/OpenColorIO.dir/CPUInfo.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/CPUInfo.cpp.o.d"
+  "/root/repo/src/core/Caching.cpp" "src/core/CMakeFiles/OpenColorIO.dir/Caching.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/Caching.cpp.o.d"
+  "/root/repo/src/core/ColorSpace.cpp" "src/core/CMakeFiles/OpenColorIO.dir/ColorSpace.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/ColorSpace.cpp.o.d"
+  "/root/repo/src/core/ColorSpaceTransform.cpp" "src/core/CMakeFiles/OpenColorIO.dir/ColorSpaceTransform.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/ColorSpaceTransform.cpp.o.d"
+  "/root/repo/src/core/Config.cpp" "src/core/CMakeFiles/OpenColorIO.dir/Config.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/Config.cpp.o.d"
+  "/root/repo/src/core/Context.cpp" "src/core/CMakeFiles/OpenColorIO.dir/Context.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/Context.cpp.o.d"
+  "/root/repo/src/core/CpuProgram.cpp" "src/core/CMakeFiles/OpenColorIO.dir/CpuProgram.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/CpuProgram.cpp.o.d"
+  "/root/repo/src/core/Display.cpp" "src/core/CMakeFiles/OpenColorIO.dir/Display.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/Display.cpp.o.d"
+  "/root/repo/src/core/DisplayTransform.cpp" "src/core/CMakeFiles/OpenColorIO.dir/DisplayTransform.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/DisplayTransform.cpp.o.d"
+  "/root/repo/src/core/Exception.cpp" "src/core/CMakeFiles/OpenColorIO.dir/Exception.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/Exception.cpp.o.d"
+  "/root/repo/src/core/ExponentOps.cpp" "src/core/CMakeFiles/OpenColorIO.dir/ExponentOps.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/ExponentOps.cpp.o.d"
+  "/root/repo/src/core/ExponentTransform.cpp" "src/core/CMakeFiles/OpenColorIO.dir/ExponentTransform.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/ExponentTransform.cpp.o.d"
+  "/root/repo/src/core/FileFormat3DL.cpp" "src/core/CMakeFiles/OpenColorIO.dir/FileFormat3DL.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/FileFormat3DL.cpp.o.d"
+  "/root/repo/src/core/FileFormatBinary.cpp" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatBinary.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatBinary.cpp.o.d"
+  "/root/repo/src/core/FileFormatCC.cpp" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatCC.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatCC.cpp.o.d"
+  "/root/repo/src/core/FileFormatCCC.cpp" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatCCC.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatCCC.cpp.o.d"
+  "/root/repo/src/core/FileFormatCDL.cpp" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatCDL.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatCDL.cpp.o.d"
+  "/root/repo/src/core/FileFormatCSP.cpp" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatCSP.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatCSP.cpp.o.d"
+  "/root/repo/src/core/FileFormatHDL.cpp" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatHDL.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatHDL.cpp.o.d"
+  "/root/repo/src/core/FileFormatIridasCube.cpp" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatIridasCube.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatIridasCube.cpp.o.d"
+  "/root/repo/src/core/FileFormatIridasItx.cpp" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatIridasItx.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatIridasItx.cpp.o.d"
+  "/root/repo/src/core/FileFormatIridasLook.cpp" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatIridasLook.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatIridasLook.cpp.o.d"
+  "/root/repo/src/core/FileFormatPandora.cpp" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatPandora.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatPandora.cpp.o.d"
+  "/root/repo/src/core/FileFormatSpi1D.cpp" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatSpi1D.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatSpi1D.cpp.o.d"
+  "/root/repo/src/core/FileFormatSpi3D.cpp" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatSpi3D.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatSpi3D.cpp.o.d"
+  "/root/repo/src/core/FileFormatSpiMtx.cpp" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatSpiMtx.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatSpiMtx.cpp.o.d"
+  "/root/repo/src/core/FileFormatTruelight.cpp" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatTruelight.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatTruelight.cpp.o.d"
+  "/root/repo/src/core/FileFormatVF.cpp" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatVF.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/FileFormatVF.cpp.o.d"
+  "/root/repo/src/core/FileTransform.cpp" "src/core/CMakeFiles/OpenColorIO.dir/FileTransform.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/FileTransform.cpp.o.d"
+  "/root/repo/src/core/GpuShaderDesc.cpp" "src/core/CMakeFiles/OpenColorIO.dir/GpuShaderDesc.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/GpuShaderDesc.cpp.o.d"
+  "/root/repo/src/core/GpuShaderUtils.cpp" "src/core/CMakeFiles/OpenColorIO.dir/GpuShaderUtils.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/GpuShaderUtils.cpp.o.d"
+  "/root/repo/src/core/GroupTransform.cpp" "src/core/CMakeFiles/OpenColorIO.dir/GroupTransform.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/GroupTransform.cpp.o.d"
+  "/root/repo/src/core/HashUtils.cpp" "src/core/CMakeFiles/OpenColorIO.dir/HashUtils.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/HashUtils.cpp.o.d"
+  "/root/repo/src/core/ImageDesc.cpp" "src/core/CMakeFiles/OpenColorIO.dir/ImageDesc.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/ImageDesc.cpp.o.d"
+  "/root/repo/src/core/ImagePacking.cpp" "src/core/CMakeFiles/OpenColorIO.dir/ImagePacking.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/ImagePacking.cpp.o.d"
+  "/root/repo/src/core/LogOps.cpp" "src/core/CMakeFiles/OpenColorIO.dir/LogOps.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/LogOps.cpp.o.d"
+  "/root/repo/src/core/LogTransform.cpp" "src/core/CMakeFiles/OpenColorIO.dir/LogTransform.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/LogTransform.cpp.o.d"
+  "/root/repo/src/core/Logging.cpp" "src/core/CMakeFiles/OpenColorIO.dir/Logging.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/Logging.cpp.o.d"
+  "/root/repo/src/core/Look.cpp" "src/core/CMakeFiles/OpenColorIO.dir/Look.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/Look.cpp.o.d"
+  "/root/repo/src/core/LookParse.cpp" "src/core/CMakeFiles/OpenColorIO.dir/LookParse.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/LookParse.cpp.o.d"
+  "/root/repo/src/core/LookTransform.cpp" "src/core/CMakeFiles/OpenColorIO.dir/LookTransform.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/LookTransform.cpp.o.d"
+  "/root/repo/src/core/Lut1DOp.cpp" "src/core/CMakeFiles/OpenColorIO.dir/Lut1DOp.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/Lut1DOp.cpp.o.d"
+  "/root/repo/src/core/Lut3DOp.cpp" "src/core/CMakeFiles/OpenColorIO.dir/Lut3DOp.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/Lut3DOp.cpp.o.d"
+  "/root/repo/src/core/LutCache.cpp" "src/core/CMakeFiles/OpenColorIO.dir/LutCache.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/LutCache.cpp.o.d"
+  "/root/repo/src/core/MathUtils.cpp" "src/core/CMakeFiles/OpenColorIO.dir/MathUtils.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/MathUtils.cpp.o.d"
+  "/root/repo/src/core/MatrixOps.cpp" "src/core/CMakeFiles/OpenColorIO.dir/MatrixOps.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/MatrixOps.cpp.o.d"
+  "/root/repo/src/core/MatrixTransform.cpp" "src/core/CMakeFiles/OpenColorIO.dir/MatrixTransform.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/MatrixTransform.cpp.o.d"
+  "/root/repo/src/core/NoOps.cpp" "src/core/CMakeFiles/OpenColorIO.dir/NoOps.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/NoOps.cpp.o.d"
+  "/root/repo/src/core/OCIOYaml.cpp" "src/core/CMakeFiles/OpenColorIO.dir/OCIOYaml.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/OCIOYaml.cpp.o.d"
+  "/root/repo/src/core/Op.cpp" "src/core/CMakeFiles/OpenColorIO.dir/Op.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/Op.cpp.o.d"
+  "/root/repo/src/core/OpOptimizers.cpp" "src/core/CMakeFiles/OpenColorIO.dir/OpOptimizers.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/OpOptimizers.cpp.o.d"
+  "/root/repo/src/core/ParseUtils.cpp" "src/core/CMakeFiles/OpenColorIO.dir/ParseUtils.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/ParseUtils.cpp.o.d"
+  "/root/repo/src/core/PathUtils.cpp" "src/core/CMakeFiles/OpenColorIO.dir/PathUtils.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/PathUtils.cpp.o.d"
+  "/root/repo/src/core/Prefetch.cpp" "src/core/CMakeFiles/OpenColorIO.dir/Prefetch.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/Prefetch.cpp.o.d"
+  "/root/repo/src/core/Processor.cpp" "src/core/CMakeFiles/OpenColorIO.dir/Processor.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/Processor.cpp.o.d"
+  "/root/repo/src/core/ProcessorCache.cpp" "src/core/CMakeFiles/OpenColorIO.dir/ProcessorCache.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/ProcessorCache.cpp.o.d"
+  "/root/repo/src/core/ScanlineHelper.cpp" "src/core/CMakeFiles/OpenColorIO.dir/ScanlineHelper.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/ScanlineHelper.cpp.o.d"
+  "/root/repo/src/core/Threading.cpp" "src/core/CMakeFiles/OpenColorIO.dir/Threading.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/Threading.cpp.o.d"
+  "/root/repo/src/core/Transform.cpp" "src/core/CMakeFiles/OpenColorIO.dir/Transform.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/Transform.cpp.o.d"
+  "/root/repo/src/core/TruelightOp.cpp" "src/core/CMakeFiles/OpenColorIO.dir/TruelightOp.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/TruelightOp.cpp.o.d"
+  "/root/repo/src/core/TruelightTransform.cpp" "src/core/CMakeFiles/OpenColorIO.dir/TruelightTransform.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/TruelightTransform.cpp.o.d"
+  "/root/repo/src/core/UnitTest.cpp" "src/core/CMakeFiles/OpenColorIO.dir/UnitTest.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/UnitTest.cpp.o.d"
+  "/root/repo/src/core/md5/md5.cpp" "src/core/CMakeFiles/OpenColorIO.dir/md5/md5.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/md5/md5.cpp.o.d"
+  "/root/repo/src/core/pystring/pystring.cpp" "src/core/CMakeFiles/OpenColorIO.dir/pystring/pystring.cpp.o" "gcc" "src/core/CMakeFiles/OpenColorIO.dir/pystring/pystring.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_tests/src/core/libOpenColorIO.so" "/root/repo/_gate_tests/src/core/libOpenColorIO.so.1.0.9"
+  "/root/repo/_gate_tests/src/core/libOpenColorIO.so.1" "/root/repo/_gate_tests/src/core/libOpenColorIO.so.1.0.9"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,151 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/OpenColorIO.dir/AllocationOp.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/AllocationOp.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/AllocationTransform.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/AllocationTransform.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/Baker.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/Baker.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/BakingUtils.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/BakingUtils.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/BitDepthUtils.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/BitDepthUtils.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/CDLTransform.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/CDLTransform.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/CPUInfo.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/CPUInfo.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/Caching.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/Caching.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/ColorSpace.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/ColorSpace.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/ColorSpaceTransform.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/ColorSpaceTransform.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/Config.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/Config.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/Context.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/Context.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/CpuProgram.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/CpuProgram.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/Display.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/Display.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/DisplayTransform.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/DisplayTransform.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/Exception.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/Exception.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/ExponentOps.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/ExponentOps.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/ExponentTransform.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/ExponentTransform.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/FileFormat3DL.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/FileFormat3DL.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/FileFormatBinary.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/FileFormatBinary.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/FileFormatCC.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/FileFormatCC.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/FileFormatCCC.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/FileFormatCCC.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/FileFormatCDL.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/FileFormatCDL.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/FileFormatCSP.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/FileFormatCSP.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/FileFormatHDL.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/FileFormatHDL.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/FileFormatIridasCube.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/FileFormatIridasCube.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/FileFormatIridasItx.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/FileFormatIridasItx.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/FileFormatIridasLook.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/FileFormatIridasLook.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/FileFormatPandora.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/FileFormatPandora.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/FileFormatSpi1D.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/FileFormatSpi1D.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/FileFormatSpi3D.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/FileFormatSpi3D.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/FileFormatSpiMtx.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/FileFormatSpiMtx.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/FileFormatTruelight.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/FileFormatTruelight.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/FileFormatVF.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/FileFormatVF.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/FileTransform.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/FileTransform.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/GpuShaderDesc.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/GpuShaderDesc.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/GpuShaderUtils.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/GpuShaderUtils.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/GroupTransform.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/GroupTransform.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/HashUtils.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/HashUtils.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/ImageDesc.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/ImageDesc.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/ImagePacking.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/ImagePacking.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/LogOps.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/LogOps.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/LogTransform.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/LogTransform.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/Logging.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/Logging.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/Look.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/Look.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/LookParse.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/LookParse.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/LookTransform.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/LookTransform.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/Lut1DOp.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/Lut1DOp.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/Lut3DOp.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/Lut3DOp.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/LutCache.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/LutCache.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/MathUtils.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/MathUtils.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/MatrixOps.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/MatrixOps.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/MatrixTransform.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/MatrixTransform.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/NoOps.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/NoOps.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/OCIOYaml.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/OCIOYaml.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/Op.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/Op.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/OpOptimizers.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/OpOptimizers.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/ParseUtils.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/ParseUtils.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/PathUtils.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/PathUtils.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/Prefetch.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/Prefetch.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/Processor.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/Processor.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/ProcessorCache.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/ProcessorCache.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/ScanlineHelper.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/ScanlineHelper.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/Threading.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/Threading.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/Transform.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/Transform.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/TruelightOp.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/TruelightOp.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/TruelightTransform.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/TruelightTransform.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/UnitTest.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/UnitTest.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/md5/md5.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/md5/md5.cpp.o.d"
+  "CMakeFiles/OpenColorIO.dir/pystring/pystring.cpp.o"
+  "CMakeFiles/OpenColorIO.dir/pystring/pystring.cpp.o.d"
+  "libOpenColorIO.pdb"
+  "libOpenColorIO.so"
+  "libOpenColorIO.so.1"
+  "libOpenColorIO.so.1.0.9"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/OpenColorIO.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
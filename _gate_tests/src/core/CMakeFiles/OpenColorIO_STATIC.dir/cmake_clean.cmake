@@ -0,0 +1,147 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/OpenColorIO_STATIC.dir/AllocationOp.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/AllocationOp.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/AllocationTransform.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/AllocationTransform.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Baker.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Baker.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/BakingUtils.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/BakingUtils.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/BitDepthUtils.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/BitDepthUtils.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/CDLTransform.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/CDLTransform.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/CPUInfo.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/CPUInfo.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Caching.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Caching.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/ColorSpace.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/ColorSpace.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/ColorSpaceTransform.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/ColorSpaceTransform.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Config.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Config.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Context.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Context.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/CpuProgram.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/CpuProgram.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Display.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Display.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/DisplayTransform.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/DisplayTransform.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Exception.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Exception.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/ExponentOps.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/ExponentOps.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/ExponentTransform.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/ExponentTransform.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormat3DL.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormat3DL.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatBinary.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatBinary.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatCC.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatCC.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatCCC.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatCCC.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatCDL.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatCDL.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatCSP.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatCSP.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatHDL.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatHDL.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatIridasCube.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatIridasCube.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatIridasItx.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatIridasItx.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatIridasLook.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatIridasLook.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatPandora.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatPandora.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatSpi1D.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatSpi1D.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatSpi3D.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatSpi3D.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatSpiMtx.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatSpiMtx.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatTruelight.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatTruelight.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatVF.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileFormatVF.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileTransform.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/FileTransform.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/GpuShaderDesc.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/GpuShaderDesc.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/GpuShaderUtils.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/GpuShaderUtils.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/GroupTransform.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/GroupTransform.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/HashUtils.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/HashUtils.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/ImageDesc.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/ImageDesc.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/ImagePacking.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/ImagePacking.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/LogOps.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/LogOps.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/LogTransform.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/LogTransform.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Logging.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Logging.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Look.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Look.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/LookParse.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/LookParse.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/LookTransform.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/LookTransform.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Lut1DOp.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Lut1DOp.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Lut3DOp.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Lut3DOp.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/LutCache.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/LutCache.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/MathUtils.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/MathUtils.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/MatrixOps.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/MatrixOps.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/MatrixTransform.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/MatrixTransform.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/NoOps.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/NoOps.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/OCIOYaml.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/OCIOYaml.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Op.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Op.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/OpOptimizers.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/OpOptimizers.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/ParseUtils.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/ParseUtils.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/PathUtils.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/PathUtils.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Prefetch.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Prefetch.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Processor.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Processor.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/ProcessorCache.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/ProcessorCache.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/ScanlineHelper.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/ScanlineHelper.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Threading.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Threading.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Transform.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/Transform.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/TruelightOp.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/TruelightOp.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/TruelightTransform.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/TruelightTransform.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/md5/md5.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/md5/md5.cpp.o.d"
+  "CMakeFiles/OpenColorIO_STATIC.dir/pystring/pystring.cpp.o"
+  "CMakeFiles/OpenColorIO_STATIC.dir/pystring/pystring.cpp.o.d"
+  "libOpenColorIO.a"
+  "libOpenColorIO.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/OpenColorIO_STATIC.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MainTests"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/MainTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,88 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/core/AllocationOp.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/AllocationOp.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/AllocationOp.cpp.o.d"
+  "/root/repo/src/core/AllocationTransform.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/AllocationTransform.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/AllocationTransform.cpp.o.d"
+  "/root/repo/src/core/Baker.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Baker.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Baker.cpp.o.d"
+  "/root/repo/src/core/BakingUtils.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/BakingUtils.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/BakingUtils.cpp.o.d"
+  "/root/repo/src/core/BitDepthUtils.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/BitDepthUtils.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/BitDepthUtils.cpp.o.d"
+  "/root/repo/src/core/CDLTransform.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/CDLTransform.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/CDLTransform.cpp.o.d"
+  "/root/repo/src/core/CPUInfo.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/CPUInfo.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/CPUInfo.cpp.o.d"
+  "/root/repo/src/core/Caching.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Caching.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Caching.cpp.o.d"
+  "/root/repo/src/core/ColorSpace.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/ColorSpace.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/ColorSpace.cpp.o.d"
+  "/root/repo/src/core/ColorSpaceTransform.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/ColorSpaceTransform.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/ColorSpaceTransform.cpp.o.d"
+  "/root/repo/src/core/Config.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Config.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Config.cpp.o.d"
+  "/root/repo/src/core/Context.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Context.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Context.cpp.o.d"
+  "/root/repo/src/core/CpuProgram.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/CpuProgram.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/CpuProgram.cpp.o.d"
+  "/root/repo/src/core/Display.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Display.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Display.cpp.o.d"
+  "/root/repo/src/core/DisplayTransform.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/DisplayTransform.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/DisplayTransform.cpp.o.d"
+  "/root/repo/src/core/Exception.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Exception.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Exception.cpp.o.d"
+  "/root/repo/src/core/ExponentOps.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/ExponentOps.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/ExponentOps.cpp.o.d"
+  "/root/repo/src/core/ExponentTransform.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/ExponentTransform.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/ExponentTransform.cpp.o.d"
+  "/root/repo/src/core/FileFormat3DL.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormat3DL.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormat3DL.cpp.o.d"
+  "/root/repo/src/core/FileFormatBinary.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatBinary.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatBinary.cpp.o.d"
+  "/root/repo/src/core/FileFormatCC.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatCC.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatCC.cpp.o.d"
+  "/root/repo/src/core/FileFormatCCC.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatCCC.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatCCC.cpp.o.d"
+  "/root/repo/src/core/FileFormatCDL.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatCDL.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatCDL.cpp.o.d"
+  "/root/repo/src/core/FileFormatCSP.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatCSP.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatCSP.cpp.o.d"
+  "/root/repo/src/core/FileFormatHDL.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatHDL.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatHDL.cpp.o.d"
+  "/root/repo/src/core/FileFormatIridasCube.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatIridasCube.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatIridasCube.cpp.o.d"
+  "/root/repo/src/core/FileFormatIridasItx.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatIridasItx.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatIridasItx.cpp.o.d"
+  "/root/repo/src/core/FileFormatIridasLook.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatIridasLook.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatIridasLook.cpp.o.d"
+  "/root/repo/src/core/FileFormatPandora.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatPandora.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatPandora.cpp.o.d"
+  "/root/repo/src/core/FileFormatSpi1D.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatSpi1D.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatSpi1D.cpp.o.d"
+  "/root/repo/src/core/FileFormatSpi3D.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatSpi3D.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatSpi3D.cpp.o.d"
+  "/root/repo/src/core/FileFormatSpiMtx.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatSpiMtx.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatSpiMtx.cpp.o.d"
+  "/root/repo/src/core/FileFormatTruelight.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatTruelight.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatTruelight.cpp.o.d"
+  "/root/repo/src/core/FileFormatVF.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatVF.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileFormatVF.cpp.o.d"
+  "/root/repo/src/core/FileTransform.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileTransform.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/FileTransform.cpp.o.d"
+  "/root/repo/src/core/GpuShaderDesc.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/GpuShaderDesc.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/GpuShaderDesc.cpp.o.d"
+  "/root/repo/src/core/GpuShaderUtils.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/GpuShaderUtils.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/GpuShaderUtils.cpp.o.d"
+  "/root/repo/src/core/GroupTransform.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/GroupTransform.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/GroupTransform.cpp.o.d"
+  "/root/repo/src/core/HashUtils.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/HashUtils.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/HashUtils.cpp.o.d"
+  "/root/repo/src/core/ImageDesc.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/ImageDesc.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/ImageDesc.cpp.o.d"
+  "/root/repo/src/core/ImagePacking.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/ImagePacking.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/ImagePacking.cpp.o.d"
+  "/root/repo/src/core/LogOps.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/LogOps.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/LogOps.cpp.o.d"
+  "/root/repo/src/core/LogTransform.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/LogTransform.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/LogTransform.cpp.o.d"
+  "/root/repo/src/core/Logging.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Logging.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Logging.cpp.o.d"
+  "/root/repo/src/core/Look.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Look.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Look.cpp.o.d"
+  "/root/repo/src/core/LookParse.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/LookParse.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/LookParse.cpp.o.d"
+  "/root/repo/src/core/LookTransform.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/LookTransform.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/LookTransform.cpp.o.d"
+  "/root/repo/src/core/Lut1DOp.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Lut1DOp.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Lut1DOp.cpp.o.d"
+  "/root/repo/src/core/Lut3DOp.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Lut3DOp.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Lut3DOp.cpp.o.d"
+  "/root/repo/src/core/LutCache.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/LutCache.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/LutCache.cpp.o.d"
+  "/root/repo/src/core/MathUtils.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/MathUtils.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/MathUtils.cpp.o.d"
+  "/root/repo/src/core/MatrixOps.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/MatrixOps.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/MatrixOps.cpp.o.d"
+  "/root/repo/src/core/MatrixTransform.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/MatrixTransform.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/MatrixTransform.cpp.o.d"
+  "/root/repo/src/core/NoOps.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/NoOps.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/NoOps.cpp.o.d"
+  "/root/repo/src/core/OCIOYaml.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/OCIOYaml.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/OCIOYaml.cpp.o.d"
+  "/root/repo/src/core/Op.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Op.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Op.cpp.o.d"
+  "/root/repo/src/core/OpOptimizers.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/OpOptimizers.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/OpOptimizers.cpp.o.d"
+  "/root/repo/src/core/ParseUtils.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/ParseUtils.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/ParseUtils.cpp.o.d"
+  "/root/repo/src/core/PathUtils.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/PathUtils.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/PathUtils.cpp.o.d"
+  "/root/repo/src/core/Prefetch.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Prefetch.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Prefetch.cpp.o.d"
+  "/root/repo/src/core/Processor.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Processor.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Processor.cpp.o.d"
+  "/root/repo/src/core/ProcessorCache.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/ProcessorCache.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/ProcessorCache.cpp.o.d"
+  "/root/repo/src/core/ScanlineHelper.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/ScanlineHelper.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/ScanlineHelper.cpp.o.d"
+  "/root/repo/src/core/Threading.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Threading.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Threading.cpp.o.d"
+  "/root/repo/src/core/Transform.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Transform.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/Transform.cpp.o.d"
+  "/root/repo/src/core/TruelightOp.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/TruelightOp.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/TruelightOp.cpp.o.d"
+  "/root/repo/src/core/TruelightTransform.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/TruelightTransform.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/TruelightTransform.cpp.o.d"
+  "/root/repo/src/core/UnitTest.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/UnitTest.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/UnitTest.cpp.o.d"
+  "/root/repo/src/core/md5/md5.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/md5/md5.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/md5/md5.cpp.o.d"
+  "/root/repo/src/core/pystring/pystring.cpp" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/pystring/pystring.cpp.o" "gcc" "src/core_tests/CMakeFiles/ocio_core_tests.dir/__/core/pystring/pystring.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,149 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ocio_core_tests.dir/__/core/AllocationOp.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/AllocationOp.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/AllocationTransform.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/AllocationTransform.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Baker.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Baker.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/BakingUtils.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/BakingUtils.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/BitDepthUtils.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/BitDepthUtils.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/CDLTransform.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/CDLTransform.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/CPUInfo.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/CPUInfo.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Caching.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Caching.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/ColorSpace.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/ColorSpace.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/ColorSpaceTransform.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/ColorSpaceTransform.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Config.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Config.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Context.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Context.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/CpuProgram.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/CpuProgram.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Display.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Display.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/DisplayTransform.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/DisplayTransform.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Exception.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Exception.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/ExponentOps.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/ExponentOps.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/ExponentTransform.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/ExponentTransform.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormat3DL.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormat3DL.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatBinary.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatBinary.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatCC.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatCC.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatCCC.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatCCC.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatCDL.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatCDL.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatCSP.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatCSP.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatHDL.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatHDL.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatIridasCube.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatIridasCube.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatIridasItx.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatIridasItx.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatIridasLook.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatIridasLook.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatPandora.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatPandora.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatSpi1D.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatSpi1D.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatSpi3D.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatSpi3D.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatSpiMtx.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatSpiMtx.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatTruelight.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatTruelight.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatVF.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileFormatVF.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileTransform.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/FileTransform.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/GpuShaderDesc.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/GpuShaderDesc.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/GpuShaderUtils.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/GpuShaderUtils.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/GroupTransform.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/GroupTransform.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/HashUtils.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/HashUtils.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/ImageDesc.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/ImageDesc.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/ImagePacking.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/ImagePacking.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/LogOps.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/LogOps.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/LogTransform.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/LogTransform.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Logging.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Logging.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Look.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Look.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/LookParse.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/LookParse.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/LookTransform.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/LookTransform.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Lut1DOp.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Lut1DOp.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Lut3DOp.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Lut3DOp.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/LutCache.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/LutCache.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/MathUtils.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/MathUtils.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/MatrixOps.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/MatrixOps.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/MatrixTransform.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/MatrixTransform.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/NoOps.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/NoOps.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/OCIOYaml.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/OCIOYaml.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Op.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Op.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/OpOptimizers.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/OpOptimizers.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/ParseUtils.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/ParseUtils.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/PathUtils.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/PathUtils.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Prefetch.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Prefetch.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Processor.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Processor.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/ProcessorCache.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/ProcessorCache.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/ScanlineHelper.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/ScanlineHelper.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Threading.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Threading.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Transform.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/Transform.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/TruelightOp.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/TruelightOp.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/TruelightTransform.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/TruelightTransform.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/UnitTest.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/UnitTest.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/md5/md5.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/md5/md5.cpp.o.d"
+  "CMakeFiles/ocio_core_tests.dir/__/core/pystring/pystring.cpp.o"
+  "CMakeFiles/ocio_core_tests.dir/__/core/pystring/pystring.cpp.o.d"
+  "ocio_core_tests"
+  "ocio_core_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ocio_core_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
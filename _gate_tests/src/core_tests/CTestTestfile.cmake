@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/core_tests
+# Build directory: /root/repo/_gate_tests/src/core_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ocio_core_tests "/usr/bin/cmake" "--build" "/root/repo/_gate_tests" "--target" "MainTests")
+set_tests_properties(ocio_core_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/core_tests/CMakeLists.txt;56;add_test;/root/repo/src/core_tests/CMakeLists.txt;0;")
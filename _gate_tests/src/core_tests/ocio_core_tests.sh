@@ -0,0 +1,8 @@
+#!/bin/sh
+OCIO_TEST_AREA=/root/repo/_gate_tests/src/core_tests \
+OCIO_DATA_ROOT=/root/repo/_gate_tests/src/core_tests/test_search \
+OCIO_TEST1=foobar \
+OCIO_JOB=meatballs \
+OCIO_SEQ=cheesecake \
+OCIO_SHOT=mb-cc-001 \
+/root/repo/_gate_tests/src/core_tests/ocio_core_tests --log_level=test_suite;
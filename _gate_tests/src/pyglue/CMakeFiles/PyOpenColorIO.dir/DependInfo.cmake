@@ -0,0 +1,41 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/pyglue/PyAllocationTransform.cpp" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyAllocationTransform.cpp.o" "gcc" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyAllocationTransform.cpp.o.d"
+  "/root/repo/src/pyglue/PyBaker.cpp" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyBaker.cpp.o" "gcc" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyBaker.cpp.o.d"
+  "/root/repo/src/pyglue/PyCDLTransform.cpp" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyCDLTransform.cpp.o" "gcc" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyCDLTransform.cpp.o.d"
+  "/root/repo/src/pyglue/PyColorSpace.cpp" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyColorSpace.cpp.o" "gcc" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyColorSpace.cpp.o.d"
+  "/root/repo/src/pyglue/PyColorSpaceTransform.cpp" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyColorSpaceTransform.cpp.o" "gcc" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyColorSpaceTransform.cpp.o.d"
+  "/root/repo/src/pyglue/PyConfig.cpp" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyConfig.cpp.o" "gcc" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyConfig.cpp.o.d"
+  "/root/repo/src/pyglue/PyConstants.cpp" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyConstants.cpp.o" "gcc" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyConstants.cpp.o.d"
+  "/root/repo/src/pyglue/PyContext.cpp" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyContext.cpp.o" "gcc" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyContext.cpp.o.d"
+  "/root/repo/src/pyglue/PyDisplayTransform.cpp" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyDisplayTransform.cpp.o" "gcc" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyDisplayTransform.cpp.o.d"
+  "/root/repo/src/pyglue/PyExponentTransform.cpp" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyExponentTransform.cpp.o" "gcc" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyExponentTransform.cpp.o.d"
+  "/root/repo/src/pyglue/PyFileTransform.cpp" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyFileTransform.cpp.o" "gcc" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyFileTransform.cpp.o.d"
+  "/root/repo/src/pyglue/PyGpuShaderDesc.cpp" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyGpuShaderDesc.cpp.o" "gcc" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyGpuShaderDesc.cpp.o.d"
+  "/root/repo/src/pyglue/PyGroupTransform.cpp" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyGroupTransform.cpp.o" "gcc" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyGroupTransform.cpp.o.d"
+  "/root/repo/src/pyglue/PyLogTransform.cpp" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyLogTransform.cpp.o" "gcc" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyLogTransform.cpp.o.d"
+  "/root/repo/src/pyglue/PyLook.cpp" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyLook.cpp.o" "gcc" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyLook.cpp.o.d"
+  "/root/repo/src/pyglue/PyLookTransform.cpp" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyLookTransform.cpp.o" "gcc" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyLookTransform.cpp.o.d"
+  "/root/repo/src/pyglue/PyMain.cpp" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyMain.cpp.o" "gcc" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyMain.cpp.o.d"
+  "/root/repo/src/pyglue/PyMatrixTransform.cpp" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyMatrixTransform.cpp.o" "gcc" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyMatrixTransform.cpp.o.d"
+  "/root/repo/src/pyglue/PyProcessor.cpp" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyProcessor.cpp.o" "gcc" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyProcessor.cpp.o.d"
+  "/root/repo/src/pyglue/PyProcessorMetadata.cpp" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyProcessorMetadata.cpp.o" "gcc" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyProcessorMetadata.cpp.o.d"
+  "/root/repo/src/pyglue/PyTransform.cpp" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyTransform.cpp.o" "gcc" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyTransform.cpp.o.d"
+  "/root/repo/src/pyglue/PyUtil.cpp" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyUtil.cpp.o" "gcc" "src/pyglue/CMakeFiles/PyOpenColorIO.dir/PyUtil.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_tests/src/core/CMakeFiles/OpenColorIO.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,54 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/PyOpenColorIO.dir/PyAllocationTransform.cpp.o"
+  "CMakeFiles/PyOpenColorIO.dir/PyAllocationTransform.cpp.o.d"
+  "CMakeFiles/PyOpenColorIO.dir/PyBaker.cpp.o"
+  "CMakeFiles/PyOpenColorIO.dir/PyBaker.cpp.o.d"
+  "CMakeFiles/PyOpenColorIO.dir/PyCDLTransform.cpp.o"
+  "CMakeFiles/PyOpenColorIO.dir/PyCDLTransform.cpp.o.d"
+  "CMakeFiles/PyOpenColorIO.dir/PyColorSpace.cpp.o"
+  "CMakeFiles/PyOpenColorIO.dir/PyColorSpace.cpp.o.d"
+  "CMakeFiles/PyOpenColorIO.dir/PyColorSpaceTransform.cpp.o"
+  "CMakeFiles/PyOpenColorIO.dir/PyColorSpaceTransform.cpp.o.d"
+  "CMakeFiles/PyOpenColorIO.dir/PyConfig.cpp.o"
+  "CMakeFiles/PyOpenColorIO.dir/PyConfig.cpp.o.d"
+  "CMakeFiles/PyOpenColorIO.dir/PyConstants.cpp.o"
+  "CMakeFiles/PyOpenColorIO.dir/PyConstants.cpp.o.d"
+  "CMakeFiles/PyOpenColorIO.dir/PyContext.cpp.o"
+  "CMakeFiles/PyOpenColorIO.dir/PyContext.cpp.o.d"
+  "CMakeFiles/PyOpenColorIO.dir/PyDisplayTransform.cpp.o"
+  "CMakeFiles/PyOpenColorIO.dir/PyDisplayTransform.cpp.o.d"
+  "CMakeFiles/PyOpenColorIO.dir/PyExponentTransform.cpp.o"
+  "CMakeFiles/PyOpenColorIO.dir/PyExponentTransform.cpp.o.d"
+  "CMakeFiles/PyOpenColorIO.dir/PyFileTransform.cpp.o"
+  "CMakeFiles/PyOpenColorIO.dir/PyFileTransform.cpp.o.d"
+  "CMakeFiles/PyOpenColorIO.dir/PyGpuShaderDesc.cpp.o"
+  "CMakeFiles/PyOpenColorIO.dir/PyGpuShaderDesc.cpp.o.d"
+  "CMakeFiles/PyOpenColorIO.dir/PyGroupTransform.cpp.o"
+  "CMakeFiles/PyOpenColorIO.dir/PyGroupTransform.cpp.o.d"
+  "CMakeFiles/PyOpenColorIO.dir/PyLogTransform.cpp.o"
+  "CMakeFiles/PyOpenColorIO.dir/PyLogTransform.cpp.o.d"
+  "CMakeFiles/PyOpenColorIO.dir/PyLook.cpp.o"
+  "CMakeFiles/PyOpenColorIO.dir/PyLook.cpp.o.d"
+  "CMakeFiles/PyOpenColorIO.dir/PyLookTransform.cpp.o"
+  "CMakeFiles/PyOpenColorIO.dir/PyLookTransform.cpp.o.d"
+  "CMakeFiles/PyOpenColorIO.dir/PyMain.cpp.o"
+  "CMakeFiles/PyOpenColorIO.dir/PyMain.cpp.o.d"
+  "CMakeFiles/PyOpenColorIO.dir/PyMatrixTransform.cpp.o"
+  "CMakeFiles/PyOpenColorIO.dir/PyMatrixTransform.cpp.o.d"
+  "CMakeFiles/PyOpenColorIO.dir/PyProcessor.cpp.o"
+  "CMakeFiles/PyOpenColorIO.dir/PyProcessor.cpp.o.d"
+  "CMakeFiles/PyOpenColorIO.dir/PyProcessorMetadata.cpp.o"
+  "CMakeFiles/PyOpenColorIO.dir/PyProcessorMetadata.cpp.o.d"
+  "CMakeFiles/PyOpenColorIO.dir/PyTransform.cpp.o"
+  "CMakeFiles/PyOpenColorIO.dir/PyTransform.cpp.o.d"
+  "CMakeFiles/PyOpenColorIO.dir/PyUtil.cpp.o"
+  "CMakeFiles/PyOpenColorIO.dir/PyUtil.cpp.o.d"
+  "PyDoc.h"
+  "PyOpenColorIO.pdb"
+  "PyOpenColorIO.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PyOpenColorIO.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/pyglue
+# Build directory: /root/repo/_gate_tests/src/pyglue
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("tests")
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/PYTests"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/PYTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/pyglue/tests
+# Build directory: /root/repo/_gate_tests/src/pyglue/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(pyglue "/usr/bin/cmake" "--build" "/root/repo/_gate_tests" "--target" "PYTests")
+set_tests_properties(pyglue PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/pyglue/tests/CMakeLists.txt;11;add_test;/root/repo/src/pyglue/tests/CMakeLists.txt;0;")
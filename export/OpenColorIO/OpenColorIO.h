@@ -156,7 +156,122 @@ OCIO_NAMESPACE_ENTER
     
     //!cpp:function:: Set the global logging level.
     extern OCIOEXPORT void SetLoggingLevel(LoggingLevel level);
+
+    //!cpp:function:: Get the number of threads used by :cpp:func:`Processor::apply`.
+    // You can override this at runtime using the :envvar:`OCIO_NUM_THREADS`
+    // environment variable, where 0 means one thread per core.
+    // The default value is 1, i.e. images are processed serially on the
+    // calling thread.
+
+    extern OCIOEXPORT int GetNumThreads();
+
+    //!cpp:function:: Set the number of threads used by :cpp:func:`Processor::apply`.
+    // A value of 0 uses one thread per core. Ignored if a
+    // :cpp:class:`TaskExecutor` has been registered.
+    extern OCIOEXPORT void SetNumThreads(int numThreads);
+
+    //!cpp:function:: Get the maximum number of processors kept in the
+    // process-wide cache of :cpp:func:`Config::getProcessor`, which returns
+    // the same processor for the same config, context, transform (or color
+    // spaces) and direction, instead of building a new one.
+    // You can override this at runtime using the
+    // :envvar:`OCIO_PROCESSOR_CACHE_SIZE` environment variable, where 0
+    // disables the cache. The default value is 128.
+
+    extern OCIOEXPORT int GetProcessorCacheSize();
+
+    //!cpp:function:: Set the maximum number of cached processors. The least
+    // recently used ones are released first. A value of 0 disables the cache.
+    extern OCIOEXPORT void SetProcessorCacheSize(int size);
+
+    //!cpp:function:: Get the memory budget, in bytes, of each of the file,
+    // file hash, cdl file and inverse 3D lut caches. When a cache grows
+    // beyond it, its least recently used entries are released (processors
+    // built from them keep their own references, so only later loads are
+    // affected). The most recently used entry is always kept.
+    // You can override this at runtime using the
+    // :envvar:`OCIO_CACHE_MEMORY_LIMIT` environment variable, in megabytes,
+    // where 0 means unlimited. The default value is 1024 megabytes.
+    
+    extern OCIOEXPORT size_t GetCacheMemoryLimit();
+    
+    //!cpp:function:: Set the memory budget of the caches, in bytes. A value
+    // of 0 means unlimited.
+    extern OCIOEXPORT void SetCacheMemoryLimit(size_t bytes);
+    
+    //!cpp:function:: Get the counters of one of the process-wide caches:
+    // the number of entries and their approximate size in bytes, and the
+    // number of hits, misses and evictions since the last
+    // :cpp:func:`ClearAllCaches`. The size of cached processors is not
+    // tracked, and reported as 0.
+    // CACHE_TYPE_GPU_SHADER covers the shader text and 3D luts that each
+    // processor keeps for the few shader descriptions it was last asked
+    // about. Its hits and misses count the shader text and 3D lut requests,
+    // and its entries are released with their processors, not by
+    // :cpp:func:`ClearAllCaches`.
+    extern OCIOEXPORT void GetCacheStats(CacheType type,
+                                         long & entries, size_t & bytes,
+                                         long & hits, long & misses,
+                                         long & evictions);
+
+    //!cpp:function:: Get the directory of the persistent lut cache. Lut
+    // files are stored there in a binary form once parsed, so that other
+    // processes using the same directory (e.g., the other tasks of a render
+    // farm job) load them without parsing the source files again. Entries
+    // are keyed by the path, inode and mtime of the source file.
+    // You can override this at runtime using the
+    // :envvar:`OCIO_LUT_CACHE_DIR` environment variable. The default value
+    // is an empty string, which disables the cache.
+    //
+    // The string returned stays valid for the life of the library, even
+    // once another directory is set.
     
+    extern OCIOEXPORT const char * GetLutCacheDir();
+    
+    //!cpp:function:: Set the directory of the persistent lut cache. It
+    // must exist and be writable. An empty string disables the cache.
+    extern OCIOEXPORT void SetLutCacheDir(const char * dir);
+
+    //!rst:: //////////////////////////////////////////////////////////////////
+
+    //!cpp:class:: A unit of work handed to a :cpp:class:`TaskExecutor`.
+    class OCIOEXPORT ParallelTask
+    {
+    public:
+        virtual ~ParallelTask();
+
+        //!cpp:function:: Run the work item at the specified index.
+        // Distinct indices may be executed concurrently. This never throws;
+        // errors are reported back to the caller of :cpp:func:`Processor::apply`.
+        virtual void execute(int index) const = 0;
+    };
+
+    //!cpp:class:: Hosts with their own thread pool (or farm wrapper) can
+    // register a task executor, which OCIO will then use in place of its
+    // internal worker pool.
+    class OCIOEXPORT TaskExecutor
+    {
+    public:
+        virtual ~TaskExecutor();
+
+        //!cpp:function:: The number of work items the executor can usefully
+        // run at the same time.
+        virtual int getConcurrency() const = 0;
+
+        //!cpp:function:: Call task.execute(i) for each i in [0, numItems),
+        // in any order and on any threads, and only return once all of them
+        // have completed. Running the items serially is valid, if slow.
+        virtual void run(const ParallelTask & task, int numItems) = 0;
+    };
+
+    //!cpp:function:: Register the executor used by :cpp:func:`Processor::apply`.
+    // Pass NULL to go back to the internal worker pool. The executor is not
+    // owned by OCIO, and must outlive any apply call that uses it.
+    extern OCIOEXPORT void SetTaskExecutor(TaskExecutor * executor);
+
+    //!cpp:function:: Get the registered executor, or NULL.
+    extern OCIOEXPORT TaskExecutor * GetTaskExecutor();
+
     
     ///////////////////////////////////////////////////////////////////////////
     //!rst::
@@ -526,6 +641,28 @@ OCIO_NAMESPACE_ENTER
                                          const ConstTransformRcPtr& transform,
                                          TransformDirection direction) const;
         
+        ///////////////////////////////////////////////////////////////////////////
+        //!rst:: .. _cfgprefetch_section:
+        // 
+        // Prefetching
+        // ^^^^^^^^^^^
+        //
+        // The files of a transform are loaded when a processor first needs
+        // them, which can stall the first :cpp:func:`Config::getProcessor`
+        // call. Prefetching loads all the files of the config up front, in
+        // the background, for example while a user is still picking a shot.
+        
+        //!cpp:function:: Start loading every file referenced by the color
+        // spaces and looks of the config, resolved with the specified
+        // context, into the file cache. The files are loaded in parallel on
+        // a background thread (through the registered
+        // :cpp:class:`TaskExecutor`, if any), and this returns immediately.
+        // Later processors find the loaded files in the cache, and report
+        // load errors as usual.
+        ConstPrefetchRcPtr prefetch(const ConstContextRcPtr & context) const;
+        //!cpp:function:: Prefetch with the current context.
+        ConstPrefetchRcPtr prefetch() const;
+        
     private:
         Config();
         ~Config();
@@ -785,6 +922,12 @@ OCIO_NAMESPACE_ENTER
         
         //!cpp:function:: Apply to an image.
         void apply(ImageDesc& img) const;
+        //!cpp:function:: Apply to srcImg, writing the result to dstImg.
+        // The images must have the same dimensions, but may differ in
+        // layout, strides and bit depth. srcImg is not modified. They must
+        // not overlap (unless they are the same ImageDesc). If srcImg has no
+        // alpha, a dstImg alpha channel is set to 0.
+        void apply(const ImageDesc& srcImg, ImageDesc& dstImg) const;
         
         //!rst::
         // Apply to a single pixel.
@@ -802,6 +945,27 @@ OCIO_NAMESPACE_ENTER
         //!cpp:function:: 
         const char * getCpuCacheID() const;
         
+        //!cpp:function:: Returns a processor with the cpu path of this one
+        // baked into a shaper (from the allocation of the source color
+        // space) followed by a lut3DEdgeLen^3 3D lut, with tetrahedral
+        // interpolation. Its cost per pixel no longer depends on the
+        // length of the transform chain.
+        //
+        // The lut is only used if its error, the largest absolute
+        // difference from this processor over a set of colors in between
+        // the lattice points (covering the allocation range, up to its
+        // edges), is at most maxError. Otherwise, the returned processor
+        // applies the exact ops. The lut clamps the colors outside of the
+        // allocation (and passes the alpha through): unless it matches this
+        // processor there as well, the pixels outside of the allocation, or
+        // with an alpha outside of 0-1, are processed by the exact ops.
+        // The gpu path is unchanged.
+        ConstProcessorRcPtr getBakedProcessor(float maxError,
+                                              int lut3DEdgeLen = 48) const;
+        
+        //!cpp:function:: Whether apply uses a baked 3D lut.
+        bool isCpuBaked() const;
+        
         ///////////////////////////////////////////////////////////////////////////
         //!rst::
         // GPU Path
@@ -813,8 +977,22 @@ OCIO_NAMESPACE_ENTER
         //    
         //    shaderFcnName(in half4 inPixel, const uniform sampler3D lut3d)
         //
+        // The other languages take the same arguments, in their own types.
+        // HLSL and Metal pass each texture with the sampler it is read
+        // with, named after it::
+        //    
+        //    shaderFcnName(in float4 inPixel, Texture3D lut3d, SamplerState lut3dSampler)
+        //    shaderFcnName(float4 inPixel, texture3d<float> lut3d, sampler lut3dSampler)
+        //
+        // The Metal text starts by including metal_stdlib.
+        //
         // lut3d should be size: 3 * edgeLen * edgeLen * edgeLen
         // return 0 if unknown
+        //
+        // The processor keeps the results of the last few shader
+        // descriptions it was asked about. The strings returned by the GPU
+        // getters (shader text, cache ids and names) stay valid for the
+        // lifetime of the processor.
         
         //!cpp:function::
         const char * getGpuShaderText(const GpuShaderDesc & shaderDesc) const;
@@ -826,6 +1004,58 @@ OCIO_NAMESPACE_ENTER
         //!cpp:function::
         const char * getGpuLut3DCacheID(const GpuShaderDesc & shaderDesc) const;
         
+        //!rst::
+        // When :cpp:func:`GpuShaderDesc::setLut1DTexturesEnabled` is on, the
+        // shader function takes one more argument per 1D lut texture, after
+        // lut3d, in order: a sampler1D if the texture height is 1, a
+        // sampler2D otherwise. Textures hold width * height rgb values,
+        // and are sampled with linear filtering and clamping to the edges.
+        
+        //!cpp:function:: Returns 0 if the option is off.
+        int getNumGpuLut1DTextures(const GpuShaderDesc & shaderDesc) const;
+        //!cpp:function:: The name of the sampler argument.
+        const char * getGpuLut1DTextureName(const GpuShaderDesc & shaderDesc,
+                                            int index) const;
+        //!cpp:function::
+        void getGpuLut1DTextureSize(int * width, int * height,
+                                    const GpuShaderDesc & shaderDesc,
+                                    int index) const;
+        //!cpp:function:: lut1d should be size: 3 * width * height
+        void getGpuLut1DTexture(float * lut1d, const GpuShaderDesc & shaderDesc,
+                                int index) const;
+        //!cpp:function::
+        const char * getGpuLut1DTextureCacheID(const GpuShaderDesc & shaderDesc,
+                                               int index) const;
+        
+        //!rst::
+        // When :cpp:func:`GpuShaderDesc::setUniformsEnabled` is on, the
+        // shader text reads the parameters of its matrix, offset and
+        // exponent ops from uniforms declared before the function (in
+        // Metal, which has no such uniforms, they are the last arguments of
+        // the function), so that grades which only change those values keep
+        // the same shader text and cache id. To that end, these ops are
+        // neither combined nor removed when they are identities (which
+        // leave the pixel unchanged, as on the cpu). The values are those
+        // of this processor: set them on the compiled program each time a
+        // new processor is used.
+        
+        //!cpp:function:: Returns 0 if the option is off.
+        int getNumGpuUniforms(const GpuShaderDesc & shaderDesc) const;
+        //!cpp:function::
+        const char * getGpuUniformName(const GpuShaderDesc & shaderDesc,
+                                       int index) const;
+        //!cpp:function::
+        GpuUniformType getGpuUniformType(const GpuShaderDesc & shaderDesc,
+                                         int index) const;
+        //!cpp:function:: values should be size 4 for GPU_UNIFORM_FLOAT4, and
+        // 16 for GPU_UNIFORM_FLOAT4X4, in the order of the matrix
+        // constructor arguments (for GLSL, as taken by glUniformMatrix4fv
+        // with transpose false, for Metal, the layout of a float4x4, for
+        // Cg and HLSL, row by row, the HLSL matrices being declared
+        // row_major so that no transpose is needed).
+        void getGpuUniformValue(float * values, const GpuShaderDesc & shaderDesc,
+                                int index) const;
+        
     private:
         Processor();
         ~Processor();
@@ -887,6 +1117,53 @@ OCIO_NAMESPACE_ENTER
     
     
     
+    ///////////////////////////////////////////////////////////////////////////
+    //!rst::
+    // Prefetch
+    // ********
+    
+    //!cpp:class:: The progress of a :cpp:func:`Config::prefetch`. The loads
+    // carry on if the handle is released. An application exiting while
+    // they are running should wait on the handle first.
+    class OCIOEXPORT Prefetch
+    {
+    public:
+        //!cpp:function:: Whether all the files have been loaded (or failed to).
+        bool isDone() const;
+        
+        //!cpp:function:: Block until all the files have been loaded.
+        void wait() const;
+        
+        //!cpp:function:: The number of distinct files referenced by the config.
+        int getNumFiles() const;
+        
+        //!cpp:function:: The number of files that could not be resolved or
+        // loaded. Waits for the loads to finish.
+        int getNumFailed() const;
+        
+        //!cpp:function:: The error of a file that failed. Waits for the loads
+        // to finish.
+        const char * getFailure(int index) const;
+        
+    private:
+        Prefetch();
+        ~Prefetch();
+        
+        Prefetch(const Prefetch &);
+        Prefetch& operator= (const Prefetch &);
+        
+        static void deleter(Prefetch* c);
+        
+        friend class Config;
+        
+        class Impl;
+        friend class Impl;
+        Impl * m_impl;
+        Impl * getImpl() { return m_impl; }
+        const Impl * getImpl() const { return m_impl; }
+    };
+    
+    
     ///////////////////////////////////////////////////////////////////////////
     //!rst::
     // Baker
@@ -985,7 +1262,18 @@ OCIO_NAMESPACE_ENTER
         
         //!cpp:function:: bake the lut into the output stream
         void bake(std::ostream & os) const;
-        
+        //!cpp:function:: bake the lut into an open file descriptor (e.g.,
+        // from open()), written in large blocks without iostream buffering
+        void bake(int fd) const;
+
+        //!cpp:function:: bake numBakes luts, bakers[i] into outputs[i].
+        // The processors of all the bakes are built up front, in parallel,
+        // so luts and colorspaces shared between the bakes (e.g., the same
+        // display for several inputs and looks) are only loaded once.
+        static void bakeBatch(const ConstBakerRcPtr * bakers,
+                              std::ostream * const * outputs,
+                              int numBakes);
+
         //!cpp:function:: get the number of lut writers
         static int getNumFormats();
         
@@ -1061,10 +1349,29 @@ OCIO_NAMESPACE_ENTER
                         ptrdiff_t xStrideBytes = AutoStride,
                         ptrdiff_t yStrideBytes = AutoStride);
         //!cpp:function::
+        // Same as above, for image data of the specified bit depth.
+        // Supported are BIT_DEPTH_UINT8, BIT_DEPTH_UINT10 to BIT_DEPTH_UINT16
+        // (each value stored in an unsigned 16-bit int), BIT_DEPTH_F16 and
+        // BIT_DEPTH_F32. Integer values are normalized to [0,1] for
+        // processing, and clamped and rounded when written back.
+        // AutoStrides are computed from the size of the bit depth.
+        
+        PackedImageDesc(void * data,
+                        long width, long height,
+                        long numChannels,
+                        BitDepth bitDepth,
+                        ptrdiff_t chanStrideBytes = AutoStride,
+                        ptrdiff_t xStrideBytes = AutoStride,
+                        ptrdiff_t yStrideBytes = AutoStride);
+        //!cpp:function::
         virtual ~PackedImageDesc();
         
         //!cpp:function::
+        // For bit depths other than BIT_DEPTH_F32, cast this to the
+        // appropriate type.
         float * getData() const;
+        //!cpp:function::
+        BitDepth getBitDepth() const;
         
         //!cpp:function::
         long getWidth() const;
@@ -1110,9 +1417,19 @@ OCIO_NAMESPACE_ENTER
                         long width, long height,
                         ptrdiff_t yStrideBytes = AutoStride);
         //!cpp:function::
+        // Same as above, for image planes of the specified bit depth.
+        // See PackedImageDesc for the supported bit depths.
+        
+        PlanarImageDesc(void * rData, void * gData, void * bData, void * aData,
+                        long width, long height,
+                        BitDepth bitDepth,
+                        ptrdiff_t yStrideBytes = AutoStride);
+        //!cpp:function::
         virtual ~PlanarImageDesc();
         
         //!cpp:function::
+        // For bit depths other than BIT_DEPTH_F32, cast these to the
+        // appropriate type.
         float* getRData() const;
         //!cpp:function::
         float* getGData() const;
@@ -1120,6 +1437,8 @@ OCIO_NAMESPACE_ENTER
         float* getBData() const;
         //!cpp:function::
         float* getAData() const;
+        //!cpp:function::
+        BitDepth getBitDepth() const;
         
         //!cpp:function::
         long getWidth() const;
@@ -1170,6 +1489,30 @@ OCIO_NAMESPACE_ENTER
         //!cpp:function::
         int getLut3DEdgeLen() const;
         
+        //!cpp:function:: When enabled, forward 1D luts are applied in the
+        // shader from textures of their own (see
+        // :cpp:func:`Processor::getNumGpuLut1DTextures`) instead of being
+        // baked into the 3D lut with the rest of the lattice ops. Off by
+        // default, as the shader function then takes one more sampler
+        // argument per texture.
+        void setLut1DTexturesEnabled(bool enabled);
+        //!cpp:function::
+        bool getLut1DTexturesEnabled() const;
+        
+        //!cpp:function:: 1D luts with more entries than this are stored in
+        // 2D textures, with rows of this width. Defaults to 4096.
+        void setLut1DTextureMaxWidth(int width);
+        //!cpp:function::
+        int getLut1DTextureMaxWidth() const;
+        
+        //!cpp:function:: When enabled, the parameters of the matrix, offset
+        // and exponent ops of the shader text are uniforms (see
+        // :cpp:func:`Processor::getNumGpuUniforms`) instead of constants.
+        // Off by default.
+        void setUniformsEnabled(bool enabled);
+        //!cpp:function::
+        bool getUniformsEnabled() const;
+        
         //!cpp:function:: 
         const char * getCacheID() const;
         
@@ -1249,7 +1592,19 @@ OCIO_NAMESPACE_ENTER
         // Also, walk the full search path until the file is found.
         // If the filename cannot be found, an exception will be thrown.
         const char * resolveFileLocation(const char * filename) const;
-    
+
+        //!cpp:function:: When enabled, resolveFileLocation reads the
+        // entries of each search path directory once, and looks candidate
+        // files up in that listing instead of querying the filesystem for
+        // each one. Files added or removed afterwards are not seen until
+        // refreshSearchPathIndex is called. Off by default.
+        void setSearchPathIndexEnabled(bool enabled);
+        //!cpp:function::
+        bool isSearchPathIndexEnabled() const;
+        //!cpp:function:: Forget the directory listings and the resolved
+        // file locations, so the next lookups see the filesystem as it is now.
+        void refreshSearchPathIndex();
+
     private:
         Context();
         ~Context();
@@ -88,6 +88,12 @@ OCIO_NAMESPACE_ENTER
     //!cpp:type::
     typedef OCIO_SHARED_PTR<ProcessorMetadata> ProcessorMetadataRcPtr;
     
+    class OCIOEXPORT Prefetch;
+    //!cpp:type::
+    typedef OCIO_SHARED_PTR<const Prefetch> ConstPrefetchRcPtr;
+    //!cpp:type::
+    typedef OCIO_SHARED_PTR<Prefetch> PrefetchRcPtr;
+    
     class OCIOEXPORT Baker;
     //!cpp:type::
     typedef OCIO_SHARED_PTR<const Baker> ConstBakerRcPtr;
@@ -263,7 +269,20 @@ OCIO_NAMESPACE_ENTER
         GPU_LANGUAGE_UNKNOWN = 0,
         GPU_LANGUAGE_CG,           ///< Nvidia Cg shader
         GPU_LANGUAGE_GLSL_1_0,     ///< OpenGL Shading Language
-        GPU_LANGUAGE_GLSL_1_3      ///< OpenGL Shading Language
+        GPU_LANGUAGE_GLSL_1_3,     ///< OpenGL Shading Language
+        GPU_LANGUAGE_GLSL_3_3,     ///< OpenGL Shading Language, core profile
+        GPU_LANGUAGE_GLSL_4_0,     ///< OpenGL Shading Language, core profile
+        GPU_LANGUAGE_HLSL_DX11,    ///< DirectX Shading Language, shader model 4 and later
+        GPU_LANGUAGE_MSL           ///< Metal Shading Language
+    };
+    
+    //!cpp:type:: The type of a shader uniform, see
+    // :cpp:func:`Processor::getGpuUniformType`.
+    enum GpuUniformType
+    {
+        GPU_UNIFORM_UNKNOWN = 0,
+        GPU_UNIFORM_FLOAT4,        ///< half4 in Cg, vec4 in GLSL
+        GPU_UNIFORM_FLOAT4X4       ///< half4x4 in Cg, mat4 in GLSL
     };
     
     //!cpp:type::
@@ -274,6 +293,18 @@ OCIO_NAMESPACE_ENTER
         ENV_ENVIRONMENT_LOAD_ALL
     };
     
+    //!cpp:type:: The process-wide caches, see :cpp:func:`GetCacheStats`.
+    enum CacheType
+    {
+        CACHE_TYPE_UNKNOWN = 0,
+        CACHE_TYPE_FILE,           ///< Parsed lut and cdl files
+        CACHE_TYPE_FILE_HASH,      ///< File hashes used in cache ids
+        CACHE_TYPE_CDL_FILE,       ///< CDLTransform::CreateFromFile
+        CACHE_TYPE_PROCESSOR,      ///< Config::getProcessor
+        CACHE_TYPE_GPU_SHADER,     ///< Shader text and 3D luts of processors
+        CACHE_TYPE_INVERSE_LUT3D   ///< Inverse lattices of 3D luts
+    };
+    
     //!rst::
     // Conversion
     // **********
@@ -333,6 +364,11 @@ OCIO_NAMESPACE_ENTER
     //!cpp:function::
     extern OCIOEXPORT EnvironmentMode EnvironmentModeFromString(const char * s);
     
+    //!cpp:function::
+    extern OCIOEXPORT const char * CacheTypeToString(CacheType type);
+    //!cpp:function::
+    extern OCIOEXPORT CacheType CacheTypeFromString(const char * s);
+    
     
     /*!rst::
     Roles
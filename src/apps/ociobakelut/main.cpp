@@ -98,6 +98,7 @@ int main (int argc, const char* argv[])
                "example:  ociobakelut --lut filmlut.3dl --lut calibration.3dl --format flame display.3dl\n"
                "example:  ociobakelut --cccid 0 --lut cdlgrade.ccc --lut calibration.3dl --format flame graded_display.3dl\n"
                "example:  ociobakelut --lut look.3dl --offset 0.01 -0.02 0.03 --lut display.3dl --format flame display_with_look.3dl\n"
+               "example:  ociobakelut --inputspace lg10 --outputspace srgb8 --format ocio_binary lg_to_srgb.blut\n"
                "example:  ociobakelut --inputspace lg10 --outputspace srgb8 --format icc ~/Library/ColorSync/Profiles/test.icc\n"
                "example:  ociobakelut --lut filmlut.3dl --lut calibration.3dl --format icc ~/Library/ColorSync/Profiles/test.icc\n\n",
                "%*", parse_end_args, "",
@@ -369,7 +370,8 @@ int main (int argc, const char* argv[])
             }
             else
             {
-                std::ofstream f(outputfile.c_str());
+                // Binary mode, as some formats (e.g., ocio_binary) are not text
+                std::ofstream f(outputfile.c_str(), std::ios_base::out | std::ios_base::binary);
                 baker->bake(f);
                 if(verbose)
                     std::cout << "[OpenColorIO INFO]: Wrote '" << outputfile << "'" << std::endl;
@@ -155,11 +155,11 @@ OCIO_NAMESPACE_ENTER
         t.getVars(&vars[0]);
 
         os << "<AllocationTransform ";
-        os << "direction=" << TransformDirectionToString(t.getDirection());
+        os << "direction=" << TransformDirectionToString(t.getDirection()) << ", ";
+        os << "allocation=" << AllocationToString(allocation);
         if (numVars)
         {
-            os << ", allocation=" << AllocationToString(allocation) << ", ";
-            os << "vars=" << vars[0];
+            os << ", vars=" << vars[0];
             for (int i = 1; i < numVars; ++i)
             {
                 os << " " << vars[i];
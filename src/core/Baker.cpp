@@ -26,15 +26,27 @@ THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <cerrno>
 #include <vector>
 #include <iostream>
+#include <sstream>
+#include <streambuf>
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "BakingUtils.h"
 #include "FileTransform.h"
 #include "MathUtils.h"
+#include "Platform.h"
+#include "Threading.h"
 #include "pystring/pystring.h"
 
+#ifdef WINDOWS
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
 OCIO_NAMESPACE_ENTER
 {
     
@@ -260,6 +272,150 @@ OCIO_NAMESPACE_ENTER
         //
     }
     
+    namespace
+    {
+        // An unbuffered streambuf writing straight to a file descriptor.
+        // (The lut writers already hand their text over in large blocks.)
+        
+        class FdStreamBuf : public std::streambuf
+        {
+        public:
+            explicit FdStreamBuf(int fd) : m_fd(fd) { }
+            
+        protected:
+            virtual int_type overflow(int_type c)
+            {
+                if(traits_type::eq_int_type(c, traits_type::eof()))
+                {
+                    return traits_type::not_eof(c);
+                }
+                char ch = traits_type::to_char_type(c);
+                return xsputn(&ch, 1) == 1 ? c : traits_type::eof();
+            }
+            
+            virtual std::streamsize xsputn(const char * str, std::streamsize size)
+            {
+                std::streamsize written = 0;
+                while(written < size)
+                {
+#ifdef WINDOWS
+                    int result = _write(m_fd, str + written,
+                        static_cast<unsigned int>(size - written));
+#else
+                    ssize_t result = ::write(m_fd, str + written,
+                        static_cast<size_t>(size - written));
+                    if(result < 0 && errno == EINTR) continue;
+#endif
+                    if(result <= 0) break;
+                    written += result;
+                }
+                return written;
+            }
+            
+        private:
+            int m_fd;
+        };
+    }
+    
+    void Baker::bake(int fd) const
+    {
+        if(fd < 0)
+        {
+            throw Exception("Cannot bake a lut to an invalid file descriptor.");
+        }
+        
+        FdStreamBuf buffer(fd);
+        std::ostream os(&buffer);
+        bake(os);
+        
+        if(!os)
+        {
+            std::ostringstream err;
+            err << "Error baking " << getImpl()->formatName_;
+            err << ": could not write to file descriptor " << fd << ".";
+            throw Exception(err.str().c_str());
+        }
+    }
+    
+    namespace
+    {
+        // Build the processors the writers will ask for, so they land in
+        // the processor cache (and their files in the file caches).
+        // Errors are left for the bake itself to report.
+        
+        class WarmBakerBody : public ParallelForBody
+        {
+        public:
+            explicit WarmBakerBody(const ConstBakerRcPtr * bakers) :
+                m_bakers(bakers)
+            { }
+            
+            void run(int /*workerIndex*/, long itemBegin, long itemEnd) const
+            {
+                for(long i=itemBegin; i<itemEnd; ++i)
+                {
+                    const Baker & baker = *m_bakers[i];
+                    try
+                    {
+                        ConstConfigRcPtr config = baker.getConfig();
+                        if(!config) continue;
+                        
+                        GetBakerProcessor(baker, baker.getInputSpace());
+                        
+                        std::string shaperSpace = baker.getShaperSpace();
+                        if(!shaperSpace.empty())
+                        {
+                            GetBakerProcessor(baker, shaperSpace.c_str());
+                            config->getProcessor(shaperSpace.c_str(),
+                                                 baker.getInputSpace());
+                            config->getProcessor(baker.getInputSpace(),
+                                                 shaperSpace.c_str());
+                        }
+                    }
+                    catch(...)
+                    {
+                    }
+                }
+            }
+            
+        private:
+            const ConstBakerRcPtr * m_bakers;
+        };
+    }
+    
+    void Baker::bakeBatch(const ConstBakerRcPtr * bakers,
+                          std::ostream * const * outputs,
+                          int numBakes)
+    {
+        if(numBakes <= 0) return;
+        
+        if(!bakers || !outputs)
+        {
+            throw Exception("Cannot bake a batch of luts, no bakers or outputs were given.");
+        }
+        
+        for(int i=0; i<numBakes; ++i)
+        {
+            if(!bakers[i] || !outputs[i])
+            {
+                std::ostringstream err;
+                err << "Cannot bake a batch of luts, the baker or output of bake ";
+                err << i << " is null.";
+                throw Exception(err.str().c_str());
+            }
+        }
+        
+        WarmBakerBody body(bakers);
+        ParallelFor(body, numBakes, 1, GetParallelForNumWorkers(numBakes));
+        
+        // Outputs may be the same stream, so the bakes run in turn;
+        // each one evaluates its lut in parallel.
+        for(int i=0; i<numBakes; ++i)
+        {
+            bakers[i]->bake(*outputs[i]);
+        }
+    }
+    
 }
 OCIO_NAMESPACE_EXIT
 
@@ -292,6 +448,122 @@ OIIO_ADD_TEST(Baker_Unit_Tests, test_listlutwriters)
 }
 */
 
+OIIO_ADD_TEST(Baker_Unit_Tests, bake_batch)
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    {
+        OCIO::ColorSpaceRcPtr cs = OCIO::ColorSpace::Create();
+        cs->setName("lnf");
+        config->addColorSpace(cs);
+        config->setRole(OCIO::ROLE_REFERENCE, cs->getName());
+    }
+    const char * targets[2] = { "gamma22", "gamma18" };
+    const float gammas[2] = { 2.2f, 1.8f };
+    for(int i=0; i<2; ++i)
+    {
+        OCIO::ColorSpaceRcPtr cs = OCIO::ColorSpace::Create();
+        cs->setName(targets[i]);
+        OCIO::ExponentTransformRcPtr transform = OCIO::ExponentTransform::Create();
+        float exponent[4] = { gammas[i], gammas[i], gammas[i], 1.0f };
+        transform->setValue(exponent);
+        cs->setTransform(transform, OCIO::COLORSPACE_DIR_FROM_REFERENCE);
+        config->addColorSpace(cs);
+    }
+    
+    const char * formats[2] = { "cinespace", "houdini" };
+    std::vector<OCIO::ConstBakerRcPtr> bakers;
+    for(int f=0; f<2; ++f)
+    {
+        for(int t=0; t<2; ++t)
+        {
+            OCIO::BakerRcPtr baker = OCIO::Baker::Create();
+            baker->setConfig(config);
+            baker->setFormat(formats[f]);
+            baker->setInputSpace("lnf");
+            baker->setTargetSpace(targets[t]);
+            baker->setCubeSize(5);
+            bakers.push_back(baker);
+        }
+    }
+    
+    std::vector<std::ostringstream *> streams;
+    std::vector<std::ostream *> outputs;
+    for(unsigned int i=0; i<bakers.size(); ++i)
+    {
+        streams.push_back(new std::ostringstream);
+        outputs.push_back(streams.back());
+    }
+    
+    OCIO::Baker::bakeBatch(&bakers[0], &outputs[0], (int)bakers.size());
+    
+    for(unsigned int i=0; i<bakers.size(); ++i)
+    {
+        std::ostringstream expected;
+        bakers[i]->bake(expected);
+        OIIO_CHECK_ASSERT(!expected.str().empty());
+        OIIO_CHECK_EQUAL(streams[i]->str(), expected.str());
+        delete streams[i];
+    }
+    
+    // Nothing to do, and invalid entries
+    OIIO_CHECK_NO_THOW(OCIO::Baker::bakeBatch(NULL, NULL, 0));
+    outputs[1] = NULL;
+    OIIO_CHECK_THOW(OCIO::Baker::bakeBatch(&bakers[0], &outputs[0], 2),
+                    OCIO::Exception);
+}
+
+#if !defined(WINDOWS)
+
+#include <fcntl.h>
+#include <fstream>
+
+OIIO_ADD_TEST(Baker_Unit_Tests, bake_fd)
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    {
+        OCIO::ColorSpaceRcPtr cs = OCIO::ColorSpace::Create();
+        cs->setName("lnf");
+        config->addColorSpace(cs);
+        config->setRole(OCIO::ROLE_REFERENCE, cs->getName());
+    }
+    {
+        OCIO::ColorSpaceRcPtr cs = OCIO::ColorSpace::Create();
+        cs->setName("gamma22");
+        OCIO::ExponentTransformRcPtr transform = OCIO::ExponentTransform::Create();
+        float exponent[4] = { 2.2f, 2.2f, 2.2f, 1.0f };
+        transform->setValue(exponent);
+        cs->setTransform(transform, OCIO::COLORSPACE_DIR_FROM_REFERENCE);
+        config->addColorSpace(cs);
+    }
+    
+    OCIO::BakerRcPtr baker = OCIO::Baker::Create();
+    baker->setConfig(config);
+    baker->setFormat("iridas_itx");
+    baker->setInputSpace("lnf");
+    baker->setTargetSpace("gamma22");
+    baker->setCubeSize(17);
+    
+    std::ostringstream expected;
+    baker->bake(expected);
+    
+    OCIO::TempDirectory dir("baker");
+    const std::string filename = dir.getFilePath("lut.itx");
+    int fd = open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    OIIO_CHECK_ASSERT(fd >= 0);
+    OIIO_CHECK_NO_THOW(baker->bake(fd));
+    close(fd);
+    
+    std::ifstream file(filename.c_str(), std::ios_base::in | std::ios_base::binary);
+    std::ostringstream baked;
+    baked << file.rdbuf();
+    file.close();
+    
+    OIIO_CHECK_EQUAL(baked.str(), expected.str());
+    OIIO_CHECK_THOW(baker->bake(-1), OCIO::Exception);
+}
+
+#endif // !WINDOWS
+
 #endif // OCIO_BUILD_TESTS
 
     
@@ -0,0 +1,472 @@
+/*
+Copyright (c) 2003-2010 Sony Pictures Imageworks Inc., et al.
+All Rights Reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Sony Pictures Imageworks nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include <algorithm>
+#include <cstring>
+#include <ostream>
+#include <sstream>
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "BakingUtils.h"
+#include "ParseUtils.h"
+#include "Threading.h"
+
+OCIO_NAMESPACE_ENTER
+{
+    namespace
+    {
+        // Lattice points evaluated at once (3MB of rgb floats).
+        const long BAKE_WINDOW_NUM_POINTS = 262144;
+        
+        // Lattice points a bake worker evaluates at a time
+        const long BAKE_BLOCK_NUM_POINTS = 4096;
+        
+        // Bytes of text a LutTextWriter holds before writing them out
+        const size_t LUT_TEXT_BUFFER_SIZE = 1 << 20;
+        
+        // Fill the identity values of lattice points [begin, begin+numPoints),
+        // matching GenerateIdentityLut3D, then run them through the processors.
+        
+        void EvaluateWindow(float * rgb, long begin, long numPoints,
+                            int cubeSize, Lut3DOrder order,
+                            const std::vector<ConstProcessorRcPtr> & processors)
+        {
+            const long edgeLen = cubeSize;
+            const float c = 1.0f / ((float)cubeSize - 1.0f);
+            
+            for(long i=0; i<numPoints; ++i)
+            {
+                const long index = begin + i;
+                const float fast = (float)(index%edgeLen) * c;
+                const float mid = (float)((index/edgeLen)%edgeLen) * c;
+                const float slow = (float)((index/edgeLen/edgeLen)%edgeLen) * c;
+                
+                if(order == LUT3DORDER_FAST_RED)
+                {
+                    rgb[3*i+0] = fast;
+                    rgb[3*i+1] = mid;
+                    rgb[3*i+2] = slow;
+                }
+                else
+                {
+                    rgb[3*i+0] = slow;
+                    rgb[3*i+1] = mid;
+                    rgb[3*i+2] = fast;
+                }
+            }
+            
+            PackedImageDesc img(rgb, numPoints, 1, 3);
+            for(unsigned int i=0; i<processors.size(); ++i)
+            {
+                processors[i]->apply(img);
+            }
+        }
+        
+        // Item 0 hands the previous window (if any) to the sink, the
+        // others each evaluate a block of the next window. The blocks are
+        // applied serially, as the bake already has a worker per core.
+        
+        class BakeWindowBody : public ParallelForBody
+        {
+        public:
+            BakeWindowBody(Lut3DBakeSink & sink,
+                           const float * prevRgb, long prevNumPoints,
+                           float * nextRgb, long nextBegin, long nextNumPoints,
+                           int cubeSize, Lut3DOrder order,
+                           const std::vector<ConstProcessorRcPtr> & processors) :
+                m_sink(sink),
+                m_prevRgb(prevRgb),
+                m_prevNumPoints(prevNumPoints),
+                m_nextRgb(nextRgb),
+                m_nextBegin(nextBegin),
+                m_nextNumPoints(nextNumPoints),
+                m_cubeSize(cubeSize),
+                m_order(order),
+                m_processors(processors)
+            { }
+            
+            long getNumItems() const
+            {
+                return 1 + (m_nextNumPoints + BAKE_BLOCK_NUM_POINTS - 1)
+                           / BAKE_BLOCK_NUM_POINTS;
+            }
+            
+            void run(int /*workerIndex*/, long itemBegin, long itemEnd) const
+            {
+                SerialScope serial;
+                
+                for(long item=itemBegin; item<itemEnd; ++item)
+                {
+                    if(item == 0)
+                    {
+                        if(m_prevRgb) m_sink.write(m_prevRgb, m_prevNumPoints);
+                        continue;
+                    }
+                    
+                    const long offset = (item-1) * BAKE_BLOCK_NUM_POINTS;
+                    const long numPoints = std::min(BAKE_BLOCK_NUM_POINTS,
+                                                    m_nextNumPoints - offset);
+                    EvaluateWindow(m_nextRgb + 3*offset, m_nextBegin + offset,
+                                   numPoints, m_cubeSize, m_order, m_processors);
+                }
+            }
+            
+        private:
+            Lut3DBakeSink & m_sink;
+            const float * m_prevRgb;
+            long m_prevNumPoints;
+            float * m_nextRgb;
+            long m_nextBegin;
+            long m_nextNumPoints;
+            int m_cubeSize;
+            Lut3DOrder m_order;
+            const std::vector<ConstProcessorRcPtr> & m_processors;
+            
+            BakeWindowBody(const BakeWindowBody &);
+            BakeWindowBody& operator= (const BakeWindowBody &);
+        };
+        
+        // Baking is evaluation of the whole lattice, so this does not
+        // follow the number of threads used by apply, only what the host
+        // can run.
+        
+        int GetBakeNumWorkers()
+        {
+            TaskExecutor * executor = GetTaskExecutor();
+            int numWorkers = executor ? executor->getConcurrency() : GetNumProcessors();
+            return numWorkers < 1 ? 1 : numWorkers;
+        }
+        
+        // Evaluate the window at nextBegin into nextRgb, while the sink
+        // consumes the previous one (if prevRgb is not NULL).
+        
+        void BakeWindow(Lut3DBakeSink & sink,
+                        const float * prevRgb, long prevNumPoints,
+                        float * nextRgb, long nextBegin, long nextNumPoints,
+                        int cubeSize, Lut3DOrder order,
+                        const std::vector<ConstProcessorRcPtr> & processors,
+                        int numWorkers)
+        {
+            BakeWindowBody body(sink, prevRgb, prevNumPoints,
+                                nextRgb, nextBegin, nextNumPoints,
+                                cubeSize, order, processors);
+            ParallelFor(body, body.getNumItems(), 1, numWorkers);
+        }
+    }
+    
+    LutTextWriter::LutTextWriter(std::ostream & ostream) :
+        m_ostream(ostream),
+        m_buffer(LUT_TEXT_BUFFER_SIZE),
+        m_size(0)
+    {
+    }
+    
+    LutTextWriter::~LutTextWriter()
+    {
+        try
+        {
+            flush();
+        }
+        catch(...)
+        {
+        }
+    }
+    
+    void LutTextWriter::flush()
+    {
+        if(m_size == 0) return;
+        m_ostream.write(&m_buffer[0], static_cast<std::streamsize>(m_size));
+        m_size = 0;
+    }
+    
+    void LutTextWriter::write(const char * str, size_t size)
+    {
+        if(m_size + size > m_buffer.size())
+        {
+            flush();
+            if(size > m_buffer.size())
+            {
+                m_ostream.write(str, static_cast<std::streamsize>(size));
+                return;
+            }
+        }
+        memcpy(&m_buffer[m_size], str, size);
+        m_size += size;
+    }
+    
+    LutTextWriter & LutTextWriter::operator<< (const char * str)
+    {
+        write(str, strlen(str));
+        return *this;
+    }
+    
+    LutTextWriter & LutTextWriter::operator<< (const std::string & str)
+    {
+        write(str.c_str(), str.size());
+        return *this;
+    }
+    
+    LutTextWriter & LutTextWriter::operator<< (char c)
+    {
+        if(m_size == m_buffer.size()) flush();
+        m_buffer[m_size++] = c;
+        return *this;
+    }
+    
+    LutTextWriter & LutTextWriter::operator<< (int value)
+    {
+        if(m_size + FORMAT_FLOAT_MAX_CHARS > m_buffer.size()) flush();
+        m_size += FormatInt(&m_buffer[m_size], value);
+        return *this;
+    }
+    
+    LutTextWriter & LutTextWriter::operator<< (float value)
+    {
+        if(m_size + FORMAT_FLOAT_MAX_CHARS > m_buffer.size()) flush();
+        m_size += FormatFloatFixed6(&m_buffer[m_size], value);
+        return *this;
+    }
+    
+    Lut3DTextSink::Lut3DTextSink(LutTextWriter & writer,
+                                 const std::string & linePrefix) :
+        m_writer(writer),
+        m_linePrefix(linePrefix)
+    {
+    }
+    
+    void Lut3DTextSink::write(const float * rgb, long numPoints)
+    {
+        for(long i=0; i<numPoints; ++i)
+        {
+            m_writer << m_linePrefix;
+            m_writer << rgb[3*i+0] << ' ' << rgb[3*i+1] << ' ' << rgb[3*i+2] << '\n';
+        }
+    }
+    
+    void BakeLut3D(Lut3DBakeSink & sink, int cubeSize, Lut3DOrder order,
+                   const std::vector<ConstProcessorRcPtr> & processors)
+    {
+        if(cubeSize < 2)
+        {
+            std::ostringstream os;
+            os << "Cannot bake a 3d lut of size " << cubeSize << ".";
+            throw Exception(os.str().c_str());
+        }
+        if(order != LUT3DORDER_FAST_RED && order != LUT3DORDER_FAST_BLUE)
+        {
+            throw Exception("Unknown Lut3DOrder.");
+        }
+        
+        const long numPoints = (long)cubeSize * cubeSize * cubeSize;
+        const long windowSize = std::min(numPoints, BAKE_WINDOW_NUM_POINTS);
+        const int numWorkers = GetBakeNumWorkers();
+        
+        std::vector<float> windows[2];
+        windows[0].resize(windowSize*3);
+        if(numPoints > windowSize) windows[1].resize(windowSize*3);
+        
+        long begin = 0;
+        long count = windowSize;
+        int current = 0;
+        BakeWindow(sink, NULL, 0, &windows[current][0], begin, count,
+                   cubeSize, order, processors, numWorkers);
+        
+        while(true)
+        {
+            const long nextBegin = begin + count;
+            const long nextCount = std::min(windowSize, numPoints - nextBegin);
+            
+            if(nextCount <= 0)
+            {
+                sink.write(&windows[current][0], count);
+                break;
+            }
+            
+            BakeWindow(sink, &windows[current][0], count,
+                       &windows[1-current][0], nextBegin, nextCount,
+                       cubeSize, order, processors, numWorkers);
+            
+            begin = nextBegin;
+            count = nextCount;
+            current = 1-current;
+        }
+    }
+    
+    void BakeLut3D(Lut3DBakeSink & sink, int cubeSize, Lut3DOrder order,
+                   const ConstProcessorRcPtr & processor)
+    {
+        std::vector<ConstProcessorRcPtr> processors(1, processor);
+        BakeLut3D(sink, cubeSize, order, processors);
+    }
+    
+    ConstProcessorRcPtr GetBakerProcessor(const Baker & baker,
+                                          const char * srcSpace)
+    {
+        ConstConfigRcPtr config = baker.getConfig();
+        
+        std::string looks = baker.getLooks();
+        if(!looks.empty())
+        {
+            LookTransformRcPtr transform = LookTransform::Create();
+            transform->setLooks(looks.c_str());
+            transform->setSrc(srcSpace);
+            transform->setDst(baker.getTargetSpace());
+            return config->getProcessor(transform, TRANSFORM_DIR_FORWARD);
+        }
+        
+        return config->getProcessor(srcSpace, baker.getTargetSpace());
+    }
+}
+OCIO_NAMESPACE_EXIT
+
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef OCIO_UNIT_TEST
+
+namespace OCIO = OCIO_NAMESPACE;
+#include "UnitTest.h"
+
+namespace
+{
+    class CollectSink : public OCIO::Lut3DBakeSink
+    {
+    public:
+        CollectSink() : numWrites(0) { }
+        
+        void write(const float * rgb, long numPoints)
+        {
+            values.insert(values.end(), rgb, rgb + 3*numPoints);
+            ++numWrites;
+        }
+        
+        std::vector<float> values;
+        int numWrites;
+    };
+    
+    // Runs the workers one after the other, counting the ones it ran
+    class CountingExecutor : public OCIO::TaskExecutor
+    {
+    public:
+        CountingExecutor() : numItems(0) { }
+        
+        virtual int getConcurrency() const { return 3; }
+        
+        virtual void run(const OCIO::ParallelTask & task, int numTaskItems)
+        {
+            numItems += numTaskItems;
+            for(int i=0; i<numTaskItems; ++i) task.execute(i);
+        }
+        
+        int numItems;
+    };
+}
+
+OIIO_ADD_TEST(BakingUtils, BakeLut3DWindows)
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    OCIO::ExponentTransformRcPtr transform = OCIO::ExponentTransform::Create();
+    float exponent[4] = { 2.2f, 1.8f, 2.6f, 1.0f };
+    transform->setValue(exponent);
+    OCIO::ConstProcessorRcPtr processor =
+        config->getProcessor(transform, OCIO::TRANSFORM_DIR_FORWARD);
+    
+    // 65^3 points span several windows, the last one partial
+    const int cubeSize = 65;
+    const long numPoints = (long)cubeSize*cubeSize*cubeSize;
+    
+    const OCIO::Lut3DOrder orders[2] = { OCIO::LUT3DORDER_FAST_RED,
+                                         OCIO::LUT3DORDER_FAST_BLUE };
+    for(int o=0; o<2; ++o)
+    {
+        std::vector<float> expected(numPoints*3);
+        OCIO::GenerateIdentityLut3D(&expected[0], cubeSize, 3, orders[o]);
+        OCIO::PackedImageDesc img(&expected[0], numPoints, 1, 3);
+        processor->apply(img);
+        
+        CollectSink sink;
+        OCIO::BakeLut3D(sink, cubeSize, orders[o], processor);
+        
+        OIIO_CHECK_ASSERT(sink.numWrites > 1);
+        OIIO_CHECK_EQUAL(sink.values.size(), expected.size());
+        OIIO_CHECK_ASSERT(sink.values == expected);
+    }
+    
+    // Several processors are applied in turn
+    std::vector<OCIO::ConstProcessorRcPtr> processors(2, processor);
+    std::vector<float> expected(8*3);
+    OCIO::GenerateIdentityLut3D(&expected[0], 2, 3, OCIO::LUT3DORDER_FAST_RED);
+    OCIO::PackedImageDesc img(&expected[0], 8, 1, 3);
+    processor->apply(img);
+    processor->apply(img);
+    
+    CollectSink sink;
+    OCIO::BakeLut3D(sink, 2, OCIO::LUT3DORDER_FAST_RED, processors);
+    OIIO_CHECK_EQUAL(sink.numWrites, 1);
+    OIIO_CHECK_ASSERT(sink.values == expected);
+    
+    OIIO_CHECK_THOW(OCIO::BakeLut3D(sink, 1, OCIO::LUT3DORDER_FAST_RED, processor),
+                    OCIO::Exception);
+}
+
+OIIO_ADD_TEST(BakingUtils, BakeLut3DWorkers)
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    OCIO::ExponentTransformRcPtr transform = OCIO::ExponentTransform::Create();
+    float exponent[4] = { 2.2f, 1.8f, 2.6f, 1.0f };
+    transform->setValue(exponent);
+    OCIO::ConstProcessorRcPtr processor =
+        config->getProcessor(transform, OCIO::TRANSFORM_DIR_FORWARD);
+    
+    const int cubeSize = 33;
+    const long numPoints = (long)cubeSize*cubeSize*cubeSize;
+    std::vector<float> expected(numPoints*3);
+    OCIO::GenerateIdentityLut3D(&expected[0], cubeSize, 3, OCIO::LUT3DORDER_FAST_RED);
+    OCIO::PackedImageDesc img(&expected[0], numPoints, 1, 3);
+    processor->apply(img);
+    
+    // The bake uses all the workers of the executor, even though apply
+    // is serial, and apply does not split the blocks any further.
+    int oldNumThreads = OCIO::GetNumThreads();
+    OCIO::SetNumThreads(1);
+    CountingExecutor executor;
+    OCIO::SetTaskExecutor(&executor);
+    
+    CollectSink sink;
+    OCIO::BakeLut3D(sink, cubeSize, OCIO::LUT3DORDER_FAST_RED, processor);
+    
+    OCIO::SetTaskExecutor(NULL);
+    OCIO::SetNumThreads(oldNumThreads);
+    
+    OIIO_CHECK_EQUAL(executor.numItems, 3);
+    OIIO_CHECK_ASSERT(sink.values == expected);
+}
+
+#endif // OCIO_UNIT_TEST
@@ -0,0 +1,123 @@
+/*
+Copyright (c) 2003-2010 Sony Pictures Imageworks Inc., et al.
+All Rights Reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Sony Pictures Imageworks nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef INCLUDED_OCIO_BAKINGUTILS_H
+#define INCLUDED_OCIO_BAKINGUTILS_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Lut3DOp.h"
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+OCIO_NAMESPACE_ENTER
+{
+    // Receives the baked values of a 3d lut, in lattice order, a window
+    // of numPoints rgb triplets at a time. Windows are passed in order,
+    // and one at a time, so a sink may write straight to a stream.
+    
+    class Lut3DBakeSink
+    {
+    public:
+        virtual ~Lut3DBakeSink() { }
+        virtual void write(const float * rgb, long numPoints) = 0;
+    };
+    
+    // Formats the text of ascii luts into a large buffer, handed to the
+    // stream in big blocks. Floats are written with 6 decimals (as a
+    // stream with std::fixed and a precision of 6 would), independent
+    // of the stream formatting and locale.
+    // Anything left is written by flush(), or on destruction.
+    
+    class LutTextWriter
+    {
+    public:
+        explicit LutTextWriter(std::ostream & ostream);
+        ~LutTextWriter();
+        
+        LutTextWriter & operator<< (const char * str);
+        LutTextWriter & operator<< (const std::string & str);
+        LutTextWriter & operator<< (char c);
+        LutTextWriter & operator<< (int value);
+        LutTextWriter & operator<< (float value);
+        
+        void flush();
+        
+    private:
+        void write(const char * str, size_t size);
+        
+        std::ostream & m_ostream;
+        std::vector<char> m_buffer;
+        size_t m_size;
+        
+        LutTextWriter(const LutTextWriter &);
+        LutTextWriter& operator= (const LutTextWriter &);
+    };
+    
+    // Writes each point as a "r g b" line, after an optional prefix.
+    
+    class Lut3DTextSink : public Lut3DBakeSink
+    {
+    public:
+        Lut3DTextSink(LutTextWriter & writer, const std::string & linePrefix = "");
+        void write(const float * rgb, long numPoints);
+        
+    private:
+        LutTextWriter & m_writer;
+        std::string m_linePrefix;
+        
+        Lut3DTextSink(const Lut3DTextSink &);
+        Lut3DTextSink& operator= (const Lut3DTextSink &);
+    };
+    
+    // Evaluate the cubeSize^3 identity lattice through the processors
+    // (applied in turn), and pass the results to the sink.
+    // The lattice is never held in full: it is evaluated in windows,
+    // and the sink consumes a window while the next one is being
+    // evaluated. The blocks of a window are spread over one worker per
+    // core (or the TaskExecutor concurrency), whatever GetNumThreads().
+    // Each worker applies the processors serially.
+    
+    void BakeLut3D(Lut3DBakeSink & sink, int cubeSize, Lut3DOrder order,
+                   const std::vector<ConstProcessorRcPtr> & processors);
+    
+    void BakeLut3D(Lut3DBakeSink & sink, int cubeSize, Lut3DOrder order,
+                   const ConstProcessorRcPtr & processor);
+    
+    // The processor from srcSpace to the baker target space,
+    // through the baker looks if it has any.
+    
+    ConstProcessorRcPtr GetBakerProcessor(const Baker & baker,
+                                          const char * srcSpace);
+}
+OCIO_NAMESPACE_EXIT
+
+#endif
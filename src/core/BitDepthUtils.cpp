@@ -0,0 +1,590 @@
+/*
+Copyright (c) 2003-2010 Sony Pictures Imageworks Inc., et al.
+All Rights Reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Sony Pictures Imageworks nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cstring>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "BitDepthUtils.h"
+#include "SSE.h"
+
+OCIO_NAMESPACE_ENTER
+{
+    namespace
+    {
+        inline unsigned int FloatAsBits(float f)
+        {
+            unsigned int u;
+            memcpy(&u, &f, sizeof(float));
+            return u;
+        }
+        
+        inline float BitsAsFloat(unsigned int u)
+        {
+            float f;
+            memcpy(&f, &u, sizeof(float));
+            return f;
+        }
+    }
+    
+    int GetBitDepthChannelSize(BitDepth bitDepth)
+    {
+        switch(bitDepth)
+        {
+            case BIT_DEPTH_UINT8:
+                return 1;
+            case BIT_DEPTH_UINT10:
+            case BIT_DEPTH_UINT12:
+            case BIT_DEPTH_UINT14:
+            case BIT_DEPTH_UINT16:
+            case BIT_DEPTH_F16:
+                return 2;
+            case BIT_DEPTH_F32:
+                return 4;
+            default:
+                return 0;
+        }
+    }
+    
+    float GetBitDepthMaxValue(BitDepth bitDepth)
+    {
+        switch(bitDepth)
+        {
+            case BIT_DEPTH_UINT8:
+                return 255.0f;
+            case BIT_DEPTH_UINT10:
+                return 1023.0f;
+            case BIT_DEPTH_UINT12:
+                return 4095.0f;
+            case BIT_DEPTH_UINT14:
+                return 16383.0f;
+            case BIT_DEPTH_UINT16:
+                return 65535.0f;
+            default:
+                return 1.0f;
+        }
+    }
+    
+    // The half conversions work on the bit patterns, following
+    // http://fgiesen.wordpress.com/2012/03/28/half-to-float-done-quic/
+    // and match the F16C instructions, including for NaNs (which are
+    // quieted, keeping the upper payload bits).
+    
+    float HalfToFloat(unsigned short h)
+    {
+        const unsigned int shiftedExp = 0x7c00u << 13;
+        
+        unsigned int o = (static_cast<unsigned int>(h) & 0x7fffu) << 13;
+        const unsigned int exp = o & shiftedExp;
+        o += (127u - 15u) << 23;
+        
+        if(exp == shiftedExp)
+        {
+            // Inf / NaN
+            o += (128u - 16u) << 23;
+            if(o & 0x7fffffu) o |= 0x400000u;
+        }
+        else if(exp == 0)
+        {
+            // Zero / denormal, renormalized by the float subtraction
+            o += 1u << 23;
+            o = FloatAsBits(BitsAsFloat(o) - BitsAsFloat(113u << 23));
+        }
+        
+        o |= (static_cast<unsigned int>(h) & 0x8000u) << 16;
+        return BitsAsFloat(o);
+    }
+    
+    unsigned short FloatToHalf(float f)
+    {
+        unsigned int u = FloatAsBits(f);
+        const unsigned int sign = (u & 0x80000000u) >> 16;
+        u &= 0x7fffffffu;
+        
+        unsigned int o = 0;
+        
+        if(u >= (143u << 23))
+        {
+            // Overflows to Inf, or NaN
+            o = (u > 0x7f800000u) ? (0x7e00u | ((u >> 13) & 0x3ffu)) : 0x7c00u;
+        }
+        else if(u < (113u << 23))
+        {
+            // Denormal (or zero) result. Let the float addition do the
+            // rounding, by aligning the lsb of the half mantissa with the
+            // lsb of the float mantissa.
+            const unsigned int denormMagic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+            o = FloatAsBits(BitsAsFloat(u) + BitsAsFloat(denormMagic)) - denormMagic;
+        }
+        else
+        {
+            // Normal result. Rebias the exponent, and round the mantissa
+            // to nearest even (a carry into the exponent is correct,
+            // including overflow to Inf).
+            const unsigned int mantOdd = (u >> 13) & 1u;
+            u += ((15u - 127u) << 23) + 0xfffu;
+            u += mantOdd;
+            o = u >> 13;
+        }
+        
+        return static_cast<unsigned short>(o | sign);
+    }
+    
+    namespace
+    {
+        // Scalar reference converters
+        
+        template<typename T, unsigned int MAXVALUE>
+        void IntToFloat(float * dst, const void * src, long numValues)
+        {
+            const T * in = static_cast<const T *>(src);
+            const float maxValue = static_cast<float>(MAXVALUE);
+            
+            for(long i=0; i<numValues; ++i)
+            {
+                dst[i] = static_cast<float>(in[i]) / maxValue;
+            }
+        }
+        
+        template<typename T, unsigned int MAXVALUE>
+        void IntFromFloat(void * dst, const float * src, long numValues)
+        {
+            T * out = static_cast<T *>(dst);
+            const float maxValue = static_cast<float>(MAXVALUE);
+            
+            for(long i=0; i<numValues; ++i)
+            {
+                float v = src[i] * maxValue + 0.5f;
+                v = (v > 0.0f) ? v : 0.0f;  // Also maps NaN to 0
+                v = (v < maxValue) ? v : maxValue;
+                out[i] = static_cast<T>(v);
+            }
+        }
+        
+        void HalfToFloat_Scalar(float * dst, const void * src, long numValues)
+        {
+            const unsigned short * in = static_cast<const unsigned short *>(src);
+            for(long i=0; i<numValues; ++i)
+            {
+                dst[i] = HalfToFloat(in[i]);
+            }
+        }
+        
+        void HalfFromFloat_Scalar(void * dst, const float * src, long numValues)
+        {
+            unsigned short * out = static_cast<unsigned short *>(dst);
+            for(long i=0; i<numValues; ++i)
+            {
+                out[i] = FloatToHalf(src[i]);
+            }
+        }
+        
+        void FloatToFloat(float * dst, const void * src, long numValues)
+        {
+            memcpy(dst, src, sizeof(float)*numValues);
+        }
+        
+        void FloatFromFloat(void * dst, const float * src, long numValues)
+        {
+            memcpy(dst, src, sizeof(float)*numValues);
+        }
+        
+#ifdef USE_SSE
+        // Same operations as IntFromFloat, up to the conversion to int32
+        inline __m128i QuantizeFloat_SSE2(__m128 v, __m128 maxValue)
+        {
+            v = _mm_add_ps(_mm_mul_ps(v, maxValue), _mm_set1_ps(0.5f));
+            v = _mm_max_ps(v, _mm_setzero_ps());
+            v = _mm_min_ps(v, maxValue);
+            return _mm_cvttps_epi32(v);
+        }
+        
+        void UInt8ToFloat_SSE2(float * dst, const void * src, long numValues)
+        {
+            const unsigned char * in = static_cast<const unsigned char *>(src);
+            const __m128 maxValue = _mm_set1_ps(255.0f);
+            const __m128i zero = _mm_setzero_si128();
+            
+            long i = 0;
+            for(; i+16<=numValues; i+=16)
+            {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in+i));
+                __m128i lo = _mm_unpacklo_epi8(v, zero);
+                __m128i hi = _mm_unpackhi_epi8(v, zero);
+                
+                _mm_storeu_ps(dst+i, _mm_div_ps(
+                    _mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), maxValue));
+                _mm_storeu_ps(dst+i+4, _mm_div_ps(
+                    _mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), maxValue));
+                _mm_storeu_ps(dst+i+8, _mm_div_ps(
+                    _mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), maxValue));
+                _mm_storeu_ps(dst+i+12, _mm_div_ps(
+                    _mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), maxValue));
+            }
+            
+            IntToFloat<unsigned char, 255>(dst+i, in+i, numValues-i);
+        }
+        
+        void UInt8FromFloat_SSE2(void * dst, const float * src, long numValues)
+        {
+            unsigned char * out = static_cast<unsigned char *>(dst);
+            const __m128 maxValue = _mm_set1_ps(255.0f);
+            
+            long i = 0;
+            for(; i+16<=numValues; i+=16)
+            {
+                __m128i i0 = QuantizeFloat_SSE2(_mm_loadu_ps(src+i), maxValue);
+                __m128i i1 = QuantizeFloat_SSE2(_mm_loadu_ps(src+i+4), maxValue);
+                __m128i i2 = QuantizeFloat_SSE2(_mm_loadu_ps(src+i+8), maxValue);
+                __m128i i3 = QuantizeFloat_SSE2(_mm_loadu_ps(src+i+12), maxValue);
+                
+                // All values are in [0,255], so no saturation happens
+                __m128i v = _mm_packus_epi16(_mm_packs_epi32(i0, i1),
+                                             _mm_packs_epi32(i2, i3));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out+i), v);
+            }
+            
+            IntFromFloat<unsigned char, 255>(out+i, src+i, numValues-i);
+        }
+        
+        template<unsigned int MAXVALUE>
+        void UInt16ToFloat_SSE2(float * dst, const void * src, long numValues)
+        {
+            const unsigned short * in = static_cast<const unsigned short *>(src);
+            const __m128 maxValue = _mm_set1_ps(static_cast<float>(MAXVALUE));
+            const __m128i zero = _mm_setzero_si128();
+            
+            long i = 0;
+            for(; i+8<=numValues; i+=8)
+            {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in+i));
+                
+                _mm_storeu_ps(dst+i, _mm_div_ps(
+                    _mm_cvtepi32_ps(_mm_unpacklo_epi16(v, zero)), maxValue));
+                _mm_storeu_ps(dst+i+4, _mm_div_ps(
+                    _mm_cvtepi32_ps(_mm_unpackhi_epi16(v, zero)), maxValue));
+            }
+            
+            IntToFloat<unsigned short, MAXVALUE>(dst+i, in+i, numValues-i);
+        }
+        
+        template<unsigned int MAXVALUE>
+        void UInt16FromFloat_SSE2(void * dst, const float * src, long numValues)
+        {
+            unsigned short * out = static_cast<unsigned short *>(dst);
+            const __m128 maxValue = _mm_set1_ps(static_cast<float>(MAXVALUE));
+            
+            // SSE2 only has a signed saturating pack, so the values are
+            // shifted into the signed range and back.
+            const __m128i bias32 = _mm_set1_epi32(32768);
+            const __m128i bias16 = _mm_set1_epi16(static_cast<short>(0x8000));
+            
+            long i = 0;
+            for(; i+8<=numValues; i+=8)
+            {
+                __m128i i0 = QuantizeFloat_SSE2(_mm_loadu_ps(src+i), maxValue);
+                __m128i i1 = QuantizeFloat_SSE2(_mm_loadu_ps(src+i+4), maxValue);
+                
+                __m128i v = _mm_packs_epi32(_mm_sub_epi32(i0, bias32),
+                                            _mm_sub_epi32(i1, bias32));
+                v = _mm_xor_si128(v, bias16);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out+i), v);
+            }
+            
+            IntFromFloat<unsigned short, MAXVALUE>(out+i, src+i, numValues-i);
+        }
+#endif // USE_SSE
+        
+#ifdef OCIO_USE_AVX
+        OCIO_TARGET_F16C
+        void HalfToFloat_F16C(float * dst, const void * src, long numValues)
+        {
+            const unsigned short * in = static_cast<const unsigned short *>(src);
+            
+            long i = 0;
+            for(; i+8<=numValues; i+=8)
+            {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in+i));
+                _mm256_storeu_ps(dst+i, _mm256_cvtph_ps(v));
+            }
+            
+            HalfToFloat_Scalar(dst+i, in+i, numValues-i);
+        }
+        
+        OCIO_TARGET_F16C
+        void HalfFromFloat_F16C(void * dst, const float * src, long numValues)
+        {
+            unsigned short * out = static_cast<unsigned short *>(dst);
+            
+            long i = 0;
+            for(; i+8<=numValues; i+=8)
+            {
+                __m128i v = _mm256_cvtps_ph(_mm256_loadu_ps(src+i),
+                                            _MM_FROUND_TO_NEAREST_INT);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out+i), v);
+            }
+            
+            HalfFromFloat_Scalar(out+i, src+i, numValues-i);
+        }
+#endif // OCIO_USE_AVX
+        
+        template<unsigned int MAXVALUE>
+        ChannelToFloatFn GetUInt16ToFloatFn(SIMDLevel level)
+        {
+#ifdef USE_SSE
+            if(level >= SIMD_LEVEL_SSE2) return UInt16ToFloat_SSE2<MAXVALUE>;
+#endif
+            (void) level;
+            return IntToFloat<unsigned short, MAXVALUE>;
+        }
+        
+        template<unsigned int MAXVALUE>
+        ChannelFromFloatFn GetUInt16FromFloatFn(SIMDLevel level)
+        {
+#ifdef USE_SSE
+            if(level >= SIMD_LEVEL_SSE2) return UInt16FromFloat_SSE2<MAXVALUE>;
+#endif
+            (void) level;
+            return IntFromFloat<unsigned short, MAXVALUE>;
+        }
+    }
+    
+    ChannelToFloatFn GetChannelToFloatFn(BitDepth bitDepth, SIMDLevel level)
+    {
+        switch(bitDepth)
+        {
+            case BIT_DEPTH_UINT8:
+#ifdef USE_SSE
+                if(level >= SIMD_LEVEL_SSE2) return UInt8ToFloat_SSE2;
+#endif
+                return IntToFloat<unsigned char, 255>;
+            case BIT_DEPTH_UINT10:
+                return GetUInt16ToFloatFn<1023>(level);
+            case BIT_DEPTH_UINT12:
+                return GetUInt16ToFloatFn<4095>(level);
+            case BIT_DEPTH_UINT14:
+                return GetUInt16ToFloatFn<16383>(level);
+            case BIT_DEPTH_UINT16:
+                return GetUInt16ToFloatFn<65535>(level);
+            case BIT_DEPTH_F16:
+#ifdef OCIO_USE_AVX
+                if(level >= SIMD_LEVEL_AVX2) return HalfToFloat_F16C;
+#endif
+                return HalfToFloat_Scalar;
+            case BIT_DEPTH_F32:
+                return FloatToFloat;
+            default:
+                return NULL;
+        }
+    }
+    
+    ChannelFromFloatFn GetChannelFromFloatFn(BitDepth bitDepth, SIMDLevel level)
+    {
+        switch(bitDepth)
+        {
+            case BIT_DEPTH_UINT8:
+#ifdef USE_SSE
+                if(level >= SIMD_LEVEL_SSE2) return UInt8FromFloat_SSE2;
+#endif
+                return IntFromFloat<unsigned char, 255>;
+            case BIT_DEPTH_UINT10:
+                return GetUInt16FromFloatFn<1023>(level);
+            case BIT_DEPTH_UINT12:
+                return GetUInt16FromFloatFn<4095>(level);
+            case BIT_DEPTH_UINT14:
+                return GetUInt16FromFloatFn<16383>(level);
+            case BIT_DEPTH_UINT16:
+                return GetUInt16FromFloatFn<65535>(level);
+            case BIT_DEPTH_F16:
+#ifdef OCIO_USE_AVX
+                if(level >= SIMD_LEVEL_AVX2) return HalfFromFloat_F16C;
+#endif
+                return HalfFromFloat_Scalar;
+            case BIT_DEPTH_F32:
+                return FloatFromFloat;
+            default:
+                return NULL;
+        }
+    }
+}
+OCIO_NAMESPACE_EXIT
+
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef OCIO_UNIT_TEST
+
+namespace OCIO = OCIO_NAMESPACE;
+#include "UnitTest.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+OCIO_NAMESPACE_USING
+
+OIIO_ADD_TEST(BitDepthUtils, Half)
+{
+    OIIO_CHECK_EQUAL(FloatToHalf(0.0f), 0x0000);
+    OIIO_CHECK_EQUAL(FloatToHalf(-0.0f), 0x8000);
+    OIIO_CHECK_EQUAL(FloatToHalf(1.0f), 0x3c00);
+    OIIO_CHECK_EQUAL(FloatToHalf(-2.0f), 0xc000);
+    OIIO_CHECK_EQUAL(FloatToHalf(65504.0f), 0x7bff);
+    OIIO_CHECK_EQUAL(FloatToHalf(65519.0f), 0x7bff);
+    OIIO_CHECK_EQUAL(FloatToHalf(65520.0f), 0x7c00);
+    OIIO_CHECK_EQUAL(FloatToHalf(1e10f), 0x7c00);
+    OIIO_CHECK_EQUAL(FloatToHalf(-std::numeric_limits<float>::infinity()), 0xfc00);
+    OIIO_CHECK_EQUAL(FloatToHalf(std::pow(2.0f, -24.0f)), 0x0001);
+    OIIO_CHECK_EQUAL(FloatToHalf(std::pow(2.0f, -25.0f)), 0x0000); // Tie to even
+    OIIO_CHECK_EQUAL(FloatToHalf(1.5f*std::pow(2.0f, -25.0f)), 0x0001);
+    OIIO_CHECK_EQUAL(FloatToHalf(1.0f + std::pow(2.0f, -11.0f)), 0x3c00); // Tie to even
+    OIIO_CHECK_EQUAL(FloatToHalf(std::numeric_limits<float>::quiet_NaN()) & 0x7e00, 0x7e00);
+    
+    OIIO_CHECK_EQUAL(HalfToFloat(0x3c00), 1.0f);
+    OIIO_CHECK_EQUAL(HalfToFloat(0xc000), -2.0f);
+    OIIO_CHECK_EQUAL(HalfToFloat(0x7bff), 65504.0f);
+    OIIO_CHECK_EQUAL(HalfToFloat(0x0001), std::pow(2.0f, -24.0f));
+    OIIO_CHECK_EQUAL(HalfToFloat(0x7c00), std::numeric_limits<float>::infinity());
+    OIIO_CHECK_ASSERT(HalfToFloat(0x7e00) != HalfToFloat(0x7e00));
+    
+    // Every half (but NaNs) survives the round trip
+    for(unsigned int h=0; h<0x10000; ++h)
+    {
+        if((h & 0x7c00) == 0x7c00 && (h & 0x3ff) != 0) continue;
+        OIIO_CHECK_EQUAL(FloatToHalf(HalfToFloat(static_cast<unsigned short>(h))), h);
+    }
+}
+
+OIIO_ADD_TEST(BitDepthUtils, IntegerRoundTrip)
+{
+    const BitDepth bitDepths[] = { BIT_DEPTH_UINT8, BIT_DEPTH_UINT10, BIT_DEPTH_UINT12,
+                                   BIT_DEPTH_UINT14, BIT_DEPTH_UINT16 };
+    
+    for(unsigned int d=0; d<sizeof(bitDepths)/sizeof(bitDepths[0]); ++d)
+    {
+        const BitDepth bitDepth = bitDepths[d];
+        const long maxValue = static_cast<long>(GetBitDepthMaxValue(bitDepth));
+        
+        ChannelToFloatFn toFloat = GetChannelToFloatFn(bitDepth, SIMD_LEVEL_NONE);
+        ChannelFromFloatFn fromFloat = GetChannelFromFloatFn(bitDepth, SIMD_LEVEL_NONE);
+        OIIO_CHECK_ASSERT(toFloat && fromFloat);
+        
+        for(long v=0; v<=maxValue; ++v)
+        {
+            unsigned short src16 = static_cast<unsigned short>(v);
+            unsigned char src8 = static_cast<unsigned char>(v);
+            const void * src = (bitDepth == BIT_DEPTH_UINT8) ?
+                static_cast<const void *>(&src8) : static_cast<const void *>(&src16);
+            
+            float f = -1.0f;
+            toFloat(&f, src, 1);
+            if(v == 0) OIIO_CHECK_EQUAL(f, 0.0f);
+            if(v == maxValue) OIIO_CHECK_EQUAL(f, 1.0f);
+            
+            unsigned short dst16 = 0;
+            unsigned char dst8 = 0;
+            if(bitDepth == BIT_DEPTH_UINT8)
+            {
+                fromFloat(&dst8, &f, 1);
+                OIIO_CHECK_EQUAL(dst8, v);
+            }
+            else
+            {
+                fromFloat(&dst16, &f, 1);
+                OIIO_CHECK_EQUAL(dst16, v);
+            }
+        }
+    }
+    
+    // Out of range values are clamped
+    const float values[4] = { -1.0f, 2.0f, std::numeric_limits<float>::quiet_NaN(), 0.5f };
+    unsigned char out[4];
+    GetChannelFromFloatFn(BIT_DEPTH_UINT8, SIMD_LEVEL_NONE)(out, values, 4);
+    OIIO_CHECK_EQUAL(out[0], 0);
+    OIIO_CHECK_EQUAL(out[1], 255);
+    OIIO_CHECK_EQUAL(out[2], 0);
+    OIIO_CHECK_EQUAL(out[3], 128);
+    
+    OIIO_CHECK_ASSERT(!GetChannelToFloatFn(BIT_DEPTH_UINT32, SIMD_LEVEL_NONE));
+    OIIO_CHECK_ASSERT(!GetChannelFromFloatFn(BIT_DEPTH_UNKNOWN, SIMD_LEVEL_NONE));
+}
+
+OIIO_ADD_TEST(BitDepthUtils, SIMDBitExact)
+{
+    const BitDepth bitDepths[] = { BIT_DEPTH_UINT8, BIT_DEPTH_UINT10, BIT_DEPTH_UINT12,
+                                   BIT_DEPTH_UINT14, BIT_DEPTH_UINT16, BIT_DEPTH_F16,
+                                   BIT_DEPTH_F32 };
+    
+    // Not a multiple of any vector width, to cover the scalar tails
+    const long numValues = 1003;
+    
+    std::vector<float> floats(numValues);
+    std::vector<unsigned char> channels(numValues*4);
+    for(long i=0; i<numValues; ++i)
+    {
+        floats[i] = static_cast<float>(i-100) / 777.0f;
+        for(int b=0; b<4; ++b)
+        {
+            channels[i*4+b] = static_cast<unsigned char>((i*31 + b*97) & 0xff);
+        }
+    }
+    floats[3] = std::numeric_limits<float>::quiet_NaN();
+    floats[5] = std::numeric_limits<float>::infinity();
+    floats[7] = -std::numeric_limits<float>::infinity();
+    floats[11] = -0.0f;
+    floats[13] = 1e-7f;
+    floats[17] = 70000.0f;
+    
+    const SIMDLevel maxLevel = GetSupportedSIMDLevel();
+    
+    for(unsigned int d=0; d<sizeof(bitDepths)/sizeof(bitDepths[0]); ++d)
+    {
+        const BitDepth bitDepth = bitDepths[d];
+        const size_t numBytes = static_cast<size_t>(numValues*GetBitDepthChannelSize(bitDepth));
+        
+        std::vector<float> refFloats(numValues);
+        std::vector<unsigned char> refChannels(numBytes);
+        GetChannelToFloatFn(bitDepth, SIMD_LEVEL_NONE)(&refFloats[0], &channels[0], numValues);
+        GetChannelFromFloatFn(bitDepth, SIMD_LEVEL_NONE)(&refChannels[0], &floats[0], numValues);
+        
+        for(int level=SIMD_LEVEL_NONE+1; level<=maxLevel; ++level)
+        {
+            std::vector<float> outFloats(numValues);
+            std::vector<unsigned char> outChannels(numBytes);
+            GetChannelToFloatFn(bitDepth, static_cast<SIMDLevel>(level))(
+                &outFloats[0], &channels[0], numValues);
+            GetChannelFromFloatFn(bitDepth, static_cast<SIMDLevel>(level))(
+                &outChannels[0], &floats[0], numValues);
+            
+            OIIO_CHECK_EQUAL(memcmp(&outFloats[0], &refFloats[0],
+                                    sizeof(float)*numValues), 0);
+            OIIO_CHECK_EQUAL(memcmp(&outChannels[0], &refChannels[0], numBytes), 0);
+        }
+    }
+}
+
+#endif // OCIO_UNIT_TEST
@@ -0,0 +1,73 @@
+/*
+Copyright (c) 2003-2010 Sony Pictures Imageworks Inc., et al.
+All Rights Reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Sony Pictures Imageworks nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef INCLUDED_OCIO_BITDEPTHUTILS_H
+#define INCLUDED_OCIO_BITDEPTHUTILS_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+
+OCIO_NAMESPACE_ENTER
+{
+    // Size of a single channel value in memory, for the bit depths that
+    // images may be processed in. The integer depths from 10 to 16 bits
+    // are stored in 16-bit unsigned integers. Returns 0 for unsupported
+    // bit depths (BIT_DEPTH_UNKNOWN, BIT_DEPTH_UINT32).
+    
+    int GetBitDepthChannelSize(BitDepth bitDepth);
+    
+    // The integer value that maps to 1.0 (2^bits-1), or 1.0 for float
+    // bit depths.
+    
+    float GetBitDepthMaxValue(BitDepth bitDepth);
+    
+    // Conversion of half floats to and from float, with round to nearest
+    // even, and preserving Inf / NaN.
+    
+    float HalfToFloat(unsigned short h);
+    unsigned short FloatToHalf(float f);
+    
+    // Convert numValues channel values of the given bit depth to float,
+    // and back. Integer values are normalized to [0,1], and on the way
+    // back clamped to [0,1] (NaN becomes 0) and rounded to the nearest
+    // integer. The buffers must not overlap.
+    //
+    // The converters for a given bit depth produce bit-identical results
+    // at every SIMD level.
+    
+    typedef void (*ChannelToFloatFn)(float * dst, const void * src, long numValues);
+    typedef void (*ChannelFromFloatFn)(void * dst, const float * src, long numValues);
+    
+    // Returns NULL if the bit depth is not supported
+    ChannelToFloatFn GetChannelToFloatFn(BitDepth bitDepth, SIMDLevel level);
+    ChannelFromFloatFn GetChannelFromFloatFn(BitDepth bitDepth, SIMDLevel level);
+}
+OCIO_NAMESPACE_EXIT
+
+#endif
@@ -27,6 +27,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <fstream>
+#include <list>
 #include <sstream>
 #include <tinyxml.h>
 
@@ -340,30 +341,126 @@ OCIO_NAMESPACE_ENTER
     
     namespace
     {
-        std::string GetCDLLocalCacheKey(const std::string & src, const std::string & cccid)
+        // The transforms of one source file, keyed by cccid and by index.
+        // A file holding a single ColorCorrection is stored with an empty
+        // cccid, so that any requested cccid is ignored.
+        struct CDLFileCacheEntry
+        {
+            std::string src;
+            bool srcIsCC;
+            CDLTransformMap transforms;
+            size_t bytes;
+            
+            CDLFileCacheEntry():
+                srcIsCC(false),
+                bytes(0)
+            {}
+        };
+        
+        // Most recently used first. The map points into the list, so that
+        // a hit can move its entry to the front in constant time.
+        typedef std::list<CDLFileCacheEntry> CDLFileCacheList;
+        typedef std::map<std::string, CDLFileCacheList::iterator> CDLFileCacheMap;
+        
+        CDLFileCacheList g_cacheList;
+        CDLFileCacheMap g_cache;
+        size_t g_cacheBytes = 0;
+        long g_cacheHits = 0;
+        long g_cacheMisses = 0;
+        long g_cacheEvictions = 0;
+        Mutex g_cacheMutex;
+        
+        std::string GetCDLLocalCacheKey(int cccindex)
         {
             std::ostringstream os;
-            os << src << " : " << cccid;
+            os << cccindex;
             return os.str();
         }
         
-        std::string GetCDLLocalCacheKey(const char * src,
-                                        int cccindex)
+        // Search for the cccid by name, then by index
+        CDLTransformRcPtr FindCachedCDL(const CDLFileCacheEntry & entry,
+                                        const std::string & cccid_)
         {
+            // If the source file is known to be a pure ColorCorrection
+            // element, null out the cccid so its ignored.
+            std::string cccid = entry.srcIsCC ? "" : cccid_;
+            
+            CDLTransformMap::const_iterator iter = entry.transforms.find(cccid);
+            if(iter != entry.transforms.end())
+            {
+                return iter->second;
+            }
+            
+            int cccindex=0;
+            if(StringToInt(&cccindex, cccid.c_str(), true))
+            {
+                iter = entry.transforms.find(GetCDLLocalCacheKey(cccindex));
+                if(iter != entry.transforms.end())
+                {
+                    return iter->second;
+                }
+            }
+            
             std::ostringstream os;
-            os << src << " : " << cccindex;
-            return os.str();
+            os << "The specified cccid/cccindex '" << cccid;
+            os << "' could not be loaded from the src file '";
+            os << entry.src;
+            os << "'.";
+            throw Exception (os.str().c_str());
         }
         
-        CDLTransformMap g_cache;
-        StringBoolMap g_cacheSrcIsCC;
-        Mutex g_cacheMutex;
+        // You must manually acquire the cache lock before calling this.
+        void TrimCDLTransformFileCacheLocked()
+        {
+            size_t limit = GetCacheMemoryLimit();
+            if(limit == 0) return;
+            
+            while(g_cacheBytes > limit && g_cacheList.size() > 1)
+            {
+                g_cacheBytes -= g_cacheList.back().bytes;
+                g_cache.erase(g_cacheList.back().src);
+                g_cacheList.pop_back();
+                ++g_cacheEvictions;
+            }
+        }
+    }
+    
+    size_t GetCDLTransformMemorySize(const ConstCDLTransformRcPtr & cdl)
+    {
+        // The Impl holds the direction, the sop and sat values, the id,
+        // the description and the xml built on request.
+        return sizeof(CDLTransform) + sizeof(TransformDirection)
+            + 10 * sizeof(float) + 3 * sizeof(std::string)
+            + strlen(cdl->getID()) + strlen(cdl->getDescription());
     }
     
     void ClearCDLTransformFileCache()
     {
         AutoMutex lock(g_cacheMutex);
         g_cache.clear();
+        g_cacheList.clear();
+        g_cacheBytes = 0;
+        g_cacheHits = 0;
+        g_cacheMisses = 0;
+        g_cacheEvictions = 0;
+    }
+    
+    void TrimCDLTransformFileCache()
+    {
+        AutoMutex lock(g_cacheMutex);
+        TrimCDLTransformFileCacheLocked();
+    }
+    
+    void GetCDLTransformFileCacheStats(long & entries, size_t & bytes,
+                                       long & hits, long & misses,
+                                       long & evictions)
+    {
+        AutoMutex lock(g_cacheMutex);
+        entries = (long)g_cache.size();
+        bytes = g_cacheBytes;
+        hits = g_cacheHits;
+        misses = g_cacheMisses;
+        evictions = g_cacheEvictions;
     }
     
     // TODO: Expose functions for introspecting in ccc file
@@ -385,43 +482,19 @@ OCIO_NAMESPACE_ENTER
         // Check cache
         AutoMutex lock(g_cacheMutex);
         
-        // Use g_cacheSrcIsCC as a proxy for if we have loaded this source
-        // file already (in which case it must be in cache, or an error)
+        // A cached source file holds all of its transforms (a missing
+        // cccid is an error)
         
-        StringBoolMap::iterator srcIsCCiter = g_cacheSrcIsCC.find(src);
-        if(srcIsCCiter != g_cacheSrcIsCC.end())
+        CDLFileCacheMap::iterator cacheiter = g_cache.find(src);
+        if(cacheiter != g_cache.end())
         {
-            // If the source file is known to be a pure ColorCorrection element,
-            // null out the cccid so its ignored.
-            if(srcIsCCiter->second) cccid = "";
-            
-            // Search for the cccid by name
-            CDLTransformMap::iterator iter = 
-                g_cache.find(GetCDLLocalCacheKey(src, cccid));
-            if(iter != g_cache.end())
-            {
-                return iter->second;
-            }
-            
-            // Search for cccid by index
-            int cccindex=0;
-            if(StringToInt(&cccindex, cccid.c_str(), true))
-            {
-                iter = g_cache.find(GetCDLLocalCacheKey(src, cccindex));
-                if(iter != g_cache.end())
-                {
-                    return iter->second;
-                }
-            }
-            
-            std::ostringstream os;
-            os << "The specified cccid/cccindex '" << cccid;
-            os << "' could not be loaded from the src file '";
-            os << src;
-            os << "'.";
-            throw Exception (os.str().c_str());
+            ++g_cacheHits;
+            g_cacheList.splice(g_cacheList.begin(),
+                               g_cacheList, cacheiter->second);
+            return FindCachedCDL(*cacheiter->second, cccid);
         }
         
+        ++g_cacheMisses;
         
         // Try to read all ccs from the file, into cache
         std::ifstream istream(src);
@@ -470,6 +543,9 @@ OCIO_NAMESPACE_ENTER
             throw Exception(os.str().c_str());
         }
         
+        CDLFileCacheEntry entry;
+        entry.src = src;
+        
         std::string rootValue = doc.RootElement()->Value();
         if(rootValue == "ColorCorrection")
         {
@@ -477,9 +553,9 @@ OCIO_NAMESPACE_ENTER
             CDLTransformRcPtr cdl = CDLTransform::Create();
             LoadCDL(cdl.get(), doc.RootElement()->ToElement());
             
-            cccid = "";
-            g_cacheSrcIsCC[src] = true;
-            g_cache[GetCDLLocalCacheKey(src, cccid)] = cdl;
+            entry.srcIsCC = true;
+            entry.transforms[""] = cdl;
+            entry.bytes += GetCDLTransformMemorySize(cdl);
         }
         else if(rootValue == "ColorCorrectionCollection")
         {
@@ -498,52 +574,40 @@ OCIO_NAMESPACE_ENTER
                 throw Exception(os.str().c_str());
             }
             
-            g_cacheSrcIsCC[src] = false;
-            
             // Add all by transforms to cache
             // First by index, then by id
             for(unsigned int i=0; i<transformVec.size(); ++i)
             {
-                g_cache[GetCDLLocalCacheKey(src, i)] = transformVec[i];
+                entry.transforms[GetCDLLocalCacheKey(i)] = transformVec[i];
+                entry.bytes += GetCDLTransformMemorySize(transformVec[i]);
             }
             
             for(CDLTransformMap::iterator iter = transformMap.begin();
                 iter != transformMap.end();
                 ++iter)
             {
-                g_cache[GetCDLLocalCacheKey(src, iter->first)] = iter->second;
+                entry.transforms[iter->first] = iter->second;
             }
         }
         
-        // The all transforms should be in the cache.  Look it up, and try
-        // to return it.
+        // Both keys and the map nodes
+        entry.bytes += sizeof(CDLFileCacheEntry) + 2 * entry.src.size();
+        for(CDLTransformMap::iterator iter = entry.transforms.begin();
+            iter != entry.transforms.end();
+            ++iter)
         {
-            // Search for the cccid by name
-            CDLTransformMap::iterator iter = 
-                g_cache.find(GetCDLLocalCacheKey(src, cccid));
-            if(iter != g_cache.end())
-            {
-                return iter->second;
-            }
-            
-            // Search for cccid by index
-            int cccindex=0;
-            if(StringToInt(&cccindex, cccid.c_str(), true))
-            {
-                iter = g_cache.find(GetCDLLocalCacheKey(src, cccindex));
-                if(iter != g_cache.end())
-                {
-                    return iter->second;
-                }
-            }
-            
-            std::ostringstream os;
-            os << "The specified cccid/cccindex '" << cccid;
-            os << "' could not be loaded from the src file '";
-            os << src;
-            os << "'.";
-            throw Exception (os.str().c_str());
+            entry.bytes += sizeof(*iter) + iter->first.size();
         }
+        
+        g_cacheList.push_front(entry);
+        g_cache[entry.src] = g_cacheList.begin();
+        g_cacheBytes += entry.bytes;
+        
+        // The all transforms should be in the cache.  Look it up, and try
+        // to return it.
+        CDLTransformRcPtr cdl = FindCachedCDL(g_cacheList.front(), cccid);
+        TrimCDLTransformFileCacheLocked();
+        return cdl;
     }
     
     void CDLTransform::deleter(CDLTransform* t)
@@ -847,3 +911,76 @@ OCIO_NAMESPACE_ENTER
     }
 }
 OCIO_NAMESPACE_EXIT
+
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef OCIO_UNIT_TEST
+
+namespace OCIO = OCIO_NAMESPACE;
+#include "UnitTest.h"
+
+OIIO_ADD_TEST(CDLTransform, CreateFromFileCache)
+{
+    OCIO::TempDirectory dir("cdltransform");
+    const std::string cccPath = dir.writeFile("grades.ccc",
+        "<ColorCorrectionCollection>\n"
+        "<ColorCorrection id=\"a\"><SOPNode><Slope>1 1 1</Slope>"
+        "<Offset>0 0 0</Offset><Power>1 1 1</Power></SOPNode>"
+        "</ColorCorrection>\n"
+        "<ColorCorrection id=\"b\"><SOPNode><Slope>2 2 2</Slope>"
+        "<Offset>0 0 0</Offset><Power>1 1 1</Power></SOPNode>"
+        "</ColorCorrection>\n"
+        "</ColorCorrectionCollection>\n");
+    const std::string ccPath = dir.writeFile("grade.cc",
+        "<ColorCorrection id=\"c\"><SOPNode><Slope>3 3 3</Slope>"
+        "<Offset>0 0 0</Offset><Power>1 1 1</Power></SOPNode>"
+        "</ColorCorrection>\n");
+    
+    size_t oldLimit = OCIO::GetCacheMemoryLimit();
+    OCIO::SetCacheMemoryLimit(0);
+    OCIO::ClearAllCaches();
+    
+    // By id, then by index
+    OCIO::CDLTransformRcPtr b = OCIO::CDLTransform::CreateFromFile(cccPath.c_str(), "b");
+    float slope[3] = { 0.0f, 0.0f, 0.0f };
+    b->getSlope(slope);
+    OIIO_CHECK_EQUAL(slope[0], 2.0f);
+    OIIO_CHECK_ASSERT(OCIO::CDLTransform::CreateFromFile(cccPath.c_str(), "1") == b);
+    OIIO_CHECK_THOW(OCIO::CDLTransform::CreateFromFile(cccPath.c_str(), "d"),
+                    OCIO::Exception);
+    
+    // The cccid of a single ColorCorrection is ignored
+    OCIO::CDLTransformRcPtr c = OCIO::CDLTransform::CreateFromFile(ccPath.c_str(), "x");
+    c->getSlope(slope);
+    OIIO_CHECK_EQUAL(slope[0], 3.0f);
+    
+    long entries = 0, hits = 0, misses = 0, evictions = 0;
+    size_t bytes = 0;
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_CDL_FILE,
+                        entries, bytes, hits, misses, evictions);
+    OIIO_CHECK_EQUAL(entries, 2);
+    OIIO_CHECK_EQUAL(hits, 2);
+    OIIO_CHECK_EQUAL(misses, 2);
+    OIIO_CHECK_ASSERT(bytes > 0);
+    
+    // The ccc file was used first, so it goes first
+    OCIO::SetCacheMemoryLimit(1);
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_CDL_FILE,
+                        entries, bytes, hits, misses, evictions);
+    OIIO_CHECK_EQUAL(entries, 1);
+    OIIO_CHECK_EQUAL(evictions, 1);
+    
+    OIIO_CHECK_ASSERT(OCIO::CDLTransform::CreateFromFile(ccPath.c_str(), "") == c);
+    OIIO_CHECK_ASSERT(OCIO::CDLTransform::CreateFromFile(cccPath.c_str(), "b") != b);
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_CDL_FILE,
+                        entries, bytes, hits, misses, evictions);
+    OIIO_CHECK_EQUAL(entries, 1);
+    OIIO_CHECK_EQUAL(hits, 3);
+    OIIO_CHECK_EQUAL(misses, 3);
+    OIIO_CHECK_EQUAL(evictions, 2);
+    
+    OCIO::SetCacheMemoryLimit(oldLimit);
+    OCIO::ClearAllCaches();
+}
+
+#endif // OCIO_UNIT_TEST
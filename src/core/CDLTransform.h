@@ -43,6 +43,18 @@ OCIO_NAMESPACE_ENTER
     
     void ClearCDLTransformFileCache();
     
+    // Evicts the least recently used source files beyond the cache memory
+    // limit.
+    void TrimCDLTransformFileCache();
+    
+    // The counters reported by GetCacheStats(CACHE_TYPE_CDL_FILE)
+    void GetCDLTransformFileCacheStats(long & entries, size_t & bytes,
+                                       long & hits, long & misses,
+                                       long & evictions);
+    
+    // An estimate of the memory held by a transform
+    size_t GetCDLTransformMemorySize(const ConstCDLTransformRcPtr & cdl);
+    
     void LoadCDL(CDLTransform * cdl, const char * xml);
     void LoadCDL(CDLTransform * cdl, TiXmlElement * root);
     
@@ -0,0 +1,165 @@
+/*
+Copyright (c) 2003-2010 Sony Pictures Imageworks Inc., et al.
+All Rights Reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Sony Pictures Imageworks nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+#include "Mutex.h"
+#include "SSE.h"
+
+#if defined(_MSC_VER) && defined(OCIO_USE_AVX)
+#include <intrin.h>
+#endif
+
+OCIO_NAMESPACE_ENTER
+{
+    namespace
+    {
+        const char * OCIO_SIMD_LEVEL_ENVVAR = "OCIO_SIMD_LEVEL";
+        
+        Mutex g_simdmutex;
+        SIMDLevel g_supportedLevel = SIMD_LEVEL_NONE;
+        SIMDLevel g_simdLevel = SIMD_LEVEL_NONE;
+        bool g_initialized = false;
+        
+        SIMDLevel DetectSIMDLevel()
+        {
+#if !defined(USE_SSE)
+            return SIMD_LEVEL_NONE;
+#elif !defined(OCIO_USE_AVX)
+            return SIMD_LEVEL_SSE2;
+#elif defined(_MSC_VER)
+            int info[4];
+            __cpuid(info, 0);
+            int maxLeaf = info[0];
+            
+            __cpuid(info, 1);
+            bool osxsave = (info[2] & (1 << 27)) != 0;
+            bool avx = (info[2] & (1 << 28)) != 0;
+            bool f16c = (info[2] & (1 << 29)) != 0;
+            if(!osxsave || !avx || !f16c || maxLeaf < 7) return SIMD_LEVEL_SSE2;
+            
+            // The OS must save the ymm (and zmm) registers on context switch
+            unsigned __int64 xcr0 = _xgetbv(0);
+            if((xcr0 & 0x6) != 0x6) return SIMD_LEVEL_SSE2;
+            
+            __cpuidex(info, 7, 0);
+            bool avx2 = (info[1] & (1 << 5)) != 0;
+            bool avx512f = (info[1] & (1 << 16)) != 0;
+            if(!avx2) return SIMD_LEVEL_SSE2;
+            if(avx512f && (xcr0 & 0xe6) == 0xe6) return SIMD_LEVEL_AVX512;
+            return SIMD_LEVEL_AVX2;
+#else
+            // These also check for OS support of the wider registers.
+            __builtin_cpu_init();
+            if(__builtin_cpu_supports("avx512f") &&
+               __builtin_cpu_supports("f16c")) return SIMD_LEVEL_AVX512;
+            if(__builtin_cpu_supports("avx2") &&
+               __builtin_cpu_supports("f16c")) return SIMD_LEVEL_AVX2;
+            return SIMD_LEVEL_SSE2;
+#endif
+        }
+        
+        // You must manually acquire the simd mutex before calling this.
+        // This will set g_supportedLevel, g_simdLevel, g_initialized
+        void InitSIMDLevel()
+        {
+            if(g_initialized) return;
+            
+            g_initialized = true;
+            g_supportedLevel = DetectSIMDLevel();
+            g_simdLevel = g_supportedLevel;
+            
+            char* levelstr = std::getenv(OCIO_SIMD_LEVEL_ENVVAR);
+            if(levelstr)
+            {
+                SIMDLevel level = SIMD_LEVEL_NONE;
+                if(SIMDLevelFromString(&level, levelstr))
+                {
+                    g_simdLevel = std::min(level, g_supportedLevel);
+                }
+                else
+                {
+                    std::cerr << "[OpenColorIO Warning]: Invalid $OCIO_SIMD_LEVEL specified. ";
+                    std::cerr << "Options: none, sse2, avx2, avx512" << std::endl;
+                }
+            }
+        }
+    }
+    
+    const char * SIMDLevelToString(SIMDLevel level)
+    {
+        if(level == SIMD_LEVEL_SSE2) return "sse2";
+        else if(level == SIMD_LEVEL_AVX2) return "avx2";
+        else if(level == SIMD_LEVEL_AVX512) return "avx512";
+        return "none";
+    }
+    
+    bool SIMDLevelFromString(SIMDLevel * level, const char * s)
+    {
+        if(!level || !s) return false;
+        
+        if(strcmp(s, "none") == 0) *level = SIMD_LEVEL_NONE;
+        else if(strcmp(s, "sse2") == 0) *level = SIMD_LEVEL_SSE2;
+        else if(strcmp(s, "avx2") == 0) *level = SIMD_LEVEL_AVX2;
+        else if(strcmp(s, "avx512") == 0) *level = SIMD_LEVEL_AVX512;
+        else return false;
+        
+        return true;
+    }
+    
+    SIMDLevel GetSupportedSIMDLevel()
+    {
+        AutoMutex lock(g_simdmutex);
+        InitSIMDLevel();
+        
+        return g_supportedLevel;
+    }
+    
+    SIMDLevel GetSIMDLevel()
+    {
+        AutoMutex lock(g_simdmutex);
+        InitSIMDLevel();
+        
+        return g_simdLevel;
+    }
+    
+    void SetSIMDLevel(SIMDLevel level)
+    {
+        AutoMutex lock(g_simdmutex);
+        InitSIMDLevel();
+        
+        g_simdLevel = std::min(level, g_supportedLevel);
+    }
+}
+OCIO_NAMESPACE_EXIT
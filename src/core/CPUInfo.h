@@ -0,0 +1,87 @@
+/*
+Copyright (c) 2003-2010 Sony Pictures Imageworks Inc., et al.
+All Rights Reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Sony Pictures Imageworks nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef INCLUDED_OCIO_CPUINFO_H
+#define INCLUDED_OCIO_CPUINFO_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+OCIO_NAMESPACE_ENTER
+{
+    // Instruction sets that ops may have specialized kernels for, in
+    // increasing order. Kernels are selected at runtime (typically when an
+    // op is finalized), so a single binary runs at full speed on older and
+    // newer hardware alike.
+    //
+    // Kernels give the same bits as the scalar code at every level (the
+    // tests compare them with memcmp), so that results do not depend on
+    // the machine. They exist for:
+    //   - the bit depth conversions of packed images (BitDepthUtils)
+    //   - the matrix and offset ops (MatrixOffsetOp)
+    //   - forward 1D luts, nearest and linear (Lut1DOp)
+    //   - 3D luts, linear and tetrahedral (Lut3DOp)
+    // The other ops are deliberately left scalar:
+    //   - log and exponent (LogOps, ExponentOps) call logf and powf, which
+    //     no vectorized approximation reproduces exactly. Processors that
+    //     may trade exactness for speed should bake them (see
+    //     Processor::getBakedProcessor) into a lut, which is vectorized.
+    //   - inverse 1D luts search the lut per channel, with branches and
+    //     gathers that do not pay off in these instruction sets.
+    //   - the truelight op, which calls into the truelight library.
+    
+    enum SIMDLevel
+    {
+        SIMD_LEVEL_NONE = 0,   // Scalar reference code
+        SIMD_LEVEL_SSE2,
+        SIMD_LEVEL_AVX2,       // Also implies F16C
+        SIMD_LEVEL_AVX512
+    };
+    
+    const char * SIMDLevelToString(SIMDLevel level);
+    
+    // Returns false if the string is not a valid level.
+    bool SIMDLevelFromString(SIMDLevel * level, const char * s);
+    
+    // The highest level supported by both this build and the cpu (as
+    // reported by cpuid, including OS support for the wider registers).
+    SIMDLevel GetSupportedSIMDLevel();
+    
+    // The level new kernels should be selected for. This is the supported
+    // level, unless lowered with the OCIO_SIMD_LEVEL environment variable
+    // or SetSIMDLevel.
+    SIMDLevel GetSIMDLevel();
+    
+    // Force a specific level (clamped to the supported level), e.g. to
+    // compare the kernels against the scalar reference in tests.
+    // Only ops finalized after this call are affected.
+    void SetSIMDLevel(SIMDLevel level);
+}
+OCIO_NAMESPACE_EXIT
+
+#endif
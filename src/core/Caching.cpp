@@ -26,14 +26,125 @@ THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "CDLTransform.h"
 #include "PathUtils.h"
 #include "FileTransform.h"
+#include "Lut3DOp.h"
+#include "Mutex.h"
+#include "ParseUtils.h"
+#include "Processor.h"
+#include "ProcessorCache.h"
 
 OCIO_NAMESPACE_ENTER
 {
+    namespace
+    {
+        const char * OCIO_CACHE_MEMORY_LIMIT_ENVVAR = "OCIO_CACHE_MEMORY_LIMIT";
+        const size_t OCIO_CACHE_MEGABYTE = 1024 * 1024;
+        const size_t OCIO_DEFAULT_CACHE_MEMORY_LIMIT = 1024 * OCIO_CACHE_MEGABYTE;
+        
+        Mutex g_cacheMemoryLimitLock;
+        size_t g_cacheMemoryLimit = OCIO_DEFAULT_CACHE_MEMORY_LIMIT;
+        bool g_initialized = false;
+        bool g_cacheMemoryLimitOverride = false;
+        
+        // You must manually acquire the cache memory limit lock before
+        // calling this. This will set g_cacheMemoryLimit, g_initialized,
+        // g_cacheMemoryLimitOverride
+        void InitCacheMemoryLimit()
+        {
+            if(g_initialized) return;
+            
+            g_initialized = true;
+            
+            char* limitstr = std::getenv(OCIO_CACHE_MEMORY_LIMIT_ENVVAR);
+            if(limitstr)
+            {
+                int megabytes = 0;
+                if(StringToInt(&megabytes, limitstr, true) && megabytes >= 0)
+                {
+                    g_cacheMemoryLimitOverride = true;
+                    g_cacheMemoryLimit = (size_t)megabytes * OCIO_CACHE_MEGABYTE;
+                }
+                else
+                {
+                    std::cerr << "[OpenColorIO Warning]: Invalid $OCIO_CACHE_MEMORY_LIMIT specified. ";
+                    std::cerr << "Options: 0 (unlimited), or a positive number of megabytes." << std::endl;
+                }
+            }
+        }
+    }
+    
+    size_t GetCacheMemoryLimit()
+    {
+        AutoMutex lock(g_cacheMemoryLimitLock);
+        InitCacheMemoryLimit();
+        
+        return g_cacheMemoryLimit;
+    }
+    
+    void SetCacheMemoryLimit(size_t bytes)
+    {
+        {
+            AutoMutex lock(g_cacheMemoryLimitLock);
+            InitCacheMemoryLimit();
+            
+            // As with the logging level, calls to SetCacheMemoryLimit are
+            // ignored if OCIO_CACHE_MEMORY_LIMIT is specified.
+            
+            if(g_cacheMemoryLimitOverride) return;
+            g_cacheMemoryLimit = bytes;
+        }
+        
+        // The caches query the limit with their own lock held, so they
+        // must be trimmed after releasing ours.
+        TrimPathCaches();
+        TrimFileTransformCaches();
+        TrimCDLTransformFileCache();
+        TrimInverseLut3DCache();
+    }
+    
+    void GetCacheStats(CacheType type,
+                       long & entries, size_t & bytes,
+                       long & hits, long & misses,
+                       long & evictions)
+    {
+        switch(type)
+        {
+        case CACHE_TYPE_FILE:
+            GetFileTransformCacheStats(entries, bytes, hits, misses, evictions);
+            break;
+        case CACHE_TYPE_FILE_HASH:
+            GetPathCacheStats(entries, bytes, hits, misses, evictions);
+            break;
+        case CACHE_TYPE_CDL_FILE:
+            GetCDLTransformFileCacheStats(entries, bytes, hits, misses, evictions);
+            break;
+        case CACHE_TYPE_PROCESSOR:
+            GetProcessorCacheStats(entries, bytes, hits, misses, evictions);
+            break;
+        case CACHE_TYPE_GPU_SHADER:
+            GetGpuShaderCacheStats(entries, bytes, hits, misses, evictions);
+            break;
+        case CACHE_TYPE_INVERSE_LUT3D:
+            GetInverseLut3DCacheStats(entries, bytes, hits, misses, evictions);
+            break;
+        default:
+        {
+            std::ostringstream os;
+            os << "Cannot get the stats of unknown cache type ";
+            os << (int)type << ".";
+            throw Exception(os.str().c_str());
+        }
+        }
+    }
+    
     // TODO: Processors which the user hangs onto have local caches.
     // Should these be cleared?
     
@@ -42,6 +153,9 @@ OCIO_NAMESPACE_ENTER
         ClearPathCaches();
         ClearFileTransformCaches();
         ClearCDLTransformFileCache();
+        ClearInverseLut3DCache();
+        ClearProcessorCache();
+        ClearGpuShaderCacheStats();
     }
 }
 OCIO_NAMESPACE_EXIT
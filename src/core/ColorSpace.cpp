@@ -253,11 +253,11 @@ OCIO_NAMESPACE_ENTER
         os << "family=" << cs.getFamily() << ", ";
         os << "equalityGroup=" << cs.getEqualityGroup() << ", ";
         os << "bitDepth=" << BitDepthToString(cs.getBitDepth()) << ", ";
-        os << "isData=" << BoolToString(cs.isData());
+        os << "isData=" << BoolToString(cs.isData()) << ", ";
+        os << "allocation=" << AllocationToString(cs.getAllocation());
         if (numVars)
         {
-            os << ", allocation=" << AllocationToString(cs.getAllocation()) << ", ";
-            os << "vars=" << vars[0];
+            os << ", vars=" << vars[0];
             for (int i = 1; i < numVars; ++i)
             {
                 os << " " << vars[i];
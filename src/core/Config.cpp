@@ -37,6 +37,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "CPUInfo.h"
 #include "HashUtils.h"
 #include "Logging.h"
 #include "LookParse.h"
@@ -46,7 +47,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "OpBuilders.h"
 #include "PathUtils.h"
 #include "ParseUtils.h"
+#include "Prefetch.h"
 #include "Processor.h"
+#include "ProcessorCache.h"
 #include "PrivateTypes.h"
 #include "pystring/pystring.h"
 #include "OCIOYaml.h"
@@ -253,7 +256,7 @@ OCIO_NAMESPACE_ENTER
         mutable Sanity sanity_;
         mutable std::string sanitytext_;
         
-        mutable Mutex cacheidMutex_;
+        mutable RWLock cacheidLock_;
         mutable StringMap cacheids_;
         mutable std::string cacheidnocontext_;
         
@@ -327,7 +330,7 @@ OCIO_NAMESPACE_ENTER
         
         // Any time you modify the state of the config, you must call this
         // to reset internal cache states.  You also should do this in a
-        // thread safe manner by acquiring the cacheidMutex_;
+        // thread safe manner by acquiring the cacheidLock_ for writing;
         void resetCacheIDs();
         
         // Get all internal transforms (to generate cacheIDs, validation, etc).
@@ -663,7 +666,7 @@ OCIO_NAMESPACE_ENTER
     {
         getImpl()->description_ = description;
         
-        AutoMutex lock(getImpl()->cacheidMutex_);
+        AutoWriteLock lock(getImpl()->cacheidLock_);
         getImpl()->resetCacheIDs();
     }
     
@@ -688,7 +691,7 @@ OCIO_NAMESPACE_ENTER
             if(iter != getImpl()->env_.end()) getImpl()->env_.erase(iter);
         }
         
-        AutoMutex lock(getImpl()->cacheidMutex_);
+        AutoWriteLock lock(getImpl()->cacheidLock_);
         getImpl()->resetCacheIDs();
     }
     
@@ -716,7 +719,7 @@ OCIO_NAMESPACE_ENTER
         getImpl()->env_.clear();
         getImpl()->context_->clearStringVars();
         
-        AutoMutex lock(getImpl()->cacheidMutex_);
+        AutoWriteLock lock(getImpl()->cacheidLock_);
         getImpl()->resetCacheIDs();
     }
     
@@ -724,7 +727,7 @@ OCIO_NAMESPACE_ENTER
     {
         getImpl()->context_->setEnvironmentMode(mode);
         
-        AutoMutex lock(getImpl()->cacheidMutex_);
+        AutoWriteLock lock(getImpl()->cacheidLock_);
         getImpl()->resetCacheIDs();
     }
     
@@ -737,7 +740,7 @@ OCIO_NAMESPACE_ENTER
     {
         getImpl()->context_->loadEnvironment();
         
-        AutoMutex lock(getImpl()->cacheidMutex_);
+        AutoWriteLock lock(getImpl()->cacheidLock_);
         getImpl()->resetCacheIDs();
     }
     
@@ -750,7 +753,7 @@ OCIO_NAMESPACE_ENTER
     {
         getImpl()->context_->setSearchPath(path);
         
-        AutoMutex lock(getImpl()->cacheidMutex_);
+        AutoWriteLock lock(getImpl()->cacheidLock_);
         getImpl()->resetCacheIDs();
     }
     
@@ -763,7 +766,7 @@ OCIO_NAMESPACE_ENTER
     {
         getImpl()->context_->setWorkingDir(dirname);
         
-        AutoMutex lock(getImpl()->cacheidMutex_);
+        AutoWriteLock lock(getImpl()->cacheidLock_);
         getImpl()->resetCacheIDs();
     }
     
@@ -847,7 +850,7 @@ OCIO_NAMESPACE_ENTER
             getImpl()->colorspaces_.push_back( cs );
         }
         
-        AutoMutex lock(getImpl()->cacheidMutex_);
+        AutoWriteLock lock(getImpl()->cacheidLock_);
         getImpl()->resetCacheIDs();
     }
     
@@ -932,7 +935,7 @@ OCIO_NAMESPACE_ENTER
     {
         getImpl()->strictParsing_ = enabled;
         
-        AutoMutex lock(getImpl()->cacheidMutex_);
+        AutoWriteLock lock(getImpl()->cacheidLock_);
         getImpl()->resetCacheIDs();
     }
     
@@ -954,7 +957,7 @@ OCIO_NAMESPACE_ENTER
             }
         }
         
-        AutoMutex lock(getImpl()->cacheidMutex_);
+        AutoWriteLock lock(getImpl()->cacheidLock_);
         getImpl()->resetCacheIDs();
     }
     
@@ -1190,7 +1193,7 @@ OCIO_NAMESPACE_ENTER
                    display, view, colorSpaceName, lookName);
         getImpl()->displayCache_.clear();
         
-        AutoMutex lock(getImpl()->cacheidMutex_);
+        AutoWriteLock lock(getImpl()->cacheidLock_);
         getImpl()->resetCacheIDs();
     }
     
@@ -1199,7 +1202,7 @@ OCIO_NAMESPACE_ENTER
         getImpl()->displays_.clear();
         getImpl()->displayCache_.clear();
         
-        AutoMutex lock(getImpl()->cacheidMutex_);
+        AutoWriteLock lock(getImpl()->cacheidLock_);
         getImpl()->resetCacheIDs();
     }
     
@@ -1210,7 +1213,7 @@ OCIO_NAMESPACE_ENTER
         
         getImpl()->displayCache_.clear();
         
-        AutoMutex lock(getImpl()->cacheidMutex_);
+        AutoWriteLock lock(getImpl()->cacheidLock_);
         getImpl()->resetCacheIDs();
     }
 
@@ -1227,7 +1230,7 @@ OCIO_NAMESPACE_ENTER
         
         getImpl()->displayCache_.clear();
         
-        AutoMutex lock(getImpl()->cacheidMutex_);
+        AutoWriteLock lock(getImpl()->cacheidLock_);
         getImpl()->resetCacheIDs();
     }
 
@@ -1249,7 +1252,7 @@ OCIO_NAMESPACE_ENTER
     {
         memcpy(&getImpl()->defaultLumaCoefs_[0], c3, 3*sizeof(float));
         
-        AutoMutex lock(getImpl()->cacheidMutex_);
+        AutoWriteLock lock(getImpl()->cacheidLock_);
         getImpl()->resetCacheIDs();
     }
     
@@ -1312,7 +1315,7 @@ OCIO_NAMESPACE_ENTER
         // Otherwise, add it
         getImpl()->looksList_.push_back(look->createEditableCopy());
         
-        AutoMutex lock(getImpl()->cacheidMutex_);
+        AutoWriteLock lock(getImpl()->cacheidLock_);
         getImpl()->resetCacheIDs();
     }
     
@@ -1320,13 +1323,37 @@ OCIO_NAMESPACE_ENTER
     {
         getImpl()->looksList_.clear();
         
-        AutoMutex lock(getImpl()->cacheidMutex_);
+        AutoWriteLock lock(getImpl()->cacheidLock_);
         getImpl()->resetCacheIDs();
     }
     
     ///////////////////////////////////////////////////////////////////////////
     
-    
+    namespace
+    {
+        // The key of a processor in the processor cache, from a description
+        // of what it is built from. The config cache id also covers the
+        // context (search path, environment, ...) and the files referenced
+        // by the config. The SIMD level the kernels are selected for at
+        // finalize is part of it too, so that forcing another level never
+        // returns a processor with kernels of the previous one.
+        
+        std::string GetProcessorCacheKey(const Config & config,
+                                         const ConstContextRcPtr & context,
+                                         const std::string & description)
+        {
+            std::string fullstr = config.getCacheID(context);
+            fullstr += " ";
+            fullstr += SIMDLevelToString(GetSIMDLevel());
+            fullstr += " ";
+            fullstr += description;
+            return CacheIDHash(fullstr.c_str(), (int)fullstr.size());
+        }
+        
+        // Floats are written with enough digits to round trip, so that
+        // transforms with different values never share a description.
+        const int PROCESSOR_CACHE_KEY_PRECISION = 9;
+    }
     
     ConstProcessorRcPtr Config::getProcessor(const ConstColorSpaceRcPtr & src,
                                              const ConstColorSpaceRcPtr & dst) const
@@ -1348,9 +1375,19 @@ OCIO_NAMESPACE_ENTER
             throw Exception("Config::GetProcessor failed. Destination colorspace is null.");
         }
         
+        std::ostringstream description;
+        description.precision(PROCESSOR_CACHE_KEY_PRECISION);
+        description << *src << " --> " << *dst;
+        std::string key = GetProcessorCacheKey(*this, context, description.str());
+        
+        ConstProcessorRcPtr cachedProcessor = GetCachedProcessor(key);
+        if(cachedProcessor) return cachedProcessor;
+        
         ProcessorRcPtr processor = Processor::Create();
         processor->getImpl()->addColorSpaceConversion(*this, context, src, dst);
         processor->getImpl()->finalize();
+        
+        AddCachedProcessor(key, processor);
         return processor;
     }
     
@@ -1403,12 +1440,73 @@ OCIO_NAMESPACE_ENTER
                                              const ConstTransformRcPtr& transform,
                                              TransformDirection direction) const
     {
+        // A null transform is valid, and corresponds to a no-op.
+        std::ostringstream description;
+        description.precision(PROCESSOR_CACHE_KEY_PRECISION);
+        if(transform) description << *transform << " ";
+        description << TransformDirectionToString(direction);
+        std::string key = GetProcessorCacheKey(*this, context, description.str());
+        
+        ConstProcessorRcPtr cachedProcessor = GetCachedProcessor(key);
+        if(cachedProcessor) return cachedProcessor;
+        
         ProcessorRcPtr processor = Processor::Create();
         processor->getImpl()->addTransform(*this, context, transform, direction);
         processor->getImpl()->finalize();
+        
+        AddCachedProcessor(key, processor);
         return processor;
     }
     
+    ///////////////////////////////////////////////////////////////////////////
+    //  Prefetch
+    
+    ConstPrefetchRcPtr Config::prefetch() const
+    {
+        return prefetch(getCurrentContext());
+    }
+    
+    ConstPrefetchRcPtr Config::prefetch(const ConstContextRcPtr & context) const
+    {
+        if(!context)
+        {
+            throw Exception("Config::prefetch requires a context.");
+        }
+        
+        ConstTransformVec allTransforms;
+        getImpl()->getAllIntenalTransforms(allTransforms);
+        
+        std::set<std::string> files;
+        for(unsigned int i=0; i<allTransforms.size(); ++i)
+        {
+            GetFileReferences(files, allTransforms[i]);
+        }
+        
+        // Resolve here, as the context only lives for this call. Distinct
+        // references may well resolve to the same file.
+        std::set<std::string> filepaths;
+        std::vector<std::string> errors;
+        for(std::set<std::string>::iterator iter = files.begin();
+            iter != files.end(); ++iter)
+        {
+            if(iter->empty()) continue;
+            
+            try
+            {
+                filepaths.insert(context->resolveFileLocation(iter->c_str()));
+            }
+            catch(std::exception & e)
+            {
+                errors.push_back(e.what());
+            }
+        }
+        
+        PrefetchRcPtr prefetch(new Prefetch(), &Prefetch::deleter);
+        prefetch->getImpl()->start(
+            std::vector<std::string>(filepaths.begin(), filepaths.end()), errors);
+        return prefetch;
+    }
+    
     std::ostream& operator<< (std::ostream& os, const Config& config)
     {
         config.serialize(os);
@@ -1425,12 +1523,23 @@ OCIO_NAMESPACE_ENTER
     
     const char * Config::getCacheID(const ConstContextRcPtr & context) const
     {
-        AutoMutex lock(getImpl()->cacheidMutex_);
-        
         // A null context will use the empty cacheid
         std::string contextcacheid = "";
         if(context) contextcacheid = context->getCacheID();
         
+        // Already computed cacheids only need a read lock
+        {
+            AutoReadLock lock(getImpl()->cacheidLock_);
+            StringMap::const_iterator cacheiditer = getImpl()->cacheids_.find(contextcacheid);
+            if(cacheiditer != getImpl()->cacheids_.end())
+            {
+                return cacheiditer->second.c_str();
+            }
+        }
+        
+        AutoWriteLock lock(getImpl()->cacheidLock_);
+        
+        // Another thread may have computed it meanwhile
         StringMap::const_iterator cacheiditer = getImpl()->cacheids_.find(contextcacheid);
         if(cacheiditer != getImpl()->cacheids_.end())
         {
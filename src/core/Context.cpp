@@ -27,9 +27,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <map>
+#include <set>
 #include <string>
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
 
@@ -44,6 +46,7 @@ OCIO_NAMESPACE_ENTER
 namespace
 {
     typedef std::map< std::string, std::string> StringMap;
+    typedef std::map< std::string, std::set<std::string> > DirectoryIndex;
     
     void GetAbsoluteSearchPaths(std::vector<std::string> & searchpaths,
                                 const std::string & pathString,
@@ -59,12 +62,22 @@ namespace
         EnvironmentMode envmode_;
         EnvMap envMap_;
         
+        bool searchPathIndex_;
+        
         mutable std::string cacheID_;
         mutable StringMap resultsCache_;
-        mutable Mutex resultsCacheMutex_;
+        // The absolute search paths, prepped on first use
+        mutable std::vector<std::string> searchPaths_;
+        mutable bool searchPathsReady_;
+        // The entries of each directory looked into, when searchPathIndex_
+        mutable DirectoryIndex directoryIndex_;
+        // Lookups of cached results only take a read lock
+        mutable RWLock resultsCacheLock_;
         
         Impl() :
-            envmode_(ENV_ENVIRONMENT_LOAD_PREDEFINED)
+            envmode_(ENV_ENVIRONMENT_LOAD_PREDEFINED),
+            searchPathIndex_(false),
+            searchPathsReady_(false)
         {
         }
         
@@ -75,18 +88,70 @@ namespace
         
         Impl& operator= (const Impl & rhs)
         {
-            AutoMutex lock1(resultsCacheMutex_);
-            AutoMutex lock2(rhs.resultsCacheMutex_);
+            AutoWriteLock lock1(resultsCacheLock_);
+            AutoReadLock lock2(rhs.resultsCacheLock_);
             
             searchPath_ = rhs.searchPath_;
             workingDir_ = rhs.workingDir_;
             envMap_ = rhs.envMap_;
+            searchPathIndex_ = rhs.searchPathIndex_;
             
             resultsCache_ = rhs.resultsCache_;
             cacheID_ = rhs.cacheID_;
+            searchPaths_ = rhs.searchPaths_;
+            searchPathsReady_ = rhs.searchPathsReady_;
+            directoryIndex_ = rhs.directoryIndex_;
             
             return *this;
         }
+        
+        // Any time the search path, working dir or env change, call this
+        // with the resultsCacheLock_ held for writing.
+        void resetCaches()
+        {
+            resultsCache_.clear();
+            cacheID_ = "";
+            searchPaths_.clear();
+            searchPathsReady_ = false;
+        }
+        
+        // You must hold the resultsCacheLock_ for writing to call these.
+        
+        const std::vector<std::string> & getSearchPaths() const
+        {
+            if(!searchPathsReady_)
+            {
+                searchPaths_.clear();
+                GetAbsoluteSearchPaths(searchPaths_, searchPath_,
+                                       workingDir_, envMap_);
+                searchPathsReady_ = true;
+            }
+            return searchPaths_;
+        }
+        
+        bool fileExists(const std::string & filepath) const
+        {
+            if(!searchPathIndex_) return FileExists(filepath);
+            
+            const std::string dirname = pystring::os::path::dirname(filepath);
+            DirectoryIndex::iterator iter = directoryIndex_.find(dirname);
+            if(iter == directoryIndex_.end())
+            {
+                iter = directoryIndex_.insert(
+                    std::make_pair(dirname, std::set<std::string>())).first;
+                // A directory that cannot be read has no entries
+                GetDirectoryEntries(iter->second,
+                                    dirname.empty() ? std::string(".") : dirname);
+            }
+            
+#ifdef WINDOWS
+            const std::string basename =
+                pystring::lower(pystring::os::path::basename(filepath));
+#else
+            const std::string basename = pystring::os::path::basename(filepath);
+#endif
+            return iter->second.find(basename) != iter->second.end();
+        }
     };
     
     
@@ -126,7 +191,15 @@ namespace
     
     const char * Context::getCacheID() const
     {
-        AutoMutex lock(getImpl()->resultsCacheMutex_);
+        {
+            AutoReadLock lock(getImpl()->resultsCacheLock_);
+            if(!getImpl()->cacheID_.empty())
+            {
+                return getImpl()->cacheID_.c_str();
+            }
+        }
+        
+        AutoWriteLock lock(getImpl()->resultsCacheLock_);
         
         if(getImpl()->cacheID_.empty())
         {
@@ -134,6 +207,8 @@ namespace
             cacheid << "Search Path " << getImpl()->searchPath_ << " ";
             cacheid << "Working Dir " << getImpl()->workingDir_ << " ";
             cacheid << "Environment Mode " << getImpl()->envmode_ << " ";
+            // Only when enabled, so that the ids of other contexts are unchanged
+            if(getImpl()->searchPathIndex_) cacheid << "Search Path Index ";
             
             for (EnvMap::const_iterator iter = getImpl()->envMap_.begin(),
                  end = getImpl()->envMap_.end();
@@ -151,11 +226,10 @@ namespace
     
     void Context::setSearchPath(const char * path)
     {
-        AutoMutex lock(getImpl()->resultsCacheMutex_);
+        AutoWriteLock lock(getImpl()->resultsCacheLock_);
         
         getImpl()->searchPath_ = path;
-        getImpl()->resultsCache_.clear();
-        getImpl()->cacheID_ = "";
+        getImpl()->resetCaches();
     }
     
     const char * Context::getSearchPath() const
@@ -165,11 +239,10 @@ namespace
     
     void Context::setWorkingDir(const char * dirname)
     {
-        AutoMutex lock(getImpl()->resultsCacheMutex_);
+        AutoWriteLock lock(getImpl()->resultsCacheLock_);
         
         getImpl()->workingDir_ = dirname;
-        getImpl()->resultsCache_.clear();
-        getImpl()->cacheID_ = "";
+        getImpl()->resetCaches();
     }
     
     const char * Context::getWorkingDir() const
@@ -179,12 +252,10 @@ namespace
     
     void Context::setEnvironmentMode(EnvironmentMode mode)
     {
-        AutoMutex lock(getImpl()->resultsCacheMutex_);
+        AutoWriteLock lock(getImpl()->resultsCacheLock_);
         
         getImpl()->envmode_ = mode;
-        
-        getImpl()->resultsCache_.clear();
-        getImpl()->cacheID_ = "";
+        getImpl()->resetCaches();
     }
     
     EnvironmentMode Context::getEnvironmentMode() const
@@ -197,16 +268,15 @@ namespace
         bool update = (getImpl()->envmode_ == ENV_ENVIRONMENT_LOAD_ALL) ? false : true;
         LoadEnvironment(getImpl()->envMap_, update);
         
-        AutoMutex lock(getImpl()->resultsCacheMutex_);
-        getImpl()->resultsCache_.clear();
-        getImpl()->cacheID_ = "";
+        AutoWriteLock lock(getImpl()->resultsCacheLock_);
+        getImpl()->resetCaches();
     }
     
     void Context::setStringVar(const char * name, const char * value)
     {
         if(!name) return;
         
-        AutoMutex lock(getImpl()->resultsCacheMutex_);
+        AutoWriteLock lock(getImpl()->resultsCacheLock_);
         
         // Set the value if specified
         if(value)
@@ -223,8 +293,7 @@ namespace
             }
         }
         
-        getImpl()->resultsCache_.clear();
-        getImpl()->cacheID_ = "";
+        getImpl()->resetCaches();
     }
     
     const char * Context::getStringVar(const char * name) const
@@ -258,18 +327,30 @@ namespace
     
     void Context::clearStringVars()
     {
+        AutoWriteLock lock(getImpl()->resultsCacheLock_);
+        
         getImpl()->envMap_.clear();
+        getImpl()->resetCaches();
     }
     
     const char * Context::resolveStringVar(const char * val) const
     {
-        AutoMutex lock(getImpl()->resultsCacheMutex_);
-        
         if(!val || !*val)
         {
             return "";
         }
         
+        {
+            AutoReadLock lock(getImpl()->resultsCacheLock_);
+            StringMap::const_iterator iter = getImpl()->resultsCache_.find(val);
+            if(iter != getImpl()->resultsCache_.end())
+            {
+                return iter->second.c_str();
+            }
+        }
+        
+        AutoWriteLock lock(getImpl()->resultsCacheLock_);
+        
         StringMap::const_iterator iter = getImpl()->resultsCache_.find(val);
         if(iter != getImpl()->resultsCache_.end())
         {
@@ -286,13 +367,23 @@ namespace
     
     const char * Context::resolveFileLocation(const char * filename) const
     {
-        AutoMutex lock(getImpl()->resultsCacheMutex_);
-        
         if(!filename || !*filename)
         {
             return "";
         }
         
+        {
+            AutoReadLock lock(getImpl()->resultsCacheLock_);
+            StringMap::const_iterator iter = getImpl()->resultsCache_.find(filename);
+            if(iter != getImpl()->resultsCache_.end())
+            {
+                return iter->second.c_str();
+            }
+        }
+        
+        AutoWriteLock lock(getImpl()->resultsCacheLock_);
+        
+        // Another thread may have resolved it meanwhile
         StringMap::const_iterator iter = getImpl()->resultsCache_.find(filename);
         if(iter != getImpl()->resultsCache_.end())
         {
@@ -304,7 +395,7 @@ namespace
         std::string expandedfullpath = EnvExpand(filename, getImpl()->envMap_);
         if(pystring::os::path::isabs(expandedfullpath))
         {
-            if(FileExists(expandedfullpath))
+            if(getImpl()->fileExists(expandedfullpath))
             {
                 getImpl()->resultsCache_[filename] = expandedfullpath;
                 return getImpl()->resultsCache_[filename].c_str();
@@ -317,13 +408,7 @@ namespace
         }
         
         // Load a relative file reference
-        // Prep the search path vector
-        // TODO: Cache this prepped vector?
-        std::vector<std::string> searchpaths;
-        GetAbsoluteSearchPaths(searchpaths,
-                               getImpl()->searchPath_,
-                               getImpl()->workingDir_,
-                               getImpl()->envMap_);
+        const std::vector<std::string> & searchpaths = getImpl()->getSearchPaths();
         
         // Loop over each path, and try to find the file
         std::ostringstream errortext;
@@ -336,7 +421,7 @@ namespace
             // Make an attempt to find the lut in one of the search paths
             std::string fullpath = pystring::os::path::join(searchpaths[i], filename);
             std::string expandedfullpath = EnvExpand(fullpath, getImpl()->envMap_);
-            if(FileExists(expandedfullpath))
+            if(getImpl()->fileExists(expandedfullpath))
             {
                 getImpl()->resultsCache_[filename] = expandedfullpath;
                 return getImpl()->resultsCache_[filename].c_str();
@@ -348,6 +433,28 @@ namespace
         throw ExceptionMissingFile(errortext.str().c_str());
     }
 
+    void Context::setSearchPathIndexEnabled(bool enabled)
+    {
+        AutoWriteLock lock(getImpl()->resultsCacheLock_);
+        
+        getImpl()->searchPathIndex_ = enabled;
+        getImpl()->resetCaches();
+        getImpl()->directoryIndex_.clear();
+    }
+    
+    bool Context::isSearchPathIndexEnabled() const
+    {
+        return getImpl()->searchPathIndex_;
+    }
+    
+    void Context::refreshSearchPathIndex()
+    {
+        AutoWriteLock lock(getImpl()->resultsCacheLock_);
+        
+        getImpl()->resultsCache_.clear();
+        getImpl()->directoryIndex_.clear();
+    }
+    
     std::ostream& operator<< (std::ostream& os, const Context& context)
     {
         os << "<Context";
@@ -410,6 +517,8 @@ OCIO_NAMESPACE_EXIT
 namespace OCIO = OCIO_NAMESPACE;
 #include "UnitTest.h"
 
+#include <cstring>
+
 #ifdef OCIO_SOURCE_DIR
 
 #define _STR(x) #x
@@ -449,4 +558,38 @@ OIIO_ADD_TEST(Context, VarSearchPath)
 
 #endif // OCIO_SOURCE_DIR
 
+OIIO_ADD_TEST(Context, SearchPathIndex)
+{
+    OCIO::TempDirectory dir("context");
+    dir.createDirectory("luts");
+    const std::string first = dir.writeFile("first.spi1d", "x");
+    const std::string second = dir.getFilePath("second.spi1d");
+    const std::string nested = dir.writeFile("luts/nested.spi1d", "x");
+    
+    OCIO::ContextRcPtr context = OCIO::Context::Create();
+    OIIO_CHECK_ASSERT(!context->isSearchPathIndexEnabled());
+    context->setWorkingDir(dir.getPath().c_str());
+    const std::string cacheID = context->getCacheID();
+    context->setSearchPathIndexEnabled(true);
+    OIIO_CHECK_ASSERT(context->isSearchPathIndexEnabled());
+    OIIO_CHECK_NE(std::string(context->getCacheID()), cacheID);
+    
+    OIIO_CHECK_NO_THOW(context->resolveFileLocation("first.spi1d"));
+    OIIO_CHECK_EQUAL(std::string(context->resolveFileLocation("first.spi1d")), first);
+    OIIO_CHECK_EQUAL(std::string(context->resolveFileLocation("luts/nested.spi1d")), nested);
+    OIIO_CHECK_EQUAL(std::string(context->resolveFileLocation(nested.c_str())), nested);
+    OIIO_CHECK_THOW(context->resolveFileLocation("second.spi1d"), OCIO::Exception);
+    
+    // The listing is kept until refreshed
+    dir.writeFile("second.spi1d", "x");
+    OIIO_CHECK_THOW(context->resolveFileLocation("second.spi1d"), OCIO::Exception);
+    context->refreshSearchPathIndex();
+    OIIO_CHECK_EQUAL(std::string(context->resolveFileLocation("second.spi1d")), second);
+    
+    // Changing the search path drops the prepped paths
+    context->setSearchPath("luts");
+    OIIO_CHECK_EQUAL(std::string(context->resolveFileLocation("nested.spi1d")), nested);
+    OIIO_CHECK_THOW(context->resolveFileLocation("first.spi1d"), OCIO::Exception);
+}
+
 #endif // OCIO_UNIT_TEST
@@ -0,0 +1,175 @@
+/*
+Copyright (c) 2003-2010 Sony Pictures Imageworks Inc., et al.
+All Rights Reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Sony Pictures Imageworks nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CpuProgram.h"
+
+#include <algorithm>
+
+OCIO_NAMESPACE_ENTER
+{
+    namespace
+    {
+        // 64 rgba float pixels is 1KB, which comfortably fits in L1
+        // alongside the op's own data (luts, etc.)
+        const long PIXELS_PER_BLOCK = 64;
+    }
+    
+    CpuProgram::CpuProgram()
+    { }
+    
+    CpuProgram::~CpuProgram()
+    { }
+    
+    void CpuProgram::compile(const OpRcPtrVec & ops)
+    {
+        m_ops = ops;
+        
+        m_kernels.clear();
+        m_kernels.reserve(m_ops.size());
+        for(OpRcPtrVec::size_type i=0, size = m_ops.size(); i<size; ++i)
+        {
+            m_kernels.push_back(m_ops[i].get());
+        }
+    }
+    
+    bool CpuProgram::empty() const
+    {
+        return m_kernels.empty();
+    }
+    
+    void CpuProgram::apply(float* rgbaBuffer, long numPixels) const
+    {
+        const std::vector<const Op *>::size_type numKernels = m_kernels.size();
+        if(numKernels == 0) return;
+        
+        // A single op gains nothing from blocking
+        if(numKernels == 1 || numPixels <= PIXELS_PER_BLOCK)
+        {
+            for(std::vector<const Op *>::size_type i=0; i<numKernels; ++i)
+            {
+                m_kernels[i]->apply(rgbaBuffer, numPixels);
+            }
+            return;
+        }
+        
+        for(long pixelIndex=0; pixelIndex<numPixels; pixelIndex+=PIXELS_PER_BLOCK)
+        {
+            float* block = rgbaBuffer + 4*pixelIndex;
+            long blockPixels = std::min(PIXELS_PER_BLOCK, numPixels - pixelIndex);
+            
+            for(std::vector<const Op *>::size_type i=0; i<numKernels; ++i)
+            {
+                m_kernels[i]->apply(block, blockPixels);
+            }
+        }
+    }
+}
+OCIO_NAMESPACE_EXIT
+
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef OCIO_UNIT_TEST
+
+namespace OCIO = OCIO_NAMESPACE;
+#include "UnitTest.h"
+#include "LogOps.h"
+#include "Lut1DOp.h"
+#include "MatrixOps.h"
+
+OIIO_ADD_TEST(CpuProgram, ApplyMatchesOps)
+{
+    // matrix, log, 1D lut, matrix (a typical display chain)
+    OCIO::OpRcPtrVec ops;
+    
+    float m44[16] = { 0.6f, 0.3f, 0.1f, 0.0f,
+                      0.2f, 0.7f, 0.1f, 0.0f,
+                      0.1f, 0.1f, 0.8f, 0.0f,
+                      0.0f, 0.0f, 0.0f, 1.0f };
+    float offset4[4] = { 0.01f, 0.02f, 0.03f, 0.0f };
+    OCIO::CreateMatrixOffsetOp(ops, m44, offset4, OCIO::TRANSFORM_DIR_FORWARD);
+    
+    float k[3] = { 0.3f, 0.3f, 0.3f };
+    float m[3] = { 1.0f, 1.0f, 1.0f };
+    float b[3] = { 0.01f, 0.01f, 0.01f };
+    float base[3] = { 10.0f, 10.0f, 10.0f };
+    float kb[3] = { 0.6f, 0.6f, 0.6f };
+    OCIO::CreateLogOp(ops, k, m, b, base, kb, OCIO::TRANSFORM_DIR_FORWARD);
+    
+    OCIO::Lut1DRcPtr lut = OCIO::Lut1D::Create();
+    for(int c=0; c<3; ++c)
+    {
+        lut->from_min[c] = 0.0f;
+        lut->from_max[c] = 1.0f;
+        for(int i=0; i<256; ++i)
+        {
+            float x = (float)i / 255.0f;
+            lut->luts[c].push_back(x*x);
+        }
+    }
+    lut->maxerror = 1e-5f;
+    lut->errortype = OCIO::ERROR_RELATIVE;
+    OCIO::CreateLut1DOp(ops, lut, OCIO::INTERP_LINEAR, OCIO::TRANSFORM_DIR_FORWARD);
+    
+    float m44b[16] = { 1.2f, -0.1f, -0.1f, 0.0f,
+                       -0.1f, 1.2f, -0.1f, 0.0f,
+                       -0.1f, -0.1f, 1.2f, 0.0f,
+                       0.0f, 0.0f, 0.0f, 1.0f };
+    OCIO::CreateMatrixOp(ops, m44b, OCIO::TRANSFORM_DIR_FORWARD);
+    
+    OCIO::FinalizeOpVec(ops, false);
+    OIIO_CHECK_EQUAL(ops.size(), 4);
+    
+    // Not a multiple of the block size
+    const long numPixels = 1000;
+    std::vector<float> expected(numPixels*4);
+    for(long i=0; i<numPixels*4; ++i)
+    {
+        expected[i] = (float)(i % 97) / 80.0f - 0.1f;
+    }
+    std::vector<float> result(expected);
+    
+    for(OCIO::OpRcPtrVec::size_type i=0; i<ops.size(); ++i)
+    {
+        ops[i]->apply(&expected[0], numPixels);
+    }
+    
+    OCIO::CpuProgram program;
+    OIIO_CHECK_ASSERT(program.empty());
+    program.compile(ops);
+    OIIO_CHECK_ASSERT(!program.empty());
+    program.apply(&result[0], numPixels);
+    
+    for(long i=0; i<numPixels*4; ++i)
+    {
+        OIIO_CHECK_EQUAL(result[i], expected[i]);
+    }
+}
+
+#endif // OCIO_UNIT_TEST
@@ -0,0 +1,74 @@
+/*
+Copyright (c) 2003-2010 Sony Pictures Imageworks Inc., et al.
+All Rights Reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Sony Pictures Imageworks nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef INCLUDED_OCIO_CPUPROGRAM_H
+#define INCLUDED_OCIO_CPUPROGRAM_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Op.h"
+
+#include <vector>
+
+OCIO_NAMESPACE_ENTER
+{
+    // The finalized cpu ops of a processor, compiled for the apply hot path.
+    //
+    // Rather than streaming the whole scanline buffer through each op in
+    // turn (one pass over memory per op), the program runs every op on a
+    // small block of pixels, which stays in L1 cache, before moving on to
+    // the next block. Adjacent ops that can be fused into a single kernel
+    // have already been combined by the optimizer (see OptimizeOpVec).
+    
+    class CpuProgram
+    {
+    public:
+        CpuProgram();
+        ~CpuProgram();
+        
+        // The ops must be finalized.
+        void compile(const OpRcPtrVec & ops);
+        
+        bool empty() const;
+        
+        // Same result as applying each op to the whole buffer in turn.
+        // This is safe to call in a multi-threaded context.
+        void apply(float* rgbaBuffer, long numPixels) const;
+        
+    private:
+        // Keeps the ops alive
+        OpRcPtrVec m_ops;
+        
+        // The same ops, avoiding shared_ptr indirection on the hot path
+        std::vector<const Op *> m_kernels;
+    };
+}
+OCIO_NAMESPACE_EXIT
+
+#endif
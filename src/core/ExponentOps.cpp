@@ -86,6 +86,10 @@ OCIO_NAMESPACE_ENTER
             virtual void writeGpuShader(std::ostream & shader,
                                         const std::string & pixelName,
                                         const GpuShaderDesc & shaderDesc) const;
+            virtual void writeGpuShaderUniforms(std::ostream & shader,
+                                                const std::string & pixelName,
+                                                const GpuShaderDesc & shaderDesc,
+                                                GpuUniformVec & uniforms) const;
         private:
             double m_exp4[4];
 
@@ -245,6 +249,34 @@ OCIO_NAMESPACE_ENTER
             shader << ", " << GpuTextHalf4(exp, lang) << ");\n";
         }
         
+        void ExponentOp::writeGpuShaderUniforms(std::ostream & shader,
+                                                const std::string & pixelName,
+                                                const GpuShaderDesc & shaderDesc,
+                                                GpuUniformVec & uniforms) const
+        {
+            float exp[4] = { float(m_exp4[0]), float(m_exp4[1]),
+                float(m_exp4[2]), float(m_exp4[3]) };
+            
+            GpuLanguage lang = shaderDesc.getLanguage();
+            float zerovec[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            std::string expName = AddGpuUniform(uniforms, shaderDesc, "exponent",
+                                                GPU_UNIFORM_FLOAT4, exp);
+            
+            // An exponent of 1.0 is a no-op on the cpu, which does not
+            // clamp (see CreateExponentOp), while the text is the same for
+            // any exponent.
+            const GpuShaderWriter & writer = GetGpuShaderWriter(lang);
+            shader << "if(!";
+            writer.writeAllEqual(shader, expName,
+                                 writer.floatType(4) + "(1.0, 1.0, 1.0, 1.0)");
+            shader << ")\n";
+            shader << "{\n";
+            shader << "    " << pixelName << " = pow(";
+            shader << "max(" << pixelName << ", " << GpuTextHalf4(zerovec, lang) << ")";
+            shader << ", " << expName << ");\n";
+            shader << "}\n";
+        }
+        
     }  // Anon namespace
     
     
@@ -253,8 +285,7 @@ OCIO_NAMESPACE_ENTER
                           const float * exp4,
                           TransformDirection direction)
     {
-        bool expIsIdentity = IsVecEqualToOne(exp4, 4);
-        if(expIsIdentity) return;
+        // As for the matrices, identities are left to the optimizer
         double d_exp[4] = { double(exp4[0]), double(exp4[1]),
                 double(exp4[2]), double(exp4[3]) };
         ops.push_back( ExponentOpRcPtr(new ExponentOp(d_exp, direction)) );
@@ -38,8 +38,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 OCIO_NAMESPACE_ENTER
 {
-    // If the exponent is 1.0, this will return without clamping
-    // Otherwise, will be clamped between [0.0, inf]
+    // If the exponent is 1.0, the op is a no-op which the optimizer
+    // removes, so it does not clamp (nor does its uniform shader text,
+    // which is kept). Otherwise, will be clamped between [0.0, inf]
     
     void CreateExponentOp(OpRcPtrVec & ops,
                           const float * exponent4,
@@ -28,12 +28,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "BakingUtils.h"
 #include "FileTransform.h"
 #include "Lut1DOp.h"
 #include "Lut3DOp.h"
+#include "LutCache.h"
 #include "MathUtils.h"
 #include "ParseUtils.h"
-#include "pystring/pystring.h"
 
 #include <algorithm>
 #include <cmath>
@@ -119,6 +120,11 @@ OCIO_NAMESPACE_ENTER
             };
             ~LocalCachedFile() {};
             
+            virtual size_t getMemorySize() const
+            {
+                return sizeof(*this) + lut1D->getMemorySize() + lut3D->getMemorySize();
+            }
+            
             bool has1D;
             bool has3D;
             Lut1DRcPtr lut1D;
@@ -149,6 +155,11 @@ OCIO_NAMESPACE_ENTER
                                       CachedFileRcPtr untypedCachedFile,
                                       const FileTransform& fileTransform,
                                       TransformDirection dir) const;
+            
+            virtual bool WriteCache(std::ostream & ostream,
+                                    const CachedFileRcPtr & untypedCachedFile) const;
+            
+            virtual CachedFileRcPtr ReadCache(std::istream & istream) const;
         };
         
         
@@ -225,24 +236,31 @@ OCIO_NAMESPACE_ENTER
             
             // Parse the file 3d lut data to an int array
             {
-                const int MAX_LINE_SIZE = 4096;
-                char lineBuffer[MAX_LINE_SIZE];
-                
-                std::vector<std::string> lineParts;
+                LineTokenizer tokenizer(istream);
                 std::vector<int> tmpData;
+                const char * tokenBegin = 0;
+                const char * tokenEnd = 0;
                 
-                while(istream.good())
+                while(tokenizer.nextLine())
                 {
-                    istream.getline(lineBuffer, MAX_LINE_SIZE);
-                    
-                    // Strip and split the line
-                    pystring::split(pystring::strip(lineBuffer), lineParts);
-                    
-                    if(lineParts.empty()) continue;
-                    if((lineParts.size() > 0) && pystring::startswith(lineParts[0],"#")) continue;
+                    // Read the line as a list of ints, straight from the buffer
+                    tmpData.clear();
+                    bool isIntList = true;
+                    while(tokenizer.nextToken(tokenBegin, tokenEnd))
+                    {
+                        int value = 0;
+                        if((tmpData.empty() && *tokenBegin == '#') ||
+                           !ParseInt(value, tokenBegin, tokenEnd))
+                        {
+                            isIntList = false;
+                            break;
+                        }
+                        tmpData.push_back(value);
+                    }
                     
-                    // If we havent found a list of ints, continue
-                    if(!StringVecToIntVec(tmpData, lineParts)) continue;
+                    // Skip empty lines, comments, and anything else
+                    // that is not a list of ints
+                    if(!isIntList || tmpData.empty()) continue;
                     
                     // If we've found more than 3 ints, and dont have
                     // a shaper lut yet, we've got it!
@@ -410,6 +428,34 @@ OCIO_NAMESPACE_ENTER
             return cachedFile;
         }
         
+        // Writes the baked cube values as integers
+        class CubeWriter : public Lut3DBakeSink
+        {
+        public:
+            CubeWriter(LutTextWriter & writer, float scale) :
+                m_writer(writer),
+                m_scale(scale)
+            { }
+            
+            void write(const float * rgb, long numPoints)
+            {
+                for(long i=0; i<numPoints; ++i)
+                {
+                    int r = GetClampedIntFromNormFloat(rgb[3*i+0], m_scale);
+                    int g = GetClampedIntFromNormFloat(rgb[3*i+1], m_scale);
+                    int b = GetClampedIntFromNormFloat(rgb[3*i+2], m_scale);
+                    m_writer << r << ' ' << g << ' ' << b << '\n';
+                }
+            }
+            
+        private:
+            LutTextWriter & m_writer;
+            float m_scale;
+            
+            CubeWriter(const CubeWriter &);
+            CubeWriter& operator= (const CubeWriter &);
+        };
+        
         // 65 -> 6
         // 33 -> 5
         // 17 -> 4
@@ -444,8 +490,6 @@ OCIO_NAMESPACE_ENTER
                 throw Exception(os.str().c_str());
             }
             
-            ConstConfigRcPtr config = baker.getConfig();
-            
             int cubeSize = baker.getCubeSize();
             if(cubeSize==-1) cubeSize = DEFAULT_CUBE_SIZE;
             cubeSize = std::max(2, cubeSize); // smallest cube is 2x2x2
@@ -453,39 +497,21 @@ OCIO_NAMESPACE_ENTER
             int shaperSize = baker.getShaperSize();
             if(shaperSize==-1) shaperSize = cubeSize;
             
-            std::vector<float> cubeData;
-            cubeData.resize(cubeSize*cubeSize*cubeSize*3);
-            GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_BLUE);
-            PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
-            
-            // Apply our conversion from the input space to the output space.
-            ConstProcessorRcPtr inputToTarget;
-            std::string looks = baker.getLooks();
-            if (!looks.empty())
-            {
-                LookTransformRcPtr transform = LookTransform::Create();
-                transform->setLooks(looks.c_str());
-                transform->setSrc(baker.getInputSpace());
-                transform->setDst(baker.getTargetSpace());
-                inputToTarget = config->getProcessor(transform,
-                    TRANSFORM_DIR_FORWARD);
-            }
-            else
-            {
-              inputToTarget = config->getProcessor(baker.getInputSpace(),
-                  baker.getTargetSpace());
-            }
-            inputToTarget->apply(cubeImg);
+            // Our conversion from the input space to the output space.
+            ConstProcessorRcPtr inputToTarget =
+                GetBakerProcessor(baker, baker.getInputSpace());
             
             // Write out the file.
             // For for maximum compatibility with other apps, we will
             // not utilize the shaper or output any metadata
             
+            LutTextWriter writer(ostream);
+            
             if(formatName == "lustre")
             {
                 int meshInputBitDepth = CubeDimensionLenToLustreBitDepth(cubeSize);
-                ostream << "3DMESH\n";
-                ostream << "Mesh " << meshInputBitDepth << " " << CUBE_BIT_DEPTH << "\n";
+                writer << "3DMESH\n";
+                writer << "Mesh " << meshInputBitDepth << " " << CUBE_BIT_DEPTH << "\n";
             }
             
             std::vector<float> shaperData(shaperSize);
@@ -496,11 +522,11 @@ OCIO_NAMESPACE_ENTER
             
             for(unsigned int i=0; i<shaperData.size(); ++i)
             {
-                if(i != 0) ostream << " ";
+                if(i != 0) writer << ' ';
                 int val = GetClampedIntFromNormFloat(shaperData[i], shaperScale);
-                ostream << val;
+                writer << val;
             }
-            ostream << "\n";
+            writer << '\n';
             
             // Write out the 3D Cube
             float cubeScale = static_cast<float>(
@@ -509,20 +535,41 @@ OCIO_NAMESPACE_ENTER
             {
                 throw Exception("Internal cube size exception.");
             }
-            for(int i=0; i<cubeSize*cubeSize*cubeSize; ++i)
-            {
-                int r = GetClampedIntFromNormFloat(cubeData[3*i+0], cubeScale);
-                int g = GetClampedIntFromNormFloat(cubeData[3*i+1], cubeScale);
-                int b = GetClampedIntFromNormFloat(cubeData[3*i+2], cubeScale);
-                ostream << r << " " << g << " " << b << "\n";
-            }
-            ostream << "\n";
+            CubeWriter cubeWriter(writer, cubeScale);
+            BakeLut3D(cubeWriter, cubeSize, LUT3DORDER_FAST_BLUE, inputToTarget);
+            writer << '\n';
             
             if(formatName == "lustre")
             {
-                ostream << "LUT8\n";
-                ostream << "gamma 1.0\n";
+                writer << "LUT8\n";
+                writer << "gamma 1.0\n";
             }
+            
+            writer.flush();
+        }
+        
+        bool LocalFileFormat::WriteCache(std::ostream & ostream,
+                                         const CachedFileRcPtr & untypedCachedFile) const
+        {
+            LocalCachedFileRcPtr cachedFile = DynamicPtrCast<LocalCachedFile>(untypedCachedFile);
+            if(!cachedFile) return false;
+            
+            WriteLutCacheBool(ostream, cachedFile->has1D);
+            WriteLutCacheBool(ostream, cachedFile->has3D);
+            if(cachedFile->has1D) WriteLutCacheLut1D(ostream, cachedFile->lut1D);
+            if(cachedFile->has3D) WriteLutCacheLut3D(ostream, cachedFile->lut3D);
+            return true;
+        }
+        
+        CachedFileRcPtr LocalFileFormat::ReadCache(std::istream & istream) const
+        {
+            LocalCachedFileRcPtr cachedFile = LocalCachedFileRcPtr(new LocalCachedFile());
+            
+            cachedFile->has1D = ReadLutCacheBool(istream);
+            cachedFile->has3D = ReadLutCacheBool(istream);
+            if(cachedFile->has1D) cachedFile->lut1D = ReadLutCacheLut1D(istream);
+            if(cachedFile->has3D) cachedFile->lut3D = ReadLutCacheLut3D(istream);
+            return cachedFile;
         }
         
         void
@@ -0,0 +1,1020 @@
+/*
+Copyright (c) 2003-2010 Sony Pictures Imageworks Inc., et al.
+All Rights Reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Sony Pictures Imageworks nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "BakingUtils.h"
+#include "BitDepthUtils.h"
+#include "FileTransform.h"
+#include "Lut1DOp.h"
+#include "Lut3DOp.h"
+#include "Platform.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#if !defined(WINDOWS)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+/*
+Binary lut, written by the ocio_binary (32-bit float values) and
+ocio_binary_half (16-bit half float values) bakers. Reading it requires no
+parsing. The float values of a 3D lut file are mapped rather than read (on
+little-endian machines), so the processes using the lut share one copy of
+it. Such a file should be replaced rather than rewritten in place while in
+use.
+
+All the values are little-endian.
+
+    char[8]    "OCIOBLUT"
+    uint32     version (1)
+    uint32     encoding of the arrays: 0 = float, 1 = half
+    uint32     shaper size, 0 if there is none
+    uint32     1D lut size, 0 if there is none
+    uint32     3D lut size (of each edge), 0 if there is none
+    float[6]   shaper domain: min rgb, max rgb
+    float[6]   lut domain: min rgb, max rgb
+    shaper     size*3 values, rgb interleaved
+    1D lut     size*3 values, rgb interleaved
+    3D lut     size^3*3 values, rgb interleaved, red changing fastest
+
+The shaper is applied before the lut, and outputs the domain of the lut.
+A file holds either a 1D or a 3D lut, with or without a shaper, or only a
+shaper.
+*/
+
+
+OCIO_NAMESPACE_ENTER
+{
+    ////////////////////////////////////////////////////////////////
+    
+    namespace
+    {
+        const char BINARY_LUT_MAGIC[8] = { 'O', 'C', 'I', 'O', 'B', 'L', 'U', 'T' };
+        const unsigned int BINARY_LUT_VERSION = 1;
+        const unsigned int BINARY_LUT_ENCODING_FLOAT = 0;
+        const unsigned int BINARY_LUT_ENCODING_HALF = 1;
+        
+        // Upper bounds, which only guard against allocating absurd amounts
+        // of memory for a corrupted header.
+        const unsigned int BINARY_LUT_MAX_1D_SIZE = 1 << 24;
+        const unsigned int BINARY_LUT_MAX_3D_SIZE = 1 << 9;
+        
+        const Interpolation SHAPER_INTERPOLATION = INTERP_LINEAR;
+        
+        class LocalCachedFile : public CachedFile
+        {
+        public:
+            LocalCachedFile () :
+                hasShaper(false),
+                has1D(false),
+                has3D(false)
+            {
+                shaper = Lut1D::Create();
+                lut1D = Lut1D::Create();
+                lut3D = Lut3D::Create();
+            };
+            ~LocalCachedFile() {};
+            
+            virtual size_t getMemorySize() const
+            {
+                return sizeof(*this) + shaper->getMemorySize()
+                    + lut1D->getMemorySize() + lut3D->getMemorySize();
+            }
+            
+            bool hasShaper;
+            bool has1D;
+            bool has3D;
+            Lut1DRcPtr shaper;
+            Lut1DRcPtr lut1D;
+            Lut3DRcPtr lut3D;
+        };
+        
+        typedef OCIO_SHARED_PTR<LocalCachedFile> LocalCachedFileRcPtr;
+        
+        // A read-only mapping of a whole file, kept alive by the luts which
+        // borrow their values from it.
+        class MappedFile
+        {
+        public:
+            // Returns NULL if the file cannot be mapped
+            static OCIO_SHARED_PTR<MappedFile> Open(const std::string & filepath);
+            
+            ~MappedFile()
+            {
+#ifdef WINDOWS
+                UnmapViewOfFile(m_data);
+#else
+                munmap(const_cast<char *>(m_data), m_size);
+#endif
+            }
+            
+            const char * data() const { return m_data; }
+            size_t size() const { return m_size; }
+            
+        private:
+            MappedFile(const char * data, size_t size) :
+                m_data(data),
+                m_size(size)
+            { }
+            
+            MappedFile(const MappedFile &);
+            MappedFile & operator= (const MappedFile &);
+            
+            const char * m_data;
+            size_t m_size;
+        };
+        
+        typedef OCIO_SHARED_PTR<MappedFile> MappedFileRcPtr;
+        
+        MappedFileRcPtr MappedFile::Open(const std::string & filepath)
+        {
+#ifdef WINDOWS
+            HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ,
+                                      FILE_SHARE_READ | FILE_SHARE_DELETE, NULL,
+                                      OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+            if(file == INVALID_HANDLE_VALUE) return MappedFileRcPtr();
+            
+            LARGE_INTEGER size;
+            HANDLE mapping = NULL;
+            if(GetFileSizeEx(file, &size) && size.QuadPart > 0)
+            {
+                mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+            }
+            CloseHandle(file);
+            if(!mapping) return MappedFileRcPtr();
+            
+            // The view keeps the mapping open
+            const void * data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+            if(!data) return MappedFileRcPtr();
+            
+            return MappedFileRcPtr(new MappedFile(static_cast<const char *>(data),
+                                                  (size_t) size.QuadPart));
+#else
+            int fd = open(filepath.c_str(), O_RDONLY);
+            if(fd < 0) return MappedFileRcPtr();
+            
+            struct stat st;
+            void * data = MAP_FAILED;
+            if(fstat(fd, &st) == 0 && st.st_size > 0)
+            {
+                data = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+            }
+            close(fd);
+            if(data == MAP_FAILED) return MappedFileRcPtr();
+            
+            return MappedFileRcPtr(new MappedFile(static_cast<const char *>(data),
+                                                  (size_t) st.st_size));
+#endif
+        }
+        
+        bool IsLittleEndian()
+        {
+            const unsigned int one = 1;
+            return *reinterpret_cast<const unsigned char *>(&one) == 1;
+        }
+        
+        // Reverse the bytes of each of the numValues values of valueSize
+        // bytes, on big-endian machines only.
+        void SwapToLittleEndian(char * data, size_t valueSize, size_t numValues)
+        {
+            if(IsLittleEndian()) return;
+            
+            for(size_t i=0; i<numValues; ++i)
+            {
+                std::reverse(data + i*valueSize, data + (i+1)*valueSize);
+            }
+        }
+        
+        void WriteUInt(std::ostream & ostream, unsigned int value)
+        {
+            char * data = reinterpret_cast<char *>(&value);
+            SwapToLittleEndian(data, sizeof(value), 1);
+            ostream.write(data, sizeof(value));
+        }
+        
+        void WriteValues(std::ostream & ostream, const float * values,
+                         size_t numValues, unsigned int encoding)
+        {
+            if(numValues == 0) return;
+            
+            if(encoding == BINARY_LUT_ENCODING_HALF)
+            {
+                std::vector<unsigned short> halfs(numValues);
+                for(size_t i=0; i<numValues; ++i)
+                {
+                    halfs[i] = FloatToHalf(values[i]);
+                }
+                char * data = reinterpret_cast<char *>(&halfs[0]);
+                SwapToLittleEndian(data, sizeof(unsigned short), numValues);
+                ostream.write(data, (std::streamsize)(numValues * sizeof(unsigned short)));
+            }
+            else
+            {
+                std::vector<float> floats(values, values + numValues);
+                char * data = reinterpret_cast<char *>(&floats[0]);
+                SwapToLittleEndian(data, sizeof(float), numValues);
+                ostream.write(data, (std::streamsize)(numValues * sizeof(float)));
+            }
+        }
+        
+        void ReadBytes(std::istream & istream, char * data, size_t size)
+        {
+            istream.read(data, (std::streamsize)size);
+            if(!istream || (size_t)istream.gcount() != size)
+            {
+                throw Exception("Error parsing binary lut. The file is truncated.");
+            }
+        }
+        
+        unsigned int ReadUInt(std::istream & istream)
+        {
+            unsigned int value = 0;
+            char * data = reinterpret_cast<char *>(&value);
+            ReadBytes(istream, data, sizeof(value));
+            SwapToLittleEndian(data, sizeof(value), 1);
+            return value;
+        }
+        
+        void ReadValues(std::istream & istream, float * values,
+                        size_t numValues, unsigned int encoding)
+        {
+            if(numValues == 0) return;
+            
+            if(encoding == BINARY_LUT_ENCODING_HALF)
+            {
+                std::vector<unsigned short> halfs(numValues);
+                char * data = reinterpret_cast<char *>(&halfs[0]);
+                ReadBytes(istream, data, numValues * sizeof(unsigned short));
+                SwapToLittleEndian(data, sizeof(unsigned short), numValues);
+                for(size_t i=0; i<numValues; ++i)
+                {
+                    values[i] = HalfToFloat(halfs[i]);
+                }
+            }
+            else
+            {
+                char * data = reinterpret_cast<char *>(values);
+                ReadBytes(istream, data, numValues * sizeof(float));
+                SwapToLittleEndian(data, sizeof(float), numValues);
+            }
+        }
+        
+        // The rgb interleaved values of a 1D lut
+        void GetLut1DValues(std::vector<float> & values, const Lut1DRcPtr & lut)
+        {
+            size_t size = lut->luts[0].size();
+            values.resize(size * 3);
+            for(size_t i=0; i<size; ++i)
+            {
+                for(int c=0; c<3; ++c)
+                {
+                    values[3*i+c] = lut->luts[c][i];
+                }
+            }
+        }
+        
+        void SetLut1DValues(const Lut1DRcPtr & lut, const std::vector<float> & values)
+        {
+            size_t size = values.size() / 3;
+            for(int c=0; c<3; ++c)
+            {
+                lut->luts[c].resize(size);
+                for(size_t i=0; i<size; ++i)
+                {
+                    lut->luts[c][i] = values[3*i+c];
+                }
+            }
+        }
+        
+        // Write a lut in the binary format. The unused luts are ignored, and
+        // may be empty. The 1D luts must have the same size for all channels.
+        void WriteBinaryLut(std::ostream & ostream,
+                            const LocalCachedFile & cachedFile,
+                            unsigned int encoding)
+        {
+            if(cachedFile.has1D && cachedFile.has3D)
+            {
+                throw Exception("A binary lut cannot hold both a 1D and a 3D lut.");
+            }
+            
+            unsigned int shaperSize = cachedFile.hasShaper ?
+                (unsigned int)cachedFile.shaper->luts[0].size() : 0;
+            unsigned int lut1DSize = cachedFile.has1D ?
+                (unsigned int)cachedFile.lut1D->luts[0].size() : 0;
+            unsigned int lut3DSize = cachedFile.has3D ?
+                (unsigned int)cachedFile.lut3D->size[0] : 0;
+            
+            ostream.write(BINARY_LUT_MAGIC, sizeof(BINARY_LUT_MAGIC));
+            WriteUInt(ostream, BINARY_LUT_VERSION);
+            WriteUInt(ostream, encoding);
+            WriteUInt(ostream, shaperSize);
+            WriteUInt(ostream, lut1DSize);
+            WriteUInt(ostream, lut3DSize);
+            
+            // The domains are always stored as floats
+            float domains[12];
+            memcpy(domains, cachedFile.shaper->from_min, 3*sizeof(float));
+            memcpy(domains + 3, cachedFile.shaper->from_max, 3*sizeof(float));
+            if(cachedFile.has1D)
+            {
+                memcpy(domains + 6, cachedFile.lut1D->from_min, 3*sizeof(float));
+                memcpy(domains + 9, cachedFile.lut1D->from_max, 3*sizeof(float));
+            }
+            else
+            {
+                memcpy(domains + 6, cachedFile.lut3D->from_min, 3*sizeof(float));
+                memcpy(domains + 9, cachedFile.lut3D->from_max, 3*sizeof(float));
+            }
+            WriteValues(ostream, domains, 12, BINARY_LUT_ENCODING_FLOAT);
+            
+            std::vector<float> values;
+            if(cachedFile.hasShaper)
+            {
+                GetLut1DValues(values, cachedFile.shaper);
+                WriteValues(ostream, &values[0], values.size(), encoding);
+            }
+            if(cachedFile.has1D)
+            {
+                GetLut1DValues(values, cachedFile.lut1D);
+                WriteValues(ostream, &values[0], values.size(), encoding);
+            }
+            if(cachedFile.has3D)
+            {
+                const Lut3D & lut = *cachedFile.lut3D;
+                WriteValues(ostream, lut.getValues(), lut.getNumValues(), encoding);
+            }
+        }
+        
+        class LocalFileFormat : public FileFormat
+        {
+        public:
+            
+            ~LocalFileFormat() {};
+            
+            virtual void GetFormatInfo(FormatInfoVec & formatInfoVec) const;
+            
+            virtual CachedFileRcPtr Read(std::istream & istream) const;
+            
+            virtual CachedFileRcPtr ReadFile(std::istream & istream,
+                                             const std::string & filepath) const;
+            
+            virtual void Write(const Baker & baker,
+                               const std::string & formatName,
+                               std::ostream & ostream) const;
+            
+            virtual void BuildFileOps(OpRcPtrVec & ops,
+                                      const Config& config,
+                                      const ConstContextRcPtr & context,
+                                      CachedFileRcPtr untypedCachedFile,
+                                      const FileTransform& fileTransform,
+                                      TransformDirection dir) const;
+            
+            virtual bool Probe(const std::string & head) const;
+        };
+        
+        void LocalFileFormat::GetFormatInfo(FormatInfoVec & formatInfoVec) const
+        {
+            FormatInfo info;
+            info.name = "ocio_binary";
+            info.extension = "blut";
+            info.capabilities = (FORMAT_CAPABILITY_READ | FORMAT_CAPABILITY_WRITE);
+            formatInfoVec.push_back(info);
+            
+            FormatInfo info2 = info;
+            info2.name = "ocio_binary_half";
+            formatInfoVec.push_back(info2);
+        }
+        
+        bool LocalFileFormat::Probe(const std::string & head) const
+        {
+            return head.size() >= sizeof(BINARY_LUT_MAGIC) &&
+                memcmp(head.data(), BINARY_LUT_MAGIC, sizeof(BINARY_LUT_MAGIC)) == 0;
+        }
+        
+        CachedFileRcPtr
+        LocalFileFormat::Read(std::istream & istream) const
+        {
+            return ReadFile(istream, "");
+        }
+        
+        // Maps the 3D lut values of the file at filepath, if it is not empty
+        CachedFileRcPtr
+        LocalFileFormat::ReadFile(std::istream & istream,
+                                  const std::string & filepath) const
+        {
+            char magic[sizeof(BINARY_LUT_MAGIC)];
+            istream.read(magic, sizeof(magic));
+            if(!istream || memcmp(magic, BINARY_LUT_MAGIC, sizeof(magic)) != 0)
+            {
+                throw Exception("Error parsing binary lut. Invalid signature.");
+            }
+            
+            unsigned int version = ReadUInt(istream);
+            if(version != BINARY_LUT_VERSION)
+            {
+                std::ostringstream os;
+                os << "Error parsing binary lut. Unsupported version ";
+                os << version << ".";
+                throw Exception(os.str().c_str());
+            }
+            
+            unsigned int encoding = ReadUInt(istream);
+            if(encoding != BINARY_LUT_ENCODING_FLOAT &&
+               encoding != BINARY_LUT_ENCODING_HALF)
+            {
+                std::ostringstream os;
+                os << "Error parsing binary lut. Unsupported encoding ";
+                os << encoding << ".";
+                throw Exception(os.str().c_str());
+            }
+            
+            unsigned int shaperSize = ReadUInt(istream);
+            unsigned int lut1DSize = ReadUInt(istream);
+            unsigned int lut3DSize = ReadUInt(istream);
+            
+            if(shaperSize == 1 || shaperSize > BINARY_LUT_MAX_1D_SIZE ||
+               lut1DSize == 1 || lut1DSize > BINARY_LUT_MAX_1D_SIZE ||
+               lut3DSize == 1 || lut3DSize > BINARY_LUT_MAX_3D_SIZE ||
+               (lut1DSize != 0 && lut3DSize != 0) ||
+               (shaperSize == 0 && lut1DSize == 0 && lut3DSize == 0))
+            {
+                std::ostringstream os;
+                os << "Error parsing binary lut. Invalid sizes (shaper ";
+                os << shaperSize << ", 1D " << lut1DSize;
+                os << ", 3D " << lut3DSize << ").";
+                throw Exception(os.str().c_str());
+            }
+            
+            float domains[12];
+            ReadValues(istream, domains, 12, BINARY_LUT_ENCODING_FLOAT);
+            
+            LocalCachedFileRcPtr cachedFile = LocalCachedFileRcPtr(new LocalCachedFile());
+            
+            std::vector<float> values;
+            if(shaperSize > 0)
+            {
+                values.resize(shaperSize * 3);
+                ReadValues(istream, &values[0], values.size(), encoding);
+                
+                memcpy(cachedFile->shaper->from_min, domains, 3*sizeof(float));
+                memcpy(cachedFile->shaper->from_max, domains + 3, 3*sizeof(float));
+                SetLut1DValues(cachedFile->shaper, values);
+                cachedFile->shaper->maxerror = 1e-6f;
+                cachedFile->shaper->errortype = ERROR_RELATIVE;
+                cachedFile->hasShaper = true;
+            }
+            
+            if(lut1DSize > 0)
+            {
+                values.resize(lut1DSize * 3);
+                ReadValues(istream, &values[0], values.size(), encoding);
+                
+                memcpy(cachedFile->lut1D->from_min, domains + 6, 3*sizeof(float));
+                memcpy(cachedFile->lut1D->from_max, domains + 9, 3*sizeof(float));
+                SetLut1DValues(cachedFile->lut1D, values);
+                cachedFile->lut1D->maxerror = 0.0f;
+                cachedFile->lut1D->errortype = ERROR_RELATIVE;
+                cachedFile->has1D = true;
+            }
+            
+            if(lut3DSize > 0)
+            {
+                Lut3DRcPtr lut3D = cachedFile->lut3D;
+                for(int c=0; c<3; ++c)
+                {
+                    lut3D->size[c] = (int)lut3DSize;
+                    lut3D->from_min[c] = domains[6 + c];
+                    lut3D->from_max[c] = domains[9 + c];
+                }
+                const size_t numValues = (size_t)lut3DSize * lut3DSize * lut3DSize * 3;
+                
+                // The values follow 32-bit fields and arrays, so they are
+                // aligned for floats in the (page aligned) mapping.
+                MappedFileRcPtr mappedFile;
+                size_t offset = 0;
+                if(!filepath.empty() && encoding == BINARY_LUT_ENCODING_FLOAT &&
+                   IsLittleEndian())
+                {
+                    const std::streamoff position = istream.tellg();
+                    if(position > 0)
+                    {
+                        offset = (size_t) position;
+                        mappedFile = MappedFile::Open(filepath);
+                    }
+                }
+                
+                if(mappedFile &&
+                   mappedFile->size() >= offset + numValues * sizeof(float))
+                {
+                    lut3D->borrowedValues =
+                        reinterpret_cast<const float *>(mappedFile->data() + offset);
+                    lut3D->borrowedStorage = mappedFile;
+                }
+                else
+                {
+                    lut3D->lut.resize(numValues);
+                    ReadValues(istream, &lut3D->lut[0], lut3D->lut.size(), encoding);
+                }
+                cachedFile->has3D = true;
+            }
+            
+            return cachedFile;
+        }
+        
+        // Appends the baked cube values to a lut
+        class Lut3DValuesSink : public Lut3DBakeSink
+        {
+        public:
+            explicit Lut3DValuesSink(std::vector<float> & values) :
+                m_values(values)
+            { }
+            
+            void write(const float * rgb, long numPoints)
+            {
+                m_values.insert(m_values.end(), rgb, rgb + 3*numPoints);
+            }
+            
+        private:
+            std::vector<float> & m_values;
+            
+            Lut3DValuesSink(const Lut3DValuesSink &);
+            Lut3DValuesSink& operator= (const Lut3DValuesSink &);
+        };
+        
+        void LocalFileFormat::Write(const Baker & baker,
+                                    const std::string & formatName,
+                                    std::ostream & ostream) const
+        {
+            const int DEFAULT_CUBE_SIZE = 64;
+            const int DEFAULT_SHAPER_SIZE = 4096;
+            
+            unsigned int encoding = BINARY_LUT_ENCODING_FLOAT;
+            if(formatName == "ocio_binary")
+            {
+                encoding = BINARY_LUT_ENCODING_FLOAT;
+            }
+            else if(formatName == "ocio_binary_half")
+            {
+                encoding = BINARY_LUT_ENCODING_HALF;
+            }
+            else
+            {
+                std::ostringstream os;
+                os << "Unknown binary lut format name, '";
+                os << formatName << "'.";
+                throw Exception(os.str().c_str());
+            }
+            
+            ConstConfigRcPtr config = baker.getConfig();
+            LocalCachedFile cachedFile;
+            
+            // The cube covers [0,1] of the shaper space if there is one, and
+            // of the input space otherwise.
+            std::string cubeSpace = baker.getInputSpace();
+            
+            std::string shaperSpace = baker.getShaperSpace();
+            if(!shaperSpace.empty())
+            {
+                int shaperSize = baker.getShaperSize();
+                if(shaperSize<0) shaperSize = DEFAULT_SHAPER_SIZE;
+                if(shaperSize<2)
+                {
+                    std::ostringstream os;
+                    os << "When a shaper space has been specified, '";
+                    os << shaperSpace << "', a shaper size less than 2 is not allowed.";
+                    throw Exception(os.str().c_str());
+                }
+                
+                ConstProcessorRcPtr shaperToInput =
+                    config->getProcessor(shaperSpace.c_str(), baker.getInputSpace());
+                if(shaperToInput->hasChannelCrosstalk())
+                {
+                    std::ostringstream os;
+                    os << "The specified shaperSpace, '";
+                    os << shaperSpace << "' has channel crosstalk, which is not appropriate for shapers. ";
+                    os << "Please select an alternate shaper space or omit this option.";
+                    throw Exception(os.str().c_str());
+                }
+                
+                // The shaper is sampled uniformly over the input values
+                // that map to [0,1] in the shaper space.
+                Lut1DRcPtr shaper = cachedFile.shaper;
+                float domain[6] = { 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f };
+                shaperToInput->applyRGB(domain);
+                shaperToInput->applyRGB(domain + 3);
+                for(int c=0; c<3; ++c)
+                {
+                    if(!(domain[c] < domain[3+c]))
+                    {
+                        std::ostringstream os;
+                        os << "The specified shaperSpace, '" << shaperSpace;
+                        os << "' does not map [0,1] to an increasing range of ";
+                        os << "the input space, which is required for the binary lut shaper.";
+                        throw Exception(os.str().c_str());
+                    }
+                    shaper->from_min[c] = domain[c];
+                    shaper->from_max[c] = domain[3+c];
+                }
+                
+                std::vector<float> shaperData(shaperSize*3);
+                for(int i=0; i<shaperSize; ++i)
+                {
+                    float t = (float)i / (float)(shaperSize-1);
+                    for(int c=0; c<3; ++c)
+                    {
+                        shaperData[3*i+c] = domain[c] + t * (domain[3+c] - domain[c]);
+                    }
+                }
+                
+                ConstProcessorRcPtr inputToShaper =
+                    config->getProcessor(baker.getInputSpace(), shaperSpace.c_str());
+                PackedImageDesc shaperImg(&shaperData[0], shaperSize, 1, 3);
+                inputToShaper->apply(shaperImg);
+                
+                SetLut1DValues(shaper, shaperData);
+                cachedFile.hasShaper = true;
+                cubeSpace = shaperSpace;
+            }
+            
+            int cubeSize = baker.getCubeSize();
+            if(cubeSize==-1) cubeSize = DEFAULT_CUBE_SIZE;
+            cubeSize = std::max(2, std::min(cubeSize, (int)BINARY_LUT_MAX_3D_SIZE));
+            
+            Lut3DRcPtr lut3D = cachedFile.lut3D;
+            lut3D->size[0] = cubeSize;
+            lut3D->size[1] = cubeSize;
+            lut3D->size[2] = cubeSize;
+            lut3D->lut.reserve(cubeSize*cubeSize*cubeSize*3);
+            
+            Lut3DValuesSink cubeWriter(lut3D->lut);
+            BakeLut3D(cubeWriter, cubeSize, LUT3DORDER_FAST_RED,
+                      GetBakerProcessor(baker, cubeSpace.c_str()));
+            cachedFile.has3D = true;
+            
+            WriteBinaryLut(ostream, cachedFile, encoding);
+        }
+        
+        void
+        LocalFileFormat::BuildFileOps(OpRcPtrVec & ops,
+                                      const Config& /*config*/,
+                                      const ConstContextRcPtr & /*context*/,
+                                      CachedFileRcPtr untypedCachedFile,
+                                      const FileTransform& fileTransform,
+                                      TransformDirection dir) const
+        {
+            LocalCachedFileRcPtr cachedFile = DynamicPtrCast<LocalCachedFile>(untypedCachedFile);
+            
+            // This should never happen.
+            if(!cachedFile)
+            {
+                std::ostringstream os;
+                os << "Cannot build binary lut Op. Invalid cache type.";
+                throw Exception(os.str().c_str());
+            }
+            
+            TransformDirection newDir = CombineTransformDirections(dir,
+                fileTransform.getDirection());
+            if(newDir == TRANSFORM_DIR_UNKNOWN)
+            {
+                std::ostringstream os;
+                os << "Cannot build file format transform,";
+                os << " unspecified transform direction.";
+                throw Exception(os.str().c_str());
+            }
+            
+            if(newDir == TRANSFORM_DIR_FORWARD)
+            {
+                if(cachedFile->hasShaper)
+                    CreateLut1DOp(ops, cachedFile->shaper,
+                                  SHAPER_INTERPOLATION, newDir);
+                if(cachedFile->has1D)
+                    CreateLut1DOp(ops, cachedFile->lut1D,
+                                  fileTransform.getInterpolation(), newDir);
+                if(cachedFile->has3D)
+                    CreateLut3DOp(ops, cachedFile->lut3D,
+                                  fileTransform.getInterpolation(), newDir);
+            }
+            else if(newDir == TRANSFORM_DIR_INVERSE)
+            {
+                if(cachedFile->has3D)
+                    CreateLut3DOp(ops, cachedFile->lut3D,
+                                  fileTransform.getInterpolation(), newDir);
+                if(cachedFile->has1D)
+                    CreateLut1DOp(ops, cachedFile->lut1D,
+                                  fileTransform.getInterpolation(), newDir);
+                if(cachedFile->hasShaper)
+                    CreateLut1DOp(ops, cachedFile->shaper,
+                                  SHAPER_INTERPOLATION, newDir);
+            }
+        }
+    }
+    
+    FileFormat * CreateFileFormatBinary()
+    {
+        return new LocalFileFormat();
+    }
+}
+OCIO_NAMESPACE_EXIT
+
+
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef OCIO_UNIT_TEST
+
+namespace OCIO = OCIO_NAMESPACE;
+#include "UnitTest.h"
+
+#include <fstream>
+
+namespace
+{
+    OCIO::ConfigRcPtr CreateBinaryLutTestConfig()
+    {
+        OCIO::ConfigRcPtr config = OCIO::Config::Create();
+        
+        config->addColorSpace(OCIO::CreateColorSpace("lnf", OCIO::ConstTransformRcPtr()));
+        config->setRole(OCIO::ROLE_REFERENCE, "lnf");
+        
+        OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+        float value[4] = { 2.6f, 2.6f, 2.6f, 1.0f };
+        exponent->setValue(value);
+        config->addColorSpace(OCIO::CreateColorSpace("shaper", exponent));
+        
+        // Saturation has channel crosstalk, and is linear (so a 2x2x2
+        // cube reproduces it exactly)
+        OCIO::CDLTransformRcPtr sat = OCIO::CDLTransform::Create();
+        sat->setSat(0.5f);
+        config->addColorSpace(OCIO::CreateColorSpace("target", sat,
+                                                     OCIO::COLORSPACE_DIR_FROM_REFERENCE));
+        
+        return config;
+    }
+    
+    OCIO::LocalCachedFileRcPtr BakeBinaryLut(const OCIO::ConstConfigRcPtr & config,
+                                             const char * format,
+                                             const char * shaperSpace,
+                                             const char * targetSpace,
+                                             std::string & data)
+    {
+        OCIO::BakerRcPtr baker = OCIO::Baker::Create();
+        baker->setConfig(config);
+        baker->setFormat(format);
+        baker->setInputSpace("lnf");
+        baker->setShaperSpace(shaperSpace);
+        baker->setTargetSpace(targetSpace);
+        baker->setShaperSize(1024);
+        baker->setCubeSize(2);
+        
+        std::ostringstream output;
+        baker->bake(output);
+        data = output.str();
+        
+        OCIO::LocalFileFormat format_;
+        std::istringstream input(data);
+        return OCIO::DynamicPtrCast<OCIO::LocalCachedFile>(format_.Read(input));
+    }
+}
+
+OIIO_ADD_TEST(FileFormatBinary, BakeLut3D)
+{
+    OCIO::ConfigRcPtr config = CreateBinaryLutTestConfig();
+    
+    std::string data;
+    OCIO::LocalCachedFileRcPtr cachedFile =
+        BakeBinaryLut(config, "ocio_binary", "", "target", data);
+    OIIO_CHECK_ASSERT(cachedFile);
+    if(!cachedFile) return;
+    
+    // Header, domains and the 2x2x2 rgb float cube
+    OIIO_CHECK_EQUAL(data.size(), 8 + 5*4 + 12*4 + 8*3*4u);
+    OIIO_CHECK_ASSERT(!cachedFile->hasShaper);
+    OIIO_CHECK_ASSERT(!cachedFile->has1D);
+    OIIO_CHECK_ASSERT(cachedFile->has3D);
+    OIIO_CHECK_EQUAL(cachedFile->lut3D->size[0], 2);
+    OIIO_CHECK_EQUAL(cachedFile->lut3D->size[2], 2);
+    
+    // Red changes fastest, and the values are stored exactly
+    const float expected[] = { 0.0f, 0.0f, 0.0f,
+                               0.6063f, 0.1063f, 0.1063f,
+                               0.3576f, 0.8576f, 0.3576f };
+    for(int i=0; i<9; ++i)
+    {
+        OIIO_CHECK_CLOSE(cachedFile->lut3D->lut[i], expected[i], 1e-4f);
+    }
+    
+    std::string halfData;
+    OCIO::LocalCachedFileRcPtr halfCachedFile =
+        BakeBinaryLut(config, "ocio_binary_half", "", "target", halfData);
+    OIIO_CHECK_EQUAL(halfData.size(), 8 + 5*4 + 12*4 + 8*3*2u);
+    for(int i=0; i<9; ++i)
+    {
+        OIIO_CHECK_CLOSE(halfCachedFile->lut3D->lut[i], expected[i], 1e-3f);
+    }
+}
+
+OIIO_ADD_TEST(FileFormatBinary, BakeShaper)
+{
+    OCIO::ConfigRcPtr config = CreateBinaryLutTestConfig();
+    
+    std::string data;
+    OCIO::LocalCachedFileRcPtr cachedFile =
+        BakeBinaryLut(config, "ocio_binary", "shaper", "shaper", data);
+    OIIO_CHECK_ASSERT(cachedFile);
+    if(!cachedFile) return;
+    
+    OIIO_CHECK_ASSERT(cachedFile->hasShaper);
+    OIIO_CHECK_ASSERT(cachedFile->has3D);
+    OIIO_CHECK_EQUAL(cachedFile->shaper->luts[1].size(), 1024u);
+    OIIO_CHECK_EQUAL(cachedFile->shaper->from_min[0], 0.0f);
+    OIIO_CHECK_EQUAL(cachedFile->shaper->from_max[0], 1.0f);
+    
+    // The shaper holds the transform to the shaper space
+    OIIO_CHECK_CLOSE(cachedFile->shaper->luts[0][1023], 1.0f, 1e-6f);
+    OIIO_CHECK_CLOSE(cachedFile->shaper->luts[0][512],
+                     powf(512.0f / 1023.0f, 1.0f / 2.6f), 1e-5f);
+    
+    // A shaper mapping [0,1] to a decreasing range is refused
+    OCIO::ColorSpaceRcPtr cs = OCIO::ColorSpace::Create();
+    cs->setName("flipped");
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    float m44[16] = { -1.0f, 0.0f, 0.0f, 0.0f,
+                       0.0f, -1.0f, 0.0f, 0.0f,
+                       0.0f, 0.0f, -1.0f, 0.0f,
+                       0.0f, 0.0f, 0.0f, 1.0f };
+    matrix->setValue(m44, NULL);
+    cs->setTransform(matrix, OCIO::COLORSPACE_DIR_TO_REFERENCE);
+    config->addColorSpace(cs);
+    OIIO_CHECK_THOW(BakeBinaryLut(config, "ocio_binary", "flipped", "target", data),
+                    OCIO::Exception);
+}
+
+OIIO_ADD_TEST(FileFormatBinary, ReadLut1D)
+{
+    OCIO::LocalCachedFile lut;
+    lut.has1D = true;
+    for(int c=0; c<3; ++c)
+    {
+        lut.lut1D->from_min[c] = -1.0f;
+        lut.lut1D->from_max[c] = 2.0f;
+        lut.lut1D->luts[c].push_back(0.0f);
+        lut.lut1D->luts[c].push_back(0.5f * (float)c);
+        lut.lut1D->luts[c].push_back(1.0f);
+    }
+    
+    std::ostringstream output;
+    OCIO::WriteBinaryLut(output, lut, OCIO::BINARY_LUT_ENCODING_FLOAT);
+    const std::string data = output.str();
+    
+    OCIO::LocalFileFormat format;
+    OIIO_CHECK_ASSERT(format.Probe(data));
+    OIIO_CHECK_ASSERT(!format.Probe("OCIO"));
+    OIIO_CHECK_ASSERT(!format.Probe("Version 1\nFrom 0.0 1.0\n"));
+    
+    std::istringstream input(data);
+    OCIO::LocalCachedFileRcPtr cachedFile =
+        OCIO::DynamicPtrCast<OCIO::LocalCachedFile>(format.Read(input));
+    OIIO_CHECK_ASSERT(cachedFile->has1D);
+    OIIO_CHECK_ASSERT(!cachedFile->has3D);
+    OIIO_CHECK_ASSERT(!cachedFile->hasShaper);
+    OIIO_CHECK_EQUAL(cachedFile->lut1D->from_min[1], -1.0f);
+    OIIO_CHECK_EQUAL(cachedFile->lut1D->from_max[2], 2.0f);
+    OIIO_CHECK_EQUAL(cachedFile->lut1D->luts[2].size(), 3u);
+    OIIO_CHECK_EQUAL(cachedFile->lut1D->luts[2][1], 1.0f);
+    
+    // Truncated data
+    for(size_t size = 0; size < data.size(); size += 7)
+    {
+        std::istringstream truncated(data.substr(0, size));
+        OIIO_CHECK_THOW(format.Read(truncated), OCIO::Exception);
+    }
+    
+    // Invalid sizes: a 1D lut of size 1
+    std::string invalid = data;
+    invalid[8 + 3*4] = 1;
+    std::istringstream invalidInput(invalid);
+    OIIO_CHECK_THOW(format.Read(invalidInput), OCIO::Exception);
+    
+    lut.has3D = true;
+    OIIO_CHECK_THOW(OCIO::WriteBinaryLut(output, lut, OCIO::BINARY_LUT_ENCODING_FLOAT),
+                    OCIO::Exception);
+}
+
+OIIO_ADD_TEST(FileFormatBinary, FileTransform)
+{
+    OCIO::TempDirectory dir("binarylut");
+    OCIO::ConfigRcPtr config = CreateBinaryLutTestConfig();
+    
+    std::string data;
+    BakeBinaryLut(config, "ocio_binary", "shaper", "shaper", data);
+    const std::string lutPath = dir.writeFile("lut.blut", data);
+    
+    OCIO::FileTransformRcPtr transform = OCIO::CreateFileTransform(lutPath);
+    OCIO::ConstProcessorRcPtr processor = config->getProcessor(transform);
+    OCIO::ConstProcessorRcPtr reference = config->getProcessor("lnf", "shaper");
+    
+    // The cube is an identity, the shaper does the work
+    float rgb[3] = { 0.25f, 0.5f, 0.75f };
+    float expected[3] = { 0.25f, 0.5f, 0.75f };
+    processor->applyRGB(rgb);
+    reference->applyRGB(expected);
+    for(int c=0; c<3; ++c)
+    {
+        OIIO_CHECK_CLOSE(rgb[c], expected[c], 1e-4f);
+    }
+    
+    // And in reverse
+    transform->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    config->getProcessor(transform)->applyRGB(rgb);
+    OIIO_CHECK_CLOSE(rgb[0], 0.25f, 1e-3f);
+    OIIO_CHECK_CLOSE(rgb[2], 0.75f, 1e-3f);
+    
+    OCIO::ClearAllCaches();
+}
+
+OIIO_ADD_TEST(FileFormatBinary, MappedLut3D)
+{
+    OCIO::TempDirectory dir("binarylut");
+    OCIO::ConfigRcPtr config = CreateBinaryLutTestConfig();
+    
+    std::string data;
+    OCIO::LocalCachedFileRcPtr readFile =
+        BakeBinaryLut(config, "ocio_binary", "", "target", data);
+    const std::string lutPath = dir.writeFile("lut.blut", data);
+    
+    // Read from a file, the float values are borrowed from its mapping
+    // (on little-endian machines)
+    OCIO::LocalFileFormat format;
+    std::ifstream istream(lutPath.c_str(), std::ios_base::in | std::ios_base::binary);
+    OCIO::LocalCachedFileRcPtr mappedFile =
+        OCIO::DynamicPtrCast<OCIO::LocalCachedFile>(format.ReadFile(istream, lutPath));
+    istream.close();
+    OIIO_CHECK_ASSERT(mappedFile->has3D);
+    
+    const OCIO::Lut3D & lut = *mappedFile->lut3D;
+    OIIO_CHECK_EQUAL(lut.borrowedValues != NULL, OCIO::IsLittleEndian());
+    OIIO_CHECK_EQUAL(lut.lut.empty(), OCIO::IsLittleEndian());
+    OIIO_CHECK_EQUAL(lut.getNumValues(), readFile->lut3D->lut.size());
+    for(size_t i=0; i<lut.getNumValues(); ++i)
+    {
+        OIIO_CHECK_EQUAL(lut.getValues()[i], readFile->lut3D->lut[i]);
+    }
+    OIIO_CHECK_EQUAL(lut.getCacheID(), readFile->lut3D->getCacheID());
+    
+    // And applied in place
+    OCIO::ConstProcessorRcPtr processor =
+        config->getProcessor(OCIO::CreateFileTransform(lutPath));
+    OCIO::ConstProcessorRcPtr reference = config->getProcessor("lnf", "target");
+    float rgb[3] = { 0.25f, 0.5f, 0.75f };
+    float expected[3] = { 0.25f, 0.5f, 0.75f };
+    processor->applyRGB(rgb);
+    reference->applyRGB(expected);
+    for(int c=0; c<3; ++c)
+    {
+        OIIO_CHECK_CLOSE(rgb[c], expected[c], 1e-4f);
+    }
+    
+    // Half values are converted, so they are read
+    BakeBinaryLut(config, "ocio_binary_half", "", "target", data);
+    const std::string halfPath = dir.writeFile("half.blut", data);
+    std::ifstream halfStream(halfPath.c_str(), std::ios_base::in | std::ios_base::binary);
+    OCIO::LocalCachedFileRcPtr halfFile =
+        OCIO::DynamicPtrCast<OCIO::LocalCachedFile>(format.ReadFile(halfStream, halfPath));
+    OIIO_CHECK_ASSERT(halfFile->lut3D->borrowedValues == NULL);
+    OIIO_CHECK_EQUAL(halfFile->lut3D->lut.size(), readFile->lut3D->lut.size());
+    
+    OCIO::ClearAllCaches();
+}
+
+#endif // OCIO_UNIT_TEST
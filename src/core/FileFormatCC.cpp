@@ -28,6 +28,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "CDLTransform.h"
 #include "FileTransform.h"
 #include "OpBuilders.h"
 
@@ -47,6 +48,11 @@ OCIO_NAMESPACE_ENTER
             
             ~LocalCachedFile() {};
             
+            virtual size_t getMemorySize() const
+            {
+                return sizeof(*this) + GetCDLTransformMemorySize(transform);
+            }
+            
             CDLTransformRcPtr transform;
         };
         
@@ -64,6 +70,8 @@ OCIO_NAMESPACE_ENTER
             
             virtual CachedFileRcPtr Read(std::istream & istream) const;
             
+            virtual bool Probe(const std::string & head) const;
+            
             virtual void BuildFileOps(OpRcPtrVec & ops,
                                       const Config& config,
                                       const ConstContextRcPtr & context,
@@ -81,6 +89,11 @@ OCIO_NAMESPACE_ENTER
             formatInfoVec.push_back(info);
         }
         
+        bool LocalFileFormat::Probe(const std::string & head) const
+        {
+            return ProbeIsXml(head);
+        }
+        
         // Try and load the format
         // Raise an exception if it can't be loaded.
         
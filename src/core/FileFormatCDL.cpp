@@ -49,6 +49,22 @@ OCIO_NAMESPACE_ENTER
             LocalCachedFile () {};
             ~LocalCachedFile() {};
             
+            virtual size_t getMemorySize() const
+            {
+                // The map holds the same transforms as the vector
+                size_t size = sizeof(*this);
+                for(unsigned int i=0; i<transformVec.size(); ++i)
+                {
+                    size += GetCDLTransformMemorySize(transformVec[i]);
+                }
+                for(CDLTransformMap::const_iterator iter = transformMap.begin();
+                    iter != transformMap.end(); ++iter)
+                {
+                    size += sizeof(*iter) + iter->first.capacity();
+                }
+                return size;
+            }
+            
             CDLTransformMap transformMap;
             CDLTransformVec transformVec;
         };
@@ -68,6 +84,8 @@ OCIO_NAMESPACE_ENTER
             
             virtual CachedFileRcPtr Read(std::istream & istream) const;
             
+            virtual bool Probe(const std::string & head) const;
+            
             virtual void BuildFileOps(OpRcPtrVec & ops,
                                       const Config& config,
                                       const ConstContextRcPtr & context,
@@ -85,6 +103,11 @@ OCIO_NAMESPACE_ENTER
             formatInfoVec.push_back(info);
         }
         
+        bool LocalFileFormat::Probe(const std::string & head) const
+        {
+            return ProbeIsXml(head);
+        }
+        
         // Try and load the format
         // Raise an exception if it can't be loaded.
         
@@ -37,9 +37,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "BakingUtils.h"
 #include "FileTransform.h"
 #include "Lut1DOp.h"
 #include "Lut3DOp.h"
+#include "LutCache.h"
 #include "MathUtils.h"
 #include "ParseUtils.h"
 #include "pystring/pystring.h"
@@ -321,6 +323,13 @@ OCIO_NAMESPACE_ENTER
             };
             ~CachedFileCSP() {};
             
+            virtual size_t getMemorySize() const
+            {
+                return sizeof(*this) + csptype.capacity() + metadata.capacity()
+                    + prelut->getMemorySize() + lut1D->getMemorySize()
+                    + lut3D->getMemorySize();
+            }
+            
             bool hasprelut;
             std::string csptype;
             std::string metadata;
@@ -346,6 +355,8 @@ OCIO_NAMESPACE_ENTER
             
             virtual CachedFileRcPtr Read(std::istream & istream) const;
             
+            virtual bool Probe(const std::string & head) const;
+            
             virtual void Write(const Baker & baker,
                                const std::string & formatName,
                                std::ostream & ostream) const;
@@ -356,6 +367,11 @@ OCIO_NAMESPACE_ENTER
                                       CachedFileRcPtr untypedCachedFile,
                                       const FileTransform& fileTransform,
                                       TransformDirection dir) const;
+            
+            virtual bool WriteCache(std::ostream & ostream,
+                                    const CachedFileRcPtr & untypedCachedFile) const;
+            
+            virtual CachedFileRcPtr ReadCache(std::istream & istream) const;
         };
 
 
@@ -378,6 +394,13 @@ OCIO_NAMESPACE_ENTER
             formatInfoVec.push_back(info);
         }
         
+        bool LocalFileFormat::Probe(const std::string & head) const
+        {
+            std::string line;
+            if(!GetProbeFirstLine(line, head, false)) return true;
+            return startswithU(line, "CSPLUTV100");
+        }
+        
         CachedFileRcPtr
         LocalFileFormat::Read(std::istream & istream) const
         {
@@ -654,16 +677,13 @@ OCIO_NAMESPACE_ENTER
             int cubeSize = baker.getCubeSize();
             if(cubeSize==-1) cubeSize = DEFAULT_CUBE_SIZE;
             cubeSize = std::max(2, cubeSize); // smallest cube is 2x2x2
-            std::vector<float> cubeData;
-            cubeData.resize(cubeSize*cubeSize*cubeSize*3);
-            GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_RED);
-            PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
-
-            std::string looks = baker.getLooks();
             
             std::vector<float> shaperInData;
             std::vector<float> shaperOutData;
             
+            // The processors taking the cube lattice to the target space
+            std::vector<ConstProcessorRcPtr> cubeProcessors;
+            
             // Use an explicitly shaper space
             // TODO: Use the optional allocation for the shaper space,
             //       instead of the implied 0-1 uniform allocation
@@ -698,22 +718,8 @@ OCIO_NAMESPACE_ENTER
                 PackedImageDesc shaperInImg(&shaperInData[0], shaperSize, 1, 3);
                 shaperToInput->apply(shaperInImg);
 
-                ConstProcessorRcPtr shaperToTarget;
-                if (!looks.empty())
-                {
-                    LookTransformRcPtr transform = LookTransform::Create();
-                    transform->setLooks(looks.c_str());
-                    transform->setSrc(baker.getShaperSpace());
-                    transform->setDst(baker.getTargetSpace());
-                    shaperToTarget = config->getProcessor(transform,
-                        TRANSFORM_DIR_FORWARD);
-                }
-                else
-                {
-                  shaperToTarget = config->getProcessor(baker.getShaperSpace(),
-                      baker.getTargetSpace());
-                }
-                shaperToTarget->apply(cubeImg);
+                cubeProcessors.push_back(
+                    GetBakerProcessor(baker, baker.getShaperSpace()));
             }
             else
             {
@@ -765,42 +771,27 @@ OCIO_NAMESPACE_ENTER
                 ConstProcessorRcPtr shaperToInput = config->getProcessor(allocationTransform, TRANSFORM_DIR_INVERSE);
                 PackedImageDesc shaperInImg(&shaperInData[0], shaperSize, 1, 3);
                 shaperToInput->apply(shaperInImg);
-                shaperToInput->apply(cubeImg);
+                cubeProcessors.push_back(shaperToInput);
                 
                 // Apply the 3d lut to the remainder (from the input to the output)
-                ConstProcessorRcPtr inputToTarget;
-                if (!looks.empty())
-                {
-                    LookTransformRcPtr transform = LookTransform::Create();
-                    transform->setLooks(looks.c_str());
-                    transform->setSrc(baker.getInputSpace());
-                    transform->setDst(baker.getTargetSpace());
-                    inputToTarget = config->getProcessor(transform,
-                        TRANSFORM_DIR_FORWARD);
-                }
-                else
-                {
-                    inputToTarget = config->getProcessor(baker.getInputSpace(), baker.getTargetSpace());
-                }
-                inputToTarget->apply(cubeImg);
+                cubeProcessors.push_back(
+                    GetBakerProcessor(baker, baker.getInputSpace()));
             }
             
             // Write out the file
-            ostream << "CSPLUTV100\n";
-            ostream << "3D\n";
-            ostream << "BEGIN METADATA\n";
+            LutTextWriter writer(ostream);
+            writer << "CSPLUTV100\n";
+            writer << "3D\n";
+            writer << "BEGIN METADATA\n";
             std::string metadata = baker.getMetadata();
             if(!metadata.empty())
             {
-                ostream << metadata << "\n";
+                writer << metadata << "\n";
             }
-            ostream << "END METADATA\n";
-            ostream << "\n";
+            writer << "END METADATA\n";
+            writer << "\n";
             
             // Write out the 1D Prelut
-            ostream.setf(std::ios::fixed, std::ios::floatfield);
-            ostream.precision(6);
-            
             if(shaperInData.size()<2 || shaperOutData.size() != shaperInData.size())
             {
                 throw Exception("Internal shaper size exception.");
@@ -810,35 +801,62 @@ OCIO_NAMESPACE_ENTER
             {
                 for(int c=0; c<3; ++c)
                 {
-                    ostream << shaperInData.size()/3 << "\n";
+                    writer << static_cast<int>(shaperInData.size()/3) << "\n";
                     for(unsigned int i = 0; i<shaperInData.size()/3; ++i)
                     {
-                        if(i != 0) ostream << " ";
-                        ostream << shaperInData[3*i+c];
+                        if(i != 0) writer << " ";
+                        writer << shaperInData[3*i+c];
                     }
-                    ostream << "\n";
+                    writer << "\n";
                     
                     for(unsigned int i = 0; i<shaperInData.size()/3; ++i)
                     {
-                        if(i != 0) ostream << " ";
-                        ostream << shaperOutData[3*i+c];
+                        if(i != 0) writer << " ";
+                        writer << shaperOutData[3*i+c];
                     }
-                    ostream << "\n";
+                    writer << "\n";
                 }
             }
-            ostream << "\n";
+            writer << "\n";
             
             // Write out the 3D Cube
             if(cubeSize < 2)
             {
                 throw Exception("Internal cube size exception.");
             }
-            ostream << cubeSize << " " << cubeSize << " " << cubeSize << "\n";
-            for(int i=0; i<cubeSize*cubeSize*cubeSize; ++i)
-            {
-                ostream << cubeData[3*i+0] << " " << cubeData[3*i+1] << " " << cubeData[3*i+2] << "\n";
-            }
-            ostream << "\n";
+            writer << cubeSize << " " << cubeSize << " " << cubeSize << "\n";
+            Lut3DTextSink cubeWriter(writer);
+            BakeLut3D(cubeWriter, cubeSize, LUT3DORDER_FAST_RED, cubeProcessors);
+            writer << "\n";
+            writer.flush();
+        }
+        
+        bool LocalFileFormat::WriteCache(std::ostream & ostream,
+                                         const CachedFileRcPtr & untypedCachedFile) const
+        {
+            CachedFileCSPRcPtr cachedFile = DynamicPtrCast<CachedFileCSP>(untypedCachedFile);
+            if(!cachedFile) return false;
+            
+            WriteLutCacheBool(ostream, cachedFile->hasprelut);
+            WriteLutCacheString(ostream, cachedFile->csptype);
+            WriteLutCacheString(ostream, cachedFile->metadata);
+            if(cachedFile->hasprelut) WriteLutCacheLut1D(ostream, cachedFile->prelut);
+            if(cachedFile->csptype == "1D") WriteLutCacheLut1D(ostream, cachedFile->lut1D);
+            else if(cachedFile->csptype == "3D") WriteLutCacheLut3D(ostream, cachedFile->lut3D);
+            return true;
+        }
+        
+        CachedFileRcPtr LocalFileFormat::ReadCache(std::istream & istream) const
+        {
+            CachedFileCSPRcPtr cachedFile = CachedFileCSPRcPtr(new CachedFileCSP());
+            
+            cachedFile->hasprelut = ReadLutCacheBool(istream);
+            cachedFile->csptype = ReadLutCacheString(istream);
+            cachedFile->metadata = ReadLutCacheString(istream);
+            if(cachedFile->hasprelut) cachedFile->prelut = ReadLutCacheLut1D(istream);
+            if(cachedFile->csptype == "1D") cachedFile->lut1D = ReadLutCacheLut1D(istream);
+            else if(cachedFile->csptype == "3D") cachedFile->lut3D = ReadLutCacheLut3D(istream);
+            return cachedFile;
         }
         
         void
@@ -54,6 +54,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "BakingUtils.h"
 #include "FileTransform.h"
 #include "Lut1DOp.h"
 #include "Lut3DOp.h"
@@ -256,6 +257,13 @@ OCIO_NAMESPACE_ENTER
                 lut3D = Lut3D::Create();
             };
             ~CachedFileHDL() {};
+            
+            virtual size_t getMemorySize() const
+            {
+                return sizeof(*this) + hdlversion.capacity()
+                    + hdlformat.capacity() + hdltype.capacity()
+                    + lut1D->getMemorySize() + lut3D->getMemorySize();
+            }
             std::string hdlversion;
             std::string hdlformat;
             std::string hdltype;
@@ -588,10 +596,6 @@ OCIO_NAMESPACE_ENTER
             // Get config
             ConstConfigRcPtr config = baker.getConfig();
 
-            // setup the floating point precision
-            ostream.setf(std::ios::fixed, std::ios::floatfield);
-            ostream.precision(6);
-
             // Default sizes
             const int DEFAULT_SHAPER_SIZE = 1024;
             // MPlay produces bad results with 32^3 cube (in a way
@@ -761,16 +765,11 @@ OCIO_NAMESPACE_ENTER
             
             // TODO: Do same "auto prelut" input-space allocation as FileFormatCSP?
             
-            // Make 3D LUT
-            std::vector<float> cubeData;
+            // Pick the 3D LUT processor (the cube itself is baked as it is
+            // written out)
+            ConstProcessorRcPtr cubeProc;
             if(required_lut == HDL_3D || required_lut == HDL_3D1D)
             {
-                cubeData.resize(cubeSize*cubeSize*cubeSize*3);
-                
-                GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_RED);
-                PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
-                
-                ConstProcessorRcPtr cubeProc;
                 if(required_lut == HDL_3D1D)
                 {
                     // Prelut goes from input-to-shaper, so cube goes from shaper-to-target
@@ -794,9 +793,6 @@ OCIO_NAMESPACE_ENTER
                     // No prelut, so cube goes from input-to-target
                   cubeProc = inputToTargetProc;
                 }
-
-                
-                cubeProc->apply(cubeImg);
             }
             
             
@@ -814,91 +810,89 @@ OCIO_NAMESPACE_ENTER
             
             
             // Write the file contents
-            ostream << "Version\t\t" << required_lut << "\n";
-            ostream << "Format\t\t" << "any" << "\n";
+            LutTextWriter writer(ostream);
+            writer << "Version\t\t" << required_lut << "\n";
+            writer << "Format\t\t" << "any" << "\n";
             
-            ostream << "Type\t\t";
+            writer << "Type\t\t";
             if(required_lut == HDL_1D)
-                ostream << "RGB";
+                writer << "RGB";
             if(required_lut == HDL_3D)
-                ostream << "3D";
+                writer << "3D";
             if(required_lut == HDL_3D1D)
-                ostream << "3D+1D";
-            ostream << "\n";
+                writer << "3D+1D";
+            writer << "\n";
             
-            ostream << "From\t\t" << fromInStart << " " << fromInEnd << "\n";
-            ostream << "To\t\t" << 0.0f << " " << 1.0f << "\n";
-            ostream << "Black\t\t" << 0.0f << "\n";
-            ostream << "White\t\t" << 1.0f << "\n";
+            writer << "From\t\t" << fromInStart << " " << fromInEnd << "\n";
+            writer << "To\t\t" << 0.0f << " " << 1.0f << "\n";
+            writer << "Black\t\t" << 0.0f << "\n";
+            writer << "White\t\t" << 1.0f << "\n";
             
             if(required_lut == HDL_3D1D)
-                ostream << "Length\t\t" << cubeSize << " " << shaperSize << "\n";
+                writer << "Length\t\t" << cubeSize << " " << shaperSize << "\n";
             if(required_lut == HDL_3D)
-                ostream << "Length\t\t" << cubeSize << "\n";
+                writer << "Length\t\t" << cubeSize << "\n";
             if(required_lut == HDL_1D)
-                ostream << "Length\t\t" << onedSize << "\n";
+                writer << "Length\t\t" << onedSize << "\n";
             
-            ostream << "LUT:\n";
+            writer << "LUT:\n";
             
             // Write prelut
             if(required_lut == HDL_3D1D)
             {
-                ostream << "Pre {\n";
+                writer << "Pre {\n";
                 for(int i=0; i < shaperSize; ++i)
                 {
                     // Grab green channel from RGB prelut
-                    ostream << "\t" << prelutData[i*3+1] << "\n";
+                    writer << "\t" << prelutData[i*3+1] << "\n";
                 }
-                ostream << "}\n";
+                writer << "}\n";
             }
             
             // Write "3D {" part of output of 3D+1D LUT
             if(required_lut == HDL_3D1D)
             {
-                ostream << "3D {\n";
+                writer << "3D {\n";
             }
             
             // Write the slightly-different "{" without line for the 3D-only LUT
             if(required_lut == HDL_3D)
             {
-                ostream << " {\n";
+                writer << " {\n";
             }
             
             // Write the cube data after the "{"
             if(required_lut == HDL_3D || required_lut == HDL_3D1D)
             {
-                for(int i=0; i < cubeSize*cubeSize*cubeSize; ++i)
-                {
-                    // TODO: Original baker code clamped values to
-                    // 1.0, was this necessary/desirable?
-
-                    ostream << "\t" << cubeData[3*i+0];
-                    ostream << " "  << cubeData[3*i+1];
-                    ostream << " "  << cubeData[3*i+2] << "\n";
-                }
+                // TODO: Original baker code clamped values to
+                // 1.0, was this necessary/desirable?
+                Lut3DTextSink cubeWriter(writer, "\t");
+                BakeLut3D(cubeWriter, cubeSize, LUT3DORDER_FAST_RED, cubeProc);
                 
                 // Write closing "}"
-                ostream << " }\n";
+                writer << " }\n";
             }
             
             // Write out channels for 1D LUT
             if(required_lut == HDL_1D)
             {
-                ostream << "R {\n";
+                writer << "R {\n";
                 for(int i=0; i < onedSize; ++i)
-                    ostream << "\t" << onedData[i*3+0] << "\n";
-                ostream << "}\n";
+                    writer << "\t" << onedData[i*3+0] << "\n";
+                writer << "}\n";
 
-                ostream << "G {\n";
+                writer << "G {\n";
                 for(int i=0; i < onedSize; ++i)
-                    ostream << "\t" << onedData[i*3+1] << "\n";
-                ostream << "}\n";
+                    writer << "\t" << onedData[i*3+1] << "\n";
+                writer << "}\n";
 
-                ostream << "B {\n";
+                writer << "B {\n";
                 for(int i=0; i < onedSize; ++i)
-                    ostream << "\t" << onedData[i*3+2] << "\n";
-                ostream << "}\n";
+                    writer << "\t" << onedData[i*3+2] << "\n";
+                writer << "}\n";
             }
+            
+            writer.flush();
         }
         
         void
@@ -35,6 +35,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "FileTransform.h"
 #include "Lut1DOp.h"
 #include "Lut3DOp.h"
+#include "LutCache.h"
 #include "ParseUtils.h"
 #include "pystring/pystring.h"
 
@@ -101,6 +102,11 @@ OCIO_NAMESPACE_ENTER
             };
             ~LocalCachedFile() {};
             
+            virtual size_t getMemorySize() const
+            {
+                return sizeof(*this) + lut1D->getMemorySize() + lut3D->getMemorySize();
+            }
+            
             bool has1D;
             bool has3D;
             Lut1DRcPtr lut1D;
@@ -121,12 +127,19 @@ OCIO_NAMESPACE_ENTER
             
             virtual CachedFileRcPtr Read(std::istream & istream) const;
             
+            virtual bool Probe(const std::string & head) const;
+            
             virtual void BuildFileOps(OpRcPtrVec & ops,
                          const Config& config,
                          const ConstContextRcPtr & context,
                          CachedFileRcPtr untypedCachedFile,
                          const FileTransform& fileTransform,
                          TransformDirection dir) const;
+            
+            virtual bool WriteCache(std::ostream & ostream,
+                                    const CachedFileRcPtr & untypedCachedFile) const;
+            
+            virtual CachedFileRcPtr ReadCache(std::istream & istream) const;
         };
         
         void LocalFileFormat::GetFormatInfo(FormatInfoVec & formatInfoVec) const
@@ -138,6 +151,26 @@ OCIO_NAMESPACE_ENTER
             formatInfoVec.push_back(info);
         }
         
+        bool LocalFileFormat::Probe(const std::string & head) const
+        {
+            // The first line that is not a comment must be a keyword
+            // or a color triple
+            std::string line;
+            if(!GetProbeFirstLine(line, head, true)) return true;
+            
+            std::vector<std::string> parts;
+            pystring::split(pystring::lower(pystring::strip(line)), parts);
+            if(parts[0] == "title" || parts[0] == "lut_1d_size" ||
+               parts[0] == "lut_3d_size" || parts[0] == "domain_min" ||
+               parts[0] == "domain_max")
+            {
+                return true;
+            }
+            
+            std::vector<float> values;
+            return StringVecToFloatVec(values, parts) && values.size() == 3;
+        }
+        
         CachedFileRcPtr
         LocalFileFormat::Read(std::istream & istream) const
         {
@@ -160,12 +193,26 @@ OCIO_NAMESPACE_ENTER
             float domain_max[] = { 1.0f, 1.0f, 1.0f };
             
             {
+                LineTokenizer tokenizer(istream);
                 std::string line;
                 std::vector<std::string> parts;
                 std::vector<float> tmpfloats;
+                float triple[3];
                 
-                while(nextline(istream, line))
+                while(tokenizer.nextNonEmptyLine())
                 {
+                    // Color triples make up nearly all of the file, so
+                    // they are tried first, straight from the buffer
+                    if(tokenizer.lineToFloats(triple, 3))
+                    {
+                        raw.push_back(triple[0]);
+                        raw.push_back(triple[1]);
+                        raw.push_back(triple[2]);
+                        continue;
+                    }
+                    
+                    line = tokenizer.line();
+                    
                     // All lines starting with '#' are comments
                     if(pystring::startswith(line,"#")) continue;
                     
@@ -325,6 +372,30 @@ OCIO_NAMESPACE_ENTER
             return cachedFile;
         }
         
+        bool LocalFileFormat::WriteCache(std::ostream & ostream,
+                                         const CachedFileRcPtr & untypedCachedFile) const
+        {
+            LocalCachedFileRcPtr cachedFile = DynamicPtrCast<LocalCachedFile>(untypedCachedFile);
+            if(!cachedFile) return false;
+            
+            WriteLutCacheBool(ostream, cachedFile->has1D);
+            WriteLutCacheBool(ostream, cachedFile->has3D);
+            if(cachedFile->has1D) WriteLutCacheLut1D(ostream, cachedFile->lut1D);
+            if(cachedFile->has3D) WriteLutCacheLut3D(ostream, cachedFile->lut3D);
+            return true;
+        }
+        
+        CachedFileRcPtr LocalFileFormat::ReadCache(std::istream & istream) const
+        {
+            LocalCachedFileRcPtr cachedFile = LocalCachedFileRcPtr(new LocalCachedFile());
+            
+            cachedFile->has1D = ReadLutCacheBool(istream);
+            cachedFile->has3D = ReadLutCacheBool(istream);
+            if(cachedFile->has1D) cachedFile->lut1D = ReadLutCacheLut1D(istream);
+            if(cachedFile->has3D) cachedFile->lut3D = ReadLutCacheLut3D(istream);
+            return cachedFile;
+        }
+        
         void
         LocalFileFormat::BuildFileOps(OpRcPtrVec & ops,
                                       const Config& /*config*/,
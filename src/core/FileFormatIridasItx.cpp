@@ -32,6 +32,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "BakingUtils.h"
 #include "FileTransform.h"
 #include "Lut1DOp.h"
 #include "Lut3DOp.h"
@@ -77,6 +78,11 @@ OCIO_NAMESPACE_ENTER
             };
             ~LocalCachedFile() {};
             
+            virtual size_t getMemorySize() const
+            {
+                return sizeof(*this) + lut3D->getMemorySize();
+            }
+            
             Lut3DRcPtr lut3D;
         };
         
@@ -225,57 +231,30 @@ OCIO_NAMESPACE_ENTER
                 throw Exception(os.str().c_str());
             }
             
-            ConstConfigRcPtr config = baker.getConfig();
-            
             int cubeSize = baker.getCubeSize();
             if(cubeSize==-1) cubeSize = DEFAULT_CUBE_SIZE;
             cubeSize = std::max(2, cubeSize); // smallest cube is 2x2x2
             
-            std::vector<float> cubeData;
-            cubeData.resize(cubeSize*cubeSize*cubeSize*3);
-            GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_RED);
-            PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
-            
-            // Apply our conversion from the input space to the output space.
-            ConstProcessorRcPtr inputToTarget;
-            std::string looks = baker.getLooks();
-            if (!looks.empty())
-            {
-                LookTransformRcPtr transform = LookTransform::Create();
-                transform->setLooks(looks.c_str());
-                transform->setSrc(baker.getInputSpace());
-                transform->setDst(baker.getTargetSpace());
-                inputToTarget = config->getProcessor(transform,
-                    TRANSFORM_DIR_FORWARD);
-            }
-            else
-            {
-                inputToTarget = config->getProcessor(baker.getInputSpace(),
-                    baker.getTargetSpace());
-            }
-            inputToTarget->apply(cubeImg);
+            // Our conversion from the input space to the output space.
+            ConstProcessorRcPtr inputToTarget =
+                GetBakerProcessor(baker, baker.getInputSpace());
             
             // Write out the file.
             // For for maximum compatibility with other apps, we will
             // not utilize the shaper or output any metadata
             
-            ostream << "LUT_3D_SIZE " << cubeSize << "\n";
+            LutTextWriter writer(ostream);
+            writer << "LUT_3D_SIZE " << cubeSize << '\n';
             if(cubeSize < 2)
             {
                 throw Exception("Internal cube size exception.");
             }
             
-            // Set to a fixed 6 decimal precision
-            ostream.setf(std::ios::fixed, std::ios::floatfield);
-            ostream.precision(6);
-            for(int i=0; i<cubeSize*cubeSize*cubeSize; ++i)
-            {
-                float r = cubeData[3*i+0];
-                float g = cubeData[3*i+1];
-                float b = cubeData[3*i+2];
-                ostream << r << " " << g << " " << b << "\n";
-            }
-            ostream << "\n";
+            // The values have a fixed 6 decimal precision
+            Lut3DTextSink cubeWriter(writer);
+            BakeLut3D(cubeWriter, cubeSize, LUT3DORDER_FAST_RED, inputToTarget);
+            writer << '\n';
+            writer.flush();
         }
         
         
@@ -161,6 +161,11 @@ OCIO_NAMESPACE_ENTER
                 lut3D = Lut3D::Create();
             };
             ~LocalCachedFile() {};
+            
+            virtual size_t getMemorySize() const
+            {
+                return sizeof(*this) + lut3D->getMemorySize();
+            }
 
             Lut3DRcPtr lut3D;
         };
@@ -178,6 +183,8 @@ OCIO_NAMESPACE_ENTER
             virtual void GetFormatInfo(FormatInfoVec & formatInfoVec) const;
 
             virtual CachedFileRcPtr Read(std::istream & istream) const;
+            
+            virtual bool Probe(const std::string & head) const;
 
             virtual void BuildFileOps(OpRcPtrVec & ops,
                          const Config& config,
@@ -195,6 +202,11 @@ OCIO_NAMESPACE_ENTER
             info.capabilities = FORMAT_CAPABILITY_READ;
             formatInfoVec.push_back(info);
         }
+        
+        bool LocalFileFormat::Probe(const std::string & head) const
+        {
+            return ProbeIsXml(head);
+        }
 
         CachedFileRcPtr
         LocalFileFormat::Read(std::istream & istream) const
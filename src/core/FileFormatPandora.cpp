@@ -51,6 +51,11 @@ OCIO_NAMESPACE_ENTER
             };
             ~LocalCachedFile() {};
             
+            virtual size_t getMemorySize() const
+            {
+                return sizeof(*this) + lut3D->getMemorySize();
+            }
+            
             Lut3DRcPtr lut3D;
         };
         
@@ -30,6 +30,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "FileTransform.h"
 #include "Lut1DOp.h"
+#include "LutCache.h"
+#include "ParseUtils.h"
 #include "pystring/pystring.h"
 
 #include <cstdio>
@@ -64,6 +66,11 @@ OCIO_NAMESPACE_ENTER
             };
             ~LocalCachedFile() {};
             
+            virtual size_t getMemorySize() const
+            {
+                return sizeof(*this) + lut->getMemorySize();
+            }
+            
             Lut1DRcPtr lut;
         };
         
@@ -86,6 +93,11 @@ OCIO_NAMESPACE_ENTER
                          CachedFileRcPtr untypedCachedFile,
                          const FileTransform& fileTransform,
                          TransformDirection dir) const;
+            
+            virtual bool WriteCache(std::ostream & ostream,
+                                    const CachedFileRcPtr & untypedCachedFile) const;
+            
+            virtual CachedFileRcPtr ReadCache(std::istream & istream) const;
         };
         
         void LocalFileFormat::GetFormatInfo(FormatInfoVec & formatInfoVec) const
@@ -111,16 +123,15 @@ OCIO_NAMESPACE_ENTER
             int version = -1;
             int components = -1;
 
-            const int MAX_LINE_SIZE = 4096;
-            char lineBuffer[MAX_LINE_SIZE];
+            LineTokenizer tokenizer(istream);
 
             // PARSE HEADER INFO
             {
                 std::string headerLine("");
-                do
+                while (tokenizer.nextLine())
                 {
-                    istream.getline(lineBuffer, MAX_LINE_SIZE);
-                    headerLine = std::string(lineBuffer);
+                    headerLine = tokenizer.line();
+                    const char * lineBuffer = headerLine.c_str();
                     if(pystring::startswith(headerLine, "Version"))
                     {
                         if(sscanf(lineBuffer, "Version %d", &version)!=1)
@@ -141,8 +152,9 @@ OCIO_NAMESPACE_ENTER
                         if(sscanf(lineBuffer, "Length %d", &lut_size)!=1)
                             throw Exception("Invalid 'Length' Tag");
                     }
+                    
+                    if(pystring::startswith(headerLine, "{")) break;
                 }
-                while (istream.good() && !pystring::startswith(headerLine,"{"));
             }
 
             if(version == -1)
@@ -167,15 +179,33 @@ OCIO_NAMESPACE_ENTER
             }
 
             {
-                istream.getline(lineBuffer, MAX_LINE_SIZE);
-
+                std::string line;
                 int lineCount=0;
                 float values[4];
 
-                while (istream.good())
+                while (tokenizer.nextLine())
                 {
+                    // Lines of exactly 'components' plain numbers are
+                    // parsed from the buffer, anything else with sscanf
+                    bool parsed = false;
+                    if(components>0)
+                    {
+                        parsed = tokenizer.lineToFloats(values, components);
+                        if(!parsed)
+                        {
+                            line = tokenizer.line();
+                            const char * lineBuffer = line.c_str();
+                            if(components==1)
+                                parsed = sscanf(lineBuffer,"%f",&values[0])==1;
+                            else if(components==2)
+                                parsed = sscanf(lineBuffer,"%f %f",&values[0],&values[1])==2;
+                            else
+                                parsed = sscanf(lineBuffer,"%f %f %f",&values[0],&values[1],&values[2])==3;
+                        }
+                    }
+                    
                     // If 1 component is specificed, use x1 x1 x1 defaultA
-                    if(components==1 && sscanf(lineBuffer,"%f",&values[0])==1)
+                    if(parsed && components==1)
                     {
                         lut1d->luts[0].push_back(values[0]);
                         lut1d->luts[1].push_back(values[0]);
@@ -183,7 +213,7 @@ OCIO_NAMESPACE_ENTER
                         ++lineCount;
                     }
                     // If 2 components are specificed, use x1 x2 0.0
-                    else if(components==2 && sscanf(lineBuffer,"%f %f",&values[0],&values[1])==2)
+                    else if(parsed && components==2)
                     {
                         lut1d->luts[0].push_back(values[0]);
                         lut1d->luts[1].push_back(values[1]);
@@ -191,7 +221,7 @@ OCIO_NAMESPACE_ENTER
                         ++lineCount;
                     }
                     // If 3 component is specificed, use x1 x2 x3 defaultA
-                    else if(components==3 && sscanf(lineBuffer,"%f %f %f",&values[0],&values[1],&values[2])==3)
+                    else if(parsed && components==3)
                     {
                         lut1d->luts[0].push_back(values[0]);
                         lut1d->luts[1].push_back(values[1]);
@@ -200,8 +230,6 @@ OCIO_NAMESPACE_ENTER
                     }
 
                     if(lineCount == lut_size) break;
-
-                    istream.getline(lineBuffer, MAX_LINE_SIZE);
                 }
 
                 if(lineCount!=lut_size)
@@ -226,7 +254,25 @@ OCIO_NAMESPACE_ENTER
             cachedFile->lut = lut1d;
             return cachedFile;
         }
-
+        
+        bool LocalFileFormat::WriteCache(std::ostream & ostream,
+                                         const CachedFileRcPtr & untypedCachedFile) const
+        {
+            LocalCachedFileRcPtr cachedFile = DynamicPtrCast<LocalCachedFile>(untypedCachedFile);
+            if(!cachedFile) return false;
+            
+            WriteLutCacheLut1D(ostream, cachedFile->lut);
+            return true;
+        }
+        
+        CachedFileRcPtr LocalFileFormat::ReadCache(std::istream & istream) const
+        {
+            LocalCachedFileRcPtr cachedFile = LocalCachedFileRcPtr(new LocalCachedFile());
+            
+            cachedFile->lut = ReadLutCacheLut1D(istream);
+            return cachedFile;
+        }
+        
         void LocalFileFormat::BuildFileOps(OpRcPtrVec & ops,
                                   const Config& /*config*/,
                                   const ConstContextRcPtr & /*context*/,
@@ -30,6 +30,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "FileTransform.h"
 #include "Lut3DOp.h"
+#include "LutCache.h"
+#include "ParseUtils.h"
 #include "pystring/pystring.h"
 
 #include <cstdio>
@@ -64,11 +66,43 @@ OCIO_NAMESPACE_ENTER
             };
             ~LocalCachedFile() {};
             
+            virtual size_t getMemorySize() const
+            {
+                return sizeof(*this) + lut->getMemorySize();
+            }
+            
             Lut3DRcPtr lut;
         };
         
         typedef OCIO_SHARED_PTR<LocalCachedFile> LocalCachedFileRcPtr;
         
+        // Parse an entry line holding exactly its six plain numbers
+        bool ParseEntry(LineTokenizer & tokenizer, int * indices, float * values)
+        {
+            const char * begin = 0;
+            const char * end = 0;
+            const char * next = 0;
+            
+            for(int i=0; i<3; ++i)
+            {
+                if(!tokenizer.nextToken(begin, end) ||
+                   !ParseInt(indices[i], begin, end, &next) || next != end)
+                {
+                    return false;
+                }
+            }
+            for(int i=0; i<3; ++i)
+            {
+                if(!tokenizer.nextToken(begin, end) ||
+                   !ParseFloat(values[i], begin, end, &next) || next != end)
+                {
+                    return false;
+                }
+            }
+            
+            return !tokenizer.nextToken(begin, end);
+        }
+        
         
         
         class LocalFileFormat : public FileFormat
@@ -81,12 +115,19 @@ OCIO_NAMESPACE_ENTER
             
             virtual CachedFileRcPtr Read(std::istream & istream) const;
             
+            virtual bool Probe(const std::string & head) const;
+            
             virtual void BuildFileOps(OpRcPtrVec & ops,
                          const Config& config,
                          const ConstContextRcPtr & context,
                          CachedFileRcPtr untypedCachedFile,
                          const FileTransform& fileTransform,
                          TransformDirection dir) const;
+            
+            virtual bool WriteCache(std::ostream & ostream,
+                                    const CachedFileRcPtr & untypedCachedFile) const;
+            
+            virtual CachedFileRcPtr ReadCache(std::istream & istream) const;
         };
         
         
@@ -99,32 +140,41 @@ OCIO_NAMESPACE_ENTER
             formatInfoVec.push_back(info);
         }
         
+        bool LocalFileFormat::Probe(const std::string & head) const
+        {
+            std::string::size_type lineEnd = head.find('\n');
+            if(lineEnd == std::string::npos) return true;
+            return pystring::startswith(pystring::lower(head.substr(0, lineEnd)), "spilut");
+        }
+        
         CachedFileRcPtr
         LocalFileFormat::Read(std::istream & istream) const
         {
-            const int MAX_LINE_SIZE = 4096;
-            char lineBuffer[MAX_LINE_SIZE];
+            LineTokenizer tokenizer(istream);
+            std::string line;
 
             Lut3DRcPtr lut3d = Lut3D::Create();
 
             // Read header information
-            istream.getline(lineBuffer, MAX_LINE_SIZE);
-            if(!pystring::startswith(pystring::lower(lineBuffer), "spilut"))
+            tokenizer.nextLine();
+            line = tokenizer.line();
+            if(!pystring::startswith(pystring::lower(line), "spilut"))
             {
                 std::ostringstream os;
                 os << "Lut does not appear to be valid spilut format. ";
-                os << "Expected 'SPILUT'.  Found, '" << lineBuffer << "'.";
+                os << "Expected 'SPILUT'.  Found, '" << line << "'.";
                 throw Exception(os.str().c_str());
             }
 
             // TODO: Assert 2nd line is 3 3
-            istream.getline(lineBuffer, MAX_LINE_SIZE);
+            tokenizer.nextLine();
 
             // Get LUT Size
             // TODO: Error handling
             int rSize, gSize, bSize;
-            istream.getline(lineBuffer, MAX_LINE_SIZE);
-            sscanf(lineBuffer, "%d %d %d", &rSize, &gSize, &bSize);
+            tokenizer.nextLine();
+            line = tokenizer.line();
+            sscanf(line.c_str(), "%d %d %d", &rSize, &gSize, &bSize);
 
             lut3d->size[0] = rSize;
             lut3d->size[1] = gSize;
@@ -133,34 +183,40 @@ OCIO_NAMESPACE_ENTER
 
             // Parse table
             int index = 0;
-            int rIndex, gIndex, bIndex;
-            float redValue, greenValue, blueValue;
+            int indices[3];
+            float values[3];
 
             int entriesRemaining = rSize * gSize * bSize;
 
-            while (istream.good() && entriesRemaining > 0)
+            while (entriesRemaining > 0 && tokenizer.nextLine())
             {
-                istream.getline(lineBuffer, MAX_LINE_SIZE);
+                // Anything else than six plain numbers goes through sscanf
+                bool parsed = ParseEntry(tokenizer, indices, values);
+                if(!parsed)
+                {
+                    line = tokenizer.line();
+                    parsed = (sscanf(line.c_str(), "%d %d %d %f %f %f",
+                                     &indices[0], &indices[1], &indices[2],
+                                     &values[0], &values[1], &values[2]) == 6);
+                }
 
-                if (sscanf(lineBuffer, "%d %d %d %f %f %f",
-                    &rIndex, &gIndex, &bIndex,
-                    &redValue, &greenValue, &blueValue) == 6)
+                if (parsed)
                 {
-                    index = GetLut3DIndex_B(rIndex, gIndex, bIndex,
+                    index = GetLut3DIndex_B(indices[0], indices[1], indices[2],
                                             rSize, gSize, bSize);
                     if(index < 0 || index >= (int) lut3d->lut.size())
                     {
                         std::ostringstream os;
                         os << "Cannot load .spi3d lut, data is invalid. ";
                         os << "A lut entry is specified (";
-                        os << rIndex << " " << gIndex << " " << bIndex;
+                        os << indices[0] << " " << indices[1] << " " << indices[2];
                         os << " that falls outside of the cube.";
                         throw Exception(os.str().c_str());
                     }
 
-                    lut3d->lut[index+0] = redValue;
-                    lut3d->lut[index+1] = greenValue;
-                    lut3d->lut[index+2] = blueValue;
+                    lut3d->lut[index+0] = values[0];
+                    lut3d->lut[index+1] = values[1];
+                    lut3d->lut[index+2] = values[2];
 
                     entriesRemaining--;
                 }
@@ -174,7 +230,25 @@ OCIO_NAMESPACE_ENTER
             cachedFile->lut = lut3d;
             return cachedFile;
         }
-
+        
+        bool LocalFileFormat::WriteCache(std::ostream & ostream,
+                                         const CachedFileRcPtr & untypedCachedFile) const
+        {
+            LocalCachedFileRcPtr cachedFile = DynamicPtrCast<LocalCachedFile>(untypedCachedFile);
+            if(!cachedFile) return false;
+            
+            WriteLutCacheLut3D(ostream, cachedFile->lut);
+            return true;
+        }
+        
+        CachedFileRcPtr LocalFileFormat::ReadCache(std::istream & istream) const
+        {
+            LocalCachedFileRcPtr cachedFile = LocalCachedFileRcPtr(new LocalCachedFile());
+            
+            cachedFile->lut = ReadLutCacheLut3D(istream);
+            return cachedFile;
+        }
+        
         void LocalFileFormat::BuildFileOps(OpRcPtrVec & ops,
                                   const Config& /*config*/,
                                   const ConstContextRcPtr & /*context*/,
@@ -54,6 +54,11 @@ OCIO_NAMESPACE_ENTER
             };
             ~LocalCachedFile() {};
             
+            virtual size_t getMemorySize() const
+            {
+                return sizeof(*this);
+            }
+            
             float m44[16];
             float offset4[4];
         };
@@ -72,6 +77,8 @@ OCIO_NAMESPACE_ENTER
             
             virtual CachedFileRcPtr Read(std::istream & istream) const;
             
+            virtual bool Probe(const std::string & head) const;
+            
             virtual void BuildFileOps(OpRcPtrVec & ops,
                          const Config& config,
                          const ConstContextRcPtr & context,
@@ -89,6 +96,21 @@ OCIO_NAMESPACE_ENTER
             formatInfoVec.push_back(info);
         }
         
+        bool LocalFileFormat::Probe(const std::string & head) const
+        {
+            // At most 12 floats, judging by the tokens the head holds
+            // whole (the last one may be cut)
+            std::string::size_type end = head.find_last_of(" \t\r\n");
+            if(end == std::string::npos) return true;
+            
+            std::vector<std::string> parts;
+            pystring::split(head.substr(0, end), parts);
+            if(parts.size() > 12) return false;
+            
+            std::vector<float> values;
+            return StringVecToFloatVec(values, parts);
+        }
+        
         CachedFileRcPtr
         LocalFileFormat::Read(std::istream & istream) const
         {
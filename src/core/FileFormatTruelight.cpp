@@ -28,11 +28,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <cstdio>
 #include <iostream>
-#include <iomanip>
 #include <iterator>
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "BakingUtils.h"
 #include "FileTransform.h"
 #include "Lut1DOp.h"
 #include "Lut3DOp.h"
@@ -71,6 +71,11 @@ OCIO_NAMESPACE_ENTER
             };
             ~LocalCachedFile() {};
             
+            virtual size_t getMemorySize() const
+            {
+                return sizeof(*this) + lut1D->getMemorySize() + lut3D->getMemorySize();
+            }
+            
             bool has1D;
             bool has3D;
             Lut1DRcPtr lut1D;
@@ -91,6 +96,8 @@ OCIO_NAMESPACE_ENTER
             
             virtual CachedFileRcPtr Read(std::istream & istream) const;
             
+            virtual bool Probe(const std::string & head) const;
+            
             virtual void Write(const Baker & baker,
                                const std::string & formatName,
                                std::ostream & ostream) const;
@@ -112,6 +119,13 @@ OCIO_NAMESPACE_ENTER
             formatInfoVec.push_back(info);
         }
         
+        bool LocalFileFormat::Probe(const std::string & head) const
+        {
+            std::string line;
+            if(!GetProbeFirstLine(line, head, false)) return true;
+            return pystring::startswith(pystring::lower(line), "# truelight cube");
+        }
+        
         CachedFileRcPtr
         LocalFileFormat::Read(std::istream & istream) const
         {
@@ -308,15 +322,8 @@ OCIO_NAMESPACE_ENTER
             if (cubeSize==-1) cubeSize = DEFAULT_CUBE_SIZE;
             cubeSize = std::max(2, cubeSize); // smallest cube is 2x2x2
 
-            std::vector<float> cubeData;
-            cubeData.resize(cubeSize*cubeSize*cubeSize*3);
-            GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_RED);
-            PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
-            
-            // Apply processor to lut data
             ConstProcessorRcPtr inputToTarget;
             inputToTarget = config->getProcessor(baker.getInputSpace(), baker.getTargetSpace());
-            inputToTarget->apply(cubeImg);
             
             int shaperSize = baker.getShaperSize();
             if (shaperSize==-1) shaperSize = DEFAULT_SHAPER_SIZE;
@@ -324,36 +331,35 @@ OCIO_NAMESPACE_ENTER
 
 
             // Write the header
-            ostream << "# Truelight Cube v2.0\n";
-            ostream << "# lutLength " << shaperSize << "\n";
-            ostream << "# iDims     3\n";
-            ostream << "# oDims     3\n";
-            ostream << "# width     " << cubeSize << " " << cubeSize << " " << cubeSize << "\n";
-            ostream << "\n";
+            LutTextWriter writer(ostream);
+            writer << "# Truelight Cube v2.0\n";
+            writer << "# lutLength " << shaperSize << "\n";
+            writer << "# iDims     3\n";
+            writer << "# oDims     3\n";
+            writer << "# width     " << cubeSize << " " << cubeSize << " " << cubeSize << "\n";
+            writer << "\n";
 
 
             // Write the shaper lut
             // (We are just going to use a unity lut)
-            ostream << "# InputLUT\n";
-            ostream << std::setprecision(6) << std::fixed;
+            writer << "# InputLUT\n";
             float v = 0.0f;
             for (int i=0; i < shaperSize-1; i++)
             {
                 v = ((float)i / (float)(shaperSize-1)) * (float)(cubeSize-1);
-                ostream << v << " " << v << " " << v << "\n";
+                writer << v << " " << v << " " << v << "\n";
             }
             v = (float) (cubeSize-1);
-            ostream << v << " " << v << " " << v << "\n"; // ensure that the last value is spot on
-            ostream << "\n";
+            writer << v << " " << v << " " << v << "\n"; // ensure that the last value is spot on
+            writer << "\n";
 
             // Write the cube
-            ostream << "# Cube\n";
-            for (int i=0; i<cubeSize*cubeSize*cubeSize; ++i)
-            {
-                ostream << cubeData[3*i+0] << " " << cubeData[3*i+1] << " " << cubeData[3*i+2] << "\n";
-            }
+            writer << "# Cube\n";
+            Lut3DTextSink cubeWriter(writer);
+            BakeLut3D(cubeWriter, cubeSize, LUT3DORDER_FAST_RED, inputToTarget);
             
-            ostream << "# end\n";
+            writer << "# end\n";
+            writer.flush();
         }
         
         void
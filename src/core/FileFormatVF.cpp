@@ -54,6 +54,11 @@ OCIO_NAMESPACE_ENTER
             };
             ~LocalCachedFile() {};
             
+            virtual size_t getMemorySize() const
+            {
+                return sizeof(*this) + lut3D->getMemorySize();
+            }
+            
             Lut3DRcPtr lut3D;
             float m44[16];
             bool useMatrix;
@@ -73,6 +78,8 @@ OCIO_NAMESPACE_ENTER
             
             virtual CachedFileRcPtr Read(std::istream & istream) const;
             
+            virtual bool Probe(const std::string & head) const;
+            
             virtual void BuildFileOps(OpRcPtrVec & ops,
                          const Config& config,
                          const ConstContextRcPtr & context,
@@ -90,6 +97,13 @@ OCIO_NAMESPACE_ENTER
             formatInfoVec.push_back(info);
         }
         
+        bool LocalFileFormat::Probe(const std::string & head) const
+        {
+            std::string line;
+            if(!GetProbeFirstLine(line, head, false)) return true;
+            return pystring::startswith(pystring::lower(line), "#inventor");
+        }
+        
         CachedFileRcPtr
         LocalFileFormat::Read(std::istream & istream) const
         {
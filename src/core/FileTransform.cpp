@@ -30,14 +30,18 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "FileTransform.h"
 #include "Logging.h"
+#include "LruOrder.h"
+#include "LutCache.h"
 #include "Mutex.h"
 #include "NoOps.h"
 #include "PathUtils.h"
 #include "pystring/pystring.h"
 
+#include <algorithm>
 #include <fstream>
 #include <map>
 #include <sstream>
+#include <vector>
 
 OCIO_NAMESPACE_ENTER
 {
@@ -203,6 +207,7 @@ OCIO_NAMESPACE_ENTER
     FormatRegistry::FormatRegistry()
     {
         registerFileFormat(CreateFileFormat3DL());
+        registerFileFormat(CreateFileFormatBinary());
         registerFileFormat(CreateFileFormatCCC());
         registerFileFormat(CreateFileFormatCDL());
         registerFileFormat(CreateFileFormatCC());
@@ -232,13 +237,19 @@ OCIO_NAMESPACE_ENTER
         return NULL;
     }
     
-    FileFormat* FormatRegistry::getFileFormatForExtension(const std::string & extension) const
+    void FormatRegistry::getFileFormatsForExtension(FileFormatVector & formats,
+                                                    const std::string & extension) const
     {
-        FileFormatMap::const_iterator iter = m_formatsByExtension.find(
-            pystring::lower(extension));
-        if(iter != m_formatsByExtension.end())
-            return iter->second;
-        return NULL;
+        formats.clear();
+        
+        std::pair<FileFormatMultimap::const_iterator,
+                  FileFormatMultimap::const_iterator> range =
+            m_formatsByExtension.equal_range(pystring::lower(extension));
+        for(FileFormatMultimap::const_iterator iter = range.first;
+            iter != range.second; ++iter)
+        {
+            formats.push_back(iter->second);
+        }
     }
     
     void FormatRegistry::registerFileFormat(FileFormat* format)
@@ -274,9 +285,16 @@ OCIO_NAMESPACE_ENTER
             
             m_formatsByName[formatInfoVec[i].name] = format;
             
-            // For now, dont worry if multiple formats register the same extension
-            // TODO: keep track of all of em! (make the value a vector)
-            m_formatsByExtension[formatInfoVec[i].extension] = format;
+            // Formats may share an extension (and a format may list the
+            // same extension for several of its names)
+            FileFormatVector extensionFormats;
+            getFileFormatsForExtension(extensionFormats, formatInfoVec[i].extension);
+            if(std::find(extensionFormats.begin(), extensionFormats.end(), format) ==
+               extensionFormats.end())
+            {
+                m_formatsByExtension.insert(std::make_pair(
+                    pystring::lower(formatInfoVec[i].extension), format));
+            }
             
             if(formatInfoVec[i].capabilities & FORMAT_CAPABILITY_READ)
             {
@@ -393,6 +411,62 @@ OCIO_NAMESPACE_ENTER
         throw Exception(os.str().c_str());
     }
     
+    bool FileFormat::WriteCache(std::ostream & /*ostream*/,
+                                const CachedFileRcPtr & /*cachedFile*/) const
+    {
+        return false;
+    }
+    
+    CachedFileRcPtr FileFormat::ReadCache(std::istream & /*istream*/) const
+    {
+        std::ostringstream os;
+        os << "Format " << getName() << " does not support the lut cache.";
+        throw Exception(os.str().c_str());
+    }
+    
+    bool FileFormat::Probe(const std::string & /*head*/) const
+    {
+        return true;
+    }
+    
+    CachedFileRcPtr FileFormat::ReadFile(std::istream & istream,
+                                         const std::string & /*filepath*/) const
+    {
+        return Read(istream);
+    }
+    
+    bool GetProbeFirstLine(std::string & line, const std::string & head,
+                           bool skipComments)
+    {
+        std::string::size_type lineBegin = 0;
+        while(lineBegin < head.size())
+        {
+            std::string::size_type lineEnd = head.find('\n', lineBegin);
+            if(lineEnd == std::string::npos) return false;
+            
+            line = head.substr(lineBegin, lineEnd - lineBegin);
+            lineBegin = lineEnd + 1;
+            
+            if(!line.empty() && line[line.size() - 1] == '\r')
+            {
+                line.resize(line.size() - 1);
+            }
+            if(pystring::strip(line).empty()) continue;
+            if(skipComments && line[0] == '#') continue;
+            return true;
+        }
+        return false;
+    }
+    
+    bool ProbeIsXml(const std::string & head)
+    {
+        std::string::size_type pos = 0;
+        if(head.compare(0, 3, "\xEF\xBB\xBF") == 0) pos = 3;
+        
+        pos = head.find_first_not_of(" \t\r\n\f\v", pos);
+        return pos == std::string::npos || head[pos] == '<';
+    }
+    
     namespace
     {
     
@@ -410,7 +484,7 @@ OCIO_NAMESPACE_ENTER
             
             // Open the filePath
             std::ifstream filestream;
-            filestream.open(filepath.c_str(), std::ios_base::in);
+            filestream.open(filepath.c_str(), std::ios_base::in | std::ios_base::binary);
             if (!filestream.good())
             {
                 std::ostringstream os;
@@ -421,7 +495,14 @@ OCIO_NAMESPACE_ENTER
                 throw Exception(os.str().c_str());
             }
             
-            // Try the initial format.
+            // Keep the head of the file for the format probes
+            std::string head(FORMAT_PROBE_SIZE, '\0');
+            filestream.read(&head[0], FORMAT_PROBE_SIZE);
+            head.resize(static_cast<std::string::size_type>(filestream.gcount()));
+            filestream.clear();
+            filestream.seekg(0, std::ios_base::beg);
+            
+            // Try the formats registered for the extension.
             std::string primaryErrorText;
             std::string root, extension;
             pystring::os::path::splitext(root, extension, filepath);
@@ -429,13 +510,14 @@ OCIO_NAMESPACE_ENTER
             
             FormatRegistry & formatRegistry = FormatRegistry::GetInstance();
             
-            FileFormat * primaryFormat = 
-                formatRegistry.getFileFormatForExtension(extension);
-            if(primaryFormat)
+            FileFormatVector primaryFormats;
+            formatRegistry.getFileFormatsForExtension(primaryFormats, extension);
+            for(unsigned int i=0; i<primaryFormats.size(); ++i)
             {
+                FileFormat * primaryFormat = primaryFormats[i];
                 try
                 {
-                    CachedFileRcPtr cachedFile = primaryFormat->Read(filestream);
+                    CachedFileRcPtr cachedFile = primaryFormat->ReadFile(filestream, filepath);
                     
                     if(IsDebugLoggingEnabled())
                     {
@@ -451,7 +533,7 @@ OCIO_NAMESPACE_ENTER
                 }
                 catch(std::exception & e)
                 {
-                    primaryErrorText = e.what();
+                    if(primaryErrorText.empty()) primaryErrorText = e.what();
                     
                     if(IsDebugLoggingEnabled())
                     {
@@ -462,12 +544,13 @@ OCIO_NAMESPACE_ENTER
                         LogDebug(os.str());
                     }
                 }
+                
+                filestream.clear();
+                filestream.seekg(0, std::ios_base::beg);
             }
             
-            filestream.clear();
-            filestream.seekg( std::ifstream::beg );
-            
-            // If this fails, try all other formats
+            // If this fails, try the other formats which the head of
+            // the file does not rule out
             CachedFileRcPtr cachedFile;
             FileFormat * altFormat = NULL;
             
@@ -477,12 +560,26 @@ OCIO_NAMESPACE_ENTER
             {
                 altFormat = formatRegistry.getRawFormatByIndex(findex);
                 
-                // Dont bother trying the primaryFormat twice.
-                if(altFormat == primaryFormat) continue;
+                // Dont bother trying the primary formats twice.
+                if(std::find(primaryFormats.begin(), primaryFormats.end(), altFormat) !=
+                   primaryFormats.end()) continue;
+                
+                if(!altFormat->Probe(head))
+                {
+                    if(IsDebugLoggingEnabled())
+                    {
+                        std::ostringstream os;
+                        os << "    Skipped alt format ";
+                        os << altFormat->getName();
+                        os << ":  the file does not match its signature";
+                        LogDebug(os.str());
+                    }
+                    continue;
+                }
                 
                 try
                 {
-                    cachedFile = altFormat->Read(filestream);
+                    cachedFile = altFormat->ReadFile(filestream, filepath);
                     
                     if(IsDebugLoggingEnabled())
                     {
@@ -509,11 +606,11 @@ OCIO_NAMESPACE_ENTER
                 }
                 
                 filestream.clear();
-                filestream.seekg( std::ifstream::beg );
+                filestream.seekg(0, std::ios_base::beg);
             }
             
             // No formats succeeded. Error out with a sensible message.
-            if(primaryFormat)
+            if(!primaryFormats.empty())
             {
                 std::ostringstream os;
                 os << "The specified transform file '";
@@ -531,9 +628,11 @@ OCIO_NAMESPACE_ENTER
             }
         }
         
-        // We mutex both the main map and each item individually, so that
-        // the potentially slow file access wont block other lookups to already
-        // existing items. (Loads of the *same* file will mutually block though)
+        // Lookups of files already in the map only take a read lock on it,
+        // so they do not block each other. Each item has its own mutex, so
+        // that the potentially slow file access wont block other lookups
+        // to already existing items. (Loads of the *same* file will
+        // mutually block though)
         
         struct FileCacheResult
         {
@@ -543,19 +642,67 @@ OCIO_NAMESPACE_ENTER
             bool error;
             CachedFileRcPtr cachedFile;
             std::string exceptionText;
+            // Set (atomically) once the load is over, after which the
+            // result is read without the mutex
+            volatile long loaded;
+            // For the LRU eviction, the cache clock at the last lookup
+            volatile long lastUse;
             
             FileCacheResult():
                 format(NULL),
                 ready(false),
-                error(false)
+                error(false),
+                loaded(0),
+                lastUse(0)
             {}
         };
         
         typedef OCIO_SHARED_PTR<FileCacheResult> FileCacheResultPtr;
-        typedef std::map<std::string, FileCacheResultPtr> FileCacheMap;
+        
+        typedef LruOrder<std::string> FileCacheOrder;
+        
+        // The size of an entry is only known once its file is loaded
+        // (0 until then).
+        struct FileCacheEntry
+        {
+            FileCacheResultPtr result;
+            size_t bytes;
+            FileCacheOrder::Position order;
+            
+            FileCacheEntry():
+                bytes(0)
+            {}
+        };
+        
+        typedef std::map<std::string, FileCacheEntry> FileCacheMap;
         
         FileCacheMap g_fileCache;
-        Mutex g_fileCacheLock;
+        FileCacheOrder g_fileCacheOrder;
+        size_t g_fileCacheBytes = 0;
+        volatile long g_fileCacheClock = 0;
+        volatile long g_fileCacheHits = 0;
+        long g_fileCacheMisses = 0;
+        long g_fileCacheEvictions = 0;
+        RWLock g_fileCacheLock;
+        
+        // You must manually acquire the file cache write lock before
+        // calling this. Evicts the least recently used entries, always
+        // keeping the most recent one.
+        void TrimFileTransformCachesLocked()
+        {
+            size_t limit = GetCacheMemoryLimit();
+            
+            while(limit > 0 && g_fileCacheBytes > limit
+                  && g_fileCacheOrder.size() > 1)
+            {
+                FileCacheMap::iterator iter =
+                    g_fileCache.find(g_fileCacheOrder.back());
+                g_fileCacheBytes -= iter->second.bytes;
+                g_fileCacheOrder.erase(iter->second.order);
+                g_fileCache.erase(iter);
+                ++g_fileCacheEvictions;
+            }
+        }
         
         void GetCachedFileAndFormat(
             FileFormat * & format, CachedFileRcPtr & cachedFile,
@@ -564,46 +711,119 @@ OCIO_NAMESPACE_ENTER
             // Load the file cache ptr from the global map
             FileCacheResultPtr result;
             {
-                AutoMutex lock(g_fileCacheLock);
+                AutoReadLock lock(g_fileCacheLock);
+                FileCacheMap::iterator iter = g_fileCache.find(filepath);
+                if(iter != g_fileCache.end())
+                {
+                    AtomicAdd(&g_fileCacheHits, 1);
+                    result = iter->second.result;
+                }
+            }
+            
+            if(!result)
+            {
+                AutoWriteLock lock(g_fileCacheLock);
+                // Another thread may have added it meanwhile
                 FileCacheMap::iterator iter = g_fileCache.find(filepath);
                 if(iter != g_fileCache.end())
                 {
-                    result = iter->second;
+                    AtomicAdd(&g_fileCacheHits, 1);
+                    result = iter->second.result;
                 }
                 else
                 {
+                    ++g_fileCacheMisses;
                     result = FileCacheResultPtr(new FileCacheResult);
-                    g_fileCache[filepath] = result;
+                    result->lastUse = AtomicAdd(&g_fileCacheClock, 1);
+                    FileCacheEntry & entry = g_fileCache[filepath];
+                    entry.result = result;
+                    entry.order = g_fileCacheOrder.push(filepath,
+                                                        &result->lastUse);
                 }
             }
             
+            AtomicStore(&result->lastUse, AtomicAdd(&g_fileCacheClock, 1));
+            
             // If this file has already been loaded, return
             // the result immediately
             
-            AutoMutex lock(result->mutex);
-            if(!result->ready)
+            if(AtomicLoad(&result->loaded))
             {
-                result->ready = true;
-                result->error = false;
-                
-                try
+                if(result->error)
                 {
-                    LoadFileUncached(result->format,
-                                     result->cachedFile,
-                                     filepath);
+                    throw Exception(result->exceptionText.c_str());
                 }
-                catch(std::exception & e)
+                format = result->format;
+                cachedFile = result->cachedFile;
+                return;
+            }
+            
+            size_t loadedBytes = 0;
+            {
+                AutoMutex lock(result->mutex);
+                if(!result->ready)
+                {
+                    result->ready = true;
+                    result->error = false;
+                    
+                    try
+                    {
+                        if(!ReadLutCacheEntry(result->format,
+                                              result->cachedFile,
+                                              filepath))
+                        {
+                            LoadFileUncached(result->format,
+                                             result->cachedFile,
+                                             filepath);
+                            WriteLutCacheEntry(result->format,
+                                               result->cachedFile,
+                                               filepath);
+                        }
+                    }
+                    catch(std::exception & e)
+                    {
+                        result->error = true;
+                        result->exceptionText = e.what();
+                    }
+                    catch(...)
+                    {
+                        result->error = true;
+                        std::ostringstream os;
+                        os << "An unknown error occurred in LoadFileUncached, ";
+                        os << filepath;
+                        result->exceptionText = os.str();
+                    }
+                    
+                    // The key of the map, and the result
+                    loadedBytes = sizeof(FileCacheMap::value_type)
+                        + sizeof(FileCacheResult) + filepath.size()
+                        + result->exceptionText.size();
+                    if(result->cachedFile)
+                    {
+                        loadedBytes += result->cachedFile->getMemorySize();
+                    }
+                    
+                    AtomicStore(&result->loaded, 1);
+                }
+                
+                if(!result->error)
                 {
-                    result->error = true;
-                    result->exceptionText = e.what();
+                    format = result->format;
+                    cachedFile = result->cachedFile;
                 }
-                catch(...)
+            }
+            
+            // Account for the size of a newly loaded file, unless it has been
+            // evicted or cleared meanwhile.
+            if(loadedBytes > 0)
+            {
+                AutoWriteLock lock(g_fileCacheLock);
+                FileCacheMap::iterator iter = g_fileCache.find(filepath);
+                if(iter != g_fileCache.end() && iter->second.result == result)
                 {
-                    result->error = true;
-                    std::ostringstream os;
-                    os << "An unknown error occurred in LoadFileUncached, ";
-                    os << filepath;
-                    result->exceptionText = os.str();
+                    iter->second.bytes = loadedBytes;
+                    g_fileCacheBytes += loadedBytes;
+                    TrimFileTransformCachesLocked();
                 }
             }
             
@@ -611,18 +831,43 @@ OCIO_NAMESPACE_ENTER
             {
                 throw Exception(result->exceptionText.c_str());
             }
-            else
-            {
-                format = result->format;
-                cachedFile = result->cachedFile;
-            }
         }
     } // namespace
     
     void ClearFileTransformCaches()
     {
-        AutoMutex lock(g_fileCacheLock);
+        AutoWriteLock lock(g_fileCacheLock);
         g_fileCache.clear();
+        g_fileCacheOrder.clear();
+        g_fileCacheBytes = 0;
+        AtomicStore(&g_fileCacheHits, 0);
+        g_fileCacheMisses = 0;
+        g_fileCacheEvictions = 0;
+    }
+    
+    void TrimFileTransformCaches()
+    {
+        AutoWriteLock lock(g_fileCacheLock);
+        TrimFileTransformCachesLocked();
+    }
+    
+    void GetFileTransformCacheStats(long & entries, size_t & bytes,
+                                    long & hits, long & misses,
+                                    long & evictions)
+    {
+        AutoReadLock lock(g_fileCacheLock);
+        entries = (long)g_fileCache.size();
+        bytes = g_fileCacheBytes;
+        hits = AtomicLoad(&g_fileCacheHits);
+        misses = g_fileCacheMisses;
+        evictions = g_fileCacheEvictions;
+    }
+    
+    void PrefetchFile(const std::string & filepath)
+    {
+        FileFormat* format = NULL;
+        CachedFileRcPtr cachedFile;
+        GetCachedFileAndFormat(format, cachedFile, filepath);
     }
     
     void BuildFileOps(OpRcPtrVec & ops,
@@ -671,3 +916,214 @@ OCIO_NAMESPACE_ENTER
     }
 }
 OCIO_NAMESPACE_EXIT
+
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef OCIO_UNIT_TEST
+
+namespace OCIO = OCIO_NAMESPACE;
+#include "UnitTest.h"
+
+#include <iostream>
+
+namespace
+{
+    const char * CUBE_SAMPLE =
+        "# comment\n"
+        "TITLE \"sample\"\n"
+        "LUT_1D_SIZE 2\n"
+        "0.0 0.0 0.0\n"
+        "1.0 1.0 1.0\n";
+    
+    const char * SPI1D_SAMPLE =
+        "Version 1\n"
+        "From 0.0 1.0\n"
+        "Length 2\n"
+        "Components 1\n"
+        "{\n"
+        "0.0\n"
+        "1.0\n"
+        "}\n";
+    
+    const char * SPI3D_SAMPLE =
+        "SPILUT 1.0\n"
+        "3 3\n"
+        "2 2 2\n"
+        "0 0 0 0.0 0.0 0.0\n"
+        "0 0 1 0.0 0.0 1.0\n"
+        "0 1 0 0.0 1.0 0.0\n"
+        "0 1 1 0.0 1.0 1.0\n"
+        "1 0 0 1.0 0.0 0.0\n"
+        "1 0 1 1.0 0.0 1.0\n"
+        "1 1 0 1.0 1.0 0.0\n"
+        "1 1 1 1.0 1.0 1.0\n";
+    
+    const char * SPIMTX_SAMPLE =
+        "1 0 0 0\n"
+        "0 1 0 0\n"
+        "0 0 1 0\n";
+    
+    const char * CC_SAMPLE =
+        "\n<ColorCorrection id=\"sample\">\n"
+        "<SOPNode><Slope>1 1 1</Slope><Offset>0 0 0</Offset>"
+        "<Power>1 1 1</Power></SOPNode>\n"
+        "</ColorCorrection>\n";
+}
+
+OIIO_ADD_TEST(FileTransform, FormatsForExtension)
+{
+    OCIO::FormatRegistry & registry = OCIO::FormatRegistry::GetInstance();
+    
+    OCIO::FileFormatVector formats;
+    registry.getFileFormatsForExtension(formats, "CUBE");
+    OIIO_CHECK_EQUAL(formats.size(), 1u);
+    OIIO_CHECK_EQUAL(formats[0]->getName(), "iridas_cube");
+    
+    registry.getFileFormatsForExtension(formats, "unknown");
+    OIIO_CHECK_ASSERT(formats.empty());
+}
+
+OIIO_ADD_TEST(FileTransform, FormatProbes)
+{
+    const char * samples[] = { CUBE_SAMPLE, SPI1D_SAMPLE, SPI3D_SAMPLE,
+                               SPIMTX_SAMPLE, CC_SAMPLE, "hello world\n", 0 };
+    
+    OCIO::FormatRegistry & registry = OCIO::FormatRegistry::GetInstance();
+    for(int i=0; samples[i]; ++i)
+    {
+        int numProbed = 0;
+        for(int findex=0; findex<registry.getNumRawFormats(); ++findex)
+        {
+            OCIO::FileFormat * format = registry.getRawFormatByIndex(findex);
+            bool probed = format->Probe(samples[i]);
+            if(probed) ++numProbed;
+            
+            // A probe must never reject a file its format can read
+            bool readable = true;
+            try
+            {
+                std::istringstream istream(samples[i]);
+                format->Read(istream);
+            }
+            catch(std::exception &)
+            {
+                readable = false;
+            }
+            
+            if(readable && !probed)
+            {
+                std::cerr << format->getName() << " rejected sample " << i << "\n";
+                OIIO_CHECK_ASSERT(false);
+            }
+        }
+        
+        // The signatures rule out a good share of the formats
+        OIIO_CHECK_ASSERT(numProbed < registry.getNumRawFormats());
+    }
+    
+    OCIO::FileFormatVector formats;
+    registry.getFileFormatsForExtension(formats, "cube");
+    OIIO_CHECK_ASSERT(formats[0]->Probe(CUBE_SAMPLE));
+    OIIO_CHECK_ASSERT(!formats[0]->Probe(SPI3D_SAMPLE));
+    OIIO_CHECK_ASSERT(!formats[0]->Probe(CC_SAMPLE));
+    
+    // An incomplete first line is not enough to rule out the format
+    OIIO_CHECK_ASSERT(formats[0]->Probe("LUT_3D_"));
+    
+    registry.getFileFormatsForExtension(formats, "cc");
+    OIIO_CHECK_ASSERT(formats[0]->Probe(CC_SAMPLE));
+    OIIO_CHECK_ASSERT(formats[0]->Probe("\xEF\xBB\xBF<?xml version=\"1.0\"?>"));
+    OIIO_CHECK_ASSERT(!formats[0]->Probe(CUBE_SAMPLE));
+    
+    registry.getFileFormatsForExtension(formats, "spimtx");
+    OIIO_CHECK_ASSERT(formats[0]->Probe(SPIMTX_SAMPLE));
+    OIIO_CHECK_ASSERT(!formats[0]->Probe(SPI3D_SAMPLE));
+}
+
+OIIO_ADD_TEST(FileTransform, LoadWithoutMatchingExtension)
+{
+    OCIO::TempDirectory dir("filetransform");
+    const std::string lutPath = dir.writeFile("lut.txt", SPI1D_SAMPLE);
+    
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    OCIO::FileTransformRcPtr transform = OCIO::CreateFileTransform(lutPath);
+    
+    float rgb[3] = { 0.25f, 0.5f, 0.75f };
+    OIIO_CHECK_NO_THOW(config->getProcessor(transform)->applyRGB(rgb));
+    OIIO_CHECK_CLOSE(rgb[1], 0.5f, 1e-6f);
+    
+    OCIO::ClearAllCaches();
+}
+
+OIIO_ADD_TEST(FileTransform, CacheMemoryLimit)
+{
+    OCIO::TempDirectory dir("filetransform");
+    
+    size_t oldLimit = OCIO::GetCacheMemoryLimit();
+    OCIO::SetCacheMemoryLimit(0);
+    OCIO::ClearAllCaches();
+    
+    std::vector<std::string> lutPaths;
+    for(int i=0; i<4; ++i)
+    {
+        std::ostringstream os;
+        os << "lut" << i << ".spi3d";
+        lutPaths.push_back(dir.writeFile(os.str(), SPI3D_SAMPLE));
+    }
+    
+    long entries = 0, hits = 0, misses = 0, evictions = 0;
+    size_t bytes = 0;
+    
+    for(unsigned int i=0; i<lutPaths.size(); ++i)
+    {
+        OIIO_CHECK_NO_THOW(OCIO::PrefetchFile(lutPaths[i]));
+    }
+    OIIO_CHECK_NO_THOW(OCIO::PrefetchFile(lutPaths[3]));
+    
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_FILE,
+                        entries, bytes, hits, misses, evictions);
+    OIIO_CHECK_EQUAL(entries, 4);
+    OIIO_CHECK_EQUAL(hits, 1);
+    OIIO_CHECK_EQUAL(misses, 4);
+    OIIO_CHECK_EQUAL(evictions, 0);
+    
+    // The lut arrays are accounted for (8 rgb entries, for each file)
+    size_t bytesPerFile = bytes / 4;
+    OIIO_CHECK_ASSERT(bytesPerFile > 24 * sizeof(float));
+    
+    // Only the two most recently used files fit in the budget
+    OCIO::SetCacheMemoryLimit(bytesPerFile * 2 + bytesPerFile / 2);
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_FILE,
+                        entries, bytes, hits, misses, evictions);
+    OIIO_CHECK_EQUAL(entries, 2);
+    OIIO_CHECK_EQUAL(bytes, bytesPerFile * 2);
+    OIIO_CHECK_EQUAL(evictions, 2);
+    
+    // lut3 was used last, so loading lut0 again evicts lut2
+    OIIO_CHECK_NO_THOW(OCIO::PrefetchFile(lutPaths[0]));
+    OIIO_CHECK_NO_THOW(OCIO::PrefetchFile(lutPaths[3]));
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_FILE,
+                        entries, bytes, hits, misses, evictions);
+    OIIO_CHECK_EQUAL(entries, 2);
+    OIIO_CHECK_EQUAL(hits, 2);
+    OIIO_CHECK_EQUAL(misses, 5);
+    OIIO_CHECK_EQUAL(evictions, 3);
+    
+    // A budget smaller than any file still keeps the last one
+    OCIO::SetCacheMemoryLimit(1);
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_FILE,
+                        entries, bytes, hits, misses, evictions);
+    OIIO_CHECK_EQUAL(entries, 1);
+    OIIO_CHECK_EQUAL(bytes, bytesPerFile);
+    
+    OCIO::ClearAllCaches();
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_FILE,
+                        entries, bytes, hits, misses, evictions);
+    OIIO_CHECK_EQUAL(entries, 0);
+    OIIO_CHECK_EQUAL(bytes, 0u);
+    OIIO_CHECK_EQUAL(misses, 0);
+    
+    OCIO::SetCacheMemoryLimit(oldLimit);
+}
+
+#endif // OCIO_UNIT_TEST
@@ -41,11 +41,27 @@ OCIO_NAMESPACE_ENTER
 {
     void ClearFileTransformCaches();
     
+    // Evicts the least recently used files beyond the cache memory limit.
+    void TrimFileTransformCaches();
+    
+    // The counters reported by GetCacheStats(CACHE_TYPE_FILE)
+    void GetFileTransformCacheStats(long & entries, size_t & bytes,
+                                    long & hits, long & misses,
+                                    long & evictions);
+    
+    // Load the file into the file cache, as BuildFileOps does on first use.
+    // Throws if it cannot be loaded (the error is cached as well).
+    void PrefetchFile(const std::string & filepath);
+    
     class CachedFile
     {
     public:
         CachedFile() {};
         virtual ~CachedFile() {};
+        
+        // An estimate of the memory held by the file, used to keep the
+        // file cache within its budget. Lut arrays dominate.
+        virtual size_t getMemorySize() const { return sizeof(*this); }
     };
     
     typedef OCIO_SHARED_PTR<CachedFile> CachedFileRcPtr;
@@ -77,6 +93,12 @@ OCIO_NAMESPACE_ENTER
         
         virtual CachedFileRcPtr Read(std::istream & istream) const = 0;
         
+        // Read the file at filepath, which istream is open on. The default
+        // reads the stream. A format may instead map the file, so that its
+        // values are shared with other processes reading it.
+        virtual CachedFileRcPtr ReadFile(std::istream & istream,
+                                         const std::string & filepath) const;
+        
         virtual void Write(const Baker & baker,
                            const std::string & formatName,
                            std::ostream & ostream) const;
@@ -88,13 +110,44 @@ OCIO_NAMESPACE_ENTER
                                   const FileTransform & fileTransform,
                                   TransformDirection dir) const = 0;
         
+        // Optional support for the persistent lut cache (see LutCache.h).
+        // WriteCache returns false if the format does not support it (the
+        // default), in which case its files are always parsed. ReadCache
+        // must accept what WriteCache wrote, and throw on invalid data.
+        virtual bool WriteCache(std::ostream & ostream,
+                                const CachedFileRcPtr & cachedFile) const;
+        
+        virtual CachedFileRcPtr ReadCache(std::istream & istream) const;
+        
+        // Cheap check of the first bytes of a file (FORMAT_PROBE_SIZE, or
+        // the whole file if shorter), which returns false when the file
+        // certainly is not in this format. Files that do not have one of
+        // the format's extensions are then never fully read with it. The
+        // default accepts everything.
+        virtual bool Probe(const std::string & head) const;
+        
         // For logging purposes
         std::string getName() const;
     private:
         FileFormat& operator= (const FileFormat &);
     };
     
+    const int FORMAT_PROBE_SIZE = 4096;
+    
+    // Helpers for FileFormat::Probe.
+    
+    // Get the first line of the head that is not blank (nor a comment
+    // starting with '#', if skipComments), without its end of line.
+    // Returns false if the head ends before there is a complete one.
+    bool GetProbeFirstLine(std::string & line, const std::string & head,
+                           bool skipComments);
+    
+    // Whether the head could start an xml document: the first character
+    // past whitespace (and a utf-8 byte order mark) is '<'.
+    bool ProbeIsXml(const std::string & head);
+    
     typedef std::map<std::string, FileFormat*> FileFormatMap;
+    typedef std::multimap<std::string, FileFormat*> FileFormatMultimap;
     typedef std::vector<FileFormat*> FileFormatVector;
     
     // TODO: This interface is ugly. What private API is actually appropriate?
@@ -107,9 +160,11 @@ OCIO_NAMESPACE_ENTER
     public:
         static FormatRegistry & GetInstance();
         
-        // TODO: Make these return a vector of possible formats
         FileFormat* getFileFormatByName(const std::string & name) const;
-        FileFormat* getFileFormatForExtension(const std::string & extension) const;
+        
+        // All the formats registered for the extension, in registration order
+        void getFileFormatsForExtension(FileFormatVector & formats,
+                                        const std::string & extension) const;
         
         int getNumRawFormats() const;
         FileFormat* getRawFormatByIndex(int index) const;
@@ -124,7 +179,7 @@ OCIO_NAMESPACE_ENTER
         void registerFileFormat(FileFormat* format);
         
         FileFormatMap m_formatsByName;
-        FileFormatMap m_formatsByExtension;
+        FileFormatMultimap m_formatsByExtension;
         FileFormatVector m_rawFormats;
         
         typedef std::vector<std::string> StringVec;
@@ -136,6 +191,7 @@ OCIO_NAMESPACE_ENTER
     
     // Registry Builders
     FileFormat * CreateFileFormat3DL();
+    FileFormat * CreateFileFormatBinary();
     FileFormat * CreateFileFormatCCC();
     FileFormat * CreateFileFormatCDL();
     FileFormat * CreateFileFormatCC();
@@ -40,13 +40,19 @@ OCIO_NAMESPACE_ENTER
         GpuLanguage language_;
         std::string functionName_;
         int lut3DEdgeLen_;
+        bool lut1DTextures_;
+        int lut1DTextureMaxWidth_;
+        bool uniforms_;
         
         mutable std::string cacheID_;
         mutable Mutex cacheIDMutex_;
         
         Impl() :
             language_(GPU_LANGUAGE_UNKNOWN),
-            lut3DEdgeLen_(0)
+            lut3DEdgeLen_(0),
+            lut1DTextures_(false),
+            lut1DTextureMaxWidth_(4096),
+            uniforms_(false)
         {
         }
         
@@ -58,6 +64,9 @@ OCIO_NAMESPACE_ENTER
             language_ = rhs.language_;
             functionName_ = rhs.functionName_;
             lut3DEdgeLen_ = rhs.lut3DEdgeLen_;
+            lut1DTextures_ = rhs.lut1DTextures_;
+            lut1DTextureMaxWidth_ = rhs.lut1DTextureMaxWidth_;
+            uniforms_ = rhs.uniforms_;
             cacheID_ = rhs.cacheID_;
             return *this;
         }
@@ -112,6 +121,42 @@ OCIO_NAMESPACE_ENTER
         return getImpl()->lut3DEdgeLen_;
     }
     
+    void GpuShaderDesc::setLut1DTexturesEnabled(bool enabled)
+    {
+        AutoMutex lock(getImpl()->cacheIDMutex_);
+        getImpl()->lut1DTextures_ = enabled;
+        getImpl()->cacheID_ = "";
+    }
+    
+    bool GpuShaderDesc::getLut1DTexturesEnabled() const
+    {
+        return getImpl()->lut1DTextures_;
+    }
+    
+    void GpuShaderDesc::setLut1DTextureMaxWidth(int width)
+    {
+        AutoMutex lock(getImpl()->cacheIDMutex_);
+        getImpl()->lut1DTextureMaxWidth_ = width;
+        getImpl()->cacheID_ = "";
+    }
+    
+    int GpuShaderDesc::getLut1DTextureMaxWidth() const
+    {
+        return getImpl()->lut1DTextureMaxWidth_;
+    }
+    
+    void GpuShaderDesc::setUniformsEnabled(bool enabled)
+    {
+        AutoMutex lock(getImpl()->cacheIDMutex_);
+        getImpl()->uniforms_ = enabled;
+        getImpl()->cacheID_ = "";
+    }
+    
+    bool GpuShaderDesc::getUniformsEnabled() const
+    {
+        return getImpl()->uniforms_;
+    }
+    
     const char * GpuShaderDesc::getCacheID() const
     {
         AutoMutex lock(getImpl()->cacheIDMutex_);
@@ -122,6 +167,14 @@ OCIO_NAMESPACE_ENTER
             os << GpuLanguageToString(getImpl()->language_) << " ";
             os << getImpl()->functionName_ << " ";
             os << getImpl()->lut3DEdgeLen_;
+            if(getImpl()->lut1DTextures_)
+            {
+                os << " lut1d " << getImpl()->lut1DTextureMaxWidth_;
+            }
+            if(getImpl()->uniforms_)
+            {
+                os << " uniforms";
+            }
             getImpl()->cacheID_ = os.str();
         }
         
@@ -36,88 +36,349 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 OCIO_NAMESPACE_ENTER
 {
-    void Write_half4x4(std::ostream & os, const float * m44, GpuLanguage lang)
+    namespace
     {
-        if(lang == GPU_LANGUAGE_CG)
+        // A float literal with full precision, and always with a decimal
+        // point (GLSL 1.0 does not convert ints to floats).
+        std::string FloatLiteral(float value)
+        {
+            std::ostringstream os;
+            os.precision(9);
+            os << value;
+            std::string str = os.str();
+            if(str.find_first_of(".en") == std::string::npos) str += ".0";
+            return str;
+        }
+        
+        std::string Float3Literal(const float * v3, const GpuShaderWriter & writer)
+        {
+            std::ostringstream os;
+            os << writer.floatType(3) << "(";
+            os << FloatLiteral(v3[0]) << ", " << FloatLiteral(v3[1]) << ", ";
+            os << FloatLiteral(v3[2]) << ")";
+            return os.str();
+        }
+        
+        std::string TypeName(const char * prefix, int n)
+        {
+            std::ostringstream os;
+            os << prefix << n;
+            return os.str();
+        }
+        
+        void WriteVector(std::ostream & os, const std::string & type,
+                         const float * v, int n, bool clampToHalf)
         {
-            os << "half4x4(";
-            for(int i=0; i<16; i++)
+            os << type << "(";
+            for(int i=0; i<n; i++)
             {
                 if(i!=0) os << ", ";
-                os << ClampToNormHalf(m44[i]);
+                if(clampToHalf) os << ClampToNormHalf(v[i]);
+                else os << v[i];
             }
             os << ")";
         }
-        else if(lang == GPU_LANGUAGE_GLSL_1_0 || lang == GPU_LANGUAGE_GLSL_1_3)
+        
+        
+        // Nvidia Cg
+        class CgWriter : public GpuShaderWriter
         {
-            os << "mat4(";
-            for(int i=0; i<16; i++)
+        public:
+            virtual std::string halfType(int n) const { return TypeName("half", n); }
+            virtual std::string floatType(int n) const { return TypeName("float", n); }
+            virtual std::string matrixType() const { return "half4x4"; }
+            virtual bool clampsToHalf() const { return true; }
+            
+            virtual void writeMtxTimesVec(std::ostream & os, const std::string & mtx,
+                                          const std::string & vec) const
             {
-                if(i!=0) os << ", ";
-                os << m44[i]; // Clamping to half is not necessary
+                os << "mul( " << mtx << ", " << vec << ")";
             }
-            os << ")";
-        }
-        else
+            
+            virtual std::string lerpFunction() const { return "lerp"; }
+            
+            virtual void writeSample(std::ostream & os, const GpuShaderSampler & sampler,
+                                     const std::string & coords) const
+            {
+                os << "tex" << sampler.dimensions << "D(" << sampler.name << ", " << coords << ")";
+            }
+            
+        protected:
+            virtual std::string pixelParameter() const { return "in half4 inPixel,"; }
+            virtual std::string samplerParameter(const GpuShaderSampler & sampler) const
+            {
+                return "const uniform sampler" + TypeName("", sampler.dimensions) + "D " + sampler.name;
+            }
+        };
+        
+        // GLSL, as long as the typed texture lookups are available
+        class GlslWriter : public GpuShaderWriter
         {
-            throw Exception("Unsupported shader language.");
-        }
-    }
-    
-    void Write_half4(std::ostream & os, const float * v4,  GpuLanguage lang)
-    {
-        if(lang == GPU_LANGUAGE_CG)
+        public:
+            // The texture lookups are texture1D, texture2D and texture3D
+            // for versions up to 1.3, and the overloaded texture from 3.3
+            // core on. From 1.3 on, the samplers are 'const'.
+            GlslWriter(bool inPixel, bool constSamplers, bool typedLookups):
+                m_inPixel(inPixel),
+                m_constSamplers(constSamplers),
+                m_typedLookups(typedLookups)
+            {}
+            
+            virtual std::string halfType(int n) const { return TypeName("vec", n); }
+            virtual std::string floatType(int n) const { return TypeName("vec", n); }
+            virtual std::string matrixType() const { return "mat4"; }
+            
+            virtual void writeMtxTimesVec(std::ostream & os, const std::string & mtx,
+                                          const std::string & vec) const
+            {
+                os << vec << " * " << mtx;
+            }
+            
+            // == compares whole vectors
+            virtual void writeAllEqual(std::ostream & os, const std::string & a,
+                                       const std::string & b) const
+            {
+                os << "all(equal(" << a << ", " << b << "))";
+            }
+            
+            virtual std::string lerpFunction() const { return "mix"; }
+            
+            virtual void writeSample(std::ostream & os, const GpuShaderSampler & sampler,
+                                     const std::string & coords) const
+            {
+                if(m_typedLookups) os << "texture" << sampler.dimensions << "D(";
+                else os << "texture(";
+                os << sampler.name << ", " << coords << ")";
+            }
+            
+        protected:
+            virtual std::string pixelParameter() const
+            {
+                return m_inPixel ? "in vec4 inPixel, " : "vec4 inPixel, ";
+            }
+            virtual std::string samplerParameter(const GpuShaderSampler & sampler) const
+            {
+                return std::string(m_constSamplers ? "const " : "") + "sampler"
+                       + TypeName("", sampler.dimensions) + "D " + sampler.name;
+            }
+        
+        private:
+            bool m_inPixel;
+            bool m_constSamplers;
+            bool m_typedLookups;
+        };
+        
+        // HLSL for Direct3D 11 (shader model 4 on), where each texture is
+        // passed with the sampler state it is sampled with
+        class HlslWriter : public GpuShaderWriter
         {
-            os << "half4(";
-            for(int i=0; i<4; i++)
+        public:
+            virtual std::string halfType(int n) const { return TypeName("float", n); }
+            virtual std::string floatType(int n) const { return TypeName("float", n); }
+            virtual std::string matrixType() const { return "float4x4"; }
+            
+            virtual void writeMtxTimesVec(std::ostream & os, const std::string & mtx,
+                                          const std::string & vec) const
             {
-                if(i!=0) os << ", ";
-                os << ClampToNormHalf(v4[i]);
+                os << "mul(" << mtx << ", " << vec << ")";
             }
-            os << ")";
-        }
-        else if(lang == GPU_LANGUAGE_GLSL_1_0 || lang == GPU_LANGUAGE_GLSL_1_3)
+            
+            virtual std::string lerpFunction() const { return "lerp"; }
+            
+            virtual void writeSample(std::ostream & os, const GpuShaderSampler & sampler,
+                                     const std::string & coords) const
+            {
+                os << sampler.name << ".Sample(" << sampler.name << "Sampler, " << coords << ")";
+            }
+            
+        protected:
+            virtual std::string pixelParameter() const { return "in float4 inPixel,"; }
+            virtual std::string samplerParameter(const GpuShaderSampler & sampler) const
+            {
+                return "Texture" + TypeName("", sampler.dimensions) + "D " + sampler.name
+                       + ", SamplerState " + sampler.name + "Sampler";
+            }
+            // The constant buffers default to column major packing, while
+            // the matrix values are given row by row
+            virtual std::string uniformType(const GpuUniform & uniform) const
+            {
+                if(uniform.type == GPU_UNIFORM_FLOAT4X4) return "row_major float4x4";
+                return GpuShaderWriter::uniformType(uniform);
+            }
+        };
+        
+        // Metal Shading Language. There are no global uniforms, they are
+        // passed as arguments of the function, after the textures.
+        class MslWriter : public GpuShaderWriter
         {
-            os << "vec4(";
-            for(int i=0; i<4; i++)
+        public:
+            virtual std::string halfType(int n) const { return TypeName("float", n); }
+            virtual std::string floatType(int n) const { return TypeName("float", n); }
+            virtual std::string matrixType() const { return "float4x4"; }
+            
+            virtual std::string floatSplat(int n, const std::string & value) const
             {
-                if(i!=0) os << ", ";
-                os << v4[i]; // Clamping to half is not necessary
+                return floatType(n) + "(" + value + ")";
             }
-            os << ")";
-        }
-        else
+            
+            // The matrix constructors take columns, the matrix is
+            // transposed as for GLSL (see writeMtxTimesVec)
+            virtual void writeMatrix(std::ostream & os, const float * m44) const
+            {
+                os << "float4x4(";
+                for(int i=0; i<4; ++i)
+                {
+                    if(i!=0) os << ", ";
+                    WriteVector(os, "float4", m44 + 4*i, 4, false);
+                }
+                os << ")";
+            }
+            
+            virtual void writeMtxTimesVec(std::ostream & os, const std::string & mtx,
+                                          const std::string & vec) const
+            {
+                os << vec << " * " << mtx;
+            }
+            
+            virtual std::string lerpFunction() const { return "mix"; }
+            
+            virtual void writeSample(std::ostream & os, const GpuShaderSampler & sampler,
+                                     const std::string & coords) const
+            {
+                os << sampler.name << ".sample(" << sampler.name << "Sampler, " << coords << ")";
+            }
+            
+            virtual void writeDeclarations(std::ostream & os,
+                                           const GpuUniformVec & /*uniforms*/) const
+            {
+                os << "#include <metal_stdlib>\n";
+                os << "using namespace metal;\n\n";
+            }
+            
+        protected:
+            virtual std::string pixelParameter() const { return "float4 inPixel,"; }
+            virtual std::string samplerParameter(const GpuShaderSampler & sampler) const
+            {
+                return "texture" + TypeName("", sampler.dimensions) + "d<float> " + sampler.name
+                       + ", sampler " + sampler.name + "Sampler";
+            }
+            virtual std::string uniformParameter(const GpuUniform & uniform) const
+            {
+                return uniformType(uniform) + " " + uniform.name;
+            }
+        };
+        
+        const CgWriter g_cgWriter;
+        const GlslWriter g_glsl10Writer(false, false, true);
+        const GlslWriter g_glsl13Writer(true, true, true);
+        const GlslWriter g_glsl33Writer(true, false, false);
+        const HlslWriter g_hlslWriter;
+        const MslWriter g_mslWriter;
+    }
+    
+    GpuShaderWriter::~GpuShaderWriter()
+    { }
+    
+    bool GpuShaderWriter::clampsToHalf() const
+    {
+        return false;
+    }
+    
+    std::string GpuShaderWriter::floatSplat(int /*n*/, const std::string & value) const
+    {
+        return value;
+    }
+    
+    void GpuShaderWriter::writeMatrix(std::ostream & os, const float * m44) const
+    {
+        WriteVector(os, matrixType(), m44, 16, clampsToHalf());
+    }
+    
+    void GpuShaderWriter::writeAllEqual(std::ostream & os, const std::string & a,
+                                        const std::string & b) const
+    {
+        os << "all(" << a << " == " << b << ")";
+    }
+    
+    void GpuShaderWriter::writeDeclarations(std::ostream & os,
+                                            const GpuUniformVec & uniforms) const
+    {
+        for(unsigned int i=0; i<uniforms.size(); ++i)
         {
-            throw Exception("Unsupported shader language.");
+            os << "uniform " << uniformType(uniforms[i]) << " " << uniforms[i].name << ";\n";
         }
+        if(!uniforms.empty()) os << "\n";
     }
     
-    void Write_half3(std::ostream & os, const float * v3,  GpuLanguage lang)
+    void GpuShaderWriter::writeFunctionBegin(std::ostream & os, const std::string & fcnName,
+                                             const GpuShaderSamplerVec & samplers,
+                                             const GpuUniformVec & uniforms) const
     {
-        if(lang == GPU_LANGUAGE_CG)
+        std::vector<std::string> parameters;
+        for(unsigned int i=0; i<samplers.size(); ++i)
         {
-            os << "half3(";
-            for(int i=0; i<3; i++)
-            {
-                if(i!=0) os << ", ";
-                os << ClampToNormHalf(v3[i]);
-            }
-            os << ")";
+            parameters.push_back(samplerParameter(samplers[i]));
         }
-        else if(lang == GPU_LANGUAGE_GLSL_1_0 || lang == GPU_LANGUAGE_GLSL_1_3)
+        for(unsigned int i=0; i<uniforms.size(); ++i)
         {
-            os << "vec3(";
-            for(int i=0; i<3; i++)
-            {
-                if(i!=0) os << ", ";
-                os << v3[i]; // Clamping to half is not necessary
-            }
-            os << ")";
+            std::string parameter = uniformParameter(uniforms[i]);
+            if(!parameter.empty()) parameters.push_back(parameter);
         }
-        else
+        
+        os << halfType(4) << " " << fcnName << "(" << pixelParameter() << "\n";
+        for(unsigned int i=0; i<parameters.size(); ++i)
         {
-            throw Exception("Unsupported shader language.");
+            if(i!=0) os << ",\n";
+            os << "    " << parameters[i];
         }
+        os << ") \n";
+    }
+    
+    std::string GpuShaderWriter::uniformParameter(const GpuUniform & /*uniform*/) const
+    {
+        return "";
+    }
+    
+    std::string GpuShaderWriter::uniformType(const GpuUniform & uniform) const
+    {
+        if(uniform.type == GPU_UNIFORM_FLOAT4X4) return matrixType();
+        return halfType(4);
+    }
+    
+    const GpuShaderWriter & GetGpuShaderWriter(GpuLanguage lang)
+    {
+        switch(lang)
+        {
+            case GPU_LANGUAGE_CG: return g_cgWriter;
+            case GPU_LANGUAGE_GLSL_1_0: return g_glsl10Writer;
+            case GPU_LANGUAGE_GLSL_1_3: return g_glsl13Writer;
+            case GPU_LANGUAGE_GLSL_3_3:
+            case GPU_LANGUAGE_GLSL_4_0: return g_glsl33Writer;
+            case GPU_LANGUAGE_HLSL_DX11: return g_hlslWriter;
+            case GPU_LANGUAGE_MSL: return g_mslWriter;
+            default: break;
+        }
+        throw Exception("Unsupported shader language.");
+    }
+    
+    
+    
+    
+    void Write_half4x4(std::ostream & os, const float * m44, GpuLanguage lang)
+    {
+        GetGpuShaderWriter(lang).writeMatrix(os, m44);
+    }
+    
+    void Write_half4(std::ostream & os, const float * v4,  GpuLanguage lang)
+    {
+        const GpuShaderWriter & writer = GetGpuShaderWriter(lang);
+        WriteVector(os, writer.halfType(4), v4, 4, writer.clampsToHalf());
+    }
+    
+    void Write_half3(std::ostream & os, const float * v3,  GpuLanguage lang)
+    {
+        const GpuShaderWriter & writer = GetGpuShaderWriter(lang);
+        WriteVector(os, writer.halfType(3), v3, 3, writer.clampsToHalf());
     }
     
     
@@ -144,23 +405,34 @@ OCIO_NAMESPACE_ENTER
         return os.str();
     }
     
+    std::string AddGpuUniform(GpuUniformVec & uniforms,
+                              const GpuShaderDesc & shaderDesc,
+                              const std::string & tag,
+                              GpuUniformType type, const float * values)
+    {
+        int numValues = 0;
+        if(type == GPU_UNIFORM_FLOAT4) numValues = 4;
+        else if(type == GPU_UNIFORM_FLOAT4X4) numValues = 16;
+        else throw Exception("Unsupported shader uniform type.");
+        
+        std::ostringstream os;
+        os << shaderDesc.getFunctionName() << "_" << tag << uniforms.size();
+        
+        GpuUniform uniform;
+        uniform.name = os.str();
+        uniform.type = type;
+        uniform.values.assign(values, values + numValues);
+        uniforms.push_back(uniform);
+        
+        return uniform.name;
+    }
+    
     // Note that Cg and GLSL have opposite ordering for vec/mtx multiplication
     void Write_mtx_x_vec(std::ostream & os,
                          const std::string & mtx, const std::string & vec,
                          GpuLanguage lang)
     {
-        if(lang == GPU_LANGUAGE_CG)
-        {
-            os << "mul( " << mtx << ", " << vec << ")";
-        }
-        else if(lang == GPU_LANGUAGE_GLSL_1_0 || lang == GPU_LANGUAGE_GLSL_1_3)
-        {
-            os << vec << " * " << mtx;
-        }
-        else
-        {
-            throw Exception("Unsupported shader language.");
-        }
+        GetGpuShaderWriter(lang).writeMtxTimesVec(os, mtx, vec);
     }
     
     
@@ -171,23 +443,92 @@ OCIO_NAMESPACE_ENTER
         float m = ((float) lut3DEdgeLen-1.0f) / (float) lut3DEdgeLen;
         float b = 1.0f / (2.0f * (float) lut3DEdgeLen);
         
-        if(lang == GPU_LANGUAGE_CG)
+        GpuShaderSampler sampler;
+        sampler.name = lutName;
+        sampler.dimensions = 3;
+        
+        std::ostringstream coords;
+        coords << m << " * " << variableName << ".rgb + " << b;
+        
+        GetGpuShaderWriter(lang).writeSample(os, sampler, coords.str());
+        os << ".rgb;" << std::endl;
+    }
+    
+    void Write_applyLut1D_rgb(std::ostream & os, const std::string & variableName,
+                              const std::string & lutName,
+                              const float * domainMin, const float * domainScale,
+                              int length, int width, int height, bool nearest,
+                              GpuLanguage lang)
+    {
+        const GpuShaderWriter & writer = GetGpuShaderWriter(lang);
+        const std::string float3Type = writer.floatType(3);
+        const std::string float2Type = writer.floatType(2);
+        const std::string mix = writer.lerpFunction();
+        
+        GpuShaderSampler sampler;
+        sampler.name = lutName;
+        sampler.dimensions = (height == 1) ? 1 : 2;
+        
+        const std::string maxIndex = FloatLiteral((float) (length-1));
+        const std::string size = FloatLiteral((float) length);
+        const std::string w = FloatLiteral((float) width);
+        const std::string h = FloatLiteral((float) height);
+        static const char * channels[3] = { "r", "g", "b" };
+        
+        os << "{\n";
+        os << "    " << float3Type << " lut1d_index = clamp((" << variableName << ".rgb - ";
+        os << Float3Literal(domainMin, writer) << ") * " << Float3Literal(domainScale, writer);
+        os << ", " << writer.floatSplat(3, "0.0") << ", " << writer.floatSplat(3, "1.0");
+        os << ") * " << maxIndex << ";\n";
+        if(nearest)
         {
-            os << "tex3D(";
-            os << lutName << ", ";
-            os << m << " * " << variableName << ".rgb + " << b << ").rgb;" << std::endl;
+            // Rounds to the closest entry, as Lut1D_Nearest does on the cpu
+            os << "    lut1d_index = floor(lut1d_index + 0.5);\n";
         }
-        else if(lang == GPU_LANGUAGE_GLSL_1_0 || lang == GPU_LANGUAGE_GLSL_1_3)
+        
+        if(height == 1)
         {
-            os << "texture3D(";
-            os << lutName << ", ";
-            os << m << " * " << variableName << ".rgb + " << b << ").rgb;" << std::endl;
+            // Hardware filtering interpolates in between the texel centers
+            os << "    lut1d_index = (lut1d_index + 0.5) / " << size << ";\n";
+            for(int c=0; c<3; ++c)
+            {
+                os << "    " << variableName << "." << channels[c] << " = ";
+                writer.writeSample(os, sampler, std::string("lut1d_index.") + channels[c]);
+                os << "." << channels[c] << ";\n";
+            }
         }
         else
         {
-            throw Exception("Unsupported shader language.");
+            // Rows are not contiguous for the hardware filtering, so the
+            // two closest entries are fetched and interpolated here.
+            os << "    " << float3Type << " lut1d_lo = floor(lut1d_index);\n";
+            os << "    " << float3Type << " lut1d_hi = min(lut1d_lo + 1.0, ";
+            os << writer.floatSplat(3, maxIndex) << ");\n";
+            os << "    " << float3Type << " lut1d_frac = lut1d_index - lut1d_lo;\n";
+            os << "    " << float3Type << " lut1d_row_lo = floor((lut1d_lo + 0.5) / " << w << ");\n";
+            os << "    " << float3Type << " lut1d_row_hi = floor((lut1d_hi + 0.5) / " << w << ");\n";
+            os << "    " << float3Type << " lut1d_col_lo = lut1d_lo - lut1d_row_lo * " << w << ";\n";
+            os << "    " << float3Type << " lut1d_col_hi = lut1d_hi - lut1d_row_hi * " << w << ";\n";
+            for(int c=0; c<3; ++c)
+            {
+                const char * ch = channels[c];
+                std::ostringstream coordsLo, coordsHi;
+                coordsLo << float2Type << "((lut1d_col_lo." << ch << " + 0.5) / " << w;
+                coordsLo << ", (lut1d_row_lo." << ch << " + 0.5) / " << h << ")";
+                coordsHi << float2Type << "((lut1d_col_hi." << ch << " + 0.5) / " << w;
+                coordsHi << ", (lut1d_row_hi." << ch << " + 0.5) / " << h << ")";
+                
+                os << "    " << variableName << "." << ch << " = " << mix << "(\n";
+                os << "        ";
+                writer.writeSample(os, sampler, coordsLo.str());
+                os << "." << ch << ",\n";
+                os << "        ";
+                writer.writeSample(os, sampler, coordsHi.str());
+                os << "." << ch << ",\n";
+                os << "        lut1d_frac." << ch << ");\n";
+            }
         }
+        os << "}\n";
     }
-
 }
 OCIO_NAMESPACE_EXIT
@@ -33,9 +33,104 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <OpenColorIO/OpenColorIO.h>
 
 #include <sstream>
+#include <vector>
 
 OCIO_NAMESPACE_ENTER
 {
+    // A parameter of the shader text read from a uniform
+    // (see GpuShaderDesc::setUniformsEnabled)
+    struct GpuUniform
+    {
+        std::string name;
+        GpuUniformType type;
+        // 4 or 16 values, as for Write_half4 / Write_half4x4
+        std::vector<float> values;
+    };
+    
+    typedef std::vector<GpuUniform> GpuUniformVec;
+    
+    // Add a uniform, named after the shader function so that several
+    // functions can share a program, and return its name
+    std::string AddGpuUniform(GpuUniformVec & uniforms,
+                              const GpuShaderDesc & shaderDesc,
+                              const std::string & tag,
+                              GpuUniformType type, const float * values);
+    
+    // A texture argument of the shader function
+    struct GpuShaderSampler
+    {
+        std::string name;
+        // 1, 2 or 3
+        int dimensions;
+    };
+    
+    typedef std::vector<GpuShaderSampler> GpuShaderSamplerVec;
+    
+    // The text which differs from one shading language to another. Each
+    // language has one writer (see GetGpuShaderWriter), which the Write_*
+    // functions below go through, so supporting a new language is a
+    // matter of adding a writer for it.
+    
+    class GpuShaderWriter
+    {
+    public:
+        virtual ~GpuShaderWriter();
+        
+        // The vector types of n components used for the pixel and the
+        // op constants (half precision where the language has it), and
+        // for computations which need full float precision
+        virtual std::string halfType(int n) const = 0;
+        virtual std::string floatType(int n) const = 0;
+        virtual std::string matrixType() const = 0;
+        
+        // Whether the constants have to be clamped to the half range
+        virtual bool clampsToHalf() const;
+        
+        // A vector of n components all set to value, where a scalar
+        // is not accepted in place of the vector (e.g. in clamp or min)
+        virtual std::string floatSplat(int n, const std::string & value) const;
+        
+        // A matrix constant, m44 being row-major
+        virtual void writeMatrix(std::ostream & os, const float * m44) const;
+        virtual void writeMtxTimesVec(std::ostream & os, const std::string & mtx,
+                                      const std::string & vec) const = 0;
+        
+        // Whether all the components of 2 vectors are equal, as a bool
+        virtual void writeAllEqual(std::ostream & os, const std::string & a,
+                                   const std::string & b) const;
+        
+        // The linear interpolation function, as mix in GLSL
+        virtual std::string lerpFunction() const = 0;
+        
+        // A texture lookup, returning 4 components
+        virtual void writeSample(std::ostream & os, const GpuShaderSampler & sampler,
+                                 const std::string & coords) const = 0;
+        
+        // Everything ahead of the function: includes and the uniforms
+        virtual void writeDeclarations(std::ostream & os,
+                                       const GpuUniformVec & uniforms) const;
+        
+        // The signature of the function, up to the opening brace
+        virtual void writeFunctionBegin(std::ostream & os, const std::string & fcnName,
+                                        const GpuShaderSamplerVec & samplers,
+                                        const GpuUniformVec & uniforms) const;
+        
+    protected:
+        // The pixel argument, with the separator which follows it
+        virtual std::string pixelParameter() const = 0;
+        // The function arguments a sampler is passed as
+        virtual std::string samplerParameter(const GpuShaderSampler & sampler) const = 0;
+        // The function argument a uniform is passed as, if it is not
+        // declared ahead of the function (empty otherwise)
+        virtual std::string uniformParameter(const GpuUniform & uniform) const;
+        // The declared type of a uniform, whose matrix values are given
+        // as documented in Processor::getGpuUniformValue
+        virtual std::string uniformType(const GpuUniform & uniform) const;
+    };
+    
+    // Throws for an unknown language
+    const GpuShaderWriter & GetGpuShaderWriter(GpuLanguage lang);
+    
     std::string GpuTextHalf4x4(const float * m44, GpuLanguage lang);
     std::string GpuTextHalf4(const float * v4, GpuLanguage lang);
     std::string GpuTextHalf3(const float * v3, GpuLanguage lang);
@@ -52,6 +147,17 @@ OCIO_NAMESPACE_ENTER
     void Write_sampleLut3D_rgb(std::ostream & os, const std::string & variableName,
                                const std::string & lutName, int lut3DEdgeLen,
                                GpuLanguage lang);
+    
+    // Applies a 1d lut sampled from a texture to variableName.rgb, as a
+    // block of statements. The lut has 'length' rgb entries, stored in
+    // rows of 'width' texels ('height' 1 is a 1D texture, sampled with
+    // linear filtering). Each channel is mapped to 0-1 as
+    // (x - domainMin) * domainScale before the lookup.
+    void Write_applyLut1D_rgb(std::ostream & os, const std::string & variableName,
+                              const std::string & lutName,
+                              const float * domainMin, const float * domainScale,
+                              int length, int width, int height, bool nearest,
+                              GpuLanguage lang);
 }
 OCIO_NAMESPACE_EXIT
 
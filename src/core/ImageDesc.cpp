@@ -31,6 +31,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <cstdlib>
 #include <sstream>
 
+#include "BitDepthUtils.h"
 #include "ImagePacking.h"
 
 OCIO_NAMESPACE_ENTER
@@ -45,6 +46,7 @@ OCIO_NAMESPACE_ENTER
             os << "width=" << packedImg->getWidth() << ", ";
             os << "height=" << packedImg->getHeight() << ", ";
             os << "numChannels=" << packedImg->getNumChannels() << ", ";
+            os << "bitDepth=" << BitDepthToString(packedImg->getBitDepth()) << ", ";
             os << "chanStrideBytes=" << packedImg->getChanStrideBytes() << ", ";
             os << "xStrideBytes=" << packedImg->getXStrideBytes() << ", ";
             os << "yStrideBytes=" << packedImg->getYStrideBytes() << "";
@@ -59,6 +61,7 @@ OCIO_NAMESPACE_ENTER
             os << "aData=" << planarImg->getAData() << ", ";
             os << "width=" << packedImg->getWidth() << ", ";
             os << "height=" << packedImg->getHeight() << ", ";
+            os << "bitDepth=" << BitDepthToString(planarImg->getBitDepth()) << ", ";
             os << "yStrideBytes=" << planarImg->getYStrideBytes() << "";
             os << ">";
         }
@@ -85,7 +88,10 @@ OCIO_NAMESPACE_ENTER
         rData(NULL),
         gData(NULL),
         bData(NULL),
-        aData(NULL)
+        aData(NULL),
+        bitDepth(BIT_DEPTH_UNKNOWN),
+        toFloat(NULL),
+        fromFloat(NULL)
     { };
     
     
@@ -114,15 +120,13 @@ OCIO_NAMESPACE_ENTER
                 throw Exception("Malformed PackedImageDesc: Unresolved AutoStride.");
             }
             
-            rData = packedImg->getData();
-            gData = reinterpret_cast<float*>( reinterpret_cast<char*>(rData)
-                + chanStrideBytes );
-            bData = reinterpret_cast<float*>( reinterpret_cast<char*>(rData)
-                + 2*chanStrideBytes );
+            bitDepth = packedImg->getBitDepth();
+            rData = reinterpret_cast<char*>(packedImg->getData());
+            gData = rData + chanStrideBytes;
+            bData = rData + 2*chanStrideBytes;
             if(numChannels >= 4)
             {
-                aData = reinterpret_cast<float*>( reinterpret_cast<char*>(rData)
-                  + 3*chanStrideBytes );
+                aData = rData + 3*chanStrideBytes;
             }
             
             if(rData == NULL)
@@ -152,8 +156,9 @@ OCIO_NAMESPACE_ENTER
         {
             width = planarImg->getWidth();
             height = planarImg->getHeight();
-            xStrideBytes = sizeof(float);
             yStrideBytes = planarImg->getYStrideBytes();
+            bitDepth = planarImg->getBitDepth();
+            xStrideBytes = GetBitDepthChannelSize(bitDepth);
             
             // AutoStrides will already be resolved by here, in the constructor of the ImageDesc
             if(yStrideBytes == AutoStride)
@@ -161,10 +166,10 @@ OCIO_NAMESPACE_ENTER
                 throw Exception("Malformed PlanarImageDesc: Unresolved AutoStride.");
             }
             
-            rData = planarImg->getRData();
-            gData = planarImg->getGData();
-            bData = planarImg->getBData();
-            aData = planarImg->getAData();
+            rData = reinterpret_cast<char*>(planarImg->getRData());
+            gData = reinterpret_cast<char*>(planarImg->getGData());
+            bData = reinterpret_cast<char*>(planarImg->getBData());
+            aData = reinterpret_cast<char*>(planarImg->getAData());
             
             if(width <= 0 || height <= 0)
             {
@@ -185,29 +190,30 @@ OCIO_NAMESPACE_ENTER
         {
             throw Exception("Unknown ImageDesc type.");
         }
+        
+        SIMDLevel simdLevel = GetSIMDLevel();
+        toFloat = GetChannelToFloatFn(bitDepth, simdLevel);
+        fromFloat = GetChannelFromFloatFn(bitDepth, simdLevel);
+        
+        if(!toFloat || !fromFloat)
+        {
+            std::ostringstream os;
+            os << "ImageDesc Error: Unsupported image bit depth '";
+            os << BitDepthToString(bitDepth) << "'.";
+            throw Exception(os.str().c_str());
+        }
     }
     
     bool GenericImageDesc::isPackedRGBA() const
     {
-        char* rPtr = reinterpret_cast<char*>(rData);
-        char* gPtr = reinterpret_cast<char*>(gData);
-        char* bPtr = reinterpret_cast<char*>(bData);
-        char* aPtr = reinterpret_cast<char*>(aData);
-        
-        if(gPtr-rPtr != sizeof(float)) return false;
-        if(bPtr-gPtr != sizeof(float)) return false;
-        if(aPtr && (aPtr-bPtr != sizeof(float))) return false;
+        const ptrdiff_t channelSize = GetBitDepthChannelSize(bitDepth);
+        if(channelSize <= 0) return false;
         
-        // Confirm xStrideBytes is a pure float-sized packing
-        // (I.e., it will divide evenly)
-        if(xStrideBytes <= 0) return false;
-        div_t result = div((int) xStrideBytes, (int)sizeof(float));
-        if(result.rem != 0) return false;
+        if(gData-rData != channelSize) return false;
+        if(bData-gData != channelSize) return false;
+        if(!aData || (aData-bData != channelSize)) return false;
         
-        int implicitChannels = result.quot;
-        if(implicitChannels != 4) return false;
-        
-        return true;
+        return xStrideBytes == 4*channelSize;
     }
     
     
@@ -217,7 +223,8 @@ OCIO_NAMESPACE_ENTER
     class PackedImageDesc::Impl
     {
     public:
-        float * data_;
+        void * data_;
+        BitDepth bitDepth_;
         long width_;
         long height_;
         long numChannels_;
@@ -227,6 +234,7 @@ OCIO_NAMESPACE_ENTER
         
         Impl() :
             data_(NULL),
+            bitDepth_(BIT_DEPTH_UNKNOWN),
             width_(0),
             height_(0),
             numChannels_(0),
@@ -238,6 +246,30 @@ OCIO_NAMESPACE_ENTER
         
         ~Impl()
         { }
+        
+        void init(void * data, BitDepth bitDepth,
+                  long width, long height,
+                  long numChannels,
+                  ptrdiff_t chanStrideBytes,
+                  ptrdiff_t xStrideBytes,
+                  ptrdiff_t yStrideBytes)
+        {
+            // An unsupported bit depth has no channel size, and will be
+            // reported when the image is used.
+            ptrdiff_t channelSize = GetBitDepthChannelSize(bitDepth);
+            
+            data_ = data;
+            bitDepth_ = bitDepth;
+            width_ = width;
+            height_ = height;
+            numChannels_ = numChannels;
+            chanStrideBytes_ = (chanStrideBytes == AutoStride)
+                ? channelSize : chanStrideBytes;
+            xStrideBytes_ = (xStrideBytes == AutoStride)
+                ? channelSize*numChannels : xStrideBytes;
+            yStrideBytes_ = (yStrideBytes == AutoStride)
+                ? xStrideBytes_*width : yStrideBytes;
+        }
     };
     
     PackedImageDesc::PackedImageDesc(float * data,
@@ -248,16 +280,21 @@ OCIO_NAMESPACE_ENTER
                                      ptrdiff_t yStrideBytes)
         : m_impl(new PackedImageDesc::Impl)
     {
-        getImpl()->data_ = data;
-        getImpl()->width_ = width;
-        getImpl()->height_ = height;
-        getImpl()->numChannels_ = numChannels;
-        getImpl()->chanStrideBytes_ = (chanStrideBytes == AutoStride)
-            ? sizeof(float) : chanStrideBytes;
-        getImpl()->xStrideBytes_ = (xStrideBytes == AutoStride)
-            ? sizeof(float)*numChannels : xStrideBytes;
-        getImpl()->yStrideBytes_ = (yStrideBytes == AutoStride)
-            ? sizeof(float)*width*numChannels : yStrideBytes;
+        getImpl()->init(data, BIT_DEPTH_F32, width, height, numChannels,
+                        chanStrideBytes, xStrideBytes, yStrideBytes);
+    }
+    
+    PackedImageDesc::PackedImageDesc(void * data,
+                                     long width, long height,
+                                     long numChannels,
+                                     BitDepth bitDepth,
+                                     ptrdiff_t chanStrideBytes,
+                                     ptrdiff_t xStrideBytes,
+                                     ptrdiff_t yStrideBytes)
+        : m_impl(new PackedImageDesc::Impl)
+    {
+        getImpl()->init(data, bitDepth, width, height, numChannels,
+                        chanStrideBytes, xStrideBytes, yStrideBytes);
     }
     
     PackedImageDesc::~PackedImageDesc()
@@ -268,7 +305,12 @@ OCIO_NAMESPACE_ENTER
     
     float * PackedImageDesc::getData() const
     {
-        return getImpl()->data_;
+        return reinterpret_cast<float *>(getImpl()->data_);
+    }
+    
+    BitDepth PackedImageDesc::getBitDepth() const
+    {
+        return getImpl()->bitDepth_;
     }
     
     long PackedImageDesc::getWidth() const
@@ -309,10 +351,11 @@ OCIO_NAMESPACE_ENTER
     class PlanarImageDesc::Impl
     {
     public:
-        float * rData_;
-        float * gData_;
-        float * bData_;
-        float * aData_;
+        void * rData_;
+        void * gData_;
+        void * bData_;
+        void * aData_;
+        BitDepth bitDepth_;
         long width_;
         long height_;
         ptrdiff_t yStrideBytes_;
@@ -322,6 +365,7 @@ OCIO_NAMESPACE_ENTER
             gData_(NULL),
             bData_(NULL),
             aData_(NULL),
+            bitDepth_(BIT_DEPTH_UNKNOWN),
             width_(0),
             height_(0),
             yStrideBytes_(0)
@@ -329,6 +373,22 @@ OCIO_NAMESPACE_ENTER
         
         ~Impl()
         { }
+        
+        void init(void * rData, void * gData, void * bData, void * aData,
+                  BitDepth bitDepth,
+                  long width, long height,
+                  ptrdiff_t yStrideBytes)
+        {
+            rData_ = rData;
+            gData_ = gData;
+            bData_ = bData;
+            aData_ = aData;
+            bitDepth_ = bitDepth;
+            width_ = width;
+            height_ = height;
+            yStrideBytes_ = (yStrideBytes == AutoStride)
+                ? GetBitDepthChannelSize(bitDepth)*width : yStrideBytes;
+        }
     };
     
     
@@ -337,14 +397,18 @@ OCIO_NAMESPACE_ENTER
                                      ptrdiff_t yStrideBytes)
         : m_impl(new PlanarImageDesc::Impl())
     {
-        getImpl()->rData_ = rData;
-        getImpl()->gData_ = gData;
-        getImpl()->bData_ = bData;
-        getImpl()->aData_ = aData;
-        getImpl()->width_ = width;
-        getImpl()->height_ = height;
-        getImpl()->yStrideBytes_ = (yStrideBytes == AutoStride)
-            ? sizeof(float)*width : yStrideBytes;
+        getImpl()->init(rData, gData, bData, aData, BIT_DEPTH_F32,
+                        width, height, yStrideBytes);
+    }
+    
+    PlanarImageDesc::PlanarImageDesc(void * rData, void * gData, void * bData, void * aData,
+                                     long width, long height,
+                                     BitDepth bitDepth,
+                                     ptrdiff_t yStrideBytes)
+        : m_impl(new PlanarImageDesc::Impl())
+    {
+        getImpl()->init(rData, gData, bData, aData, bitDepth,
+                        width, height, yStrideBytes);
     }
     
     PlanarImageDesc::~PlanarImageDesc()
@@ -355,22 +419,27 @@ OCIO_NAMESPACE_ENTER
     
     float* PlanarImageDesc::getRData() const
     {
-        return getImpl()->rData_;
+        return reinterpret_cast<float*>(getImpl()->rData_);
     }
     
     float* PlanarImageDesc::getGData() const
     {
-        return getImpl()->gData_;
+        return reinterpret_cast<float*>(getImpl()->gData_);
     }
     
     float* PlanarImageDesc::getBData() const
     {
-        return getImpl()->bData_;
+        return reinterpret_cast<float*>(getImpl()->bData_);
     }
     
     float* PlanarImageDesc::getAData() const
     {
-        return getImpl()->aData_;
+        return reinterpret_cast<float*>(getImpl()->aData_);
+    }
+    
+    BitDepth PlanarImageDesc::getBitDepth() const
+    {
+        return getImpl()->bitDepth_;
     }
     
     long PlanarImageDesc::getWidth() const
@@ -28,6 +28,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include <algorithm>
 #include <sstream>
 #include <iostream>
 #include <cassert>
@@ -41,356 +42,220 @@ OCIO_NAMESPACE_ENTER
 
     namespace
     {
-        // GENERIC CASE, SLOW BUT ALWAYS WORKS
+        // Pixels of non-float images are gathered into (or scattered
+        // from) a small rgba buffer of raw channel values, which is
+        // then converted to (or from) float in one go.
         
-        void PackRGBAFromImageDesc_Generic(const GenericImageDesc& srcImg,
-                                           float* outputBuffer,
-                                           int* numPixelsCopied,
-                                           int outputBufferSize,
-                                           long imagePixelStartIndex)
+        const long PIXELS_PER_CHUNK = 256;
+        
+        template<typename T>
+        void GatherRGBA(T* outputBuffer,
+                        const char* rPtr, const char* gPtr,
+                        const char* bPtr, const char* aPtr,
+                        ptrdiff_t xStrideBytes, long numPixels)
         {
-            assert(outputBuffer);
-            assert(numPixelsCopied);
-            
-            long imgWidth = srcImg.width;
-            long imgHeight = srcImg.height;
-            long imgPixels = imgWidth * imgHeight;
-            
-            if(imagePixelStartIndex<0 || imagePixelStartIndex>=imgPixels)
+            for(long pixelIndex=0; pixelIndex<numPixels; ++pixelIndex)
             {
-                *numPixelsCopied = 0;
-                return;
-            }
-            
-            ptrdiff_t xStrideBytes  = srcImg.xStrideBytes;
-            ptrdiff_t yStrideBytes  = srcImg.yStrideBytes;
-            long yIndex = imagePixelStartIndex / imgWidth;
-            long xIndex = imagePixelStartIndex % imgWidth;
-            
-            // Figure out our initial ptr positions
-            char* rRow = reinterpret_cast<char*>(srcImg.rData) +
-                yStrideBytes * yIndex;
-            char* gRow = reinterpret_cast<char*>(srcImg.gData) +
-                yStrideBytes * yIndex;
-            char* bRow = reinterpret_cast<char*>(srcImg.bData) +
-                yStrideBytes * yIndex;
-            char* aRow = NULL;
-            
-            float* rPtr = reinterpret_cast<float*>(rRow + xStrideBytes*xIndex);
-            float* gPtr = reinterpret_cast<float*>(gRow + xStrideBytes*xIndex);
-            float* bPtr = reinterpret_cast<float*>(bRow + xStrideBytes*xIndex);
-            float* aPtr = NULL;
-            
-            if(srcImg.aData)
-            {
-                aRow = reinterpret_cast<char*>(srcImg.aData) + yStrideBytes * yIndex;
-                aPtr = reinterpret_cast<float*>(aRow + xStrideBytes*xIndex);
-            }
-            
-            if(aPtr)
-            {
-                int pixelsCopied = 0;
-                while(pixelsCopied < outputBufferSize)
-                {
-                    outputBuffer[4*pixelsCopied] = *rPtr;
-                    outputBuffer[4*pixelsCopied+1] = *gPtr;
-                    outputBuffer[4*pixelsCopied+2] = *bPtr;
-                    outputBuffer[4*pixelsCopied+3] = *aPtr;
-                    pixelsCopied++;
-                    xIndex++;
-                    
-                    // Jump to the next scanline
-                    if(xIndex == imgWidth)
-                    {
-                        yIndex += 1;
-                        if(yIndex == imgHeight)
-                        {
-                            *numPixelsCopied = pixelsCopied;
-                            return;
-                        }
-                        
-                        xIndex = 0;
-                        rRow += yStrideBytes;
-                        gRow += yStrideBytes;
-                        bRow += yStrideBytes;
-                        aRow += yStrideBytes;
-                        
-                        rPtr = reinterpret_cast<float*>(rRow);
-                        gPtr = reinterpret_cast<float*>(gRow);
-                        bPtr = reinterpret_cast<float*>(bRow);
-                        aPtr = reinterpret_cast<float*>(aRow);
-                    }
-                    // Jump to the next pixel
-                    else
-                    {
-                        rPtr = reinterpret_cast<float*>(
-                            reinterpret_cast<char*>(rPtr) + xStrideBytes);
-                        gPtr = reinterpret_cast<float*>(
-                            reinterpret_cast<char*>(gPtr) + xStrideBytes);
-                        bPtr = reinterpret_cast<float*>(
-                            reinterpret_cast<char*>(bPtr) + xStrideBytes);
-                        aPtr = reinterpret_cast<float*>(
-                            reinterpret_cast<char*>(aPtr) + xStrideBytes);
-                    }
-                }
+                outputBuffer[4*pixelIndex] = *reinterpret_cast<const T*>(rPtr);
+                outputBuffer[4*pixelIndex+1] = *reinterpret_cast<const T*>(gPtr);
+                outputBuffer[4*pixelIndex+2] = *reinterpret_cast<const T*>(bPtr);
+                outputBuffer[4*pixelIndex+3] = aPtr ?
+                    *reinterpret_cast<const T*>(aPtr) : T(0);
                 
-                *numPixelsCopied = pixelsCopied;
+                rPtr += xStrideBytes;
+                gPtr += xStrideBytes;
+                bPtr += xStrideBytes;
+                if(aPtr) aPtr += xStrideBytes;
             }
-            else
+        }
+        
+        template<typename T>
+        void ScatterRGBA(const T* inputBuffer,
+                         char* rPtr, char* gPtr,
+                         char* bPtr, char* aPtr,
+                         ptrdiff_t xStrideBytes, long numPixels)
+        {
+            for(long pixelIndex=0; pixelIndex<numPixels; ++pixelIndex)
             {
-                int pixelsCopied = 0;
-                while(pixelsCopied < outputBufferSize)
-                {
-                    outputBuffer[4*pixelsCopied] = *rPtr;
-                    outputBuffer[4*pixelsCopied+1] = *gPtr;
-                    outputBuffer[4*pixelsCopied+2] = *bPtr;
-                    outputBuffer[4*pixelsCopied+3] = 0.0;
-                    pixelsCopied++;
-                    xIndex++;
-                    
-                    // Jump to the next scanline
-                    if(xIndex == imgWidth)
-                    {
-                        yIndex += 1;
-                        if(yIndex == imgHeight)
-                        {
-                            *numPixelsCopied = pixelsCopied;
-                            return;
-                        }
-                        
-                        xIndex = 0;
-                        rRow += yStrideBytes;
-                        gRow += yStrideBytes;
-                        bRow += yStrideBytes;
-                        
-                        rPtr = reinterpret_cast<float*>(rRow);
-                        gPtr = reinterpret_cast<float*>(gRow);
-                        bPtr = reinterpret_cast<float*>(bRow);
-                    }
-                    // Jump to the next pixel
-                    else
-                    {
-                        rPtr = reinterpret_cast<float*>(
-                            reinterpret_cast<char*>(rPtr) + xStrideBytes);
-                        gPtr = reinterpret_cast<float*>(
-                            reinterpret_cast<char*>(gPtr) + xStrideBytes);
-                        bPtr = reinterpret_cast<float*>(
-                            reinterpret_cast<char*>(bPtr) + xStrideBytes);
-                    }
-                }
+                *reinterpret_cast<T*>(rPtr) = inputBuffer[4*pixelIndex];
+                *reinterpret_cast<T*>(gPtr) = inputBuffer[4*pixelIndex+1];
+                *reinterpret_cast<T*>(bPtr) = inputBuffer[4*pixelIndex+2];
+                if(aPtr) *reinterpret_cast<T*>(aPtr) = inputBuffer[4*pixelIndex+3];
                 
-                *numPixelsCopied = pixelsCopied;
+                rPtr += xStrideBytes;
+                gPtr += xStrideBytes;
+                bPtr += xStrideBytes;
+                if(aPtr) aPtr += xStrideBytes;
             }
         }
         
-        void UnpackRGBAToImageDesc_Generic(GenericImageDesc& dstImg,
-                                           float* inputBuffer,
-                                           int numPixelsToUnpack,
-                                           long imagePixelStartIndex)
+        // Pack numPixels pixels of a single scanline, starting at xIndex
+        
+        void PackRGBAFromScanline(const GenericImageDesc& srcImg,
+                                  bool isPackedRGBA,
+                                  long xIndex, long yIndex, long numPixels,
+                                  float* outputBuffer)
         {
-            assert(inputBuffer);
-            
-            long imgWidth = dstImg.width;
-            long imgHeight = dstImg.height;
-            long imgPixels = imgWidth * imgHeight;
+            const ptrdiff_t offset = srcImg.yStrideBytes * yIndex +
+                                     srcImg.xStrideBytes * xIndex;
+            const char* rPtr = srcImg.rData + offset;
+            const char* gPtr = srcImg.gData + offset;
+            const char* bPtr = srcImg.bData + offset;
+            const char* aPtr = srcImg.aData ? srcImg.aData + offset : NULL;
             
-            if(imagePixelStartIndex<0 || imagePixelStartIndex>=imgPixels)
+            // The channel values are already in rgba order
+            if(isPackedRGBA)
             {
+                srcImg.toFloat(outputBuffer, rPtr, 4*numPixels);
                 return;
             }
             
-            ptrdiff_t xStrideBytes  = dstImg.xStrideBytes;
-            ptrdiff_t yStrideBytes  = dstImg.yStrideBytes;
-            long yIndex = imagePixelStartIndex / imgWidth;
-            long xIndex = imagePixelStartIndex % imgWidth;
-            
-            // Figure out our initial ptr positions
-            char* rRow = reinterpret_cast<char*>(dstImg.rData) +
-                yStrideBytes * yIndex;
-            char* gRow = reinterpret_cast<char*>(dstImg.gData) +
-                yStrideBytes * yIndex;
-            char* bRow = reinterpret_cast<char*>(dstImg.bData) +
-                yStrideBytes * yIndex;
-            char* aRow = NULL;
-            
-            float* rPtr = reinterpret_cast<float*>(rRow + xStrideBytes*xIndex);
-            float* gPtr = reinterpret_cast<float*>(gRow + xStrideBytes*xIndex);
-            float* bPtr = reinterpret_cast<float*>(bRow + xStrideBytes*xIndex);
-            float* aPtr = NULL;
-            
-            if(dstImg.aData)
+            if(srcImg.bitDepth == BIT_DEPTH_F32)
             {
-                aRow = reinterpret_cast<char*>(dstImg.aData) + yStrideBytes * yIndex;
-                aPtr = reinterpret_cast<float*>(aRow + xStrideBytes*xIndex);
+                GatherRGBA<float>(outputBuffer, rPtr, gPtr, bPtr, aPtr,
+                                  srcImg.xStrideBytes, numPixels);
+                return;
             }
             
-            if(aPtr)
+            // Wide enough for all the other bit depths
+            unsigned short rawBuffer[PIXELS_PER_CHUNK*4];
+            const int channelSize = GetBitDepthChannelSize(srcImg.bitDepth);
+            
+            while(numPixels > 0)
             {
-                int pixelsCopied = 0;
-                while(pixelsCopied < numPixelsToUnpack)
+                long chunkPixels = std::min(numPixels, PIXELS_PER_CHUNK);
+                
+                if(channelSize == 1)
                 {
-                    *rPtr = inputBuffer[4*pixelsCopied];
-                    *gPtr = inputBuffer[4*pixelsCopied+1];
-                    *bPtr = inputBuffer[4*pixelsCopied+2];
-                    *aPtr = inputBuffer[4*pixelsCopied+3];
-                    
-                    pixelsCopied++;
-                    xIndex++;
-                    
-                    // Jump to the next scanline
-                    if(xIndex == imgWidth)
-                    {
-                        yIndex += 1;
-                        if(yIndex == imgHeight)
-                        {
-                            return;
-                        }
-                        
-                        xIndex = 0;
-                        rRow += yStrideBytes;
-                        gRow += yStrideBytes;
-                        bRow += yStrideBytes;
-                        aRow += yStrideBytes;
-                        
-                        rPtr = reinterpret_cast<float*>(rRow);
-                        gPtr = reinterpret_cast<float*>(gRow);
-                        bPtr = reinterpret_cast<float*>(bRow);
-                        aPtr = reinterpret_cast<float*>(aRow);
-                    }
-                    // Jump to the next pixel
-                    else
-                    {
-                        rPtr = reinterpret_cast<float*>(
-                            reinterpret_cast<char*>(rPtr) + xStrideBytes);
-                        gPtr = reinterpret_cast<float*>(
-                            reinterpret_cast<char*>(gPtr) + xStrideBytes);
-                        bPtr = reinterpret_cast<float*>(
-                            reinterpret_cast<char*>(bPtr) + xStrideBytes);
-                        aPtr = reinterpret_cast<float*>(
-                            reinterpret_cast<char*>(aPtr) + xStrideBytes);
-                    }
+                    GatherRGBA<unsigned char>(
+                        reinterpret_cast<unsigned char*>(rawBuffer),
+                        rPtr, gPtr, bPtr, aPtr,
+                        srcImg.xStrideBytes, chunkPixels);
                 }
-            }
-            else
-            {
-                int pixelsCopied = 0;
-                while(pixelsCopied < numPixelsToUnpack)
+                else
                 {
-                    *rPtr = inputBuffer[4*pixelsCopied];
-                    *gPtr = inputBuffer[4*pixelsCopied+1];
-                    *bPtr = inputBuffer[4*pixelsCopied+2];
-                    
-                    pixelsCopied++;
-                    xIndex++;
-                    
-                    // Jump to the next scanline
-                    if(xIndex == imgWidth)
-                    {
-                        yIndex += 1;
-                        if(yIndex == imgHeight)
-                        {
-                            return;
-                        }
-                        
-                        xIndex = 0;
-                        rRow += yStrideBytes;
-                        gRow += yStrideBytes;
-                        bRow += yStrideBytes;
-                        
-                        rPtr = reinterpret_cast<float*>(rRow);
-                        gPtr = reinterpret_cast<float*>(gRow);
-                        bPtr = reinterpret_cast<float*>(bRow);
-                    }
-                    // Jump to the next pixel
-                    else
-                    {
-                        rPtr = reinterpret_cast<float*>(
-                            reinterpret_cast<char*>(rPtr) + xStrideBytes);
-                        gPtr = reinterpret_cast<float*>(
-                            reinterpret_cast<char*>(gPtr) + xStrideBytes);
-                        bPtr = reinterpret_cast<float*>(
-                            reinterpret_cast<char*>(bPtr) + xStrideBytes);
-                    }
+                    GatherRGBA<unsigned short>(rawBuffer,
+                        rPtr, gPtr, bPtr, aPtr,
+                        srcImg.xStrideBytes, chunkPixels);
                 }
+                
+                srcImg.toFloat(outputBuffer, rawBuffer, 4*chunkPixels);
+                
+                const ptrdiff_t chunkBytes = srcImg.xStrideBytes * chunkPixels;
+                rPtr += chunkBytes;
+                gPtr += chunkBytes;
+                bPtr += chunkBytes;
+                if(aPtr) aPtr += chunkBytes;
+                
+                outputBuffer += 4*chunkPixels;
+                numPixels -= chunkPixels;
             }
         }
         
-    }
-    
-    
-    /*
-    namespace
-    {
-    
-        void PackRGBAFromImageDesc_RGBAMemcpy(const GenericImageDesc& srcImg,
-                                              float* outputBuffer,
-                                              int* numPixelsCopied,
-                                              int outputBufferSize,
-                                              int imagePixelStartIndex)
+        // Unpack numPixels pixels into a single scanline, starting at xIndex
+        
+        void UnpackRGBAToScanline(GenericImageDesc& dstImg,
+                                  bool isPackedRGBA,
+                                  long xIndex, long yIndex, long numPixels,
+                                  const float* inputBuffer)
         {
-            assert(outputBuffer);
-            assert(numPixelsCopied);
+            const ptrdiff_t offset = dstImg.yStrideBytes * yIndex +
+                                     dstImg.xStrideBytes * xIndex;
+            char* rPtr = dstImg.rData + offset;
+            char* gPtr = dstImg.gData + offset;
+            char* bPtr = dstImg.bData + offset;
+            char* aPtr = dstImg.aData ? dstImg.aData + offset : NULL;
             
-            long imgWidth = srcImg.getWidth();
-            long imgHeight = srcImg.getHeight();
-            long imgPixels = srcImg.getNumPixels();
-            
-            if(imagePixelStartIndex<0 || imagePixelStartIndex>=imgPixels)
+            if(isPackedRGBA)
             {
-                *numPixelsCopied = 0;
+                dstImg.fromFloat(rPtr, inputBuffer, 4*numPixels);
                 return;
             }
             
-            ptrdiff_t xStrideBytes  = srcImg.getXStrideBytes();
-            ptrdiff_t yStrideBytes  = srcImg.getYStrideBytes();
-            int yIndex = imagePixelStartIndex / imgWidth;
-            int xIndex = imagePixelStartIndex % imgWidth;
-            
-            // Figure out our initial ptr positions
-            char* imgRow = reinterpret_cast<char*>(srcImg.getRData()) +
-                yStrideBytes * yIndex;
-            
-            char* imgPtr = imgRow + xStrideBytes*xIndex;
+            if(dstImg.bitDepth == BIT_DEPTH_F32)
+            {
+                ScatterRGBA<float>(inputBuffer, rPtr, gPtr, bPtr, aPtr,
+                                   dstImg.xStrideBytes, numPixels);
+                return;
+            }
             
-            int totalPixelsCopied = 0;
-            int pixelsRemainingToCopy = outputBufferSize;
+            unsigned short rawBuffer[PIXELS_PER_CHUNK*4];
+            const int channelSize = GetBitDepthChannelSize(dstImg.bitDepth);
             
-            while(pixelsRemainingToCopy>0 && yIndex < imgHeight)
+            while(numPixels > 0)
             {
-                int imgScanlinePixels = imgWidth - xIndex;
-                int numPixels = std::min(imgScanlinePixels,
-                                         pixelsRemainingToCopy);
-                memcpy(outputBuffer+totalPixelsCopied,
-                       imgPtr, numPixels);
+                long chunkPixels = std::min(numPixels, PIXELS_PER_CHUNK);
+                
+                dstImg.fromFloat(rawBuffer, inputBuffer, 4*chunkPixels);
+                
+                if(channelSize == 1)
+                {
+                    ScatterRGBA<unsigned char>(
+                        reinterpret_cast<const unsigned char*>(rawBuffer),
+                        rPtr, gPtr, bPtr, aPtr,
+                        dstImg.xStrideBytes, chunkPixels);
+                }
+                else
+                {
+                    ScatterRGBA<unsigned short>(rawBuffer,
+                        rPtr, gPtr, bPtr, aPtr,
+                        dstImg.xStrideBytes, chunkPixels);
+                }
                 
-                yIndex += 1;
-                xIndex = 0;
+                const ptrdiff_t chunkBytes = dstImg.xStrideBytes * chunkPixels;
+                rPtr += chunkBytes;
+                gPtr += chunkBytes;
+                bPtr += chunkBytes;
+                if(aPtr) aPtr += chunkBytes;
                 
-                imgRow += yStrideBytes;
-                imgPtr = imgRow;
-                totalPixelsCopied += numPixels;
-                pixelsRemainingToCopy -= numPixels;
+                inputBuffer += 4*chunkPixels;
+                numPixels -= chunkPixels;
             }
-            
-            if(numPixelsCopied) *numPixelsCopied = totalPixelsCopied;
         }
     }
-    */
     
     ////////////////////////////////////////////////////////////////////////////
     
-    // TODO: Add optimized codepaths to image packing / unpacking
-    
     void PackRGBAFromImageDesc(const GenericImageDesc& srcImg,
                                float* outputBuffer,
                                int* numPixelsCopied,
                                int outputBufferSize,
                                long imagePixelStartIndex)
     {
-        PackRGBAFromImageDesc_Generic(srcImg, outputBuffer,
-                                      numPixelsCopied,
-                                      outputBufferSize,
-                                      imagePixelStartIndex);
+        assert(outputBuffer);
+        assert(numPixelsCopied);
+        
+        long imgWidth = srcImg.width;
+        long imgPixels = imgWidth * srcImg.height;
+        
+        if(imagePixelStartIndex<0 || imagePixelStartIndex>=imgPixels)
+        {
+            *numPixelsCopied = 0;
+            return;
+        }
+        
+        const bool isPackedRGBA = srcImg.isPackedRGBA();
+        long numPixels = std::min(static_cast<long>(outputBufferSize),
+                                  imgPixels - imagePixelStartIndex);
+        long pixelIndex = imagePixelStartIndex;
+        long pixelsCopied = 0;
+        
+        while(pixelsCopied < numPixels)
+        {
+            long yIndex = pixelIndex / imgWidth;
+            long xIndex = pixelIndex % imgWidth;
+            long scanlinePixels = std::min(imgWidth - xIndex,
+                                           numPixels - pixelsCopied);
+            
+            PackRGBAFromScanline(srcImg, isPackedRGBA,
+                                 xIndex, yIndex, scanlinePixels,
+                                 outputBuffer + 4*pixelsCopied);
+            
+            pixelIndex += scanlinePixels;
+            pixelsCopied += scanlinePixels;
+        }
+        
+        *numPixelsCopied = static_cast<int>(pixelsCopied);
     }
     
     
@@ -399,9 +264,187 @@ OCIO_NAMESPACE_ENTER
                                int numPixelsToUnpack,
                                long imagePixelStartIndex)
     {
-        UnpackRGBAToImageDesc_Generic(dstImg, inputBuffer,
-                                      numPixelsToUnpack,
-                                      imagePixelStartIndex);
+        assert(inputBuffer);
+        
+        long imgWidth = dstImg.width;
+        long imgPixels = imgWidth * dstImg.height;
+        
+        if(imagePixelStartIndex<0 || imagePixelStartIndex>=imgPixels)
+        {
+            return;
+        }
+        
+        const bool isPackedRGBA = dstImg.isPackedRGBA();
+        long numPixels = std::min(static_cast<long>(numPixelsToUnpack),
+                                  imgPixels - imagePixelStartIndex);
+        long pixelIndex = imagePixelStartIndex;
+        long pixelsCopied = 0;
+        
+        while(pixelsCopied < numPixels)
+        {
+            long yIndex = pixelIndex / imgWidth;
+            long xIndex = pixelIndex % imgWidth;
+            long scanlinePixels = std::min(imgWidth - xIndex,
+                                           numPixels - pixelsCopied);
+            
+            UnpackRGBAToScanline(dstImg, isPackedRGBA,
+                                 xIndex, yIndex, scanlinePixels,
+                                 inputBuffer + 4*pixelsCopied);
+            
+            pixelIndex += scanlinePixels;
+            pixelsCopied += scanlinePixels;
+        }
     }
 }
 OCIO_NAMESPACE_EXIT
+
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef OCIO_UNIT_TEST
+
+namespace OCIO = OCIO_NAMESPACE;
+#include "UnitTest.h"
+
+#include <vector>
+
+OCIO_NAMESPACE_USING
+
+OIIO_ADD_TEST(ImagePacking, PackedUInt8)
+{
+    // 3 x 2 pixels of rgba, and of rgb
+    const long width = 3;
+    const long height = 2;
+    unsigned char rgba[width*height*4];
+    unsigned char rgb[width*height*3];
+    for(int i=0; i<width*height*4; ++i) rgba[i] = static_cast<unsigned char>(i*10);
+    for(int i=0; i<width*height*3; ++i) rgb[i] = static_cast<unsigned char>(i*10);
+    
+    PackedImageDesc rgbaImg(rgba, width, height, 4, BIT_DEPTH_UINT8);
+    PackedImageDesc rgbImg(rgb, width, height, 3, BIT_DEPTH_UINT8);
+    OIIO_CHECK_EQUAL(rgbaImg.getXStrideBytes(), 4);
+    OIIO_CHECK_EQUAL(rgbaImg.getYStrideBytes(), 12);
+    
+    GenericImageDesc rgbaDesc;
+    rgbaDesc.init(rgbaImg);
+    OIIO_CHECK_ASSERT(rgbaDesc.isPackedRGBA());
+    GenericImageDesc rgbDesc;
+    rgbDesc.init(rgbImg);
+    OIIO_CHECK_ASSERT(!rgbDesc.isPackedRGBA());
+    
+    // Start mid-scanline
+    float buffer[8*4];
+    int numPixelsCopied = 0;
+    PackRGBAFromImageDesc(rgbaDesc, buffer, &numPixelsCopied, 8, 1);
+    OIIO_CHECK_EQUAL(numPixelsCopied, 5);
+    for(int i=0; i<5*4; ++i)
+    {
+        OIIO_CHECK_EQUAL(buffer[i], static_cast<float>(rgba[i+4]) / 255.0f);
+    }
+    
+    PackRGBAFromImageDesc(rgbDesc, buffer, &numPixelsCopied, 8, 1);
+    OIIO_CHECK_EQUAL(numPixelsCopied, 5);
+    for(int p=0; p<5; ++p)
+    {
+        OIIO_CHECK_EQUAL(buffer[4*p], static_cast<float>(rgb[3*p+3]) / 255.0f);
+        OIIO_CHECK_EQUAL(buffer[4*p+1], static_cast<float>(rgb[3*p+4]) / 255.0f);
+        OIIO_CHECK_EQUAL(buffer[4*p+2], static_cast<float>(rgb[3*p+5]) / 255.0f);
+        OIIO_CHECK_EQUAL(buffer[4*p+3], 0.0f);
+    }
+    
+    // Write back the inverted values
+    for(int i=0; i<5*4; ++i) buffer[i] = 1.0f - buffer[i];
+    UnpackRGBAToImageDesc(rgbDesc, buffer, 5, 1);
+    for(int i=0; i<3; ++i) OIIO_CHECK_EQUAL(rgb[i], i*10);
+    for(int i=3; i<width*height*3; ++i) OIIO_CHECK_EQUAL(rgb[i], 255 - i*10);
+}
+
+OIIO_ADD_TEST(ImagePacking, PlanarUInt16)
+{
+    const long width = 400;
+    const long height = 3;
+    const long numPixels = width*height;
+    std::vector<unsigned short> r(numPixels), g(numPixels), b(numPixels), a(numPixels);
+    for(long i=0; i<numPixels; ++i)
+    {
+        r[i] = static_cast<unsigned short>(i%1024);
+        g[i] = static_cast<unsigned short>((i+1)%1024);
+        b[i] = static_cast<unsigned short>(1023-i%1024);
+        a[i] = static_cast<unsigned short>(i/2);
+    }
+    
+    PlanarImageDesc img(&r[0], &g[0], &b[0], &a[0], width, height, BIT_DEPTH_UINT10);
+    OIIO_CHECK_EQUAL(img.getYStrideBytes(), 800);
+    GenericImageDesc desc;
+    desc.init(img);
+    
+    std::vector<float> buffer(numPixels*4);
+    int numPixelsCopied = 0;
+    PackRGBAFromImageDesc(desc, &buffer[0], &numPixelsCopied,
+                          static_cast<int>(numPixels), 0);
+    OIIO_CHECK_EQUAL(numPixelsCopied, numPixels);
+    OIIO_CHECK_EQUAL(buffer[4*1023+0], 1.0f);
+    OIIO_CHECK_EQUAL(buffer[4*1022+1], 1.0f);
+    OIIO_CHECK_EQUAL(buffer[2], 1.0f);
+    OIIO_CHECK_EQUAL(buffer[4*5+3], 2.0f/1023.0f);
+    
+    // Out of range values are clamped
+    buffer[0] = -0.5f;
+    buffer[1] = 1.5f;
+    UnpackRGBAToImageDesc(desc, &buffer[0], static_cast<int>(numPixels), 0);
+    OIIO_CHECK_EQUAL(r[0], 0);
+    OIIO_CHECK_EQUAL(g[0], 1023);
+    for(long i=1; i<numPixels; ++i)
+    {
+        OIIO_CHECK_EQUAL(r[i], i%1024);
+        OIIO_CHECK_EQUAL(b[i], 1023-i%1024);
+        OIIO_CHECK_EQUAL(a[i], i/2);
+    }
+}
+
+OIIO_ADD_TEST(ImagePacking, PackedHalf)
+{
+    // rgb with an extra channel, which must be left untouched
+    const long width = 1000;
+    const long numChannels = 4;
+    std::vector<unsigned short> data(width*numChannels);
+    for(long i=0; i<width; ++i)
+    {
+        data[4*i] = FloatToHalf(static_cast<float>(i));
+        data[4*i+1] = FloatToHalf(0.5f);
+        data[4*i+2] = FloatToHalf(-static_cast<float>(i)/1000.0f);
+        data[4*i+3] = 0x1234;
+    }
+    
+    // Skip the 4th channel by using 3 channels with a 4 channel x stride
+    PackedImageDesc img(&data[0], width, 1, 3, BIT_DEPTH_F16,
+                        AutoStride, 4*sizeof(unsigned short));
+    GenericImageDesc desc;
+    desc.init(img);
+    OIIO_CHECK_ASSERT(!desc.isPackedRGBA());
+    
+    std::vector<float> buffer(width*4);
+    int numPixelsCopied = 0;
+    PackRGBAFromImageDesc(desc, &buffer[0], &numPixelsCopied,
+                          static_cast<int>(width), 0);
+    OIIO_CHECK_EQUAL(numPixelsCopied, width);
+    OIIO_CHECK_EQUAL(buffer[4*999], 999.0f);
+    OIIO_CHECK_EQUAL(buffer[4*999+1], 0.5f);
+    OIIO_CHECK_EQUAL(buffer[4*500+2], -0.5f);
+    
+    for(long i=0; i<width*4; ++i) buffer[i] *= 2.0f;
+    UnpackRGBAToImageDesc(desc, &buffer[0], static_cast<int>(width), 0);
+    OIIO_CHECK_EQUAL(HalfToFloat(data[4*999]), 1998.0f);
+    OIIO_CHECK_EQUAL(HalfToFloat(data[4*999+1]), 1.0f);
+    OIIO_CHECK_EQUAL(HalfToFloat(data[4*500+2]), -1.0f);
+    OIIO_CHECK_EQUAL(data[4*999+3], 0x1234);
+}
+
+OIIO_ADD_TEST(ImagePacking, UnsupportedBitDepth)
+{
+    unsigned int data[4] = { 0, 0, 0, 0 };
+    PackedImageDesc img(data, 1, 1, 4, BIT_DEPTH_UINT32);
+    GenericImageDesc desc;
+    OIIO_CHECK_THOW(desc.init(img), OCIO::Exception);
+}
+
+#endif // OCIO_UNIT_TEST
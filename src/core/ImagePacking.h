@@ -32,6 +32,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "BitDepthUtils.h"
+
 OCIO_NAMESPACE_ENTER
 {
     struct GenericImageDesc
@@ -41,10 +43,16 @@ OCIO_NAMESPACE_ENTER
         ptrdiff_t xStrideBytes;
         ptrdiff_t yStrideBytes;
         
-        float* rData;
-        float* gData;
-        float* bData;
-        float* aData;
+        char* rData;
+        char* gData;
+        char* bData;
+        char* aData;
+        
+        BitDepth bitDepth;
+        
+        // Converters between the channel values and float
+        ChannelToFloatFn toFloat;
+        ChannelFromFloatFn fromFloat;
         
         GenericImageDesc();
         ~GenericImageDesc();
@@ -52,15 +60,22 @@ OCIO_NAMESPACE_ENTER
         // Resolves all AutoStride
         void init(const ImageDesc& img);
         
+        // Interleaved rgba, in any bit depth
         bool isPackedRGBA() const;
     };
     
+    // Pack (up to) outputBufferSize pixels, starting at the given pixel
+    // index, into float rgba.
+    
     void PackRGBAFromImageDesc(const GenericImageDesc& srcImg,
                                float* outputBuffer,
                                int* numPixelsCopied,
                                int outputBufferSize,
                                long imagePixelStartIndex);
     
+    // Write numPixelsToUnpack pixels of float rgba back into the image,
+    // converting to its bit depth.
+    
     void UnpackRGBAToImageDesc(GenericImageDesc& dstImg,
                                float* inputBuffer,
                                int numPixelsToUnpack,
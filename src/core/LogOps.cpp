@@ -29,12 +29,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <cmath>
 #include <cstring>
 #include <iostream>
+#include <sstream>
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "GpuShaderUtils.h"
 #include "LogOps.h"
 #include "MathUtils.h"
+#include "MatrixOps.h"
 
 
 OCIO_NAMESPACE_ENTER
@@ -130,6 +132,8 @@ OCIO_NAMESPACE_ENTER
             virtual bool isNoOp() const;
             virtual bool isSameType(const OpRcPtr & op) const;
             virtual bool isInverse(const OpRcPtr & op) const;
+            virtual bool canCombineWith(const OpRcPtr & op) const;
+            virtual void combineWith(OpRcPtrVec & ops, const OpRcPtr & secondOp) const;
             virtual bool hasChannelCrosstalk() const;
             virtual void finalize();
             virtual void apply(float* rgbaBuffer, long numPixels) const;
@@ -139,6 +143,12 @@ OCIO_NAMESPACE_ENTER
                                         const std::string & pixelName,
                                         const GpuShaderDesc & shaderDesc) const;
             
+            bool canFoldScaleOffset(const float * scale3,
+                                    bool scaleOffsetFirst) const;
+            OpRcPtr foldScaleOffset(const float * scale3,
+                                    const float * offset3,
+                                    bool scaleOffsetFirst) const;
+            
         private:
             float m_k[3];
             float m_m[3];
@@ -227,6 +237,91 @@ OCIO_NAMESPACE_ENTER
             return true;
         }
         
+        bool LogOp::canCombineWith(const OpRcPtr & op) const
+        {
+            float scale3[3];
+            float offset3[3];
+            return GetRGBScaleOffsetFromOp(scale3, offset3, op) &&
+                   canFoldScaleOffset(scale3, false);
+        }
+        
+        void LogOp::combineWith(OpRcPtrVec & ops, const OpRcPtr & secondOp) const
+        {
+            float scale3[3];
+            float offset3[3];
+            if(!GetRGBScaleOffsetFromOp(scale3, offset3, secondOp) ||
+               !canFoldScaleOffset(scale3, false))
+            {
+                std::ostringstream os;
+                os << "LogOp can only be combined with a following rgb ";
+                os << "scale/offset MatrixOffsetOp.  secondOp:" << secondOp->getInfo();
+                throw Exception(os.str().c_str());
+            }
+            
+            ops.push_back(foldScaleOffset(scale3, offset3, false));
+        }
+        
+        // Folding y = x*scale + offset into the log (lin->log direction),
+        //   y = k * log(mx+b, base) + kb
+        // - applied before:  m' = m*scale, b' = m*offset + b
+        // - applied after:   k' = k*scale, kb' = kb*scale + offset
+        // The log->lin direction is the inverse function, so the
+        // coefficients are adjusted the other way around, which requires
+        // a non-zero scale:
+        // - applied before:  k' = k/scale, kb' = (kb - offset)/scale
+        // - applied after:   m' = m/scale, b' = b - offset*m/scale
+        
+        bool LogOp::canFoldScaleOffset(const float * scale3,
+                                       bool /*scaleOffsetFirst*/) const
+        {
+            if(m_direction == TRANSFORM_DIR_FORWARD) return true;
+            if(m_direction == TRANSFORM_DIR_INVERSE) return !VecContainsZero(scale3, 3);
+            return false;
+        }
+        
+        OpRcPtr LogOp::foldScaleOffset(const float * scale3,
+                                       const float * offset3,
+                                       bool scaleOffsetFirst) const
+        {
+            float k[3], m[3], b[3], kb[3];
+            memcpy(k, m_k, sizeof(float)*3);
+            memcpy(m, m_m, sizeof(float)*3);
+            memcpy(b, m_b, sizeof(float)*3);
+            memcpy(kb, m_kb, sizeof(float)*3);
+            
+            for(int i=0; i<3; ++i)
+            {
+                if(m_direction == TRANSFORM_DIR_FORWARD)
+                {
+                    if(scaleOffsetFirst)
+                    {
+                        b[i] = m_m[i]*offset3[i] + m_b[i];
+                        m[i] = m_m[i]*scale3[i];
+                    }
+                    else
+                    {
+                        k[i] = m_k[i]*scale3[i];
+                        kb[i] = m_kb[i]*scale3[i] + offset3[i];
+                    }
+                }
+                else
+                {
+                    if(scaleOffsetFirst)
+                    {
+                        k[i] = m_k[i]/scale3[i];
+                        kb[i] = (m_kb[i] - offset3[i])/scale3[i];
+                    }
+                    else
+                    {
+                        m[i] = m_m[i]/scale3[i];
+                        b[i] = m_b[i] - offset3[i]*m_m[i]/scale3[i];
+                    }
+                }
+            }
+            
+            return OpRcPtr(new LogOp(k, m, b, m_base, kb, m_direction));
+        }
+        
         bool LogOp::hasChannelCrosstalk() const
         {
             return false;
@@ -305,7 +400,7 @@ OCIO_NAMESPACE_ENTER
                 float clampMin[3] = { FLTMIN, FLTMIN, FLTMIN };
                 
                 // TODO: Switch to f32 for internal Cg processing?
-                if(lang == GPU_LANGUAGE_CG)
+                if(GetGpuShaderWriter(lang).clampsToHalf())
                 {
                     clampMin[0] = static_cast<float>(GetHalfNormMin());
                     clampMin[1] = static_cast<float>(GetHalfNormMin());
@@ -372,6 +467,29 @@ OCIO_NAMESPACE_ENTER
     {
         ops.push_back( LogOpRcPtr(new LogOp(k, m, b, base, kb, direction)) );
     }
+    
+    bool CanCombineLogOpWithScaleOffset(const OpRcPtr & logOp,
+                                        const float * scale3,
+                                        bool scaleOffsetFirst)
+    {
+        LogOpRcPtr typedRcPtr = DynamicPtrCast<LogOp>(logOp);
+        if(!typedRcPtr) return false;
+        return typedRcPtr->canFoldScaleOffset(scale3, scaleOffsetFirst);
+    }
+    
+    bool CombineLogOpWithScaleOffset(OpRcPtrVec & ops,
+                                     const OpRcPtr & logOp,
+                                     const float * scale3,
+                                     const float * offset3,
+                                     bool scaleOffsetFirst)
+    {
+        LogOpRcPtr typedRcPtr = DynamicPtrCast<LogOp>(logOp);
+        if(!typedRcPtr) return false;
+        if(!typedRcPtr->canFoldScaleOffset(scale3, scaleOffsetFirst)) return false;
+        
+        ops.push_back(typedRcPtr->foldScaleOffset(scale3, offset3, scaleOffsetFirst));
+        return true;
+    }
 }
 OCIO_NAMESPACE_EXIT
 
@@ -525,4 +643,80 @@ OIIO_ADD_TEST(LogOps, Inverse)
     }
 }
 
+OIIO_ADD_TEST(LogOps, CombineScaleOffset)
+{
+    float k[3] = { 0.18f, 0.5f, 0.3f };
+    float m[3] = { 2.0f, 4.0f, 8.0f };
+    float b[3] = { 0.1f, 0.1f, 0.1f };
+    float base[3] = { 10.0f, 5.0f, 2.0f };
+    float kb[3] = { 1.0f, 1.0f, 1.0f };
+    
+    float scale4[4] = { 0.5f, 2.0f, 1.5f, 1.0f };
+    float offset4[4] = { 0.1f, -0.2f, 0.3f, 0.0f };
+    
+    float source[12] = { 0.01f, 0.1f, 1.0f, 1.0f,
+                         1.0f, 10.0f, 100.0f, 0.5f,
+                         1000.0f, 1.0f, 0.5f, 0.0f };
+    
+    // scale/offset before and after a log, in both directions
+    for(int test=0; test<4; ++test)
+    {
+        OCIO::TransformDirection logDir = (test/2 == 0) ?
+            OCIO::TRANSFORM_DIR_FORWARD : OCIO::TRANSFORM_DIR_INVERSE;
+        bool scaleOffsetFirst = (test%2 == 0);
+        
+        OCIO::OpRcPtrVec ops;
+        if(scaleOffsetFirst)
+        {
+            OCIO::CreateScaleOffsetOp(ops, scale4, offset4, OCIO::TRANSFORM_DIR_FORWARD);
+            CreateLogOp(ops, k, m, b, base, kb, logDir);
+        }
+        else
+        {
+            CreateLogOp(ops, k, m, b, base, kb, logDir);
+            OCIO::CreateScaleOffsetOp(ops, scale4, offset4, OCIO::TRANSFORM_DIR_INVERSE);
+        }
+        
+        OCIO::OpRcPtrVec unoptimizedOps;
+        for(OCIO::OpRcPtrVec::size_type i=0; i<ops.size(); ++i)
+        {
+            unoptimizedOps.push_back(ops[i]->clone());
+        }
+        
+        OCIO::FinalizeOpVec(ops);
+        OCIO::FinalizeOpVec(unoptimizedOps, false);
+        OIIO_CHECK_EQUAL(ops.size(), 1);
+        OIIO_CHECK_EQUAL(unoptimizedOps.size(), 2);
+        
+        float data[12];
+        float expected[12];
+        for(int i=0; i<12; ++i)
+        {
+            // Keep within the domain of the log in the inverse case
+            data[i] = (logDir == OCIO::TRANSFORM_DIR_FORWARD) ? source[i] : source[i]*0.001f;
+            expected[i] = data[i];
+        }
+        
+        ops[0]->apply(data, 3);
+        unoptimizedOps[0]->apply(expected, 3);
+        unoptimizedOps[1]->apply(expected, 3);
+        
+        for(int i=0; i<12; ++i)
+        {
+            OIIO_CHECK_CLOSE( data[i], expected[i], 1.0e-4 );
+        }
+    }
+    
+    // A matrix with crosstalk cannot be folded
+    float m44[16] = { 1.0f, 0.1f, 0.0f, 0.0f,
+                      0.0f, 1.0f, 0.0f, 0.0f,
+                      0.0f, 0.0f, 1.0f, 0.0f,
+                      0.0f, 0.0f, 0.0f, 1.0f };
+    OCIO::OpRcPtrVec ops;
+    OCIO::CreateMatrixOp(ops, m44, OCIO::TRANSFORM_DIR_FORWARD);
+    CreateLogOp(ops, k, m, b, base, kb, OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO::FinalizeOpVec(ops);
+    OIIO_CHECK_EQUAL(ops.size(), 2);
+}
+
 #endif // OCIO_UNIT_TEST
@@ -51,6 +51,22 @@ OCIO_NAMESPACE_ENTER
                      const float * kb,
                      TransformDirection direction);
     
+    // An rgb scale and offset (x*scale + offset, alpha untouched) next to
+    // a LogOp can be folded into the log coefficients, saving a pass over
+    // the pixels. scaleOffsetFirst is true if the scale/offset is applied
+    // before logOp. These return false if logOp is not a LogOp, or the
+    // fold is not possible; CombineLogOpWithScaleOffset appends the
+    // combined op to ops on success.
+    
+    bool CanCombineLogOpWithScaleOffset(const OpRcPtr & logOp,
+                                        const float * scale3,
+                                        bool scaleOffsetFirst);
+    
+    bool CombineLogOpWithScaleOffset(OpRcPtrVec & ops,
+                                     const OpRcPtr & logOp,
+                                     const float * scale3,
+                                     const float * offset3,
+                                     bool scaleOffsetFirst);
 }
 OCIO_NAMESPACE_EXIT
 
@@ -0,0 +1,133 @@
+/*
+Copyright (c) 2003-2010 Sony Pictures Imageworks Inc., et al.
+All Rights Reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Sony Pictures Imageworks nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef INCLUDED_OCIO_LRUORDER_H
+#define INCLUDED_OCIO_LRUORDER_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include <list>
+
+#include "Platform.h"
+
+OCIO_NAMESPACE_ENTER
+{
+    // The eviction order of a cache whose hits only take a read lock, and
+    // so can not move their entry in a list. A hit stamps its entry with
+    // the cache clock instead, and the order catches up at eviction time:
+    // the list is kept sorted by the stamps seen when the items were queued,
+    // so the back item is the least recently used one unless it was stamped
+    // since, in which case it is requeued by its new stamp. Recent stamps
+    // requeue near the front, and the evictions never walk or sort the
+    // whole cache.
+    //
+    // All the calls expect the cache write lock to be held. Stamps may still
+    // land meanwhile (from lookups done before the lock was taken), so the
+    // catching up is bounded by the size of the order.
+    
+    template<typename Key>
+    class LruOrder
+    {
+    private:
+        struct Item
+        {
+            Key key;
+            // The stamp of the entry, which must outlive its item
+            volatile long * lastUse;
+            // Its value when the item was queued
+            long queuedUse;
+        };
+        
+        typedef std::list<Item> ItemList;
+        
+    public:
+        typedef typename ItemList::iterator Position;
+        
+        LruOrder():
+            m_size(0)
+        {}
+        
+        // Queue a new entry by its current stamp
+        Position push(const Key & key, volatile long * lastUse)
+        {
+            Item item;
+            item.key = key;
+            item.lastUse = lastUse;
+            item.queuedUse = AtomicLoad(lastUse);
+            ++m_size;
+            return m_items.insert(findQueuePosition(item.queuedUse), item);
+        }
+        
+        void erase(Position pos)
+        {
+            m_items.erase(pos);
+            --m_size;
+        }
+        
+        void clear()
+        {
+            m_items.clear();
+            m_size = 0;
+        }
+        
+        size_t size() const { return m_size; }
+        
+        // The least recently used key (there must be one)
+        const Key & back()
+        {
+            for(size_t moves=0; moves<m_size; ++moves)
+            {
+                Item & item = m_items.back();
+                const long lastUse = AtomicLoad(item.lastUse);
+                if(lastUse == item.queuedUse) break;
+                
+                item.queuedUse = lastUse;
+                m_items.splice(findQueuePosition(lastUse), m_items,
+                               --m_items.end());
+            }
+            return m_items.back().key;
+        }
+        
+    private:
+        // The first item queued before the given stamp
+        Position findQueuePosition(long queuedUse)
+        {
+            Position pos = m_items.begin();
+            while(pos != m_items.end() && pos->queuedUse > queuedUse) ++pos;
+            return pos;
+        }
+        
+        ItemList m_items;
+        // std::list::size() may be linear
+        size_t m_size;
+    };
+}
+OCIO_NAMESPACE_EXIT
+
+#endif
@@ -28,13 +28,17 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "CPUInfo.h"
 #include "HashUtils.h"
 #include "Lut1DOp.h"
 #include "MathUtils.h"
 #include "SSE.h"
+#include "pystring/pystring.h"
 
 #include <algorithm>
 #include <cmath>
+#include <cstdlib>
+#include <limits>
 #include <sstream>
 #include <iostream>
 
@@ -218,75 +222,6 @@ OCIO_NAMESPACE_ENTER
                 rgbaBuffer += 4;
             }
         }
-#ifdef USE_SSE
-        void Lut1D_Nearest_SSE(float* rgbaBuffer, long numPixels, const Lut1D & lut)
-        {
-            // orig: 546 ms
-            // curr: 91 ms
-            
-            // These are all sized 4, to allow simpler sse loading
-            float maxIndex[4] = {0.0f, 0.0f, 0.0f, 0.0f};
-            float mInv[4] = {0.0f, 0.0f, 0.0f, 0.0f};
-            float b[4] = {0.0f, 0.0f, 0.0f, 0.0f};
-            float mInv_x_maxIndex[4] = {0.0f, 0.0f, 0.0f, 0.0f};
-            const float* startPos[3];
-            
-            for(int i=0; i<3; ++i)
-            {
-                maxIndex[i] = (float) (lut.luts[i].size() - 1);
-                mInv[i] = 1.0f / (lut.from_max[i] - lut.from_min[i]);
-                b[i] = lut.from_min[i];
-                mInv_x_maxIndex[i] = (float) (mInv[i] * maxIndex[i]);
-                startPos[i] = &(lut.luts[i][0]);
-            }
-            
-            const __m128 _zero = _mm_setzero_ps();
-            const __m128 _mInv_x_maxIndex = _mm_loadu_ps(mInv_x_maxIndex);
-            const __m128 _b = _mm_loadu_ps(b);
-            const __m128 _maxIndex = _mm_loadu_ps(maxIndex);
-            const __m128 _half = _mm_set1_ps(0.5f);
-            
-            float result[4];
-            
-            for(long pixelIndex=0; pixelIndex<numPixels; ++pixelIndex)
-            {
-                // TODO: SSE Optimized nancheck
-                
-                __m128 p = _mm_loadu_ps(rgbaBuffer);
-                
-                // mInv_x_maxIndex * (p - b)
-                p = _mm_sub_ps(p, _b);
-                p = _mm_mul_ps(p, _mInv_x_maxIndex);
-                
-                // clamp _zero <= b <= _maxIndex
-                p = _mm_max_ps(p, _zero);
-                p = _mm_min_ps(p, _maxIndex);
-                
-                // add 0.5f for rounding
-                p = _mm_add_ps(p, _half);
-                
-                _mm_storeu_ps(result, p);
-                
-                
-                // TODO: use native SSE to convert to an int?
-                // _mm_cvttss_si32
-                // Converts the lower single-precision, floating-point value of
-                // a to a 32-bit integer with truncation
-                //
-                // _mm_cvttps_pi32 converts 2 floats to 2 32-bit packed ints,
-                // with truncation
-                
-                if(!isnan(result[0]))
-                    rgbaBuffer[0] = startPos[0][(int)(result[0])];
-                if(!isnan(result[1]))
-                    rgbaBuffer[1] = startPos[1][(int)(result[1])];
-                if(!isnan(result[2]))
-                    rgbaBuffer[2] = startPos[2][(int)(result[2])];
-                
-                rgbaBuffer += 4;
-            }
-        }
-#endif
         
         
         ///////////////////////////////////////////////////////////////////////
@@ -331,13 +266,452 @@ OCIO_NAMESPACE_ENTER
         }
         
         
+        ///////////////////////////////////////////////////////////////////////
+        // SIMD kernels (forward)
+        //
+        // These produce the same results as Lut1D_Nearest / Lut1D_Linear
+        // bit for bit: the lut index is computed with the same operations
+        // in the same order, a NaN channel is left unchanged, and the
+        // pixels left over after the last full vector go through the
+        // scalar code. The pixels are transposed so each channel is a
+        // vector of its own (each channel has its own lut).
+        //
+        // The clamped index k is non-negative, so roundf(k) is computed
+        // as trunc(k) + (k-trunc(k) >= 0.5) (the subtraction is exact),
+        // and floor(k) / ceil(k) as trunc(k) / trunc(k) + (k > trunc(k)).
+        // Clamping before or after rounding gives the same index, as the
+        // bounds are integers.
+        
+        typedef void (*Lut1DKernel)(float* rgbaBuffer, long numPixels, const Lut1D & lut);
+        
+        struct Lut1DScale
+        {
+            float maxIndex[3];
+            float b[3];
+            float mInv_x_maxIndex[3];
+            const float* startPos[3];
+            
+            explicit Lut1DScale(const Lut1D & lut)
+            {
+                for(int i=0; i<3; ++i)
+                {
+                    maxIndex[i] = (float) (lut.luts[i].size() - 1);
+                    float mInv = 1.0f / (lut.from_max[i] - lut.from_min[i]);
+                    b[i] = lut.from_min[i];
+                    mInv_x_maxIndex[i] = (float) (mInv * maxIndex[i]);
+                    startPos[i] = &(lut.luts[i][0]);
+                }
+            }
+        };
+        
+#ifdef USE_SSE
+        // 4 pixels at a time. SSE2 has no gather, so the lut entries are
+        // scalar loads from the indices computed in vector registers.
+        
+        template<bool LINEAR>
+        void Lut1D_SSE2(float* rgbaBuffer, long numPixels, const Lut1D & lut)
+        {
+            const Lut1DScale scale(lut);
+            
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 one = _mm_set1_ps(1.0f);
+            const __m128 half = _mm_set1_ps(0.5f);
+            
+            __m128 maxIndex[3];
+            __m128 b[3];
+            __m128 mInv_x_maxIndex[3];
+            for(int i=0; i<3; ++i)
+            {
+                maxIndex[i] = _mm_set1_ps(scale.maxIndex[i]);
+                b[i] = _mm_set1_ps(scale.b[i]);
+                mInv_x_maxIndex[i] = _mm_set1_ps(scale.mInv_x_maxIndex[i]);
+            }
+            
+            long pixelIndex = 0;
+            for(; pixelIndex+4<=numPixels; pixelIndex+=4)
+            {
+                __m128 v[4];
+                v[0] = _mm_loadu_ps(rgbaBuffer);
+                v[1] = _mm_loadu_ps(rgbaBuffer+4);
+                v[2] = _mm_loadu_ps(rgbaBuffer+8);
+                v[3] = _mm_loadu_ps(rgbaBuffer+12);
+                _MM_TRANSPOSE4_PS(v[0], v[1], v[2], v[3]);
+                
+                for(int i=0; i<3; ++i)
+                {
+                    const __m128 nanMask = _mm_cmpunord_ps(v[i], v[i]);
+                    const __m128 index = _mm_mul_ps(mInv_x_maxIndex[i],
+                        _mm_sub_ps(_mm_andnot_ps(nanMask, v[i]), b[i]));
+                    const __m128 clamped = _mm_max_ps(_mm_min_ps(index, maxIndex[i]), zero);
+                    
+                    const __m128i indexTrunc = _mm_cvttps_epi32(clamped);
+                    const __m128 indexTruncf = _mm_cvtepi32_ps(indexTrunc);
+                    const float * startPos = scale.startPos[i];
+                    
+                    __m128 out;
+                    if(LINEAR)
+                    {
+                        const __m128i indexHigh = _mm_sub_epi32(indexTrunc,
+                            _mm_castps_si128(_mm_cmpgt_ps(clamped, indexTruncf)));
+                        
+                        int low[4];
+                        int high[4];
+                        _mm_storeu_si128((__m128i *)low, indexTrunc);
+                        _mm_storeu_si128((__m128i *)high, indexHigh);
+                        
+                        const __m128 delta = _mm_sub_ps(index, indexTruncf);
+                        out = _mm_add_ps(
+                            _mm_mul_ps(_mm_sub_ps(one, delta),
+                                       _mm_setr_ps(startPos[low[0]], startPos[low[1]],
+                                                   startPos[low[2]], startPos[low[3]])),
+                            _mm_mul_ps(delta,
+                                       _mm_setr_ps(startPos[high[0]], startPos[high[1]],
+                                                   startPos[high[2]], startPos[high[3]])));
+                    }
+                    else
+                    {
+                        const __m128i indexNearest = _mm_sub_epi32(indexTrunc,
+                            _mm_castps_si128(_mm_cmpge_ps(_mm_sub_ps(clamped, indexTruncf), half)));
+                        
+                        int nearest[4];
+                        _mm_storeu_si128((__m128i *)nearest, indexNearest);
+                        
+                        out = _mm_setr_ps(startPos[nearest[0]], startPos[nearest[1]],
+                                          startPos[nearest[2]], startPos[nearest[3]]);
+                    }
+                    
+                    v[i] = _mm_or_ps(_mm_and_ps(nanMask, v[i]), _mm_andnot_ps(nanMask, out));
+                }
+                
+                _MM_TRANSPOSE4_PS(v[0], v[1], v[2], v[3]);
+                
+                _mm_storeu_ps(rgbaBuffer, v[0]);
+                _mm_storeu_ps(rgbaBuffer+4, v[1]);
+                _mm_storeu_ps(rgbaBuffer+8, v[2]);
+                _mm_storeu_ps(rgbaBuffer+12, v[3]);
+                
+                rgbaBuffer += 16;
+            }
+            
+            if(LINEAR) Lut1D_Linear(rgbaBuffer, numPixels-pixelIndex, lut);
+            else Lut1D_Nearest(rgbaBuffer, numPixels-pixelIndex, lut);
+        }
+#endif // USE_SSE
+        
+#ifdef OCIO_USE_AVX
+        // 8 pixels at a time, with the lut entries fetched by gathers.
+        
+        template<bool LINEAR>
+        OCIO_TARGET_AVX2
+        void Lut1D_AVX2(float* rgbaBuffer, long numPixels, const Lut1D & lut)
+        {
+            const Lut1DScale scale(lut);
+            
+            const __m256 zero = _mm256_setzero_ps();
+            const __m256 one = _mm256_set1_ps(1.0f);
+            const __m256 half = _mm256_set1_ps(0.5f);
+            
+            __m256 maxIndex[3];
+            __m256 b[3];
+            __m256 mInv_x_maxIndex[3];
+            for(int i=0; i<3; ++i)
+            {
+                maxIndex[i] = _mm256_set1_ps(scale.maxIndex[i]);
+                b[i] = _mm256_set1_ps(scale.b[i]);
+                mInv_x_maxIndex[i] = _mm256_set1_ps(scale.mInv_x_maxIndex[i]);
+            }
+            
+            long pixelIndex = 0;
+            for(; pixelIndex+8<=numPixels; pixelIndex+=8)
+            {
+                __m256 v[4];
+                v[0] = _mm256_loadu_ps(rgbaBuffer);
+                v[1] = _mm256_loadu_ps(rgbaBuffer+8);
+                v[2] = _mm256_loadu_ps(rgbaBuffer+16);
+                v[3] = _mm256_loadu_ps(rgbaBuffer+24);
+                Transpose4_AVX2(v[0], v[1], v[2], v[3]);
+                
+                for(int i=0; i<3; ++i)
+                {
+                    const __m256 nanMask = _mm256_cmp_ps(v[i], v[i], _CMP_UNORD_Q);
+                    const __m256 index = _mm256_mul_ps(mInv_x_maxIndex[i],
+                        _mm256_sub_ps(_mm256_andnot_ps(nanMask, v[i]), b[i]));
+                    const __m256 clamped = _mm256_max_ps(_mm256_min_ps(index, maxIndex[i]), zero);
+                    
+                    const __m256i indexTrunc = _mm256_cvttps_epi32(clamped);
+                    const __m256 indexTruncf = _mm256_cvtepi32_ps(indexTrunc);
+                    const float * startPos = scale.startPos[i];
+                    
+                    __m256 out;
+                    if(LINEAR)
+                    {
+                        const __m256i indexHigh = _mm256_sub_epi32(indexTrunc,
+                            _mm256_castps_si256(_mm256_cmp_ps(clamped, indexTruncf, _CMP_GT_OQ)));
+                        
+                        const __m256 delta = _mm256_sub_ps(index, indexTruncf);
+                        out = _mm256_add_ps(
+                            _mm256_mul_ps(_mm256_sub_ps(one, delta),
+                                          _mm256_i32gather_ps(startPos, indexTrunc, 4)),
+                            _mm256_mul_ps(delta,
+                                          _mm256_i32gather_ps(startPos, indexHigh, 4)));
+                    }
+                    else
+                    {
+                        const __m256i indexNearest = _mm256_sub_epi32(indexTrunc,
+                            _mm256_castps_si256(_mm256_cmp_ps(_mm256_sub_ps(clamped, indexTruncf),
+                                                              half, _CMP_GE_OQ)));
+                        out = _mm256_i32gather_ps(startPos, indexNearest, 4);
+                    }
+                    
+                    v[i] = _mm256_blendv_ps(out, v[i], nanMask);
+                }
+                
+                Transpose4_AVX2(v[0], v[1], v[2], v[3]);
+                
+                _mm256_storeu_ps(rgbaBuffer, v[0]);
+                _mm256_storeu_ps(rgbaBuffer+8, v[1]);
+                _mm256_storeu_ps(rgbaBuffer+16, v[2]);
+                _mm256_storeu_ps(rgbaBuffer+24, v[3]);
+                
+                rgbaBuffer += 32;
+            }
+            
+            if(LINEAR) Lut1D_Linear(rgbaBuffer, numPixels-pixelIndex, lut);
+            else Lut1D_Nearest(rgbaBuffer, numPixels-pixelIndex, lut);
+        }
+        
+        // gcc 12 warns about the placeholder (_mm512_undefined_*) operands
+        // within its own avx512 intrinsics (gcc bug 105593).
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+        
+        // 16 pixels at a time, same as Lut1D_AVX2 with mask registers.
+        
+        template<bool LINEAR>
+        OCIO_TARGET_AVX512
+        void Lut1D_AVX512(float* rgbaBuffer, long numPixels, const Lut1D & lut)
+        {
+            const Lut1DScale scale(lut);
+            
+            const __m512 zero = _mm512_setzero_ps();
+            const __m512 one = _mm512_set1_ps(1.0f);
+            const __m512 half = _mm512_set1_ps(0.5f);
+            const __m512i increment = _mm512_set1_epi32(1);
+            
+            __m512 maxIndex[3];
+            __m512 b[3];
+            __m512 mInv_x_maxIndex[3];
+            for(int i=0; i<3; ++i)
+            {
+                maxIndex[i] = _mm512_set1_ps(scale.maxIndex[i]);
+                b[i] = _mm512_set1_ps(scale.b[i]);
+                mInv_x_maxIndex[i] = _mm512_set1_ps(scale.mInv_x_maxIndex[i]);
+            }
+            
+            long pixelIndex = 0;
+            for(; pixelIndex+16<=numPixels; pixelIndex+=16)
+            {
+                __m512 v[4];
+                v[0] = _mm512_loadu_ps(rgbaBuffer);
+                v[1] = _mm512_loadu_ps(rgbaBuffer+16);
+                v[2] = _mm512_loadu_ps(rgbaBuffer+32);
+                v[3] = _mm512_loadu_ps(rgbaBuffer+48);
+                Transpose4_AVX512(v[0], v[1], v[2], v[3]);
+                
+                for(int i=0; i<3; ++i)
+                {
+                    const __mmask16 notNanMask = _mm512_cmp_ps_mask(v[i], v[i], _CMP_ORD_Q);
+                    const __m512 index = _mm512_mul_ps(mInv_x_maxIndex[i],
+                        _mm512_sub_ps(_mm512_maskz_mov_ps(notNanMask, v[i]), b[i]));
+                    const __m512 clamped = _mm512_max_ps(_mm512_min_ps(index, maxIndex[i]), zero);
+                    
+                    const __m512i indexTrunc = _mm512_cvttps_epi32(clamped);
+                    const __m512 indexTruncf = _mm512_cvtepi32_ps(indexTrunc);
+                    const float * startPos = scale.startPos[i];
+                    
+                    __m512 out;
+                    if(LINEAR)
+                    {
+                        const __m512i indexHigh = _mm512_mask_add_epi32(indexTrunc,
+                            _mm512_cmp_ps_mask(clamped, indexTruncf, _CMP_GT_OQ),
+                            indexTrunc, increment);
+                        
+                        const __m512 delta = _mm512_sub_ps(index, indexTruncf);
+                        out = _mm512_add_ps(
+                            _mm512_mul_ps(_mm512_sub_ps(one, delta),
+                                          _mm512_i32gather_ps(indexTrunc, startPos, 4)),
+                            _mm512_mul_ps(delta,
+                                          _mm512_i32gather_ps(indexHigh, startPos, 4)));
+                    }
+                    else
+                    {
+                        const __m512i indexNearest = _mm512_mask_add_epi32(indexTrunc,
+                            _mm512_cmp_ps_mask(_mm512_sub_ps(clamped, indexTruncf), half, _CMP_GE_OQ),
+                            indexTrunc, increment);
+                        out = _mm512_i32gather_ps(indexNearest, startPos, 4);
+                    }
+                    
+                    v[i] = _mm512_mask_blend_ps(notNanMask, v[i], out);
+                }
+                
+                Transpose4_AVX512(v[0], v[1], v[2], v[3]);
+                
+                _mm512_storeu_ps(rgbaBuffer, v[0]);
+                _mm512_storeu_ps(rgbaBuffer+16, v[1]);
+                _mm512_storeu_ps(rgbaBuffer+32, v[2]);
+                _mm512_storeu_ps(rgbaBuffer+48, v[3]);
+                
+                rgbaBuffer += 64;
+            }
+            
+            if(LINEAR) Lut1D_Linear(rgbaBuffer, numPixels-pixelIndex, lut);
+            else Lut1D_Nearest(rgbaBuffer, numPixels-pixelIndex, lut);
+        }
+        
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif // OCIO_USE_AVX
+        
+        // Returns 0 if there is no vectorized kernel for the arguments.
+        Lut1DKernel GetLut1DKernel(Interpolation interpolation, SIMDLevel level)
+        {
+            if(interpolation != INTERP_NEAREST && interpolation != INTERP_LINEAR)
+                return 0;
+            
+            const bool linear = (interpolation == INTERP_LINEAR);
+            
+#ifdef OCIO_USE_AVX
+            if(level >= SIMD_LEVEL_AVX512)
+                return linear ? Lut1D_AVX512<true> : Lut1D_AVX512<false>;
+            if(level >= SIMD_LEVEL_AVX2)
+                return linear ? Lut1D_AVX2<true> : Lut1D_AVX2<false>;
+#endif
+#ifdef USE_SSE
+            if(level >= SIMD_LEVEL_SSE2)
+                return linear ? Lut1D_SSE2<true> : Lut1D_SSE2<false>;
+#endif
+            (void)linear;
+            (void)level;
+            return 0;
+        }
+        
+        
+        
+        ///////////////////////////////////////////////////////////////////////
+        // Inverse lookups
+        //
+        // Both need the lower bound of the value in the (non-decreasing)
+        // lut. It is either found by bisection of the whole lut, or with
+        // the help of an index precomputed at finalize.
+        
+        class Lut1DBisect
+        {
+        public:
+            Lut1DBisect(const float * start, const float * end) :
+                m_start(start),
+                m_end(end)
+            { }
+            
+            inline const float * lowerBound(float v) const
+            {
+                return std::lower_bound(m_start, m_end, v);
+            }
+            
+        private:
+            const float * m_start;
+            const float * m_end;
+        };
+        
+        // The range of the lut values is split into uniform buckets, and
+        // bucketStart[k] is the index of the first entry in bucket k or
+        // above. As the bucket of a value never decreases with the value,
+        // the lower bound of a value in bucket k is within
+        // [bucketStart[k], bucketStart[k+1]], so only that (typically
+        // tiny) range needs to be bisected. The result is the same as
+        // with Lut1DBisect, at O(1) cost for well distributed luts.
+        
+        class Lut1DInverseIndex
+        {
+        public:
+            Lut1DInverseIndex() :
+                m_start(0),
+                m_minValue(0.0f),
+                m_scale(0.0f),
+                m_maxBucket(0.0f)
+            { }
+            
+            // Returns false if the lut is decreasing anywhere, as the lower
+            // bound is then not meaningful (and Lut1DBisect must be used
+            // to get the same results as before).
+            bool build(const float * start, const float * end)
+            {
+                const long size = (long)(end - start);
+                if(size < 2) return false;
+                
+                for(long i=1; i<size; ++i)
+                {
+                    if(!(start[i] >= start[i-1])) return false;
+                }
+                
+                // About one entry per bucket
+                const float maxFloat = std::numeric_limits<float>::max();
+                const float range = end[-1] - start[0];
+                if(!(range > 0.0f && range <= maxFloat)) return false;
+                const float scale = (float)size / range;
+                if(!(scale <= maxFloat)) return false;
+                
+                m_start = start;
+                m_minValue = start[0];
+                m_scale = scale;
+                m_maxBucket = (float)(size - 1);
+                
+                m_bucketStart.assign(size + 1, (int)size);
+                for(long i=size-1; i>=0; --i)
+                {
+                    m_bucketStart[bucket(start[i])] = (int)i;
+                }
+                for(long k=size-1; k>=0; --k)
+                {
+                    m_bucketStart[k] = std::min(m_bucketStart[k],
+                                                m_bucketStart[k+1]);
+                }
+                
+                return true;
+            }
+            
+            inline const float * lowerBound(float v) const
+            {
+                const int k = bucket(v);
+                return std::lower_bound(m_start + m_bucketStart[k],
+                                        m_start + m_bucketStart[k+1], v);
+            }
+            
+        private:
+            const float * m_start;
+            float m_minValue;
+            float m_scale;
+            float m_maxBucket;
+            std::vector<int> m_bucketStart;
+            
+            // Clamped before the conversion, which also handles infinities.
+            inline int bucket(float v) const
+            {
+                const float k = (v - m_minValue) * m_scale;
+                return (int)std::min(std::max(k, 0.0f), m_maxBucket);
+            }
+        };
         
         ///////////////////////////////////////////////////////////////////////
         // Nearest Inverse
         
-        inline float reverseLookupNearest_1D(const float v, const float *start, const float *end)
+        template<class LowerBound>
+        inline float reverseLookupNearest_1D(const float v, const LowerBound & lowerBound,
+                                             const float *start, const float *end)
         {
-            const float *lowbound = std::lower_bound(start, end, v);
+            const float *lowbound = lowerBound.lowerBound(v);
             if (lowbound != start) --lowbound;
             
             const float *highbound = lowbound;
@@ -354,7 +728,9 @@ OCIO_NAMESPACE_ENTER
             }
         }
         
-        void Lut1D_NearestInverse(float* rgbaBuffer, long numPixels, const Lut1D & lut)
+        template<class LowerBound>
+        void Lut1D_NearestInverse(float* rgbaBuffer, long numPixels, const Lut1D & lut,
+                                  const LowerBound * lowerBound)
         {
             float m[3];
             float b[3];
@@ -376,22 +752,34 @@ OCIO_NAMESPACE_ENTER
             for(long pixelIndex=0; pixelIndex<numPixels; ++pixelIndex)
             {
                 if(!isnan(rgbaBuffer[0]))
-                    rgbaBuffer[0] = m[0] * reverseLookupNearest_1D(rgbaBuffer[0], startPos[0], endPos[0]) + b[0];
+                    rgbaBuffer[0] = m[0] * reverseLookupNearest_1D(rgbaBuffer[0], lowerBound[0], startPos[0], endPos[0]) + b[0];
                 if(!isnan(rgbaBuffer[1]))
-                    rgbaBuffer[1] = m[1] * reverseLookupNearest_1D(rgbaBuffer[1], startPos[1], endPos[1]) + b[1];
+                    rgbaBuffer[1] = m[1] * reverseLookupNearest_1D(rgbaBuffer[1], lowerBound[1], startPos[1], endPos[1]) + b[1];
                 if(!isnan(rgbaBuffer[2]))
-                    rgbaBuffer[2] = m[2] * reverseLookupNearest_1D(rgbaBuffer[2], startPos[2], endPos[2]) + b[2];
+                    rgbaBuffer[2] = m[2] * reverseLookupNearest_1D(rgbaBuffer[2], lowerBound[2], startPos[2], endPos[2]) + b[2];
                 
                 rgbaBuffer += 4;
             }
         }
         
+        void Lut1D_NearestInverse(float* rgbaBuffer, long numPixels, const Lut1D & lut)
+        {
+            const Lut1DBisect lowerBound[3] = {
+                Lut1DBisect(&lut.luts[0][0], &lut.luts[0][0] + lut.luts[0].size()),
+                Lut1DBisect(&lut.luts[1][0], &lut.luts[1][0] + lut.luts[1].size()),
+                Lut1DBisect(&lut.luts[2][0], &lut.luts[2][0] + lut.luts[2].size()) };
+            
+            Lut1D_NearestInverse(rgbaBuffer, numPixels, lut, lowerBound);
+        }
+        
         ///////////////////////////////////////////////////////////////////////
         // Linear Inverse
         
-        inline float reverseLookupLinear_1D(const float v, const float *start, const float *end, float invMaxIndex)
+        template<class LowerBound>
+        inline float reverseLookupLinear_1D(const float v, const LowerBound & lowerBound,
+                                            const float *start, const float *end, float invMaxIndex)
         {
-            const float *lowbound = std::lower_bound(start, end, v);
+            const float *lowbound = lowerBound.lowerBound(v);
             if (lowbound != start) --lowbound;
             
             const float *highbound = lowbound;
@@ -407,7 +795,9 @@ OCIO_NAMESPACE_ENTER
             return ((float)(lowbound - start) + delta) * invMaxIndex;
         }
         
-        void Lut1D_LinearInverse(float* rgbaBuffer, long numPixels, const Lut1D & lut)
+        template<class LowerBound>
+        void Lut1D_LinearInverse(float* rgbaBuffer, long numPixels, const Lut1D & lut,
+                                 const LowerBound * lowerBound)
         {
             float m[3];
             float b[3];
@@ -429,17 +819,61 @@ OCIO_NAMESPACE_ENTER
             for(long pixelIndex=0; pixelIndex<numPixels; ++pixelIndex)
             {
                 if(!isnan(rgbaBuffer[0]))
-                    rgbaBuffer[0] = m[0] * reverseLookupLinear_1D(rgbaBuffer[0], startPos[0], endPos[0], invMaxIndex[0]) + b[0];
+                    rgbaBuffer[0] = m[0] * reverseLookupLinear_1D(rgbaBuffer[0], lowerBound[0], startPos[0], endPos[0], invMaxIndex[0]) + b[0];
                 if(!isnan(rgbaBuffer[1]))
-                    rgbaBuffer[1] = m[1] * reverseLookupLinear_1D(rgbaBuffer[1], startPos[1], endPos[1], invMaxIndex[0]) + b[1];
+                    rgbaBuffer[1] = m[1] * reverseLookupLinear_1D(rgbaBuffer[1], lowerBound[1], startPos[1], endPos[1], invMaxIndex[1]) + b[1];
                 if(!isnan(rgbaBuffer[2]))
-                    rgbaBuffer[2] = m[2] * reverseLookupLinear_1D(rgbaBuffer[2], startPos[2], endPos[2], invMaxIndex[0]) + b[2];
+                    rgbaBuffer[2] = m[2] * reverseLookupLinear_1D(rgbaBuffer[2], lowerBound[2], startPos[2], endPos[2], invMaxIndex[2]) + b[2];
                 
                 rgbaBuffer += 4;
             }
         }
-    
-    
+        
+        void Lut1D_LinearInverse(float* rgbaBuffer, long numPixels, const Lut1D & lut)
+        {
+            const Lut1DBisect lowerBound[3] = {
+                Lut1DBisect(&lut.luts[0][0], &lut.luts[0][0] + lut.luts[0].size()),
+                Lut1DBisect(&lut.luts[1][0], &lut.luts[1][0] + lut.luts[1].size()),
+                Lut1DBisect(&lut.luts[2][0], &lut.luts[2][0] + lut.luts[2].size()) };
+            
+            Lut1D_LinearInverse(rgbaBuffer, numPixels, lut, lowerBound);
+        }
+        
+        ///////////////////////////////////////////////////////////////////////
+        
+        const char * OCIO_LUT1D_INVERSE_ENVVAR = "OCIO_LUT1D_INVERSE";
+        
+        Mutex g_lut1DInverseMutex;
+        bool g_lut1DInverseIndexed = true;
+        bool g_lut1DInverseInitialized = false;
+        
+        // Whether inverse luts use a Lut1DInverseIndex, which is the
+        // default. Setting OCIO_LUT1D_INVERSE to "bisect" keeps the plain
+        // bisection of the whole lut, e.g. as a reference when debugging.
+        bool UseLut1DInverseIndex()
+        {
+            AutoMutex lock(g_lut1DInverseMutex);
+            
+            if(!g_lut1DInverseInitialized)
+            {
+                g_lut1DInverseInitialized = true;
+                
+                char* modestr = std::getenv(OCIO_LUT1D_INVERSE_ENVVAR);
+                if(modestr)
+                {
+                    std::string mode = pystring::lower(modestr);
+                    if(mode == "bisect") g_lut1DInverseIndexed = false;
+                    else if(mode == "indexed") g_lut1DInverseIndexed = true;
+                    else
+                    {
+                        std::cerr << "[OpenColorIO Warning]: Invalid $OCIO_LUT1D_INVERSE specified. ";
+                        std::cerr << "Options: indexed, bisect" << std::endl;
+                    }
+                }
+            }
+            
+            return g_lut1DInverseIndexed;
+        }
     }
     
     namespace
@@ -469,12 +903,23 @@ OCIO_NAMESPACE_ENTER
                                         const std::string & pixelName,
                                         const GpuShaderDesc & shaderDesc) const;
             
+            const Lut1DRcPtr & getLut() const { return m_lut; }
+            Interpolation getInterpolation() const { return m_interpolation; }
+            TransformDirection getDirection() const { return m_direction; }
+            
         private:
             const Lut1DRcPtr m_lut;
             Interpolation m_interpolation;
             TransformDirection m_direction;
             
             std::string m_cacheID;
+            
+            // Only built for the inverse direction (see finalize)
+            Lut1DInverseIndex m_inverseIndex[3];
+            bool m_useInverseIndex;
+            
+            // Forward only, 0 if there is none for the SIMD level
+            Lut1DKernel m_kernel;
         };
         
         typedef OCIO_SHARED_PTR<Lut1DOp> Lut1DOpRcPtr;
@@ -486,7 +931,9 @@ OCIO_NAMESPACE_ENTER
                             Op(),
                             m_lut(lut),
                             m_interpolation(interpolation),
-                            m_direction(direction)
+                            m_direction(direction),
+                            m_useInverseIndex(false),
+                            m_kernel(0)
         {
         }
         
@@ -570,6 +1017,28 @@ OCIO_NAMESPACE_ENTER
                 throw Exception("Cannot apply lut1d op, no lut data provided.");
             }
             
+            // Build the index for the inverse lookups, unless a channel
+            // does not allow it.
+            m_useInverseIndex = false;
+            if(m_direction == TRANSFORM_DIR_INVERSE && UseLut1DInverseIndex())
+            {
+                m_useInverseIndex = true;
+                for(int i=0; i<3; ++i)
+                {
+                    const float * start = &(m_lut->luts[i][0]);
+                    if(!m_inverseIndex[i].build(start, start + m_lut->luts[i].size()))
+                    {
+                        m_useInverseIndex = false;
+                    }
+                }
+            }
+            
+            m_kernel = 0;
+            if(m_direction == TRANSFORM_DIR_FORWARD)
+            {
+                m_kernel = GetLut1DKernel(m_interpolation, GetSIMDLevel());
+            }
+            
             // Create the cacheID
             std::ostringstream cacheIDStream;
             cacheIDStream << "<Lut1DOp ";
@@ -582,15 +1051,15 @@ OCIO_NAMESPACE_ENTER
         
         void Lut1DOp::apply(float* rgbaBuffer, long numPixels) const
         {
-            if(m_direction == TRANSFORM_DIR_FORWARD)
+            if(m_kernel)
+            {
+                m_kernel(rgbaBuffer, numPixels, *m_lut);
+            }
+            else if(m_direction == TRANSFORM_DIR_FORWARD)
             {
                 if(m_interpolation == INTERP_NEAREST)
                 {
-#ifdef USE_SSE
-                    Lut1D_Nearest_SSE(rgbaBuffer, numPixels, *m_lut);
-#else
                     Lut1D_Nearest(rgbaBuffer, numPixels, *m_lut);
-#endif
                 }
                 else if(m_interpolation == INTERP_LINEAR)
                 {
@@ -601,11 +1070,17 @@ OCIO_NAMESPACE_ENTER
             {
                 if(m_interpolation == INTERP_NEAREST)
                 {
-                    Lut1D_NearestInverse(rgbaBuffer, numPixels, *m_lut);
+                    if(m_useInverseIndex)
+                        Lut1D_NearestInverse(rgbaBuffer, numPixels, *m_lut, m_inverseIndex);
+                    else
+                        Lut1D_NearestInverse(rgbaBuffer, numPixels, *m_lut);
                 }
                 else if(m_interpolation == INTERP_LINEAR)
                 {
-                    Lut1D_LinearInverse(rgbaBuffer, numPixels, *m_lut);
+                    if(m_useInverseIndex)
+                        Lut1D_LinearInverse(rgbaBuffer, numPixels, *m_lut, m_inverseIndex);
+                    else
+                        Lut1D_LinearInverse(rgbaBuffer, numPixels, *m_lut);
                 }
             }
         }
@@ -636,6 +1111,37 @@ OCIO_NAMESPACE_ENTER
         ops.push_back( OpRcPtr(new Lut1DOp(lut, interpolation, direction)) );
     }
     
+    bool GetGpuLut1DTexture(Lut1DRcPtr & lut,
+                            Interpolation & interpolation,
+                            const OpRcPtr & op)
+    {
+        Lut1DOpRcPtr lutOp = DynamicPtrCast<Lut1DOp>(op);
+        if(!lutOp) return false;
+        
+        if(lutOp->getDirection() != TRANSFORM_DIR_FORWARD) return false;
+        
+        const Lut1DRcPtr & opLut = lutOp->getLut();
+        if(opLut->luts[0].empty() ||
+           opLut->luts[1].size() != opLut->luts[0].size() ||
+           opLut->luts[2].size() != opLut->luts[0].size())
+        {
+            return false;
+        }
+        
+        // Tetrahedral, unknown or invalid values are left to finalize
+        // to reject, on the cpu path.
+        Interpolation opInterpolation = lutOp->getInterpolation();
+        if(opInterpolation == INTERP_BEST) opInterpolation = INTERP_LINEAR;
+        if(opInterpolation != INTERP_NEAREST && opInterpolation != INTERP_LINEAR)
+        {
+            return false;
+        }
+        
+        lut = opLut;
+        interpolation = opInterpolation;
+        return true;
+    }
+    
     
     void GenerateIdentityLut1D(float* img, int numElements, int numChannels)
     {
@@ -842,94 +1348,85 @@ OIIO_ADD_TEST(Lut1DOp, Inverse)
 }
 
 
-#ifdef USE_SSE
-OIIO_ADD_TEST(Lut1DOp, SSE)
+OIIO_ADD_TEST(Lut1DOp, SIMDBitExact)
 {
-    // Make a lut that squares the input
+    // Channels of different sizes and domains
     OCIO::Lut1DRcPtr lut = OCIO::Lut1D::Create();
-    lut->from_min[0] = 0.0f;
-    lut->from_min[1] = 0.0f;
-    lut->from_min[2] = 0.0f;
+    lut->from_min[0] = -0.1f;
+    lut->from_max[0] = 1.2f;
+    lut->from_max[2] = 2.0f;
     
-    lut->from_max[0] = 1.0f;
-    lut->from_max[1] = 1.0f;
-    lut->from_max[2] = 1.0f;
-    
-    int size = 256;
-    for(int i=0; i<size; ++i)
+    const int sizes[3] = { 256, 17, 2 };
+    for(int c=0; c<3; ++c)
     {
-        float x = (float)i / (float)(size-1);
-        float x2 = x*x;
-        
-        for(int c=0; c<3; ++c)
+        for(int i=0; i<sizes[c]; ++i)
         {
-            lut->luts[c].push_back(x2);
+            float x = (float)i / (float)(sizes[c]-1);
+            lut->luts[c].push_back(x*x - 0.05f*(float)c);
         }
     }
     
-    lut->maxerror = 1e-5f;
-    lut->errortype = OCIO::ERROR_RELATIVE;
-    OIIO_CHECK_EQUAL(lut->isNoOp(), false);
-    
-    int NUM_TEST_PIXELS = 1024;
-    std::vector<float> testValues(NUM_TEST_PIXELS*4);
-    std::vector<float> outputBuffer_cpu(NUM_TEST_PIXELS*4);
-    std::vector<float> outputBuffer_sse(NUM_TEST_PIXELS*4);
-    
+    // Not a multiple of any vector width
+    const long numPixels = 203;
+    std::vector<float> source(numPixels*4);
     float val = -1.0f;
-    float delta = 0.00123456789f;
-    
-    for(int i=0; i<NUM_TEST_PIXELS*4; ++i)
+    for(long i=0; i<numPixels*4; ++i)
     {
-        testValues[i] = val;
-        val += delta;
+        source[i] = val;
+        val += 0.00923456789f;
     }
-    
-    memcpy(&outputBuffer_cpu[0], &testValues[0], testValues.size()*sizeof(float));
-    memcpy(&outputBuffer_sse[0], &testValues[0], testValues.size()*sizeof(float));
-    
-    OCIO::Lut1D_Nearest(&outputBuffer_cpu[0], NUM_TEST_PIXELS, *lut);
-    OCIO::Lut1D_Nearest_SSE(&outputBuffer_sse[0], NUM_TEST_PIXELS, *lut);
-    
-    for(int i=0; i<NUM_TEST_PIXELS*4; ++i)
+    // Lut entries and the midpoints between them
+    for(long i=0; i<16; ++i)
     {
-        OIIO_CHECK_CLOSE(outputBuffer_cpu[i], outputBuffer_sse[i], 1e-7f);
-        //OIIO_CHECK_EQUAL(outputBuffer_cpu[i], outputBuffer_sse[i]);
+        source[4*i+0] = (float)i / 510.0f;
+        source[4*i+1] = (float)i / 32.0f;
+        source[4*i+2] = (float)i / 8.0f;
     }
+    // Just below a midpoint (where floor(k+0.5) would round up)
+    source[4*16+1] = 0.49999997f / 16.0f;
+    source[4*17+1] = std::numeric_limits<float>::quiet_NaN();
+    source[4*18+3] = std::numeric_limits<float>::quiet_NaN();
+    source[4*19+0] = std::numeric_limits<float>::infinity();
+    source[4*20+2] = -std::numeric_limits<float>::infinity();
+    source[4*21+0] = -0.0f;
+    source[4*22+1] = 1e30f;
+    source[4*23+2] = -1e30f;
     
+    OCIO::SIMDLevel supportedLevel = OCIO::GetSupportedSIMDLevel();
+    OCIO::SIMDLevel originalLevel = OCIO::GetSIMDLevel();
     
-    // Test special values
-    /*
-    NUM_TEST_PIXELS = 2;
-    testValues.resize(NUM_TEST_PIXELS*4);
-    outputBuffer_cpu.resize(NUM_TEST_PIXELS*4);
-    outputBuffer_sse.resize(NUM_TEST_PIXELS*4);
-    
-    testValues[0] = std::numeric_limits<float>::signaling_NaN();
-    testValues[1] = std::numeric_limits<float>::quiet_NaN();
-    testValues[2] = -std::numeric_limits<float>::signaling_NaN();
-    testValues[3] = -std::numeric_limits<float>::signaling_NaN();
-    
-    testValues[4] = std::numeric_limits<float>::infinity();
-    testValues[5] = -std::numeric_limits<float>::infinity();
-    testValues[6] = 0.0f;
-    
-    
-    memcpy(&outputBuffer_cpu[0], &testValues[0], testValues.size()*sizeof(float));
-    memcpy(&outputBuffer_sse[0], &testValues[0], testValues.size()*sizeof(float));
-    
-    OCIO::Lut1D_Nearest(&outputBuffer_cpu[0], NUM_TEST_PIXELS, lut);
-    OCIO::Lut1D_Nearest_SSE(&outputBuffer_sse[0], NUM_TEST_PIXELS, lut);
-    
-    for(int i=0; i<NUM_TEST_PIXELS*4; ++i)
+    const OCIO::Interpolation interps[2] = { OCIO::INTERP_NEAREST,
+                                             OCIO::INTERP_LINEAR };
+    for(int interpIndex=0; interpIndex<2; ++interpIndex)
     {
-        //OIIO_CHECK_CLOSE(outputBuffer_cpu[i], outputBuffer_sse[i], 1e-7f);
-        OIIO_CHECK_EQUAL(outputBuffer_cpu[i], outputBuffer_sse[i]);
+        std::vector<float> reference;
+        
+        for(int level=OCIO::SIMD_LEVEL_NONE; level<=supportedLevel; ++level)
+        {
+            OCIO::SetSIMDLevel(static_cast<OCIO::SIMDLevel>(level));
+            
+            OCIO::OpRcPtrVec ops;
+            OCIO::CreateLut1DOp(ops, lut, interps[interpIndex],
+                                OCIO::TRANSFORM_DIR_FORWARD);
+            OCIO::FinalizeOpVec(ops, false);
+            
+            std::vector<float> data(source);
+            ops[0]->apply(&data[0], numPixels);
+            
+            if(level == OCIO::SIMD_LEVEL_NONE)
+            {
+                reference = data;
+            }
+            else
+            {
+                OIIO_CHECK_EQUAL(memcmp(&data[0], &reference[0],
+                                        sizeof(float)*numPixels*4), 0);
+            }
+        }
     }
     
-    */
+    OCIO::SetSIMDLevel(originalLevel);
 }
-#endif
 
 
 OIIO_ADD_TEST(Lut1DOp, NanInf)
@@ -1035,4 +1532,71 @@ OIIO_ADD_TEST(Lut1DOp, NanInf)
     */
 }
 
+OIIO_ADD_TEST(Lut1DOp, InverseIndex)
+{
+    // A steep curve with a flat segment (repeated values) in red, a plain
+    // curve in green, and a lut with a single step in blue
+    OCIO::Lut1DRcPtr lut = OCIO::Lut1D::Create();
+    int size = 1024;
+    for(int i=0; i<size; ++i)
+    {
+        float x = (float)i / (float)(size-1);
+        float xr = (i > 400 && i < 600) ? 400.0f / (float)(size-1) : x;
+        lut->luts[0].push_back(powf(xr, 6.0f) - 0.1f);
+        lut->luts[1].push_back(sqrtf(x) * 2.0f);
+        lut->luts[2].push_back(i < 700 ? -1.0f : 1.0f);
+    }
+    lut->from_min[1] = -0.5f;
+    lut->from_max[2] = 4.0f;
+    
+    OCIO::Lut1DInverseIndex index[3];
+    for(int c=0; c<3; ++c)
+    {
+        const float * start = &lut->luts[c][0];
+        OIIO_CHECK_ASSERT(index[c].build(start, start + size));
+    }
+    
+    // Values in between, on, and outside of the lut entries
+    std::vector<float> src;
+    for(int i=0; i<size; ++i)
+    {
+        for(int c=0; c<3; ++c) src.push_back(lut->luts[c][i]);
+        src.push_back(0.0f);
+        for(int c=0; c<3; ++c) src.push_back(lut->luts[c][i] + 1e-4f);
+        src.push_back(0.0f);
+    }
+    const float extra[8] = { -10.0f, 10.0f, 1e-30f, -1e-30f,
+                             std::numeric_limits<float>::infinity(),
+                             -std::numeric_limits<float>::infinity(),
+                             std::numeric_limits<float>::quiet_NaN(), 0.5f };
+    src.insert(src.end(), extra, extra + 8);
+    const long numPixels = (long)src.size() / 4;
+    
+    std::vector<float> bisect(src), indexed(src);
+    OCIO::Lut1D_LinearInverse(&bisect[0], numPixels, *lut);
+    OCIO::Lut1D_LinearInverse(&indexed[0], numPixels, *lut, index);
+    for(unsigned int i=0; i<src.size(); ++i)
+    {
+        if(isnan(bisect[i])) OIIO_CHECK_ASSERT(isnan(indexed[i]));
+        else OIIO_CHECK_EQUAL(indexed[i], bisect[i]);
+    }
+    
+    bisect = src;
+    indexed = src;
+    OCIO::Lut1D_NearestInverse(&bisect[0], numPixels, *lut);
+    OCIO::Lut1D_NearestInverse(&indexed[0], numPixels, *lut, index);
+    for(unsigned int i=0; i<src.size(); ++i)
+    {
+        if(isnan(bisect[i])) OIIO_CHECK_ASSERT(isnan(indexed[i]));
+        else OIIO_CHECK_EQUAL(indexed[i], bisect[i]);
+    }
+    
+    // Decreasing or constant luts are not indexed
+    const float decreasing[4] = { 0.0f, 0.5f, 0.4f, 1.0f };
+    const float constant[4] = { 0.5f, 0.5f, 0.5f, 0.5f };
+    OCIO::Lut1DInverseIndex other;
+    OIIO_CHECK_ASSERT(!other.build(decreasing, decreasing + 4));
+    OIIO_CHECK_ASSERT(!other.build(constant, constant + 4));
+}
+
 #endif // OCIO_UNIT_TEST
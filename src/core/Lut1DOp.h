@@ -81,6 +81,13 @@ OCIO_NAMESPACE_ENTER
         std::string getCacheID() const;
         bool isNoOp() const;
         
+        // An estimate of the memory held by the lut
+        size_t getMemorySize() const
+        {
+            return sizeof(Lut1D) + (luts[0].capacity() + luts[1].capacity()
+                                    + luts[2].capacity()) * sizeof(float);
+        }
+        
         void unfinalize();
     private:
         Lut1D();
@@ -101,6 +108,15 @@ OCIO_NAMESPACE_ENTER
                        const Lut1DRcPtr & lut,
                        Interpolation interpolation,
                        TransformDirection direction);
+    
+    // A forward lut1d op whose channels all have the same length can be
+    // applied in a shader by sampling a texture of the lut, instead of
+    // being baked into the 3D lut (see GpuShaderDesc::setLut1DTexturesEnabled).
+    // If the op is one, get its lut and interpolation and return true.
+    
+    bool GetGpuLut1DTexture(Lut1DRcPtr & lut,
+                            Interpolation & interpolation,
+                            const OpRcPtr & op);
 }
 OCIO_NAMESPACE_EXIT
 
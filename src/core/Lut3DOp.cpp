@@ -28,17 +28,25 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "CPUInfo.h"
 #include "HashUtils.h"
+#include "Logging.h"
+#include "LruOrder.h"
 #include "Lut3DOp.h"
 #include "MathUtils.h"
+#include "SSE.h"
+#include "Threading.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <map>
 #include <sstream>
 
 OCIO_NAMESPACE_ENTER
 {
-    Lut3D::Lut3D()
+    Lut3D::Lut3D() :
+        borrowedValues(NULL)
     {
         for(int i=0; i<3; ++i)
         {
@@ -57,7 +65,7 @@ OCIO_NAMESPACE_ENTER
     {
         AutoMutex lock(m_cacheidMutex);
         
-        if(lut.empty())
+        if(getNumValues() == 0)
             throw Exception("Cannot compute cacheID of invalid Lut3D");
         
         if(!m_cacheID.empty())
@@ -71,7 +79,7 @@ OCIO_NAMESPACE_ENTER
         md5_append(&state, (const md5_byte_t *)from_min, 3*sizeof(float));
         md5_append(&state, (const md5_byte_t *)from_max, 3*sizeof(float));
         md5_append(&state, (const md5_byte_t *)size, 3*sizeof(int));
-        md5_append(&state, (const md5_byte_t *)&lut[0], (int) (lut.size()*sizeof(float)));
+        md5_append(&state, (const md5_byte_t *)getValues(), (int) (getNumValues()*sizeof(float)));
         
         md5_finish(&state, digest);
         
@@ -162,7 +170,7 @@ OCIO_NAMESPACE_ENTER
             float b[3];
             float mInv_x_maxIndex[3];
             int lutSize[3];
-            const float* startPos = &(lut.lut[0]);
+            const float* startPos = lut.getValues();
             
             for(int i=0; i<3; ++i)
             {
@@ -208,7 +216,7 @@ OCIO_NAMESPACE_ENTER
             float b[3];
             float mInv_x_maxIndex[3];
             int lutSize[3];
-            const float* startPos = &(lut.lut[0]);
+            const float* startPos = lut.getValues();
             
             for(int i=0; i<3; ++i)
             {
@@ -303,7 +311,7 @@ OCIO_NAMESPACE_ENTER
         float b[3];
         float mInv_x_maxIndex[3];
         int lutSize[3];
-        const float* startPos = &(lut.lut[0]);
+        const float* startPos = lut.getValues();
 
         for(int i=0; i<3; ++i)
         {
@@ -500,6 +508,657 @@ OCIO_NAMESPACE_ENTER
             rgbaBuffer += 4;
         }
     }
+    
+    namespace
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // SIMD kernels
+        //
+        // These produce the same results as Lut3D_Linear / Lut3D_Tetrahedral
+        // bit for bit: the indices, deltas and weights are computed with the
+        // same operations in the same order, a pixel with a NaN in rgb
+        // gives NaN, and the pixels left over after the last full vector go
+        // through the scalar code.
+        //
+        // The lattice is repacked at finalize with a 4th (padding) float
+        // per point, so a lattice point is a single 16-byte load (SSE2), and
+        // the gather index of a point is 4 times its position.
+        
+        struct Lut3DPacked
+        {
+            std::vector<float> rgba;
+            float maxIndex[3];
+            float b[3];
+            float mInv_x_maxIndex[3];
+            int stride[3];
+            
+            Lut3DPacked()
+            {
+                for(int i=0; i<3; ++i)
+                {
+                    maxIndex[i] = 0.0f;
+                    b[i] = 0.0f;
+                    mInv_x_maxIndex[i] = 0.0f;
+                    stride[i] = 0;
+                }
+            }
+        };
+        
+        void PackLut3D(Lut3DPacked & packed, const Lut3D & lut)
+        {
+            for(int i=0; i<3; ++i)
+            {
+                float mInv = 1.0f / (lut.from_max[i] - lut.from_min[i]);
+                packed.maxIndex[i] = (float) (lut.size[i] - 1);
+                packed.b[i] = lut.from_min[i];
+                packed.mInv_x_maxIndex[i] = (float) (mInv * packed.maxIndex[i]);
+            }
+            
+            packed.stride[0] = 4;
+            packed.stride[1] = 4 * lut.size[0];
+            packed.stride[2] = 4 * lut.size[0] * lut.size[1];
+            
+            const float * values = lut.getValues();
+            const size_t numPoints = lut.getNumValues() / 3;
+            packed.rgba.resize(4 * numPoints);
+            for(size_t i=0; i<numPoints; ++i)
+            {
+                packed.rgba[4*i+0] = values[3*i+0];
+                packed.rgba[4*i+1] = values[3*i+1];
+                packed.rgba[4*i+2] = values[3*i+2];
+                packed.rgba[4*i+3] = 0.0f;
+            }
+        }
+        
+        typedef void (*Lut3DKernel)(float* rgbaBuffer, long numPixels,
+                                    const Lut3D & lut, const Lut3DPacked & packed);
+        
+        // For the tetrahedral kernels, the six cases of Lut3D_Tetrahedral
+        // are expressed as the order in which the path from the low to the
+        // high corner of the cell steps through the axes (first, middle,
+        // last): the weights are 1-d[first], d[first]-d[middle],
+        // d[middle]-d[last], d[last], and the 2 inner vertices are
+        // low+step[first] and high-step[last]. With
+        //   gxy = fx>fy, gyz = fy>fz, gxz = fx>fz, gzy = fz>fy, gzx = fz>fx
+        // the cases are
+        //   c1 = gxy & gyz                (x, y, z)
+        //   c2 = gxy & !gyz & gxz         (x, z, y)
+        //   c3 = gxy & !gyz & !gxz        (z, x, y)
+        //   c4 = !gxy & gzy               (z, y, x)
+        //   c5 = !gxy & !gzy & gzx        (y, z, x)
+        //   c6 = !gxy & !gzy & !gzx       (y, x, z)
+        // so first is x for c1|c2, z for c3|c4, else y; middle is y for
+        // c1|c4, z for c2|c5, else x; last is z for c1|c6, y for c2|c3,
+        // else x.
+        
+#ifdef USE_SSE
+        inline __m128 Select_SSE2(__m128 mask, __m128 a, __m128 b)
+        {
+            return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+        }
+        
+        inline __m128i Select_SSE2(__m128 mask, __m128i a, __m128i b)
+        {
+            const __m128i m = _mm_castps_si128(mask);
+            return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b));
+        }
+        
+        inline __m128 Lerp_SSE2(__m128 a, __m128 b, __m128 z)
+        {
+            return _mm_add_ps(_mm_mul_ps(_mm_sub_ps(b, a), z), a);
+        }
+        
+        // 4 pixels at a time. The indices, weights and vertex offsets are
+        // computed in vector registers, then the vertices of each pixel
+        // are 16-byte loads from the packed lattice.
+        
+        template<bool TETRAHEDRAL>
+        void Lut3D_SSE2(float* rgbaBuffer, long numPixels,
+                        const Lut3D & lut, const Lut3DPacked & packed)
+        {
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 one = _mm_set1_ps(1.0f);
+            const __m128 allOnes = _mm_cmpeq_ps(zero, zero);
+            const __m128 qnan = _mm_set1_ps(std::numeric_limits<float>::quiet_NaN());
+            
+            __m128 maxIndex[3];
+            __m128 b[3];
+            __m128 mInv_x_maxIndex[3];
+            __m128i stride[3];
+            for(int i=0; i<3; ++i)
+            {
+                maxIndex[i] = _mm_set1_ps(packed.maxIndex[i]);
+                b[i] = _mm_set1_ps(packed.b[i]);
+                mInv_x_maxIndex[i] = _mm_set1_ps(packed.mInv_x_maxIndex[i]);
+                stride[i] = _mm_set1_epi32(packed.stride[i]);
+            }
+            
+            const float * lattice = &packed.rgba[0];
+            
+            long pixelIndex = 0;
+            for(; pixelIndex+4<=numPixels; pixelIndex+=4)
+            {
+                __m128 v[4];
+                v[0] = _mm_loadu_ps(rgbaBuffer);
+                v[1] = _mm_loadu_ps(rgbaBuffer+4);
+                v[2] = _mm_loadu_ps(rgbaBuffer+8);
+                v[3] = _mm_loadu_ps(rgbaBuffer+12);
+                _MM_TRANSPOSE4_PS(v[0], v[1], v[2], v[3]);
+                
+                const __m128 nanMask = _mm_or_ps(_mm_or_ps(_mm_cmpunord_ps(v[0], v[0]),
+                                                           _mm_cmpunord_ps(v[1], v[1])),
+                                                 _mm_cmpunord_ps(v[2], v[2]));
+                
+                __m128 delta[3];
+                __m128i offset[3];
+                int low[3][4];
+                
+                for(int i=0; i<3; ++i)
+                {
+                    __m128 localIndex = _mm_mul_ps(mInv_x_maxIndex[i],
+                        _mm_sub_ps(_mm_andnot_ps(nanMask, v[i]), b[i]));
+                    localIndex = _mm_max_ps(zero, _mm_min_ps(maxIndex[i], localIndex));
+                    
+                    const __m128i indexLow = _mm_cvttps_epi32(localIndex);
+                    const __m128 indexLowf = _mm_cvtepi32_ps(indexLow);
+                    delta[i] = _mm_sub_ps(localIndex, indexLowf);
+                    offset[i] = _mm_and_si128(_mm_castps_si128(_mm_cmpgt_ps(localIndex, indexLowf)),
+                                              stride[i]);
+                    _mm_storeu_si128((__m128i *)low[i], indexLow);
+                }
+                
+                const __m128i offsetAll = _mm_add_epi32(_mm_add_epi32(offset[0], offset[1]), offset[2]);
+                
+                __m128 out[4];
+                
+                if(TETRAHEDRAL)
+                {
+                    const __m128 gxy = _mm_cmpgt_ps(delta[0], delta[1]);
+                    const __m128 gyz = _mm_cmpgt_ps(delta[1], delta[2]);
+                    const __m128 gxz = _mm_cmpgt_ps(delta[0], delta[2]);
+                    const __m128 gzy = _mm_cmpgt_ps(delta[2], delta[1]);
+                    const __m128 gzx = _mm_cmpgt_ps(delta[2], delta[0]);
+                    
+                    const __m128 c1 = _mm_and_ps(gxy, gyz);
+                    const __m128 c2 = _mm_and_ps(_mm_andnot_ps(gyz, gxy), gxz);
+                    const __m128 c3 = _mm_andnot_ps(gxz, _mm_andnot_ps(gyz, gxy));
+                    const __m128 c4 = _mm_andnot_ps(gxy, gzy);
+                    const __m128 c5 = _mm_andnot_ps(gxy, _mm_andnot_ps(gzy, gzx));
+                    const __m128 c6 = _mm_andnot_ps(_mm_or_ps(_mm_or_ps(gxy, gzy), gzx), allOnes);
+                    
+                    const __m128 firstX = _mm_or_ps(c1, c2);
+                    const __m128 firstZ = _mm_or_ps(c3, c4);
+                    const __m128 middleY = _mm_or_ps(c1, c4);
+                    const __m128 middleZ = _mm_or_ps(c2, c5);
+                    const __m128 lastZ = _mm_or_ps(c1, c6);
+                    const __m128 lastY = _mm_or_ps(c2, c3);
+                    
+                    const __m128 d0 = Select_SSE2(firstX, delta[0], Select_SSE2(firstZ, delta[2], delta[1]));
+                    const __m128 d1 = Select_SSE2(middleY, delta[1], Select_SSE2(middleZ, delta[2], delta[0]));
+                    const __m128 d2 = Select_SSE2(lastZ, delta[2], Select_SSE2(lastY, delta[1], delta[0]));
+                    
+                    float w[4][4];
+                    _mm_storeu_ps(w[0], _mm_sub_ps(one, d0));
+                    _mm_storeu_ps(w[1], _mm_sub_ps(d0, d1));
+                    _mm_storeu_ps(w[2], _mm_sub_ps(d1, d2));
+                    _mm_storeu_ps(w[3], d2);
+                    
+                    const __m128i offsetFirst =
+                        Select_SSE2(firstX, offset[0], Select_SSE2(firstZ, offset[2], offset[1]));
+                    const __m128i offsetLast =
+                        Select_SSE2(lastZ, offset[2], Select_SSE2(lastY, offset[1], offset[0]));
+                    
+                    int n1[4];
+                    int n2[4];
+                    int n3[4];
+                    _mm_storeu_si128((__m128i *)n1, offsetFirst);
+                    _mm_storeu_si128((__m128i *)n2, _mm_sub_epi32(offsetAll, offsetLast));
+                    _mm_storeu_si128((__m128i *)n3, offsetAll);
+                    
+                    for(int j=0; j<4; ++j)
+                    {
+                        const float * n000 = lattice + packed.stride[0]*low[0][j]
+                            + packed.stride[1]*low[1][j] + packed.stride[2]*low[2][j];
+                        
+                        out[j] = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+                            _mm_mul_ps(_mm_set1_ps(w[0][j]), _mm_loadu_ps(n000)),
+                            _mm_mul_ps(_mm_set1_ps(w[1][j]), _mm_loadu_ps(n000 + n1[j]))),
+                            _mm_mul_ps(_mm_set1_ps(w[2][j]), _mm_loadu_ps(n000 + n2[j]))),
+                            _mm_mul_ps(_mm_set1_ps(w[3][j]), _mm_loadu_ps(n000 + n3[j])));
+                    }
+                }
+                else
+                {
+                    float d[3][4];
+                    int n[3][4];
+                    for(int i=0; i<3; ++i)
+                    {
+                        _mm_storeu_ps(d[i], delta[i]);
+                        _mm_storeu_si128((__m128i *)n[i], offset[i]);
+                    }
+                    
+                    for(int j=0; j<4; ++j)
+                    {
+                        const float * n000 = lattice + packed.stride[0]*low[0][j]
+                            + packed.stride[1]*low[1][j] + packed.stride[2]*low[2][j];
+                        const float * n100 = n000 + n[0][j];
+                        
+                        const __m128 x = _mm_set1_ps(d[0][j]);
+                        const __m128 y = _mm_set1_ps(d[1][j]);
+                        const __m128 z = _mm_set1_ps(d[2][j]);
+                        
+                        const __m128 v1 = Lerp_SSE2(
+                            Lerp_SSE2(_mm_loadu_ps(n000), _mm_loadu_ps(n000 + n[2][j]), z),
+                            Lerp_SSE2(_mm_loadu_ps(n000 + n[1][j]), _mm_loadu_ps(n000 + n[1][j] + n[2][j]), z),
+                            y);
+                        const __m128 v2 = Lerp_SSE2(
+                            Lerp_SSE2(_mm_loadu_ps(n100), _mm_loadu_ps(n100 + n[2][j]), z),
+                            Lerp_SSE2(_mm_loadu_ps(n100 + n[1][j]), _mm_loadu_ps(n100 + n[1][j] + n[2][j]), z),
+                            y);
+                        out[j] = Lerp_SSE2(v1, v2, x);
+                    }
+                }
+                
+                _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+                
+                out[0] = Select_SSE2(nanMask, qnan, out[0]);
+                out[1] = Select_SSE2(nanMask, qnan, out[1]);
+                out[2] = Select_SSE2(nanMask, qnan, out[2]);
+                out[3] = v[3];
+                
+                _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+                
+                _mm_storeu_ps(rgbaBuffer, out[0]);
+                _mm_storeu_ps(rgbaBuffer+4, out[1]);
+                _mm_storeu_ps(rgbaBuffer+8, out[2]);
+                _mm_storeu_ps(rgbaBuffer+12, out[3]);
+                
+                rgbaBuffer += 16;
+            }
+            
+            if(TETRAHEDRAL) Lut3D_Tetrahedral(rgbaBuffer, numPixels-pixelIndex, lut);
+            else Lut3D_Linear(rgbaBuffer, numPixels-pixelIndex, lut);
+        }
+#endif // USE_SSE
+        
+#ifdef OCIO_USE_AVX
+        OCIO_TARGET_AVX2
+        inline __m256 Lerp_AVX2(__m256 a, __m256 b, __m256 z)
+        {
+            return _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(b, a), z), a);
+        }
+        
+        OCIO_TARGET_AVX2
+        inline __m256i Select_AVX2(__m256 mask, __m256i a, __m256i b)
+        {
+            return _mm256_blendv_epi8(b, a, _mm256_castps_si256(mask));
+        }
+        
+        // 8 pixels at a time, with the vertices fetched by gathers (one per
+        // vertex and channel).
+        
+        template<bool TETRAHEDRAL>
+        OCIO_TARGET_AVX2
+        void Lut3D_AVX2(float* rgbaBuffer, long numPixels,
+                        const Lut3D & lut, const Lut3DPacked & packed)
+        {
+            const __m256 zero = _mm256_setzero_ps();
+            const __m256 one = _mm256_set1_ps(1.0f);
+            const __m256 allOnes = _mm256_cmp_ps(zero, zero, _CMP_EQ_OQ);
+            const __m256 qnan = _mm256_set1_ps(std::numeric_limits<float>::quiet_NaN());
+            
+            __m256 maxIndex[3];
+            __m256 b[3];
+            __m256 mInv_x_maxIndex[3];
+            __m256i stride[3];
+            for(int i=0; i<3; ++i)
+            {
+                maxIndex[i] = _mm256_set1_ps(packed.maxIndex[i]);
+                b[i] = _mm256_set1_ps(packed.b[i]);
+                mInv_x_maxIndex[i] = _mm256_set1_ps(packed.mInv_x_maxIndex[i]);
+                stride[i] = _mm256_set1_epi32(packed.stride[i]);
+            }
+            
+            const float * lattice = &packed.rgba[0];
+            
+            long pixelIndex = 0;
+            for(; pixelIndex+8<=numPixels; pixelIndex+=8)
+            {
+                __m256 v[4];
+                v[0] = _mm256_loadu_ps(rgbaBuffer);
+                v[1] = _mm256_loadu_ps(rgbaBuffer+8);
+                v[2] = _mm256_loadu_ps(rgbaBuffer+16);
+                v[3] = _mm256_loadu_ps(rgbaBuffer+24);
+                Transpose4_AVX2(v[0], v[1], v[2], v[3]);
+                
+                const __m256 nanMask = _mm256_or_ps(_mm256_or_ps(_mm256_cmp_ps(v[0], v[0], _CMP_UNORD_Q),
+                                                                 _mm256_cmp_ps(v[1], v[1], _CMP_UNORD_Q)),
+                                                    _mm256_cmp_ps(v[2], v[2], _CMP_UNORD_Q));
+                
+                __m256 delta[3];
+                __m256i offset[3];
+                __m256i n000 = _mm256_setzero_si256();
+                
+                for(int i=0; i<3; ++i)
+                {
+                    __m256 localIndex = _mm256_mul_ps(mInv_x_maxIndex[i],
+                        _mm256_sub_ps(_mm256_andnot_ps(nanMask, v[i]), b[i]));
+                    localIndex = _mm256_max_ps(zero, _mm256_min_ps(maxIndex[i], localIndex));
+                    
+                    const __m256i indexLow = _mm256_cvttps_epi32(localIndex);
+                    const __m256 indexLowf = _mm256_cvtepi32_ps(indexLow);
+                    delta[i] = _mm256_sub_ps(localIndex, indexLowf);
+                    offset[i] = _mm256_and_si256(_mm256_castps_si256(_mm256_cmp_ps(localIndex, indexLowf, _CMP_GT_OQ)),
+                                                 stride[i]);
+                    n000 = _mm256_add_epi32(n000, _mm256_mullo_epi32(indexLow, stride[i]));
+                }
+                
+                const __m256i offsetAll = _mm256_add_epi32(_mm256_add_epi32(offset[0], offset[1]), offset[2]);
+                
+                __m256 out[3];
+                
+                if(TETRAHEDRAL)
+                {
+                    const __m256 gxy = _mm256_cmp_ps(delta[0], delta[1], _CMP_GT_OQ);
+                    const __m256 gyz = _mm256_cmp_ps(delta[1], delta[2], _CMP_GT_OQ);
+                    const __m256 gxz = _mm256_cmp_ps(delta[0], delta[2], _CMP_GT_OQ);
+                    const __m256 gzy = _mm256_cmp_ps(delta[2], delta[1], _CMP_GT_OQ);
+                    const __m256 gzx = _mm256_cmp_ps(delta[2], delta[0], _CMP_GT_OQ);
+                    
+                    const __m256 c1 = _mm256_and_ps(gxy, gyz);
+                    const __m256 c2 = _mm256_and_ps(_mm256_andnot_ps(gyz, gxy), gxz);
+                    const __m256 c3 = _mm256_andnot_ps(gxz, _mm256_andnot_ps(gyz, gxy));
+                    const __m256 c4 = _mm256_andnot_ps(gxy, gzy);
+                    const __m256 c5 = _mm256_andnot_ps(gxy, _mm256_andnot_ps(gzy, gzx));
+                    const __m256 c6 = _mm256_andnot_ps(_mm256_or_ps(_mm256_or_ps(gxy, gzy), gzx), allOnes);
+                    
+                    const __m256 firstX = _mm256_or_ps(c1, c2);
+                    const __m256 firstZ = _mm256_or_ps(c3, c4);
+                    const __m256 middleY = _mm256_or_ps(c1, c4);
+                    const __m256 middleZ = _mm256_or_ps(c2, c5);
+                    const __m256 lastZ = _mm256_or_ps(c1, c6);
+                    const __m256 lastY = _mm256_or_ps(c2, c3);
+                    
+                    const __m256 d0 = _mm256_blendv_ps(_mm256_blendv_ps(delta[1], delta[2], firstZ), delta[0], firstX);
+                    const __m256 d1 = _mm256_blendv_ps(_mm256_blendv_ps(delta[0], delta[2], middleZ), delta[1], middleY);
+                    const __m256 d2 = _mm256_blendv_ps(_mm256_blendv_ps(delta[0], delta[1], lastY), delta[2], lastZ);
+                    
+                    const __m256 w0 = _mm256_sub_ps(one, d0);
+                    const __m256 w1 = _mm256_sub_ps(d0, d1);
+                    const __m256 w2 = _mm256_sub_ps(d1, d2);
+                    const __m256 w3 = d2;
+                    
+                    const __m256i offsetFirst =
+                        Select_AVX2(firstX, offset[0], Select_AVX2(firstZ, offset[2], offset[1]));
+                    const __m256i offsetLast =
+                        Select_AVX2(lastZ, offset[2], Select_AVX2(lastY, offset[1], offset[0]));
+                    
+                    const __m256i n1 = _mm256_add_epi32(n000, offsetFirst);
+                    const __m256i n2 = _mm256_add_epi32(n000, _mm256_sub_epi32(offsetAll, offsetLast));
+                    const __m256i n3 = _mm256_add_epi32(n000, offsetAll);
+                    
+                    for(int c=0; c<3; ++c)
+                    {
+                        const float * channel = lattice + c;
+                        out[c] = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(
+                            _mm256_mul_ps(w0, _mm256_i32gather_ps(channel, n000, 4)),
+                            _mm256_mul_ps(w1, _mm256_i32gather_ps(channel, n1, 4))),
+                            _mm256_mul_ps(w2, _mm256_i32gather_ps(channel, n2, 4))),
+                            _mm256_mul_ps(w3, _mm256_i32gather_ps(channel, n3, 4)));
+                    }
+                }
+                else
+                {
+                    const __m256i n001 = _mm256_add_epi32(n000, offset[2]);
+                    const __m256i n010 = _mm256_add_epi32(n000, offset[1]);
+                    const __m256i n011 = _mm256_add_epi32(n010, offset[2]);
+                    const __m256i n100 = _mm256_add_epi32(n000, offset[0]);
+                    const __m256i n101 = _mm256_add_epi32(n100, offset[2]);
+                    const __m256i n110 = _mm256_add_epi32(n100, offset[1]);
+                    const __m256i n111 = _mm256_add_epi32(n110, offset[2]);
+                    
+                    for(int c=0; c<3; ++c)
+                    {
+                        const float * channel = lattice + c;
+                        const __m256 v1 = Lerp_AVX2(
+                            Lerp_AVX2(_mm256_i32gather_ps(channel, n000, 4),
+                                      _mm256_i32gather_ps(channel, n001, 4), delta[2]),
+                            Lerp_AVX2(_mm256_i32gather_ps(channel, n010, 4),
+                                      _mm256_i32gather_ps(channel, n011, 4), delta[2]),
+                            delta[1]);
+                        const __m256 v2 = Lerp_AVX2(
+                            Lerp_AVX2(_mm256_i32gather_ps(channel, n100, 4),
+                                      _mm256_i32gather_ps(channel, n101, 4), delta[2]),
+                            Lerp_AVX2(_mm256_i32gather_ps(channel, n110, 4),
+                                      _mm256_i32gather_ps(channel, n111, 4), delta[2]),
+                            delta[1]);
+                        out[c] = Lerp_AVX2(v1, v2, delta[0]);
+                    }
+                }
+                
+                __m256 r = _mm256_blendv_ps(out[0], qnan, nanMask);
+                __m256 g = _mm256_blendv_ps(out[1], qnan, nanMask);
+                __m256 bl = _mm256_blendv_ps(out[2], qnan, nanMask);
+                __m256 a = v[3];
+                
+                Transpose4_AVX2(r, g, bl, a);
+                
+                _mm256_storeu_ps(rgbaBuffer, r);
+                _mm256_storeu_ps(rgbaBuffer+8, g);
+                _mm256_storeu_ps(rgbaBuffer+16, bl);
+                _mm256_storeu_ps(rgbaBuffer+24, a);
+                
+                rgbaBuffer += 32;
+            }
+            
+            if(TETRAHEDRAL) Lut3D_Tetrahedral(rgbaBuffer, numPixels-pixelIndex, lut);
+            else Lut3D_Linear(rgbaBuffer, numPixels-pixelIndex, lut);
+        }
+        
+        // gcc 12 warns about the placeholder (_mm512_undefined_*) operands
+        // within its own avx512 intrinsics (gcc bug 105593).
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+        
+        OCIO_TARGET_AVX512
+        inline __m512 Lerp_AVX512(__m512 a, __m512 b, __m512 z)
+        {
+            return _mm512_add_ps(_mm512_mul_ps(_mm512_sub_ps(b, a), z), a);
+        }
+        
+        // 16 pixels at a time, same as Lut3D_AVX2 with mask registers.
+        
+        template<bool TETRAHEDRAL>
+        OCIO_TARGET_AVX512
+        void Lut3D_AVX512(float* rgbaBuffer, long numPixels,
+                          const Lut3D & lut, const Lut3DPacked & packed)
+        {
+            const __m512 zero = _mm512_setzero_ps();
+            const __m512 one = _mm512_set1_ps(1.0f);
+            const __m512 qnan = _mm512_set1_ps(std::numeric_limits<float>::quiet_NaN());
+            
+            __m512 maxIndex[3];
+            __m512 b[3];
+            __m512 mInv_x_maxIndex[3];
+            __m512i stride[3];
+            for(int i=0; i<3; ++i)
+            {
+                maxIndex[i] = _mm512_set1_ps(packed.maxIndex[i]);
+                b[i] = _mm512_set1_ps(packed.b[i]);
+                mInv_x_maxIndex[i] = _mm512_set1_ps(packed.mInv_x_maxIndex[i]);
+                stride[i] = _mm512_set1_epi32(packed.stride[i]);
+            }
+            
+            const float * lattice = &packed.rgba[0];
+            
+            long pixelIndex = 0;
+            for(; pixelIndex+16<=numPixels; pixelIndex+=16)
+            {
+                __m512 v[4];
+                v[0] = _mm512_loadu_ps(rgbaBuffer);
+                v[1] = _mm512_loadu_ps(rgbaBuffer+16);
+                v[2] = _mm512_loadu_ps(rgbaBuffer+32);
+                v[3] = _mm512_loadu_ps(rgbaBuffer+48);
+                Transpose4_AVX512(v[0], v[1], v[2], v[3]);
+                
+                const __mmask16 nanMask = (__mmask16)(_mm512_cmp_ps_mask(v[0], v[0], _CMP_UNORD_Q)
+                    | _mm512_cmp_ps_mask(v[1], v[1], _CMP_UNORD_Q)
+                    | _mm512_cmp_ps_mask(v[2], v[2], _CMP_UNORD_Q));
+                const __mmask16 notNanMask = (__mmask16)~nanMask;
+                
+                __m512 delta[3];
+                __m512i offset[3];
+                __m512i n000 = _mm512_setzero_si512();
+                
+                for(int i=0; i<3; ++i)
+                {
+                    __m512 localIndex = _mm512_mul_ps(mInv_x_maxIndex[i],
+                        _mm512_sub_ps(_mm512_maskz_mov_ps(notNanMask, v[i]), b[i]));
+                    localIndex = _mm512_max_ps(zero, _mm512_min_ps(maxIndex[i], localIndex));
+                    
+                    const __m512i indexLow = _mm512_cvttps_epi32(localIndex);
+                    const __m512 indexLowf = _mm512_cvtepi32_ps(indexLow);
+                    delta[i] = _mm512_sub_ps(localIndex, indexLowf);
+                    offset[i] = _mm512_maskz_mov_epi32(_mm512_cmp_ps_mask(localIndex, indexLowf, _CMP_GT_OQ),
+                                                       stride[i]);
+                    n000 = _mm512_add_epi32(n000, _mm512_mullo_epi32(indexLow, stride[i]));
+                }
+                
+                const __m512i offsetAll = _mm512_add_epi32(_mm512_add_epi32(offset[0], offset[1]), offset[2]);
+                
+                __m512 out[3];
+                
+                if(TETRAHEDRAL)
+                {
+                    const __mmask16 gxy = _mm512_cmp_ps_mask(delta[0], delta[1], _CMP_GT_OQ);
+                    const __mmask16 gyz = _mm512_cmp_ps_mask(delta[1], delta[2], _CMP_GT_OQ);
+                    const __mmask16 gxz = _mm512_cmp_ps_mask(delta[0], delta[2], _CMP_GT_OQ);
+                    const __mmask16 gzy = _mm512_cmp_ps_mask(delta[2], delta[1], _CMP_GT_OQ);
+                    const __mmask16 gzx = _mm512_cmp_ps_mask(delta[2], delta[0], _CMP_GT_OQ);
+                    
+                    const __mmask16 c1 = (__mmask16)(gxy & gyz);
+                    const __mmask16 c2 = (__mmask16)(gxy & ~gyz & gxz);
+                    const __mmask16 c3 = (__mmask16)(gxy & ~gyz & ~gxz);
+                    const __mmask16 c4 = (__mmask16)(~gxy & gzy);
+                    const __mmask16 c5 = (__mmask16)(~gxy & ~gzy & gzx);
+                    const __mmask16 c6 = (__mmask16)(~gxy & ~gzy & ~gzx);
+                    
+                    const __mmask16 firstX = (__mmask16)(c1 | c2);
+                    const __mmask16 firstZ = (__mmask16)(c3 | c4);
+                    const __mmask16 middleY = (__mmask16)(c1 | c4);
+                    const __mmask16 middleZ = (__mmask16)(c2 | c5);
+                    const __mmask16 lastZ = (__mmask16)(c1 | c6);
+                    const __mmask16 lastY = (__mmask16)(c2 | c3);
+                    
+                    const __m512 d0 = _mm512_mask_blend_ps(firstX,
+                        _mm512_mask_blend_ps(firstZ, delta[1], delta[2]), delta[0]);
+                    const __m512 d1 = _mm512_mask_blend_ps(middleY,
+                        _mm512_mask_blend_ps(middleZ, delta[0], delta[2]), delta[1]);
+                    const __m512 d2 = _mm512_mask_blend_ps(lastZ,
+                        _mm512_mask_blend_ps(lastY, delta[0], delta[1]), delta[2]);
+                    
+                    const __m512 w0 = _mm512_sub_ps(one, d0);
+                    const __m512 w1 = _mm512_sub_ps(d0, d1);
+                    const __m512 w2 = _mm512_sub_ps(d1, d2);
+                    const __m512 w3 = d2;
+                    
+                    const __m512i offsetFirst = _mm512_mask_blend_epi32(firstX,
+                        _mm512_mask_blend_epi32(firstZ, offset[1], offset[2]), offset[0]);
+                    const __m512i offsetLast = _mm512_mask_blend_epi32(lastZ,
+                        _mm512_mask_blend_epi32(lastY, offset[0], offset[1]), offset[2]);
+                    
+                    const __m512i n1 = _mm512_add_epi32(n000, offsetFirst);
+                    const __m512i n2 = _mm512_add_epi32(n000, _mm512_sub_epi32(offsetAll, offsetLast));
+                    const __m512i n3 = _mm512_add_epi32(n000, offsetAll);
+                    
+                    for(int c=0; c<3; ++c)
+                    {
+                        const float * channel = lattice + c;
+                        out[c] = _mm512_add_ps(_mm512_add_ps(_mm512_add_ps(
+                            _mm512_mul_ps(w0, _mm512_i32gather_ps(n000, channel, 4)),
+                            _mm512_mul_ps(w1, _mm512_i32gather_ps(n1, channel, 4))),
+                            _mm512_mul_ps(w2, _mm512_i32gather_ps(n2, channel, 4))),
+                            _mm512_mul_ps(w3, _mm512_i32gather_ps(n3, channel, 4)));
+                    }
+                }
+                else
+                {
+                    const __m512i n001 = _mm512_add_epi32(n000, offset[2]);
+                    const __m512i n010 = _mm512_add_epi32(n000, offset[1]);
+                    const __m512i n011 = _mm512_add_epi32(n010, offset[2]);
+                    const __m512i n100 = _mm512_add_epi32(n000, offset[0]);
+                    const __m512i n101 = _mm512_add_epi32(n100, offset[2]);
+                    const __m512i n110 = _mm512_add_epi32(n100, offset[1]);
+                    const __m512i n111 = _mm512_add_epi32(n110, offset[2]);
+                    
+                    for(int c=0; c<3; ++c)
+                    {
+                        const float * channel = lattice + c;
+                        const __m512 v1 = Lerp_AVX512(
+                            Lerp_AVX512(_mm512_i32gather_ps(n000, channel, 4),
+                                        _mm512_i32gather_ps(n001, channel, 4), delta[2]),
+                            Lerp_AVX512(_mm512_i32gather_ps(n010, channel, 4),
+                                        _mm512_i32gather_ps(n011, channel, 4), delta[2]),
+                            delta[1]);
+                        const __m512 v2 = Lerp_AVX512(
+                            Lerp_AVX512(_mm512_i32gather_ps(n100, channel, 4),
+                                        _mm512_i32gather_ps(n101, channel, 4), delta[2]),
+                            Lerp_AVX512(_mm512_i32gather_ps(n110, channel, 4),
+                                        _mm512_i32gather_ps(n111, channel, 4), delta[2]),
+                            delta[1]);
+                        out[c] = Lerp_AVX512(v1, v2, delta[0]);
+                    }
+                }
+                
+                __m512 r = _mm512_mask_blend_ps(nanMask, out[0], qnan);
+                __m512 g = _mm512_mask_blend_ps(nanMask, out[1], qnan);
+                __m512 bl = _mm512_mask_blend_ps(nanMask, out[2], qnan);
+                __m512 a = v[3];
+                
+                Transpose4_AVX512(r, g, bl, a);
+                
+                _mm512_storeu_ps(rgbaBuffer, r);
+                _mm512_storeu_ps(rgbaBuffer+16, g);
+                _mm512_storeu_ps(rgbaBuffer+32, bl);
+                _mm512_storeu_ps(rgbaBuffer+48, a);
+                
+                rgbaBuffer += 64;
+            }
+            
+            if(TETRAHEDRAL) Lut3D_Tetrahedral(rgbaBuffer, numPixels-pixelIndex, lut);
+            else Lut3D_Linear(rgbaBuffer, numPixels-pixelIndex, lut);
+        }
+        
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif // OCIO_USE_AVX
+        
+        // Returns 0 if there is no vectorized kernel for the arguments.
+        Lut3DKernel GetLut3DKernel(Interpolation interpolation, SIMDLevel level)
+        {
+            if(interpolation != INTERP_LINEAR && interpolation != INTERP_TETRAHEDRAL)
+                return 0;
+            
+            const bool tetrahedral = (interpolation == INTERP_TETRAHEDRAL);
+            
+#ifdef OCIO_USE_AVX
+            if(level >= SIMD_LEVEL_AVX512)
+                return tetrahedral ? Lut3D_AVX512<true> : Lut3D_AVX512<false>;
+            if(level >= SIMD_LEVEL_AVX2)
+                return tetrahedral ? Lut3D_AVX2<true> : Lut3D_AVX2<false>;
+#endif
+#ifdef USE_SSE
+            if(level >= SIMD_LEVEL_SSE2)
+                return tetrahedral ? Lut3D_SSE2<true> : Lut3D_SSE2<false>;
+#endif
+            (void)tetrahedral;
+            (void)level;
+            return 0;
+        }
+    }
 
 
     void GenerateIdentityLut3D(float* img, int edgeLen, int numChannels, Lut3DOrder lut3DOrder)
@@ -554,6 +1213,375 @@ OCIO_NAMESPACE_ENTER
         return dim;
     }
     
+    namespace
+    {
+        // Tetrahedral interpolation of the lut at the color x (as in
+        // Lut3D_Tetrahedral), also returning its derivatives
+        // (jacobian[3*outChannel + inChannel]). Within a tetrahedron the
+        // interpolation is linear: the path from the low to the high corner
+        // of the cell through its vertices steps along one axis at a time,
+        // in decreasing order of the position within the cell.
+        
+        void EvalLut3DTetrahedral(float * out, double * jacobian,
+                                  const float * x, const Lut3D & lut)
+        {
+            int index[3];
+            float delta[3];
+            double scale[3];
+            
+            for(int i=0; i<3; ++i)
+            {
+                const float maxIndex = (float)(lut.size[i] - 1);
+                scale[i] = maxIndex / (lut.from_max[i] - lut.from_min[i]);
+                float localIndex = (float)scale[i] * (x[i] - lut.from_min[i]);
+                localIndex = std::max(std::min(localIndex, maxIndex), 0.0f);
+                
+                // The upper edge belongs to the last cell, so that the
+                // derivatives are not zero there.
+                index[i] = std::min(static_cast<int>(std::floor(localIndex)),
+                                    lut.size[i] - 2);
+                delta[i] = localIndex - static_cast<float>(index[i]);
+            }
+            
+            int axes[3] = { 0, 1, 2 };
+            if(delta[axes[0]] < delta[axes[1]]) std::swap(axes[0], axes[1]);
+            if(delta[axes[1]] < delta[axes[2]]) std::swap(axes[1], axes[2]);
+            if(delta[axes[0]] < delta[axes[1]]) std::swap(axes[0], axes[1]);
+            
+            const float * vertex = lut.getValues() + GetLut3DIndex_B(index[0], index[1], index[2],
+                                                                     lut.size[0], lut.size[1], lut.size[2]);
+            out[0] = vertex[0];
+            out[1] = vertex[1];
+            out[2] = vertex[2];
+            
+            for(int k=0; k<3; ++k)
+            {
+                const int axis = axes[k];
+                ++index[axis];
+                const float * next = lut.getValues() + GetLut3DIndex_B(index[0], index[1], index[2],
+                                                                       lut.size[0], lut.size[1], lut.size[2]);
+                for(int c=0; c<3; ++c)
+                {
+                    const float diff = next[c] - vertex[c];
+                    out[c] += delta[axis] * diff;
+                    jacobian[3*c + axis] = diff * scale[axis];
+                }
+                vertex = next;
+            }
+        }
+        
+        // Solves m * x = b, returns false if m is singular.
+        bool Solve3x3(double * x, const double * m, const double * b)
+        {
+            const double c0 = m[4]*m[8] - m[5]*m[7];
+            const double c1 = m[5]*m[6] - m[3]*m[8];
+            const double c2 = m[3]*m[7] - m[4]*m[6];
+            const double det = m[0]*c0 + m[1]*c1 + m[2]*c2;
+            if(det == 0.0 || isnan(det)) return false;
+            
+            const double invDet = 1.0 / det;
+            x[0] = (b[0]*c0 + m[1]*(m[5]*b[2] - b[1]*m[8]) + m[2]*(b[1]*m[7] - m[4]*b[2])) * invDet;
+            x[1] = (m[0]*(b[1]*m[8] - m[5]*b[2]) + b[0]*c1 + m[2]*(m[3]*b[2] - b[1]*m[6])) * invDet;
+            x[2] = (m[0]*(m[4]*b[2] - b[1]*m[7]) + m[1]*(b[1]*m[6] - m[3]*b[2]) + b[0]*c2) * invDet;
+            return true;
+        }
+        
+        const int MAX_INVERSE_ITERATIONS = 32;
+        
+        // Newton iterations for lut(x) = y, starting from x. As the
+        // interpolation is piecewise linear, each step solves exactly
+        // within the current tetrahedron. x is left at the closest match
+        // found, and the largest absolute residual is returned.
+        
+        float InvertLut3DTetrahedral(float * x, const float * y,
+                                     const Lut3D & lut, float tolerance)
+        {
+            float best[3] = { x[0], x[1], x[2] };
+            float bestError = std::numeric_limits<float>::max();
+            
+            for(int iteration=0; iteration<MAX_INVERSE_ITERATIONS; ++iteration)
+            {
+                float f[3];
+                double jacobian[9];
+                EvalLut3DTetrahedral(f, jacobian, x, lut);
+                
+                const double residual[3] = { y[0] - f[0], y[1] - f[1], y[2] - f[2] };
+                const float error = (float)std::max(std::fabs(residual[0]),
+                    std::max(std::fabs(residual[1]), std::fabs(residual[2])));
+                if(error < bestError)
+                {
+                    bestError = error;
+                    best[0] = x[0];
+                    best[1] = x[1];
+                    best[2] = x[2];
+                }
+                if(error <= tolerance) break;
+                
+                double step[3];
+                if(!Solve3x3(step, jacobian, residual)) break;
+                
+                bool moved = false;
+                for(int i=0; i<3; ++i)
+                {
+                    const float xi = std::max(std::min(x[i] + (float)step[i],
+                                                       lut.from_max[i]),
+                                              lut.from_min[i]);
+                    if(xi != x[i]) moved = true;
+                    x[i] = xi;
+                }
+                if(!moved) break;
+            }
+            
+            x[0] = best[0];
+            x[1] = best[1];
+            x[2] = best[2];
+            return bestError;
+        }
+        
+        // Each item is a row (along red) of the inverse lattice. The
+        // solution for the previous point of the row is a second starting
+        // point, for when the first one does not converge.
+        
+        class InverseLut3DBody : public ParallelForBody
+        {
+        public:
+            InverseLut3DBody(Lut3D & inverse, const Lut3D & lut, float tolerance,
+                             std::vector<float> & rowErrors) :
+                m_inverse(inverse),
+                m_lut(lut),
+                m_tolerance(tolerance),
+                m_rowErrors(rowErrors)
+            { }
+            
+            virtual void run(int /*workerIndex*/, long rowBegin, long rowEnd) const
+            {
+                const int * size = m_inverse.size;
+                
+                for(long row=rowBegin; row<rowEnd; ++row)
+                {
+                    const int indexG = (int)(row % size[1]);
+                    const int indexB = (int)(row / size[1]);
+                    
+                    float rowError = 0.0f;
+                    float previous[3] = { 0.0f, 0.0f, 0.0f };
+                    
+                    for(int indexR=0; indexR<size[0]; ++indexR)
+                    {
+                        const int index[3] = { indexR, indexG, indexB };
+                        float y[3];
+                        float x[3];
+                        for(int i=0; i<3; ++i)
+                        {
+                            const float t = (float)index[i] / (float)(size[i] - 1);
+                            y[i] = lerpf(m_inverse.from_min[i], m_inverse.from_max[i], t);
+                            x[i] = lerpf(m_lut.from_min[i], m_lut.from_max[i], t);
+                        }
+                        
+                        float error = InvertLut3DTetrahedral(x, y, m_lut, m_tolerance);
+                        if(error > m_tolerance && indexR > 0)
+                        {
+                            float x2[3] = { previous[0], previous[1], previous[2] };
+                            const float error2 = InvertLut3DTetrahedral(x2, y, m_lut, m_tolerance);
+                            if(error2 < error)
+                            {
+                                error = error2;
+                                x[0] = x2[0];
+                                x[1] = x2[1];
+                                x[2] = x2[2];
+                            }
+                        }
+                        
+                        float * out = &m_inverse.lut[GetLut3DIndex_B(indexR, indexG, indexB,
+                                                                     size[0], size[1], size[2])];
+                        out[0] = x[0];
+                        out[1] = x[1];
+                        out[2] = x[2];
+                        
+                        previous[0] = x[0];
+                        previous[1] = x[1];
+                        previous[2] = x[2];
+                        rowError = std::max(rowError, error);
+                    }
+                    
+                    m_rowErrors[row] = rowError;
+                }
+            }
+            
+        private:
+            Lut3D & m_inverse;
+            const Lut3D & m_lut;
+            float m_tolerance;
+            std::vector<float> & m_rowErrors;
+            
+            InverseLut3DBody(const InverseLut3DBody &);
+            InverseLut3DBody& operator= (const InverseLut3DBody &);
+        };
+        
+        typedef LruOrder<std::string> InverseLut3DOrder;
+        
+        struct InverseLut3DEntry
+        {
+            Lut3DRcPtr inverse;
+            size_t bytes;
+            // For the LRU eviction, the cache clock at the last lookup
+            volatile long lastUse;
+            InverseLut3DOrder::Position order;
+            
+            InverseLut3DEntry():
+                bytes(0),
+                lastUse(0)
+            {}
+        };
+        
+        typedef std::map<std::string, InverseLut3DEntry> InverseLut3DMap;
+        
+        InverseLut3DMap g_inverseLut3DCache;
+        InverseLut3DOrder g_inverseLut3DCacheOrder;
+        size_t g_inverseLut3DCacheBytes = 0;
+        volatile long g_inverseLut3DCacheClock = 0;
+        volatile long g_inverseLut3DCacheHits = 0;
+        long g_inverseLut3DCacheMisses = 0;
+        long g_inverseLut3DCacheEvictions = 0;
+        RWLock g_inverseLut3DCacheLock;
+        
+        // You must manually acquire the inverse cache write lock before
+        // calling this. Evicts the least recently used lattices, always
+        // keeping the most recent one. The ops using an evicted lattice
+        // keep their own reference to it.
+        void TrimInverseLut3DCacheLocked()
+        {
+            size_t limit = GetCacheMemoryLimit();
+            
+            while(limit > 0 && g_inverseLut3DCacheBytes > limit
+                  && g_inverseLut3DCacheOrder.size() > 1)
+            {
+                InverseLut3DMap::iterator iter =
+                    g_inverseLut3DCache.find(g_inverseLut3DCacheOrder.back());
+                g_inverseLut3DCacheBytes -= iter->second.bytes;
+                g_inverseLut3DCacheOrder.erase(iter->second.order);
+                g_inverseLut3DCache.erase(iter);
+                ++g_inverseLut3DCacheEvictions;
+            }
+        }
+    }
+    
+    Lut3DRcPtr GetInverseLut3D(const Lut3DRcPtr & lut)
+    {
+        const std::string cacheID = lut->getCacheID();
+        
+        {
+            AutoReadLock lock(g_inverseLut3DCacheLock);
+            InverseLut3DMap::iterator iter = g_inverseLut3DCache.find(cacheID);
+            if(iter != g_inverseLut3DCache.end())
+            {
+                AtomicAdd(&g_inverseLut3DCacheHits, 1);
+                AtomicStore(&iter->second.lastUse,
+                            AtomicAdd(&g_inverseLut3DCacheClock, 1));
+                return iter->second.inverse;
+            }
+        }
+        
+        for(int i=0; i<3; ++i)
+        {
+            if(lut->size[i] < 2)
+            {
+                throw Exception("Cannot invert Lut3D, at least 2 points per axis are required.");
+            }
+        }
+        
+        // The inverse covers the range of the lut values
+        Lut3DRcPtr inverse = Lut3D::Create();
+        float tolerance = 0.0f;
+        for(int i=0; i<3; ++i)
+        {
+            inverse->size[i] = lut->size[i];
+            inverse->from_min[i] = std::numeric_limits<float>::max();
+            inverse->from_max[i] = -std::numeric_limits<float>::max();
+        }
+        const float * values = lut->getValues();
+        for(size_t i=0; i<lut->getNumValues(); ++i)
+        {
+            inverse->from_min[i%3] = std::min(inverse->from_min[i%3], values[i]);
+            inverse->from_max[i%3] = std::max(inverse->from_max[i%3], values[i]);
+        }
+        for(int i=0; i<3; ++i)
+        {
+            if(!(inverse->from_max[i] > inverse->from_min[i]))
+            {
+                inverse->from_max[i] = inverse->from_min[i] + 1.0f;
+            }
+            tolerance = std::max(tolerance,
+                1e-6f * (inverse->from_max[i] - inverse->from_min[i]));
+        }
+        inverse->lut.resize(lut->getNumValues());
+        
+        const long numRows = (long)inverse->size[1] * inverse->size[2];
+        std::vector<float> rowErrors(numRows, 0.0f);
+        InverseLut3DBody body(*inverse, *lut, tolerance, rowErrors);
+        ParallelFor(body, numRows, 1, GetParallelForNumWorkers(numRows));
+        
+        if(IsDebugLoggingEnabled())
+        {
+            std::ostringstream os;
+            os << "Inverted Lut3D " << cacheID << ", max residual ";
+            os << "(including colors outside of the lut range) ";
+            os << *std::max_element(rowErrors.begin(), rowErrors.end());
+            LogDebug(os.str());
+        }
+        
+        AutoWriteLock lock(g_inverseLut3DCacheLock);
+        // Another thread may have added it meanwhile
+        InverseLut3DMap::iterator iter = g_inverseLut3DCache.find(cacheID);
+        if(iter != g_inverseLut3DCache.end())
+        {
+            AtomicAdd(&g_inverseLut3DCacheHits, 1);
+            AtomicStore(&iter->second.lastUse,
+                        AtomicAdd(&g_inverseLut3DCacheClock, 1));
+            return iter->second.inverse;
+        }
+        
+        ++g_inverseLut3DCacheMisses;
+        InverseLut3DEntry & entry = g_inverseLut3DCache[cacheID];
+        entry.inverse = inverse;
+        entry.bytes = sizeof(InverseLut3DEntry) + sizeof(Lut3D)
+            + inverse->lut.size() * sizeof(float) + 2 * cacheID.size();
+        entry.lastUse = AtomicAdd(&g_inverseLut3DCacheClock, 1);
+        entry.order = g_inverseLut3DCacheOrder.push(cacheID, &entry.lastUse);
+        g_inverseLut3DCacheBytes += entry.bytes;
+        TrimInverseLut3DCacheLocked();
+        
+        return inverse;
+    }
+    
+    void ClearInverseLut3DCache()
+    {
+        AutoWriteLock lock(g_inverseLut3DCacheLock);
+        g_inverseLut3DCache.clear();
+        g_inverseLut3DCacheOrder.clear();
+        g_inverseLut3DCacheBytes = 0;
+        AtomicStore(&g_inverseLut3DCacheHits, 0);
+        g_inverseLut3DCacheMisses = 0;
+        g_inverseLut3DCacheEvictions = 0;
+    }
+    
+    void TrimInverseLut3DCache()
+    {
+        AutoWriteLock lock(g_inverseLut3DCacheLock);
+        TrimInverseLut3DCacheLocked();
+    }
+    
+    void GetInverseLut3DCacheStats(long & entries, size_t & bytes,
+                                   long & hits, long & misses,
+                                   long & evictions)
+    {
+        AutoReadLock lock(g_inverseLut3DCacheLock);
+        entries = (long)g_inverseLut3DCache.size();
+        bytes = g_inverseLut3DCacheBytes;
+        hits = AtomicLoad(&g_inverseLut3DCacheHits);
+        misses = g_inverseLut3DCacheMisses;
+        evictions = g_inverseLut3DCacheEvictions;
+    }
+    
     namespace
     {
         class Lut3DOp : public Op
@@ -588,6 +1616,9 @@ OCIO_NAMESPACE_ENTER
             
             // Set in finalize
             std::string m_cacheID;
+            Lut3DRcPtr m_invLut;
+            Lut3DKernel m_kernel;
+            Lut3DPacked m_packed;
         };
         
         typedef OCIO_SHARED_PTR<Lut3DOp> Lut3DOpRcPtr;
@@ -599,7 +1630,8 @@ OCIO_NAMESPACE_ENTER
                             Op(),
                             m_lut(lut),
                             m_interpolation(interpolation),
-                            m_direction(direction)
+                            m_direction(direction),
+                            m_kernel(0)
         {
         }
         
@@ -654,13 +1686,9 @@ OCIO_NAMESPACE_ENTER
         
         void Lut3DOp::finalize()
         {
-            if(m_direction != TRANSFORM_DIR_FORWARD)
+            if(m_direction == TRANSFORM_DIR_UNKNOWN)
             {
-                std::ostringstream os;
-                os << "3D Luts can only be applied in the forward direction. ";
-                os << "(" << TransformDirectionToString(m_direction) << ")";
-                os << " specified.";
-                throw Exception(os.str().c_str());
+                throw Exception("Cannot apply Lut3DOp, unspecified transform direction.");
             }
             
             // Validate the requested interpolation type
@@ -690,11 +1718,29 @@ OCIO_NAMESPACE_ENTER
                 // TODO if from_min[i] == from_max[i]
             }
             
-            if(m_lut->size[0]*m_lut->size[1]*m_lut->size[2] * 3 != (int)m_lut->lut.size())
+            if(m_lut->size[0]*m_lut->size[1]*m_lut->size[2] * 3 != (int)m_lut->getNumValues())
             {
                 throw Exception("Cannot apply Lut3DOp, specified size does not match data.");
             }
             
+            // The inverse is applied as a (forward) lookup into the
+            // inverse lattice.
+            if(m_direction == TRANSFORM_DIR_INVERSE)
+            {
+                m_invLut = GetInverseLut3D(m_lut);
+            }
+            
+            // The SIMD kernels read a padded copy of the lattice. Borrowed
+            // values are read in place by the scalar kernels instead, as a
+            // copy per process would defeat sharing them.
+            const Lut3D & lut = m_invLut ? *m_invLut : *m_lut;
+            m_kernel = lut.borrowedValues ? NULL
+                                          : GetLut3DKernel(m_interpolation, GetSIMDLevel());
+            if(m_kernel)
+            {
+                PackLut3D(m_packed, lut);
+            }
+            
             // Create the cacheID
             std::ostringstream cacheIDStream;
             cacheIDStream << "<Lut3DOp ";
@@ -707,17 +1753,23 @@ OCIO_NAMESPACE_ENTER
         
         void Lut3DOp::apply(float* rgbaBuffer, long numPixels) const
         {
-            if(m_interpolation == INTERP_NEAREST)
+            const Lut3D & lut = m_invLut ? *m_invLut : *m_lut;
+            
+            if(m_kernel)
+            {
+                m_kernel(rgbaBuffer, numPixels, lut, m_packed);
+            }
+            else if(m_interpolation == INTERP_NEAREST)
             {
-                Lut3D_Nearest(rgbaBuffer, numPixels, *m_lut);
+                Lut3D_Nearest(rgbaBuffer, numPixels, lut);
             }
             else if(m_interpolation == INTERP_LINEAR)
             {
-                Lut3D_Linear(rgbaBuffer, numPixels, *m_lut);
+                Lut3D_Linear(rgbaBuffer, numPixels, lut);
             }
             else if(m_interpolation == INTERP_TETRAHEDRAL)
             {
-                Lut3D_Tetrahedral(rgbaBuffer, numPixels, *m_lut);
+                Lut3D_Tetrahedral(rgbaBuffer, numPixels, lut);
             }
         }
         
@@ -750,7 +1802,6 @@ OCIO_NAMESPACE_EXIT
 
 #include <cstring>
 #include <cstdlib>
-#include <sys/time.h>
 
 namespace OCIO = OCIO_NAMESPACE;
 #include "UnitTest.h"
@@ -773,7 +1824,7 @@ OIIO_ADD_TEST(Lut3DOp, NanInfValueCheck)
     
     lut->lut.resize(lut->size[0]*lut->size[1]*lut->size[2]*3);
     
-    GenerateIdentityLut3D(&lut->lut[0], lut->size[0], 3, OCIO::LUT3DORDER_FAST_RED);
+    OCIO::GenerateIdentityLut3D(&lut->lut[0], lut->size[0], 3, OCIO::LUT3DORDER_FAST_RED);
     for(unsigned int i=0; i<lut->lut.size(); ++i)
     {
         lut->lut[i] = powf(lut->lut[i], 2.0f);
@@ -810,7 +1861,7 @@ OIIO_ADD_TEST(Lut3DOp, ValueCheck)
     lut->size[2] = 32;
     
     lut->lut.resize(lut->size[0]*lut->size[1]*lut->size[2]*3);
-    GenerateIdentityLut3D(&lut->lut[0], lut->size[0], 3, OCIO::LUT3DORDER_FAST_RED);
+    OCIO::GenerateIdentityLut3D(&lut->lut[0], lut->size[0], 3, OCIO::LUT3DORDER_FAST_RED);
     for(unsigned int i=0; i<lut->lut.size(); ++i)
     {
         lut->lut[i] = powf(lut->lut[i], 2.0f);
@@ -904,79 +1955,321 @@ OIIO_ADD_TEST(Lut3DOp, InverseComparisonCheck)
     OIIO_CHECK_EQUAL( ops[2]->isInverse(ops[3]), true);
 }
 
-
-OIIO_ADD_TEST(Lut3DOp, PerformanceCheck)
+OIIO_ADD_TEST(Lut3DOp, InverseLattice)
 {
-    /*
-    OCIO::Lut3D lut;
-    
-    lut.from_min[0] = 0.0f;
-    lut.from_min[1] = 0.0f;
-    lut.from_min[2] = 0.0f;
-    
-    lut.from_max[0] = 1.0f;
-    lut.from_max[1] = 1.0f;
-    lut.from_max[2] = 1.0f;
-    
-    lut.size[0] = 32;
-    lut.size[1] = 32;
-    lut.size[2] = 32;
+    // A smooth lut with crosstalk, and an output range different from
+    // its input range
+    OCIO::Lut3DRcPtr lut = OCIO::Lut3D::Create();
+    const int edgeLen = 33;
+    for(int i=0; i<3; ++i)
+    {
+        lut->size[i] = edgeLen;
+        lut->from_min[i] = -0.25f;
+        lut->from_max[i] = 1.25f;
+    }
+    lut->lut.resize(edgeLen*edgeLen*edgeLen*3);
+    GenerateIdentityLut3D(&lut->lut[0], edgeLen, 3, OCIO::LUT3DORDER_FAST_RED);
+    const float m[9] = { 0.7f, 0.2f, 0.1f,
+                         0.1f, 0.8f, 0.1f,
+                         0.05f, 0.15f, 0.8f };
+    for(unsigned int i=0; i<lut->lut.size(); i+=3)
+    {
+        float x[3];
+        for(int c=0; c<3; ++c) x[c] = powf(lut->lut[i+c], 1.5f);
+        for(int c=0; c<3; ++c)
+        {
+            lut->lut[i+c] = 2.0f * (m[3*c]*x[0] + m[3*c+1]*x[1] + m[3*c+2]*x[2]);
+        }
+    }
     
-    lut.lut.resize(lut.size[0]*lut.size[1]*lut.size[2]*3);
-    GenerateIdentityLut3D(&lut.lut[0], lut.size[0], 3, OCIO::LUT3DORDER_FAST_RED);
+    OCIO::OpRcPtrVec ops;
+    CreateLut3DOp(ops, lut, OCIO::INTERP_TETRAHEDRAL, OCIO::TRANSFORM_DIR_FORWARD);
+    CreateLut3DOp(ops, lut, OCIO::INTERP_TETRAHEDRAL, OCIO::TRANSFORM_DIR_INVERSE);
+    ops[0]->finalize();
+    ops[1]->finalize();
     
     std::vector<float> img;
-    int xres = 2048;
-    int yres = 1;
-    int channels = 4;
-    img.resize(xres*yres*channels);
-    
-    srand48(0);
-    
-    // create random values from -0.05 to 1.05
-    // (To simulate clipping performance)
+    for(int b=0; b<10; ++b)
+    {
+        for(int g=0; g<10; ++g)
+        {
+            for(int r=0; r<10; ++r)
+            {
+                img.push_back(0.2f + 0.07f * (float)r);
+                img.push_back(0.2f + 0.07f * (float)g);
+                img.push_back(0.2f + 0.07f * (float)b);
+                img.push_back(0.5f);
+            }
+        }
+    }
+    const std::vector<float> src(img);
     
+    ops[0]->apply(&img[0], 1000);
+    ops[1]->apply(&img[0], 1000);
     for(unsigned int i=0; i<img.size(); ++i)
     {
-        float uniform = (float)drand48();
-        img[i] = uniform*1.1f - 0.05f;
+        OIIO_CHECK_CLOSE(img[i], src[i], 1e-3f);
     }
     
-    timeval t;
-    gettimeofday(&t, 0);
-    double starttime = (double) t.tv_sec + (double) t.tv_usec / 1000000.0;
+    // The inverse lattice is computed once per lut
+    OCIO::Lut3DRcPtr inverse = OCIO::GetInverseLut3D(lut);
+    OIIO_CHECK_ASSERT(OCIO::GetInverseLut3D(lut) == inverse);
+    OCIO::ClearAllCaches();
+    OCIO::Lut3DRcPtr inverse2 = OCIO::GetInverseLut3D(lut);
+    OIIO_CHECK_ASSERT(inverse2 != inverse);
+    OIIO_CHECK_ASSERT(inverse2->lut == inverse->lut);
     
-    int numloops = 1024;
-    for(int i=0; i<numloops; ++i)
+    // The inverse of an identity is an identity
+    OCIO::Lut3DRcPtr identity = OCIO::Lut3D::Create();
+    for(int i=0; i<3; ++i) identity->size[i] = 5;
+    identity->lut.resize(5*5*5*3);
+    GenerateIdentityLut3D(&identity->lut[0], 5, 3, OCIO::LUT3DORDER_FAST_RED);
+    OCIO::Lut3DRcPtr identityInverse = OCIO::GetInverseLut3D(identity);
+    for(unsigned int i=0; i<identity->lut.size(); ++i)
     {
-        //OCIO::Lut3D_Nearest(&img[0], xres*yres, lut);
-        OCIO::Lut3D_Linear(&img[0], xres*yres, lut);
+        OIIO_CHECK_CLOSE(identityInverse->lut[i], identity->lut[i], 1e-6f);
     }
     
-    gettimeofday(&t, 0);
-    double endtime = (double) t.tv_sec + (double) t.tv_usec / 1000000.0;
-    double totaltime_a = (endtime-starttime)/numloops;
+    // Beyond the cache memory limit, the least recently used lattices
+    // are released (the most recent one is always kept)
+    long entries = 0, hits = 0, misses = 0, evictions = 0;
+    size_t bytes = 0;
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_INVERSE_LUT3D,
+                        entries, bytes, hits, misses, evictions);
+    OIIO_CHECK_EQUAL(entries, 2);
+    OIIO_CHECK_EQUAL(hits, 0);
+    OIIO_CHECK_EQUAL(misses, 2);
+    OIIO_CHECK_ASSERT(bytes > lut->lut.size() * sizeof(float));
     
-    printf("Linear: %0.1f ms  - %0.1f fps\n", totaltime_a*1000.0, 1.0/totaltime_a);
-
+    const size_t oldLimit = OCIO::GetCacheMemoryLimit();
+    OCIO::SetCacheMemoryLimit(1);
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_INVERSE_LUT3D,
+                        entries, bytes, hits, misses, evictions);
+    OIIO_CHECK_EQUAL(entries, 1);
+    OIIO_CHECK_EQUAL(evictions, 1);
+    
+    OCIO::Lut3DRcPtr small = OCIO::Lut3D::Create();
+    for(int i=0; i<3; ++i) small->size[i] = 2;
+    small->lut.resize(2*2*2*3);
+    GenerateIdentityLut3D(&small->lut[0], 2, 3, OCIO::LUT3DORDER_FAST_RED);
+    OCIO::Lut3DRcPtr smallInverse = OCIO::GetInverseLut3D(small);
+    OIIO_CHECK_ASSERT(OCIO::GetInverseLut3D(small) == smallInverse);
+    OIIO_CHECK_ASSERT(OCIO::GetInverseLut3D(identity) != identityInverse);
+    OIIO_CHECK_ASSERT(OCIO::GetInverseLut3D(small) != smallInverse);
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_INVERSE_LUT3D,
+                        entries, bytes, hits, misses, evictions);
+    OIIO_CHECK_EQUAL(entries, 1);
+    OIIO_CHECK_EQUAL(hits, 1);
+    OIIO_CHECK_EQUAL(misses, 5);
+    OIIO_CHECK_EQUAL(evictions, 4);
+    OCIO::SetCacheMemoryLimit(oldLimit);
+    
+    OCIO::Lut3DRcPtr flat = OCIO::Lut3D::Create();
+    flat->size[0] = 1;
+    flat->size[1] = 1;
+    flat->size[2] = 1;
+    flat->lut.resize(3, 0.5f);
+    OIIO_CHECK_THOW(OCIO::GetInverseLut3D(flat), OCIO::Exception);
+}
 
-    // Tetrahedral
-    gettimeofday(&t, 0);
-    starttime = (double) t.tv_sec + (double) t.tv_usec / 1000000.0;
 
-    for(int i=0; i<numloops; ++i)
+OIIO_ADD_TEST(Lut3DOp, SIMDBitExact)
+{
+    OCIO::Lut3DRcPtr lut = OCIO::Lut3D::Create();
+    lut->from_min[0] = -0.1f;
+    lut->from_max[0] = 1.2f;
+    lut->from_max[2] = 2.0f;
+    lut->size[0] = 17;
+    lut->size[1] = 9;
+    lut->size[2] = 5;
+    lut->lut.resize(lut->size[0]*lut->size[1]*lut->size[2]*3);
+    for(unsigned int i=0; i<lut->lut.size(); ++i)
     {
-        OCIO::Lut3D_Tetrahedral(&img[0], xres*yres, lut);
+        lut->lut[i] = (float)((i*7919) % 1000) / 997.0f - 0.1f;
+    }
+    
+    // Not a multiple of any vector width
+    const long numPixels = 203;
+    std::vector<float> source(numPixels*4);
+    for(long i=0; i<numPixels*4; ++i)
+    {
+        source[i] = (float)((i*104729) % 1000) / 800.0f - 0.1f;
+    }
+    // Lattice points, cell edges and diagonals
+    for(long i=0; i<16; ++i)
+    {
+        source[4*i+0] = (float)(i/4) / 4.0f;
+        source[4*i+1] = (float)(i%4) / 8.0f;
+        source[4*i+2] = (float)(i%2) / 2.0f;
+    }
+    source[4*16+0] = source[4*16+1] = source[4*16+2] = 0.3f;
+    source[4*17+1] = std::numeric_limits<float>::quiet_NaN();
+    source[4*18+3] = std::numeric_limits<float>::quiet_NaN();
+    source[4*19+0] = std::numeric_limits<float>::infinity();
+    source[4*20+2] = -std::numeric_limits<float>::infinity();
+    source[4*21+0] = -0.0f;
+    source[4*22+1] = 1e30f;
+    
+    OCIO::SIMDLevel supportedLevel = OCIO::GetSupportedSIMDLevel();
+    OCIO::SIMDLevel originalLevel = OCIO::GetSIMDLevel();
+    
+    const OCIO::Interpolation interps[2] = { OCIO::INTERP_LINEAR,
+                                             OCIO::INTERP_TETRAHEDRAL };
+    for(int interpIndex=0; interpIndex<2; ++interpIndex)
+    {
+        std::vector<float> reference;
+        
+        for(int level=OCIO::SIMD_LEVEL_NONE; level<=supportedLevel; ++level)
+        {
+            OCIO::SetSIMDLevel(static_cast<OCIO::SIMDLevel>(level));
+            
+            OCIO::OpRcPtrVec ops;
+            OCIO::CreateLut3DOp(ops, lut, interps[interpIndex],
+                                OCIO::TRANSFORM_DIR_FORWARD);
+            OCIO::FinalizeOpVec(ops, false);
+            
+            std::vector<float> data(source);
+            ops[0]->apply(&data[0], numPixels);
+            
+            if(level == OCIO::SIMD_LEVEL_NONE)
+            {
+                reference = data;
+            }
+            else
+            {
+                OIIO_CHECK_EQUAL(memcmp(&data[0], &reference[0],
+                                        sizeof(float)*numPixels*4), 0);
+            }
+        }
     }
+    
+    OCIO::SetSIMDLevel(originalLevel);
+}
 
-    gettimeofday(&t, 0);
-    endtime = (double) t.tv_sec + (double) t.tv_usec / 1000000.0;
-    double totaltime_b = (endtime-starttime)/numloops;
+namespace
+{
+    // A 65^3 lattice, which spans several cache blocks
+    OCIO::Lut3DRcPtr CreateLargeLut3D()
+    {
+        OCIO::Lut3DRcPtr lut = OCIO::Lut3D::Create();
+        lut->size[0] = 65;
+        lut->size[1] = 65;
+        lut->size[2] = 65;
+        lut->lut.resize(lut->size[0]*lut->size[1]*lut->size[2]*3);
+        OCIO::GenerateIdentityLut3D(&lut->lut[0], lut->size[0], 3, OCIO::LUT3DORDER_FAST_RED);
+        for(unsigned int i=0; i<lut->lut.size(); ++i)
+        {
+            lut->lut[i] = lut->lut[i] * lut->lut[i];
+        }
+        return lut;
+    }
+    
+    // Random rgba values from -0.05 to 1.05 (to go through the clamping)
+    std::vector<float> CreateClippedPixels(long numPixels)
+    {
+        std::vector<float> pixels(numPixels*4);
+        
+        srand48(0);
+        for(unsigned int i=0; i<pixels.size(); ++i)
+        {
+            float uniform = (float)drand48();
+            pixels[i] = uniform*1.1f - 0.05f;
+        }
+        return pixels;
+    }
+}
 
-    printf("Tetra: %0.1f ms  - %0.1f fps\n", totaltime_b*1000.0, 1.0/totaltime_b);
+OIIO_ADD_TEST(Lut3DOp, LargeLutSIMDLevels)
+{
+    // A large lattice, and values slightly outside of the domain, give
+    // the same results with every kernel.
+    
+    OCIO::Lut3DRcPtr lut = CreateLargeLut3D();
+    
+    const long numPixels = 256*256;
+    const std::vector<float> source = CreateClippedPixels(numPixels);
+    
+    OCIO::SIMDLevel supportedLevel = OCIO::GetSupportedSIMDLevel();
+    OCIO::SIMDLevel originalLevel = OCIO::GetSIMDLevel();
+    
+    const OCIO::Interpolation interps[2] = { OCIO::INTERP_LINEAR,
+                                             OCIO::INTERP_TETRAHEDRAL };
+    for(int interpIndex=0; interpIndex<2; ++interpIndex)
+    {
+        std::vector<float> reference;
+        
+        for(int level=OCIO::SIMD_LEVEL_NONE; level<=supportedLevel; ++level)
+        {
+            OCIO::SetSIMDLevel(static_cast<OCIO::SIMDLevel>(level));
+            
+            OCIO::OpRcPtrVec ops;
+            OCIO::CreateLut3DOp(ops, lut, interps[interpIndex],
+                                OCIO::TRANSFORM_DIR_FORWARD);
+            OCIO::FinalizeOpVec(ops, false);
+            
+            std::vector<float> img(source);
+            ops[0]->apply(&img[0], numPixels);
+            
+            if(level == OCIO::SIMD_LEVEL_NONE)
+            {
+                reference = img;
+            }
+            else
+            {
+                OIIO_CHECK_EQUAL(memcmp(&img[0], &reference[0],
+                                        sizeof(float)*numPixels*4), 0);
+            }
+        }
+    }
+    
+    OCIO::SetSIMDLevel(originalLevel);
+}
 
-    double speed_diff = totaltime_a/totaltime_b;
-    printf("Tetra is %.04f speed of Linear\n", speed_diff);
-    */
+OIIO_ADD_TEST(Lut3DOp, Benchmark)
+{
+    // Prints the throughput of each kernel, so changes in performance
+    // can be tracked. Only run when benchmarks are enabled.
+    if(!OCIO::BenchmarksEnabled()) return;
+    
+    OCIO::Lut3DRcPtr lut = CreateLargeLut3D();
+    
+    const long numPixels = 1024*1024;
+    const std::vector<float> source = CreateClippedPixels(numPixels);
+    
+    OCIO::SIMDLevel supportedLevel = OCIO::GetSupportedSIMDLevel();
+    OCIO::SIMDLevel originalLevel = OCIO::GetSIMDLevel();
+    
+    const OCIO::Interpolation interps[2] = { OCIO::INTERP_LINEAR,
+                                             OCIO::INTERP_TETRAHEDRAL };
+    for(int interpIndex=0; interpIndex<2; ++interpIndex)
+    {
+        for(int level=OCIO::SIMD_LEVEL_NONE; level<=supportedLevel; ++level)
+        {
+            OCIO::SetSIMDLevel(static_cast<OCIO::SIMDLevel>(level));
+            
+            OCIO::OpRcPtrVec ops;
+            OCIO::CreateLut3DOp(ops, lut, interps[interpIndex],
+                                OCIO::TRANSFORM_DIR_FORWARD);
+            OCIO::FinalizeOpVec(ops, false);
+            
+            std::vector<float> img(source);
+            
+            const int numLoops = 4;
+            double startTime = OCIO::GetBenchmarkTime();
+            for(int i=0; i<numLoops; ++i)
+            {
+                ops[0]->apply(&img[0], numPixels);
+            }
+            double totalTime = std::max(OCIO::GetBenchmarkTime() - startTime, 1e-6);
+            
+            printf("Lut3DOp %s %s: %0.1f Mpixels/s\n",
+                   OCIO::InterpolationToString(interps[interpIndex]),
+                   OCIO::SIMDLevelToString(static_cast<OCIO::SIMDLevel>(level)),
+                   (double)numPixels*numLoops/totalTime/1000000.0);
+        }
+    }
+    
+    OCIO::SetSIMDLevel(originalLevel);
 }
+
 #endif // OCIO_UNIT_TEST
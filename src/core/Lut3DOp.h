@@ -55,8 +55,35 @@ OCIO_NAMESPACE_ENTER
         typedef std::vector<float> fv_t;
         fv_t lut;
         
+        // Values borrowed from memory the lut does not own, used instead
+        // of lut when set. This is how a mapped binary lut file is shared
+        // (see FileFormatBinary.cpp). borrowedStorage keeps the memory
+        // alive, and may be shared by several luts.
+        const float * borrowedValues;
+        OCIO_SHARED_PTR<void> borrowedStorage;
+        
+        // The lattice, owned or borrowed
+        const float * getValues() const
+        {
+            if(borrowedValues) return borrowedValues;
+            return lut.empty() ? NULL : &lut[0];
+        }
+        
+        size_t getNumValues() const
+        {
+            if(borrowedValues) return (size_t) size[0] * size[1] * size[2] * 3;
+            return lut.size();
+        }
+        
         std::string getCacheID() const;
         
+        // An estimate of the memory held by the lut (borrowed values are
+        // not counted, they are not the lut's to release)
+        size_t getMemorySize() const
+        {
+            return sizeof(Lut3D) + lut.capacity() * sizeof(float);
+        }
+        
     private:
         Lut3D();
         mutable std::string m_cacheID;
@@ -104,6 +131,23 @@ OCIO_NAMESPACE_ENTER
     
     
     
+    // The lut mapping the output of lut back to its input, over the range
+    // of the lut values (with the same number of lattice points). Each
+    // lattice point is found by iteratively inverting the tetrahedral
+    // interpolation of lut; colors the lut cannot produce map to the
+    // closest match found. The result is cached by lut cacheID, within the
+    // budget of GetCacheMemoryLimit (least recently used lattices first).
+    Lut3DRcPtr GetInverseLut3D(const Lut3DRcPtr & lut);
+    
+    void ClearInverseLut3DCache();
+    
+    void TrimInverseLut3DCache();
+    
+    // The counters reported by GetCacheStats(CACHE_TYPE_INVERSE_LUT3D)
+    void GetInverseLut3DCacheStats(long & entries, size_t & bytes,
+                                   long & hits, long & misses,
+                                   long & evictions);
+    
     void CreateLut3DOp(OpRcPtrVec & ops,
                        Lut3DRcPtr lut,
                        Interpolation interpolation,
@@ -0,0 +1,583 @@
+/*
+Copyright (c) 2003-2010 Sony Pictures Imageworks Inc., et al.
+All Rights Reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Sony Pictures Imageworks nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <set>
+#include <sstream>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "HashUtils.h"
+#include "Logging.h"
+#include "LutCache.h"
+#include "Mutex.h"
+#include "PathUtils.h"
+#include "Platform.h"
+#include "pystring/pystring.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#if !defined(WINDOWS)
+#include <unistd.h>
+#endif
+
+OCIO_NAMESPACE_ENTER
+{
+    namespace
+    {
+        const char * OCIO_LUT_CACHE_DIR_ENVVAR = "OCIO_LUT_CACHE_DIR";
+        
+        // Bump this when the layout of the entries changes, including the
+        // payload written by any format.
+        const unsigned int LUT_CACHE_VERSION = 1;
+        const char LUT_CACHE_MAGIC[8] = { 'O', 'C', 'I', 'O', 'L', 'U', 'T', 'C' };
+        const unsigned int LUT_CACHE_BYTE_ORDER = 0x01020304;
+        
+        // So that a corrupt entry fails cleanly, rather than with a huge
+        // allocation.
+        const unsigned int LUT_CACHE_MAX_ELEMENTS = 1u << 28;
+        
+        // Temporary file names tried before giving up on writing an entry
+        const int LUT_CACHE_MAX_TEMP_FILE_ATTEMPTS = 16;
+        
+        Mutex g_lutCacheLock;
+        std::string g_lutCacheDir;
+        // Every directory returned by GetLutCacheDir, once each, so that
+        // the pointer survives later calls to SetLutCacheDir.
+        std::set<std::string> g_lutCacheDirsReturned;
+        bool g_initialized = false;
+        bool g_lutCacheDirOverride = false;
+        unsigned int g_tempFileCounter = 0;
+        
+        // You must manually acquire the lut cache lock before calling this.
+        // This will set g_lutCacheDir, g_initialized, g_lutCacheDirOverride
+        void InitLutCache()
+        {
+            if(g_initialized) return;
+            
+            g_initialized = true;
+            
+            char* dir = std::getenv(OCIO_LUT_CACHE_DIR_ENVVAR);
+            if(dir)
+            {
+                g_lutCacheDirOverride = true;
+                g_lutCacheDir = dir;
+            }
+        }
+        
+        std::string GetLutCacheDirString()
+        {
+            AutoMutex lock(g_lutCacheLock);
+            InitLutCache();
+            
+            return g_lutCacheDir;
+        }
+        
+        int GetPid()
+        {
+#ifdef WINDOWS
+            return _getpid();
+#else
+            return static_cast<int>(getpid());
+#endif
+        }
+        
+        // Creates an empty file, failing if it already exists, even if
+        // another host created it in a shared (e.g., NFS) directory.
+        bool CreateNewFile(const std::string & path)
+        {
+#ifdef WINDOWS
+            int fd = _open(path.c_str(), _O_CREAT | _O_EXCL | _O_WRONLY | _O_BINARY,
+                           _S_IREAD | _S_IWRITE);
+            if(fd < 0) return false;
+            _close(fd);
+#else
+            int fd = open(path.c_str(), O_CREAT | O_EXCL | O_WRONLY, 0644);
+            if(fd < 0) return false;
+            close(fd);
+#endif
+            return true;
+        }
+        
+        // Replaces an existing file, atomically where the OS allows it.
+        bool RenameFile(const std::string & from, const std::string & to)
+        {
+#ifdef WINDOWS
+            return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+            return std::rename(from.c_str(), to.c_str()) == 0;
+#endif
+        }
+        
+        void WriteUInt(std::ostream & ostream, unsigned int value)
+        {
+            ostream.write(reinterpret_cast<const char *>(&value), sizeof(value));
+        }
+        
+        unsigned int ReadUInt(std::istream & istream)
+        {
+            unsigned int value = 0;
+            istream.read(reinterpret_cast<char *>(&value), sizeof(value));
+            if(!istream)
+            {
+                throw Exception("Truncated lut cache entry.");
+            }
+            return value;
+        }
+        
+        void WriteFloats(std::ostream & ostream, const float * values, unsigned int count)
+        {
+            if(count == 0) return;
+            ostream.write(reinterpret_cast<const char *>(values),
+                          static_cast<std::streamsize>(count*sizeof(float)));
+        }
+        
+        void ReadFloats(std::istream & istream, float * values, unsigned int count)
+        {
+            if(count == 0) return;
+            istream.read(reinterpret_cast<char *>(values),
+                         static_cast<std::streamsize>(count*sizeof(float)));
+            if(!istream)
+            {
+                throw Exception("Truncated lut cache entry.");
+            }
+        }
+        
+        void WriteFloatVec(std::ostream & ostream, const std::vector<float> & values)
+        {
+            WriteUInt(ostream, static_cast<unsigned int>(values.size()));
+            if(!values.empty())
+            {
+                WriteFloats(ostream, &values[0], static_cast<unsigned int>(values.size()));
+            }
+        }
+        
+        void ReadFloatVec(std::istream & istream, std::vector<float> & values)
+        {
+            unsigned int size = ReadUInt(istream);
+            if(size > LUT_CACHE_MAX_ELEMENTS)
+            {
+                throw Exception("Invalid array size in lut cache entry.");
+            }
+            
+            values.resize(size);
+            if(size > 0)
+            {
+                ReadFloats(istream, &values[0], size);
+            }
+        }
+    }
+    
+    const char * GetLutCacheDir()
+    {
+        const std::string dir = GetLutCacheDirString();
+        
+        AutoMutex lock(g_lutCacheLock);
+        return g_lutCacheDirsReturned.insert(dir).first->c_str();
+    }
+    
+    void SetLutCacheDir(const char * dir)
+    {
+        AutoMutex lock(g_lutCacheLock);
+        InitLutCache();
+        
+        // As with the logging level, calls to SetLutCacheDir are ignored
+        // if OCIO_LUT_CACHE_DIR is specified.
+        
+        if(!g_lutCacheDirOverride)
+        {
+            g_lutCacheDir = dir ? dir : "";
+        }
+    }
+    
+    std::string GetLutCacheEntryPath(const std::string & filepath)
+    {
+        std::string dir = GetLutCacheDirString();
+        if(dir.empty()) return "";
+        
+        std::string filehash = GetFastFileHash(filepath);
+        if(filehash.empty()) return "";
+        
+        std::string key = filepath + "\n" + filehash;
+        std::string name = CacheIDHash(key.c_str(), static_cast<int>(key.size()));
+        
+        // Without the leading '$' of the printable hash
+        return pystring::os::path::join(dir, name.substr(1) + ".ociolut");
+    }
+    
+    bool ReadLutCacheEntry(FileFormat * & format,
+                           CachedFileRcPtr & cachedFile,
+                           const std::string & filepath)
+    {
+        std::string entryPath = GetLutCacheEntryPath(filepath);
+        if(entryPath.empty()) return false;
+        
+        std::ifstream istream(entryPath.c_str(), std::ios_base::in | std::ios_base::binary);
+        if(!istream.good()) return false;
+        
+        try
+        {
+            char magic[8];
+            istream.read(magic, 8);
+            if(!istream || memcmp(magic, LUT_CACHE_MAGIC, 8) != 0)
+            {
+                throw Exception("Not a lut cache entry.");
+            }
+            
+            if(ReadUInt(istream) != LUT_CACHE_VERSION ||
+               ReadUInt(istream) != LUT_CACHE_BYTE_ORDER ||
+               ReadLutCacheString(istream) != OCIO_VERSION)
+            {
+                throw Exception("Written by another library version or platform.");
+            }
+            
+            std::string formatName = ReadLutCacheString(istream);
+            
+            if(ReadLutCacheString(istream) != filepath ||
+               ReadLutCacheString(istream) != GetFastFileHash(filepath))
+            {
+                throw Exception("Written for another file.");
+            }
+            
+            FileFormat * entryFormat =
+                FormatRegistry::GetInstance().getFileFormatByName(formatName);
+            if(!entryFormat)
+            {
+                std::ostringstream os;
+                os << "Unknown format " << formatName << ".";
+                throw Exception(os.str().c_str());
+            }
+            
+            CachedFileRcPtr entryFile = entryFormat->ReadCache(istream);
+            if(istream.peek() != std::char_traits<char>::eof())
+            {
+                throw Exception("Unexpected data at the end of the entry.");
+            }
+            
+            format = entryFormat;
+            cachedFile = entryFile;
+        }
+        catch(std::exception & e)
+        {
+            if(IsDebugLoggingEnabled())
+            {
+                std::ostringstream os;
+                os << "    Ignored lut cache entry " << entryPath;
+                os << ":  " << e.what();
+                LogDebug(os.str());
+            }
+            return false;
+        }
+        
+        if(IsDebugLoggingEnabled())
+        {
+            std::ostringstream os;
+            os << "    Loaded lut cache entry " << entryPath;
+            LogDebug(os.str());
+        }
+        
+        return true;
+    }
+    
+    void WriteLutCacheEntry(const FileFormat * format,
+                            const CachedFileRcPtr & cachedFile,
+                            const std::string & filepath)
+    {
+        if(!format || !cachedFile) return;
+        
+        std::string entryPath = GetLutCacheEntryPath(filepath);
+        if(entryPath.empty()) return;
+        
+        std::ostringstream payload;
+        try
+        {
+            if(!format->WriteCache(payload, cachedFile)) return;
+        }
+        catch(std::exception & e)
+        {
+            std::ostringstream os;
+            os << "Could not write the lut cache entry for " << filepath;
+            os << ":  " << e.what();
+            LogWarning(os.str());
+            return;
+        }
+        
+        // Readers never see a partial entry, as it is only renamed to its
+        // final name once complete. Several processes may write the same
+        // entry, the last one wins. Processes on other hosts sharing the
+        // directory may have the same pid, so the temporary file is created
+        // exclusively, under another name if it is taken.
+        
+        std::string tempPath;
+        bool created = false;
+        for(int attempt=0; attempt<LUT_CACHE_MAX_TEMP_FILE_ATTEMPTS && !created; ++attempt)
+        {
+            std::ostringstream os;
+            {
+                AutoMutex lock(g_lutCacheLock);
+                os << entryPath << ".tmp" << GetPid() << "_" << g_tempFileCounter++;
+            }
+            tempPath = os.str();
+            created = CreateNewFile(tempPath);
+        }
+        
+        bool written = false;
+        if(created)
+        {
+            std::ofstream ostream(tempPath.c_str(),
+                std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+            if(ostream.good())
+            {
+                ostream.write(LUT_CACHE_MAGIC, 8);
+                WriteUInt(ostream, LUT_CACHE_VERSION);
+                WriteUInt(ostream, LUT_CACHE_BYTE_ORDER);
+                WriteLutCacheString(ostream, OCIO_VERSION);
+                WriteLutCacheString(ostream, format->getName());
+                WriteLutCacheString(ostream, filepath);
+                WriteLutCacheString(ostream, GetFastFileHash(filepath));
+                
+                std::string data = payload.str();
+                ostream.write(data.data(), static_cast<std::streamsize>(data.size()));
+                
+                ostream.close();
+                written = !ostream.fail();
+            }
+        }
+        
+        if(!written || !RenameFile(tempPath, entryPath))
+        {
+            if(created) std::remove(tempPath.c_str());
+            
+            std::ostringstream os;
+            os << "Could not write the lut cache entry " << entryPath;
+            os << " for " << filepath << ".";
+            LogWarning(os.str());
+            return;
+        }
+        
+        if(IsDebugLoggingEnabled())
+        {
+            std::ostringstream os;
+            os << "    Wrote lut cache entry " << entryPath;
+            LogDebug(os.str());
+        }
+    }
+    
+    void WriteLutCacheBool(std::ostream & ostream, bool value)
+    {
+        char c = value ? 1 : 0;
+        ostream.write(&c, 1);
+    }
+    
+    bool ReadLutCacheBool(std::istream & istream)
+    {
+        char c = 0;
+        istream.read(&c, 1);
+        if(!istream || (c != 0 && c != 1))
+        {
+            throw Exception("Invalid bool in lut cache entry.");
+        }
+        return c == 1;
+    }
+    
+    void WriteLutCacheString(std::ostream & ostream, const std::string & value)
+    {
+        WriteUInt(ostream, static_cast<unsigned int>(value.size()));
+        ostream.write(value.data(), static_cast<std::streamsize>(value.size()));
+    }
+    
+    std::string ReadLutCacheString(std::istream & istream)
+    {
+        unsigned int size = ReadUInt(istream);
+        if(size > LUT_CACHE_MAX_ELEMENTS)
+        {
+            throw Exception("Invalid string size in lut cache entry.");
+        }
+        
+        std::string value(size, '\0');
+        if(size > 0)
+        {
+            istream.read(&value[0], size);
+            if(!istream)
+            {
+                throw Exception("Truncated lut cache entry.");
+            }
+        }
+        return value;
+    }
+    
+    void WriteLutCacheLut1D(std::ostream & ostream, const Lut1DRcPtr & lut)
+    {
+        WriteFloats(ostream, &lut->maxerror, 1);
+        WriteUInt(ostream, static_cast<unsigned int>(lut->errortype));
+        WriteFloats(ostream, lut->from_min, 3);
+        WriteFloats(ostream, lut->from_max, 3);
+        for(int i=0; i<3; ++i)
+        {
+            WriteFloatVec(ostream, lut->luts[i]);
+        }
+    }
+    
+    Lut1DRcPtr ReadLutCacheLut1D(std::istream & istream)
+    {
+        Lut1DRcPtr lut = Lut1D::Create();
+        
+        ReadFloats(istream, &lut->maxerror, 1);
+        
+        unsigned int errortype = ReadUInt(istream);
+        if(errortype != ERROR_ABSOLUTE && errortype != ERROR_RELATIVE)
+        {
+            throw Exception("Invalid Lut1D error type in lut cache entry.");
+        }
+        lut->errortype = static_cast<ErrorType>(errortype);
+        
+        ReadFloats(istream, lut->from_min, 3);
+        ReadFloats(istream, lut->from_max, 3);
+        for(int i=0; i<3; ++i)
+        {
+            ReadFloatVec(istream, lut->luts[i]);
+        }
+        
+        return lut;
+    }
+    
+    void WriteLutCacheLut3D(std::ostream & ostream, const Lut3DRcPtr & lut)
+    {
+        WriteFloats(ostream, lut->from_min, 3);
+        WriteFloats(ostream, lut->from_max, 3);
+        for(int i=0; i<3; ++i)
+        {
+            WriteUInt(ostream, static_cast<unsigned int>(lut->size[i]));
+        }
+        WriteFloatVec(ostream, lut->lut);
+    }
+    
+    Lut3DRcPtr ReadLutCacheLut3D(std::istream & istream)
+    {
+        Lut3DRcPtr lut = Lut3D::Create();
+        
+        ReadFloats(istream, lut->from_min, 3);
+        ReadFloats(istream, lut->from_max, 3);
+        
+        unsigned int numValues = 3;
+        for(int i=0; i<3; ++i)
+        {
+            unsigned int size = ReadUInt(istream);
+            if(size == 0 || numValues > LUT_CACHE_MAX_ELEMENTS / size)
+            {
+                throw Exception("Invalid Lut3D size in lut cache entry.");
+            }
+            lut->size[i] = static_cast<int>(size);
+            numValues *= size;
+        }
+        
+        ReadFloatVec(istream, lut->lut);
+        if(numValues != lut->lut.size())
+        {
+            throw Exception("Invalid Lut3D size in lut cache entry.");
+        }
+        
+        return lut;
+    }
+}
+OCIO_NAMESPACE_EXIT
+
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef OCIO_UNIT_TEST
+
+namespace OCIO = OCIO_NAMESPACE;
+#include "UnitTest.h"
+
+OIIO_ADD_TEST(LutCache, ReadWrite)
+{
+    OCIO::TempDirectory dir("lutcache");
+    const std::string lutPath = dir.writeFile("test.cube",
+        "LUT_3D_SIZE 2\n"
+        "0.0 0.1 0.0\n" "1.0 0.0 0.0\n"
+        "0.0 1.0 0.2\n" "0.9 1.0 0.0\n"
+        "0.0 0.0 1.0\n" "1.0 0.3 1.0\n"
+        "0.1 1.0 1.0\n" "1.0 1.0 0.8\n");
+    
+    const char * oldDirPtr = OCIO::GetLutCacheDir();
+    const std::string oldDir = oldDirPtr;
+    OCIO::SetLutCacheDir(dir.getPath().c_str());
+    // Setting another directory leaves the one returned before valid
+    OIIO_CHECK_EQUAL(std::string(oldDirPtr), oldDir);
+    OCIO::ClearAllCaches();
+    
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    OCIO::FileTransformRcPtr transform = OCIO::CreateFileTransform(lutPath);
+    
+    float parsed[3] = { 0.25f, 0.5f, 0.75f };
+    config->getProcessor(transform)->applyRGB(parsed);
+    
+    // The first load wrote the entry
+    const std::string entryPath = OCIO::GetLutCacheEntryPath(lutPath);
+    OIIO_CHECK_ASSERT(!entryPath.empty());
+    
+    OCIO::FileFormat * format = NULL;
+    OCIO::CachedFileRcPtr cachedFile;
+    OIIO_CHECK_ASSERT(OCIO::ReadLutCacheEntry(format, cachedFile, lutPath));
+    OIIO_CHECK_ASSERT(format && format->getName() == "iridas_cube");
+    
+    // Loading the entry gives the same result as parsing the file
+    OCIO::ClearAllCaches();
+    float cached[3] = { 0.25f, 0.5f, 0.75f };
+    config->getProcessor(transform)->applyRGB(cached);
+    for(int i=0; i<3; ++i)
+    {
+        OIIO_CHECK_EQUAL(cached[i], parsed[i]);
+    }
+    
+    // A corrupt entry is ignored, and replaced
+    {
+        std::ofstream entryFile(entryPath.c_str(),
+            std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        entryFile << "OCIOLUTC";
+    }
+    OIIO_CHECK_ASSERT(!OCIO::ReadLutCacheEntry(format, cachedFile, lutPath));
+    
+    OCIO::ClearAllCaches();
+    float reparsed[3] = { 0.25f, 0.5f, 0.75f };
+    config->getProcessor(transform)->applyRGB(reparsed);
+    for(int i=0; i<3; ++i)
+    {
+        OIIO_CHECK_EQUAL(reparsed[i], parsed[i]);
+    }
+    OIIO_CHECK_ASSERT(OCIO::ReadLutCacheEntry(format, cachedFile, lutPath));
+    
+    OCIO::SetLutCacheDir(oldDir.c_str());
+    OCIO::ClearAllCaches();
+    OIIO_CHECK_ASSERT(!OCIO::ReadLutCacheEntry(format, cachedFile, lutPath));
+}
+
+#endif // OCIO_UNIT_TEST
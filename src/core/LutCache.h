@@ -0,0 +1,91 @@
+/*
+Copyright (c) 2003-2010 Sony Pictures Imageworks Inc., et al.
+All Rights Reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Sony Pictures Imageworks nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef INCLUDED_OCIO_LUTCACHE_H
+#define INCLUDED_OCIO_LUTCACHE_H
+
+#include <iosfwd>
+#include <string>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "FileTransform.h"
+#include "Lut1DOp.h"
+#include "Lut3DOp.h"
+
+OCIO_NAMESPACE_ENTER
+{
+    // The persistent lut cache stores the parsed CachedFile of lut files
+    // in a binary form, in the directory returned by GetLutCacheDir. All
+    // the processes using the same directory (e.g., the tasks of a render
+    // farm job) share the entries, so only the first one parses the
+    // source file.
+    //
+    // Entries are keyed by the path and fast hash (inode, mtime) of the
+    // source file, so editing the file invalidates its entry. They are
+    // written to a temporary file then renamed, so concurrent readers and
+    // writers of the same entry never see a partial file.
+    
+    // The path of the entry for a source file, or an empty string if the
+    // cache is disabled or the file does not exist.
+    std::string GetLutCacheEntryPath(const std::string & filepath);
+    
+    // Returns false if the cache is disabled, or the entry is missing or
+    // cannot be read (e.g., it was written by another library version).
+    bool ReadLutCacheEntry(FileFormat * & format,
+                           CachedFileRcPtr & cachedFile,
+                           const std::string & filepath);
+    
+    // Does nothing if the cache is disabled, or the format does not
+    // support it (see FileFormat::WriteCache). The cache is only an
+    // optimization, so failures are logged rather than thrown.
+    void WriteLutCacheEntry(const FileFormat * format,
+                            const CachedFileRcPtr & cachedFile,
+                            const std::string & filepath);
+    
+    // Helpers for FileFormat::WriteCache / ReadCache. The values are
+    // stored in the native byte order (entries record it, and are ignored
+    // on a machine with another one). The readers throw an Exception on
+    // truncated or invalid data.
+    
+    void WriteLutCacheBool(std::ostream & ostream, bool value);
+    bool ReadLutCacheBool(std::istream & istream);
+    
+    void WriteLutCacheString(std::ostream & ostream, const std::string & value);
+    std::string ReadLutCacheString(std::istream & istream);
+    
+    void WriteLutCacheLut1D(std::ostream & ostream, const Lut1DRcPtr & lut);
+    Lut1DRcPtr ReadLutCacheLut1D(std::istream & istream);
+    
+    void WriteLutCacheLut3D(std::ostream & ostream, const Lut3DRcPtr & lut);
+    Lut3DRcPtr ReadLutCacheLut3D(std::istream & istream);
+}
+OCIO_NAMESPACE_EXIT
+
+#endif
@@ -28,10 +28,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "CPUInfo.h"
 #include "GpuShaderUtils.h"
 #include "HashUtils.h"
+#include "LogOps.h"
 #include "MatrixOps.h"
 #include "MathUtils.h"
+#include "SSE.h"
 
 #include <cstring>
 #include <sstream>
@@ -40,52 +43,379 @@ OCIO_NAMESPACE_ENTER
 {
     namespace
     {
-        void ApplyScale(float* rgbaBuffer, long numPixels,
-                        const float* scale4)
+        // The affine kernels below cover everything a MatrixOffsetOp does,
+        // in a single pass over the pixels:
+        //
+        //   x = x + preOffset4      (if PRE)
+        //   x = diag(m44) * x       (if MODE == AFFINE_SCALE)
+        //   x = m44 * x             (if MODE == AFFINE_MATRIX)
+        //   x = x + postOffset4     (if POST)
+        //
+        // ApplyAffine is the scalar reference. The SIMD versions perform
+        // the exact same float operations in the same order (matrices are
+        // transposed to SoA internally, 4 pixels per 128 bits), so their
+        // results are bit-identical to it.
+        
+        enum AffineMode
         {
+            AFFINE_NONE = 0,
+            AFFINE_SCALE,
+            AFFINE_MATRIX
+        };
+        
+        typedef void (*AffineKernel)(float* rgbaBuffer, long numPixels,
+                                     const float* preOffset4,
+                                     const float* m44,
+                                     const float* postOffset4);
+        
+        template<int MODE, bool PRE, bool POST>
+        void ApplyAffine(float* rgbaBuffer, long numPixels,
+                         const float* preOffset4,
+                         const float* m44,
+                         const float* postOffset4)
+        {
+            float r,g,b,a;
+            
             for(long pixelIndex=0; pixelIndex<numPixels; ++pixelIndex)
             {
-                rgbaBuffer[0] *= scale4[0];
-                rgbaBuffer[1] *= scale4[1];
-                rgbaBuffer[2] *= scale4[2];
-                rgbaBuffer[3] *= scale4[3];
+                r = rgbaBuffer[0];
+                g = rgbaBuffer[1];
+                b = rgbaBuffer[2];
+                a = rgbaBuffer[3];
+                
+                if(PRE)
+                {
+                    r += preOffset4[0];
+                    g += preOffset4[1];
+                    b += preOffset4[2];
+                    a += preOffset4[3];
+                }
+                
+                if(MODE == AFFINE_SCALE)
+                {
+                    r *= m44[0];
+                    g *= m44[5];
+                    b *= m44[10];
+                    a *= m44[15];
+                }
+                else if(MODE == AFFINE_MATRIX)
+                {
+                    float r2 = r*m44[0] + g*m44[1] + b*m44[2] + a*m44[3];
+                    float g2 = r*m44[4] + g*m44[5] + b*m44[6] + a*m44[7];
+                    float b2 = r*m44[8] + g*m44[9] + b*m44[10] + a*m44[11];
+                    float a2 = r*m44[12] + g*m44[13] + b*m44[14] + a*m44[15];
+                    r = r2;
+                    g = g2;
+                    b = b2;
+                    a = a2;
+                }
+                
+                if(POST)
+                {
+                    r += postOffset4[0];
+                    g += postOffset4[1];
+                    b += postOffset4[2];
+                    a += postOffset4[3];
+                }
+                
+                rgbaBuffer[0] = r;
+                rgbaBuffer[1] = g;
+                rgbaBuffer[2] = b;
+                rgbaBuffer[3] = a;
                 
                 rgbaBuffer += 4;
             }
         }
         
-        void ApplyOffset(float* rgbaBuffer, long numPixels,
-                         const float* offset4)
+#ifdef USE_SSE
+        template<int MODE, bool PRE, bool POST>
+        void ApplyAffine_SSE2(float* rgbaBuffer, long numPixels,
+                              const float* preOffset4,
+                              const float* m44,
+                              const float* postOffset4)
         {
-            for(long pixelIndex=0; pixelIndex<numPixels; ++pixelIndex)
+            const __m128 pre = PRE ? _mm_loadu_ps(preOffset4) : _mm_setzero_ps();
+            const __m128 post = POST ? _mm_loadu_ps(postOffset4) : _mm_setzero_ps();
+            const __m128 scale = _mm_setr_ps(m44[0], m44[5], m44[10], m44[15]);
+            __m128 m[16];
+            for(int i=0; i<16; ++i) m[i] = _mm_set1_ps(m44[i]);
+            
+            long pixelIndex = 0;
+            for(; pixelIndex+4<=numPixels; pixelIndex+=4)
             {
-                rgbaBuffer[0] += offset4[0];
-                rgbaBuffer[1] += offset4[1];
-                rgbaBuffer[2] += offset4[2];
-                rgbaBuffer[3] += offset4[3];
+                __m128 p0 = _mm_loadu_ps(rgbaBuffer);
+                __m128 p1 = _mm_loadu_ps(rgbaBuffer+4);
+                __m128 p2 = _mm_loadu_ps(rgbaBuffer+8);
+                __m128 p3 = _mm_loadu_ps(rgbaBuffer+12);
                 
-                rgbaBuffer += 4;
+                if(PRE)
+                {
+                    p0 = _mm_add_ps(p0, pre);
+                    p1 = _mm_add_ps(p1, pre);
+                    p2 = _mm_add_ps(p2, pre);
+                    p3 = _mm_add_ps(p3, pre);
+                }
+                
+                if(MODE == AFFINE_SCALE)
+                {
+                    p0 = _mm_mul_ps(p0, scale);
+                    p1 = _mm_mul_ps(p1, scale);
+                    p2 = _mm_mul_ps(p2, scale);
+                    p3 = _mm_mul_ps(p3, scale);
+                }
+                else if(MODE == AFFINE_MATRIX)
+                {
+                    // p0..p3 become rrrr, gggg, bbbb, aaaa
+                    _MM_TRANSPOSE4_PS(p0, p1, p2, p3);
+                    
+                    __m128 r = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+                        _mm_mul_ps(p0, m[0]), _mm_mul_ps(p1, m[1])),
+                        _mm_mul_ps(p2, m[2])), _mm_mul_ps(p3, m[3]));
+                    __m128 g = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+                        _mm_mul_ps(p0, m[4]), _mm_mul_ps(p1, m[5])),
+                        _mm_mul_ps(p2, m[6])), _mm_mul_ps(p3, m[7]));
+                    __m128 b = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+                        _mm_mul_ps(p0, m[8]), _mm_mul_ps(p1, m[9])),
+                        _mm_mul_ps(p2, m[10])), _mm_mul_ps(p3, m[11]));
+                    __m128 a = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+                        _mm_mul_ps(p0, m[12]), _mm_mul_ps(p1, m[13])),
+                        _mm_mul_ps(p2, m[14])), _mm_mul_ps(p3, m[15]));
+                    
+                    _MM_TRANSPOSE4_PS(r, g, b, a);
+                    p0 = r;
+                    p1 = g;
+                    p2 = b;
+                    p3 = a;
+                }
+                
+                if(POST)
+                {
+                    p0 = _mm_add_ps(p0, post);
+                    p1 = _mm_add_ps(p1, post);
+                    p2 = _mm_add_ps(p2, post);
+                    p3 = _mm_add_ps(p3, post);
+                }
+                
+                _mm_storeu_ps(rgbaBuffer, p0);
+                _mm_storeu_ps(rgbaBuffer+4, p1);
+                _mm_storeu_ps(rgbaBuffer+8, p2);
+                _mm_storeu_ps(rgbaBuffer+12, p3);
+                
+                rgbaBuffer += 16;
             }
+            
+            ApplyAffine<MODE, PRE, POST>(rgbaBuffer, numPixels-pixelIndex,
+                                         preOffset4, m44, postOffset4);
         }
+#endif // USE_SSE
         
-        void ApplyMatrix(float* rgbaBuffer, long numPixels,
-                         const float* mat44)
+#ifdef OCIO_USE_AVX
+        OCIO_TARGET_AVX2
+        inline __m256 Broadcast4_AVX2(__m128 v)
         {
-            float r,g,b,a;
+            return _mm256_insertf128_ps(_mm256_castps128_ps256(v), v, 1);
+        }
+        
+        template<int MODE, bool PRE, bool POST>
+        OCIO_TARGET_AVX2
+        void ApplyAffine_AVX2(float* rgbaBuffer, long numPixels,
+                              const float* preOffset4,
+                              const float* m44,
+                              const float* postOffset4)
+        {
+            const __m256 pre = PRE ? Broadcast4_AVX2(_mm_loadu_ps(preOffset4)) : _mm256_setzero_ps();
+            const __m256 post = POST ? Broadcast4_AVX2(_mm_loadu_ps(postOffset4)) : _mm256_setzero_ps();
+            const __m256 scale = Broadcast4_AVX2(_mm_setr_ps(m44[0], m44[5], m44[10], m44[15]));
+            __m256 m[16];
+            for(int i=0; i<16; ++i) m[i] = _mm256_set1_ps(m44[i]);
             
-            for(long pixelIndex=0; pixelIndex<numPixels; ++pixelIndex)
+            long pixelIndex = 0;
+            for(; pixelIndex+8<=numPixels; pixelIndex+=8)
             {
-                r = rgbaBuffer[0];
-                g = rgbaBuffer[1];
-                b = rgbaBuffer[2];
-                a = rgbaBuffer[3];
+                __m256 p0 = _mm256_loadu_ps(rgbaBuffer);
+                __m256 p1 = _mm256_loadu_ps(rgbaBuffer+8);
+                __m256 p2 = _mm256_loadu_ps(rgbaBuffer+16);
+                __m256 p3 = _mm256_loadu_ps(rgbaBuffer+24);
                 
-                rgbaBuffer[0] = r*mat44[0] + g*mat44[1] + b*mat44[2] + a*mat44[3];
-                rgbaBuffer[1] = r*mat44[4] + g*mat44[5] + b*mat44[6] + a*mat44[7];
-                rgbaBuffer[2] = r*mat44[8] + g*mat44[9] + b*mat44[10] + a*mat44[11];
-                rgbaBuffer[3] = r*mat44[12] + g*mat44[13] + b*mat44[14] + a*mat44[15];
+                if(PRE)
+                {
+                    p0 = _mm256_add_ps(p0, pre);
+                    p1 = _mm256_add_ps(p1, pre);
+                    p2 = _mm256_add_ps(p2, pre);
+                    p3 = _mm256_add_ps(p3, pre);
+                }
                 
-                rgbaBuffer += 4;
+                if(MODE == AFFINE_SCALE)
+                {
+                    p0 = _mm256_mul_ps(p0, scale);
+                    p1 = _mm256_mul_ps(p1, scale);
+                    p2 = _mm256_mul_ps(p2, scale);
+                    p3 = _mm256_mul_ps(p3, scale);
+                }
+                else if(MODE == AFFINE_MATRIX)
+                {
+                    Transpose4_AVX2(p0, p1, p2, p3);
+                    
+                    __m256 r = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(
+                        _mm256_mul_ps(p0, m[0]), _mm256_mul_ps(p1, m[1])),
+                        _mm256_mul_ps(p2, m[2])), _mm256_mul_ps(p3, m[3]));
+                    __m256 g = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(
+                        _mm256_mul_ps(p0, m[4]), _mm256_mul_ps(p1, m[5])),
+                        _mm256_mul_ps(p2, m[6])), _mm256_mul_ps(p3, m[7]));
+                    __m256 b = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(
+                        _mm256_mul_ps(p0, m[8]), _mm256_mul_ps(p1, m[9])),
+                        _mm256_mul_ps(p2, m[10])), _mm256_mul_ps(p3, m[11]));
+                    __m256 a = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(
+                        _mm256_mul_ps(p0, m[12]), _mm256_mul_ps(p1, m[13])),
+                        _mm256_mul_ps(p2, m[14])), _mm256_mul_ps(p3, m[15]));
+                    
+                    Transpose4_AVX2(r, g, b, a);
+                    p0 = r;
+                    p1 = g;
+                    p2 = b;
+                    p3 = a;
+                }
+                
+                if(POST)
+                {
+                    p0 = _mm256_add_ps(p0, post);
+                    p1 = _mm256_add_ps(p1, post);
+                    p2 = _mm256_add_ps(p2, post);
+                    p3 = _mm256_add_ps(p3, post);
+                }
+                
+                _mm256_storeu_ps(rgbaBuffer, p0);
+                _mm256_storeu_ps(rgbaBuffer+8, p1);
+                _mm256_storeu_ps(rgbaBuffer+16, p2);
+                _mm256_storeu_ps(rgbaBuffer+24, p3);
+                
+                rgbaBuffer += 32;
+            }
+            
+            ApplyAffine<MODE, PRE, POST>(rgbaBuffer, numPixels-pixelIndex,
+                                         preOffset4, m44, postOffset4);
+        }
+        
+        template<int MODE, bool PRE, bool POST>
+        OCIO_TARGET_AVX512
+        void ApplyAffine_AVX512(float* rgbaBuffer, long numPixels,
+                                const float* preOffset4,
+                                const float* m44,
+                                const float* postOffset4)
+        {
+            const __m512 pre = PRE ? _mm512_maskz_broadcast_f32x4(0xFFFF, _mm_loadu_ps(preOffset4)) : _mm512_setzero_ps();
+            const __m512 post = POST ? _mm512_maskz_broadcast_f32x4(0xFFFF, _mm_loadu_ps(postOffset4)) : _mm512_setzero_ps();
+            const __m512 scale = _mm512_maskz_broadcast_f32x4(0xFFFF, _mm_setr_ps(m44[0], m44[5], m44[10], m44[15]));
+            __m512 m[16];
+            for(int i=0; i<16; ++i) m[i] = _mm512_set1_ps(m44[i]);
+            
+            long pixelIndex = 0;
+            for(; pixelIndex+16<=numPixels; pixelIndex+=16)
+            {
+                __m512 p0 = _mm512_loadu_ps(rgbaBuffer);
+                __m512 p1 = _mm512_loadu_ps(rgbaBuffer+16);
+                __m512 p2 = _mm512_loadu_ps(rgbaBuffer+32);
+                __m512 p3 = _mm512_loadu_ps(rgbaBuffer+48);
+                
+                if(PRE)
+                {
+                    p0 = _mm512_add_ps(p0, pre);
+                    p1 = _mm512_add_ps(p1, pre);
+                    p2 = _mm512_add_ps(p2, pre);
+                    p3 = _mm512_add_ps(p3, pre);
+                }
+                
+                if(MODE == AFFINE_SCALE)
+                {
+                    p0 = _mm512_mul_ps(p0, scale);
+                    p1 = _mm512_mul_ps(p1, scale);
+                    p2 = _mm512_mul_ps(p2, scale);
+                    p3 = _mm512_mul_ps(p3, scale);
+                }
+                else if(MODE == AFFINE_MATRIX)
+                {
+                    Transpose4_AVX512(p0, p1, p2, p3);
+                    
+                    __m512 r = _mm512_add_ps(_mm512_add_ps(_mm512_add_ps(
+                        _mm512_mul_ps(p0, m[0]), _mm512_mul_ps(p1, m[1])),
+                        _mm512_mul_ps(p2, m[2])), _mm512_mul_ps(p3, m[3]));
+                    __m512 g = _mm512_add_ps(_mm512_add_ps(_mm512_add_ps(
+                        _mm512_mul_ps(p0, m[4]), _mm512_mul_ps(p1, m[5])),
+                        _mm512_mul_ps(p2, m[6])), _mm512_mul_ps(p3, m[7]));
+                    __m512 b = _mm512_add_ps(_mm512_add_ps(_mm512_add_ps(
+                        _mm512_mul_ps(p0, m[8]), _mm512_mul_ps(p1, m[9])),
+                        _mm512_mul_ps(p2, m[10])), _mm512_mul_ps(p3, m[11]));
+                    __m512 a = _mm512_add_ps(_mm512_add_ps(_mm512_add_ps(
+                        _mm512_mul_ps(p0, m[12]), _mm512_mul_ps(p1, m[13])),
+                        _mm512_mul_ps(p2, m[14])), _mm512_mul_ps(p3, m[15]));
+                    
+                    Transpose4_AVX512(r, g, b, a);
+                    p0 = r;
+                    p1 = g;
+                    p2 = b;
+                    p3 = a;
+                }
+                
+                if(POST)
+                {
+                    p0 = _mm512_add_ps(p0, post);
+                    p1 = _mm512_add_ps(p1, post);
+                    p2 = _mm512_add_ps(p2, post);
+                    p3 = _mm512_add_ps(p3, post);
+                }
+                
+                _mm512_storeu_ps(rgbaBuffer, p0);
+                _mm512_storeu_ps(rgbaBuffer+16, p1);
+                _mm512_storeu_ps(rgbaBuffer+32, p2);
+                _mm512_storeu_ps(rgbaBuffer+48, p3);
+                
+                rgbaBuffer += 64;
+            }
+            
+            ApplyAffine<MODE, PRE, POST>(rgbaBuffer, numPixels-pixelIndex,
+                                         preOffset4, m44, postOffset4);
+        }
+#endif // OCIO_USE_AVX
+        
+        template<int MODE, bool PRE, bool POST>
+        AffineKernel GetAffineKernel(SIMDLevel level)
+        {
+#ifdef OCIO_USE_AVX
+            if(level >= SIMD_LEVEL_AVX512) return ApplyAffine_AVX512<MODE, PRE, POST>;
+            if(level >= SIMD_LEVEL_AVX2) return ApplyAffine_AVX2<MODE, PRE, POST>;
+#endif
+#ifdef USE_SSE
+            if(level >= SIMD_LEVEL_SSE2) return ApplyAffine_SSE2<MODE, PRE, POST>;
+#endif
+            (void)level;
+            return ApplyAffine<MODE, PRE, POST>;
+        }
+        
+        // Returns NULL if there is nothing to do
+        
+        AffineKernel GetAffineKernel(AffineMode mode, bool pre, bool post,
+                                     SIMDLevel level)
+        {
+            if(mode == AFFINE_NONE)
+            {
+                if(pre && post) return GetAffineKernel<AFFINE_NONE, true, true>(level);
+                if(pre) return GetAffineKernel<AFFINE_NONE, true, false>(level);
+                if(post) return GetAffineKernel<AFFINE_NONE, false, true>(level);
+                return 0;
+            }
+            else if(mode == AFFINE_SCALE)
+            {
+                if(pre && post) return GetAffineKernel<AFFINE_SCALE, true, true>(level);
+                if(pre) return GetAffineKernel<AFFINE_SCALE, true, false>(level);
+                if(post) return GetAffineKernel<AFFINE_SCALE, false, true>(level);
+                return GetAffineKernel<AFFINE_SCALE, false, false>(level);
+            }
+            else
+            {
+                if(pre && post) return GetAffineKernel<AFFINE_MATRIX, true, true>(level);
+                if(pre) return GetAffineKernel<AFFINE_MATRIX, true, false>(level);
+                if(post) return GetAffineKernel<AFFINE_MATRIX, false, true>(level);
+                return GetAffineKernel<AFFINE_MATRIX, false, false>(level);
             }
         }
     }
@@ -134,6 +464,12 @@ OCIO_NAMESPACE_ENTER
             virtual void writeGpuShader(std::ostream & shader,
                                         const std::string & pixelName,
                                         const GpuShaderDesc & shaderDesc) const;
+            virtual void writeGpuShaderUniforms(std::ostream & shader,
+                                                const std::string & pixelName,
+                                                const GpuShaderDesc & shaderDesc,
+                                                GpuUniformVec & uniforms) const;
+            
+            bool getRGBScaleOffset(float * scale3, float * offset3) const;
         
         private:
             bool m_isNoOp;
@@ -147,6 +483,12 @@ OCIO_NAMESPACE_ENTER
             bool m_offset4IsIdentity;
             float m_m44_inv[16];
             std::string m_cacheID;
+            
+            // The kernel for the cpu's instruction set, and its arguments
+            AffineKernel m_kernel;
+            float m_kernelPreOffset4[4];
+            float m_kernelM44[16];
+            float m_kernelPostOffset4[4];
         };
         
         
@@ -160,7 +502,9 @@ OCIO_NAMESPACE_ENTER
                                        m_isNoOp(false),
                                        m_direction(direction),
                                        m_m44IsIdentity(false),
-                                       m_offset4IsIdentity(false)
+                                       m_m44IsDiagonal(false),
+                                       m_offset4IsIdentity(false),
+                                       m_kernel(0)
         {
             if(m_direction == TRANSFORM_DIR_UNKNOWN)
             {
@@ -171,6 +515,9 @@ OCIO_NAMESPACE_ENTER
             memcpy(m_offset4, offset4, 4*sizeof(float));
             
             memset(m_m44_inv, 0, 16*sizeof(float));
+            memset(m_kernelPreOffset4, 0, 4*sizeof(float));
+            memset(m_kernelM44, 0, 16*sizeof(float));
+            memset(m_kernelPostOffset4, 0, 4*sizeof(float));
             
             // This Op will be a NoOp if and old if both the offset and matrix
             // are identity. This hold true no matter what the direction is,
@@ -226,9 +573,17 @@ OCIO_NAMESPACE_ENTER
             return true;
         }
         
+        // A pure rgb scale and offset can also be folded into a following
+        // LogOp (see CombineLogOpWithScaleOffset).
+        
         bool MatrixOffsetOp::canCombineWith(const OpRcPtr & op) const
         {
-            return isSameType(op);
+            if(isSameType(op)) return true;
+            
+            float scale3[3];
+            float offset3[3];
+            return getRGBScaleOffset(scale3, offset3) &&
+                   CanCombineLogOpWithScaleOffset(op, scale3, true);
         }
         
         void MatrixOffsetOp::combineWith(OpRcPtrVec & ops, const OpRcPtr & secondOp) const
@@ -236,9 +591,17 @@ OCIO_NAMESPACE_ENTER
             MatrixOffsetOpRcPtr typedRcPtr = DynamicPtrCast<MatrixOffsetOp>(secondOp);
             if(!typedRcPtr)
             {
+                float scale3[3];
+                float offset3[3];
+                if(getRGBScaleOffset(scale3, offset3) &&
+                   CombineLogOpWithScaleOffset(ops, secondOp, scale3, offset3, true))
+                {
+                    return;
+                }
+                
                 std::ostringstream os;
                 os << "MatrixOffsetOp can only be combined with other ";
-                os << "MatrixOffsetOps.  secondOp:" << secondOp->getInfo();
+                os << "MatrixOffsetOps, or LogOps.  secondOp:" << secondOp->getInfo();
                 throw Exception(os.str().c_str());
             }
             
@@ -346,9 +709,45 @@ OCIO_NAMESPACE_ENTER
                 throw Exception(os.str().c_str());
             }
             
-            CreateMatrixOffsetOp(ops,
-                                 mout, vout,
-                                 TRANSFORM_DIR_FORWARD);
+            if(!IsM44Identity(mout) || !IsVecEqualToZero(vout, 4))
+            {
+                CreateMatrixOffsetOp(ops,
+                                     mout, vout,
+                                     TRANSFORM_DIR_FORWARD);
+            }
+        }
+        
+        // Get the forward rgb scale and offset, if that is all this op
+        // does (no channel crosstalk, alpha untouched).
+        // This is valid prior to finalize.
+        
+        bool MatrixOffsetOp::getRGBScaleOffset(float * scale3, float * offset3) const
+        {
+            if(!IsM44Diagonal(m_m44)) return false;
+            if(m_m44[15] != 1.0f || m_offset4[3] != 0.0f) return false;
+            
+            for(int i=0; i<3; ++i)
+            {
+                float scale = m_m44[5*i];
+                
+                if(m_direction == TRANSFORM_DIR_FORWARD)
+                {
+                    scale3[i] = scale;
+                    offset3[i] = m_offset4[i];
+                }
+                else if(m_direction == TRANSFORM_DIR_INVERSE)
+                {
+                    if(IsScalarEqualToZero(scale)) return false;
+                    scale3[i] = 1.0f / scale;
+                    offset3[i] = -m_offset4[i] / scale;
+                }
+                else
+                {
+                    return false;
+                }
+            }
+            
+            return true;
         }
         
         bool MatrixOffsetOp::hasChannelCrosstalk() const
@@ -375,6 +774,32 @@ OCIO_NAMESPACE_ENTER
                 }
             }
             
+            // Select the kernel. In the forward direction, the offset is
+            // applied after the matrix, in the inverse direction it is
+            // negated, and applied before the inverse matrix.
+            
+            AffineMode mode = AFFINE_MATRIX;
+            if(m_m44IsIdentity) mode = AFFINE_NONE;
+            else if(m_m44IsDiagonal) mode = AFFINE_SCALE;
+            
+            bool pre = false;
+            bool post = false;
+            
+            if(m_direction == TRANSFORM_DIR_FORWARD)
+            {
+                memcpy(m_kernelM44, m_m44, 16*sizeof(float));
+                memcpy(m_kernelPostOffset4, m_offset4, 4*sizeof(float));
+                post = !m_offset4IsIdentity;
+            }
+            else
+            {
+                memcpy(m_kernelM44, m_m44_inv, 16*sizeof(float));
+                for(int i=0; i<4; ++i) m_kernelPreOffset4[i] = -m_offset4[i];
+                pre = !m_offset4IsIdentity;
+            }
+            
+            m_kernel = GetAffineKernel(mode, pre, post, GetSIMDLevel());
+            
             // Create the cacheID
             md5_state_t state;
             md5_byte_t digest[16];
@@ -394,53 +819,10 @@ OCIO_NAMESPACE_ENTER
         
         void MatrixOffsetOp::apply(float* rgbaBuffer, long numPixels) const
         {
-            if(m_direction == TRANSFORM_DIR_FORWARD)
-            {
-                if(!m_m44IsIdentity)
-                {
-                    if(m_m44IsDiagonal)
-                    {
-                        float scale[4];
-                        GetM44Diagonal(scale, m_m44);
-                        ApplyScale(rgbaBuffer, numPixels, scale);
-                    }
-                    else
-                    {
-                        ApplyMatrix(rgbaBuffer, numPixels, m_m44);
-                    }
-                }
-                
-                if(!m_offset4IsIdentity)
-                {
-                    ApplyOffset(rgbaBuffer, numPixels, m_offset4);
-                }
-            }
-            else if(m_direction == TRANSFORM_DIR_INVERSE)
-            {
-                if(!m_offset4IsIdentity)
-                {
-                    float offset_inv[] = { -m_offset4[0],
-                                           -m_offset4[1],
-                                           -m_offset4[2],
-                                           -m_offset4[3] };
-                    
-                    ApplyOffset(rgbaBuffer, numPixels, offset_inv);
-                }
-                
-                if(!m_m44IsIdentity)
-                {
-                    if(m_m44IsDiagonal)
-                    {
-                        float scale[4];
-                        GetM44Diagonal(scale, m_m44_inv);
-                        ApplyScale(rgbaBuffer, numPixels, scale);
-                    }
-                    else
-                    {
-                        ApplyMatrix(rgbaBuffer, numPixels, m_m44_inv);
-                    }
-                }
-            }
+            if(!m_kernel) return;
+            
+            m_kernel(rgbaBuffer, numPixels,
+                     m_kernelPreOffset4, m_kernelM44, m_kernelPostOffset4);
         } // Op::process
         
         bool MatrixOffsetOp::supportsGpuShader() const
@@ -522,6 +904,45 @@ OCIO_NAMESPACE_ENTER
             }
         }
         
+        // The full matrix and offset are always applied, so that the text
+        // does not change when they become diagonal or identity
+        void MatrixOffsetOp::writeGpuShaderUniforms(std::ostream & shader,
+                                                    const std::string & pixelName,
+                                                    const GpuShaderDesc & shaderDesc,
+                                                    GpuUniformVec & uniforms) const
+        {
+            GpuLanguage lang = shaderDesc.getLanguage();
+            
+            if(m_direction == TRANSFORM_DIR_FORWARD)
+            {
+                std::string mtxName = AddGpuUniform(uniforms, shaderDesc, "matrix",
+                                                    GPU_UNIFORM_FLOAT4X4, m_m44);
+                std::string offsetName = AddGpuUniform(uniforms, shaderDesc, "offset",
+                                                       GPU_UNIFORM_FLOAT4, m_offset4);
+                
+                shader << pixelName << " = ";
+                Write_mtx_x_vec(shader, mtxName, pixelName, lang);
+                shader << " + " << offsetName << ";\n";
+            }
+            else if(m_direction == TRANSFORM_DIR_INVERSE)
+            {
+                float offset_inv[] = { -m_offset4[0],
+                                       -m_offset4[1],
+                                       -m_offset4[2],
+                                       -m_offset4[3] };
+                
+                std::string offsetName = AddGpuUniform(uniforms, shaderDesc, "offset",
+                                                       GPU_UNIFORM_FLOAT4, offset_inv);
+                std::string mtxName = AddGpuUniform(uniforms, shaderDesc, "matrix",
+                                                    GPU_UNIFORM_FLOAT4X4, m_m44_inv);
+                
+                shader << pixelName << " = ";
+                Write_mtx_x_vec(shader, mtxName,
+                                "(" + pixelName + " + " + offsetName + ")", lang);
+                shader << ";\n";
+            }
+        }
+        
     }  // Anon namespace
     
     
@@ -543,6 +964,14 @@ OCIO_NAMESPACE_ENTER
     
     
     
+    bool GetRGBScaleOffsetFromOp(float * scale3, float * offset3,
+                                 const OpRcPtr & op)
+    {
+        MatrixOffsetOpRcPtr typedRcPtr = DynamicPtrCast<MatrixOffsetOp>(op);
+        if(!typedRcPtr) return false;
+        return typedRcPtr->getRGBScaleOffset(scale3, offset3);
+    }
+    
     void CreateScaleOp(OpRcPtrVec & ops,
                        const float * scale4,
                        TransformDirection direction)
@@ -601,10 +1030,9 @@ OCIO_NAMESPACE_ENTER
                               const float * m44, const float * offset4,
                               TransformDirection direction)
     {
-        bool mtxIsIdentity = IsM44Identity(m44);
-        bool offsetIsIdentity = IsVecEqualToZero(offset4, 4);
-        if(mtxIsIdentity && offsetIsIdentity) return;
-        
+        // Identities are kept, and removed when the ops are optimized,
+        // so that the shader text with uniforms does not depend on the
+        // values (see GpuShaderDesc::setUniformsEnabled)
         ops.push_back( MatrixOffsetOpRcPtr(new MatrixOffsetOp(m44,
             offset4, direction)) );
     }
@@ -785,4 +1213,63 @@ OIIO_ADD_TEST(MatrixOps, Combining)
     }
 }
 
+OIIO_ADD_TEST(MatrixOps, SIMDBitExact)
+{
+    float m44[16] = { 0.6f, 0.3f, 0.1f, 0.05f,
+                      0.2f, 0.7f, 0.1f, 0.0f,
+                      0.1f, -0.1f, 0.8f, 0.0f,
+                      0.01f, 0.0f, 0.02f, 1.1f };
+    float scale4[4] = { 1.1f, 0.9f, 0.33f, 1.0f };
+    float offset4[4] = { 0.01f, -0.02f, 0.03f, 0.5f };
+    
+    // Not a multiple of any vector width
+    const long numPixels = 101;
+    std::vector<float> source(numPixels*4);
+    for(long i=0; i<numPixels*4; ++i)
+    {
+        source[i] = (float)((i*7919) % 1000) / 37.0f - 9.0f;
+    }
+    source[5] = std::numeric_limits<float>::quiet_NaN();
+    source[10] = std::numeric_limits<float>::infinity();
+    source[15] = -0.0f;
+    
+    SIMDLevel supportedLevel = GetSupportedSIMDLevel();
+    SIMDLevel originalLevel = GetSIMDLevel();
+    
+    for(int opIndex=0; opIndex<8; ++opIndex)
+    {
+        TransformDirection dir = (opIndex%2 == 0) ?
+            TRANSFORM_DIR_FORWARD : TRANSFORM_DIR_INVERSE;
+        
+        std::vector<float> reference;
+        
+        for(int level=SIMD_LEVEL_NONE; level<=supportedLevel; ++level)
+        {
+            SetSIMDLevel(static_cast<SIMDLevel>(level));
+            
+            OpRcPtrVec ops;
+            if(opIndex/2 == 0) CreateMatrixOp(ops, m44, dir);
+            else if(opIndex/2 == 1) CreateMatrixOffsetOp(ops, m44, offset4, dir);
+            else if(opIndex/2 == 2) CreateScaleOp(ops, scale4, dir);
+            else CreateScaleOffsetOp(ops, scale4, offset4, dir);
+            FinalizeOpVec(ops, false);
+            
+            std::vector<float> data(source);
+            ops[0]->apply(&data[0], numPixels);
+            
+            if(level == SIMD_LEVEL_NONE)
+            {
+                reference = data;
+            }
+            else
+            {
+                OIIO_CHECK_EQUAL(memcmp(&data[0], &reference[0],
+                                        sizeof(float)*numPixels*4), 0);
+            }
+        }
+    }
+    
+    SetSIMDLevel(originalLevel);
+}
+
 #endif
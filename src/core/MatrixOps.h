@@ -69,6 +69,13 @@ OCIO_NAMESPACE_ENTER
                             float sat,
                             const float * lumaCoef3,
                             TransformDirection direction);
+    
+    // If op is a MatrixOffsetOp that only scales and offsets rgb
+    // (no channel crosstalk, alpha untouched), get its equivalent forward
+    // scale and offset. Returns false otherwise.
+    
+    bool GetRGBScaleOffsetFromOp(float * scale3, float * offset3,
+                                 const OpRcPtr & op);
 }
 OCIO_NAMESPACE_EXIT
 
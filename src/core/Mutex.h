@@ -109,6 +109,32 @@ OCIO_NAMESPACE_ENTER
     typedef AutoLock<Mutex> AutoMutex;
     typedef AutoLock<SpinLock> AutoSpin;
 
+    typedef _Event Event;
+
+    typedef _Semaphore Semaphore;
+
+    typedef _RWLock RWLock;
+
+    /** Automatically acquire and release a shared (read) lock within
+        enclosing scope. */
+    class AutoReadLock {
+    public:
+	AutoReadLock(RWLock& m) : _m(m) { _m.readLock(); }
+	~AutoReadLock()                 { _m.readUnlock(); }
+    private:
+	RWLock& _m;
+    };
+
+    /** Automatically acquire and release an exclusive (write) lock within
+        enclosing scope. */
+    class AutoWriteLock {
+    public:
+	AutoWriteLock(RWLock& m) : _m(m) { _m.writeLock(); }
+	~AutoWriteLock()                 { _m.writeUnlock(); }
+    private:
+	RWLock& _m;
+    };
+
 }
 OCIO_NAMESPACE_EXIT
 
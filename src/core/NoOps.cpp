@@ -31,6 +31,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "AllocationOp.h"
+#include "Lut1DOp.h"
 #include "NoOps.h"
 #include "OpBuilders.h"
 #include "Op.h"
@@ -125,8 +126,18 @@ OCIO_NAMESPACE_ENTER
         // If the entire opVec supports GPU generation, both the
         // startIndex and endIndex will equal -1
         
+        bool SupportsGpuShader(const OpRcPtr & op, bool lut1DTextures)
+        {
+            if(op->supportsGpuShader()) return true;
+            
+            Lut1DRcPtr lut;
+            Interpolation interpolation;
+            return lut1DTextures && GetGpuLut1DTexture(lut, interpolation, op);
+        }
+        
         void GetGpuUnsupportedIndexRange(int * startIndex, int * endIndex,
-                                         const OpRcPtrVec & opVec)
+                                         const OpRcPtrVec & opVec,
+                                         bool lut1DTextures)
         {
             int start = -1;
             int end = -1;
@@ -137,7 +148,7 @@ OCIO_NAMESPACE_ENTER
                 // If it's the first, save it as our start.
                 // Otherwise, update the end.
                 
-                if(!opVec[i]->supportsGpuShader())
+                if(!SupportsGpuShader(opVec[i], lut1DTextures))
                 {
                     if(start<0)
                     {
@@ -161,29 +172,29 @@ OCIO_NAMESPACE_ENTER
             if(startIndex) *startIndex = start;
             if(endIndex) *endIndex = end;
         }
+    }
+    
+    bool GetGpuAllocation(AllocationData & allocation,
+                          const OpRcPtr & op)
+    {
+        AllocationNoOpRcPtr allocationNoOpRcPtr = 
+            DynamicPtrCast<AllocationNoOp>(op);
         
-        
-        bool GetGpuAllocation(AllocationData & allocation,
-                              const OpRcPtr & op)
+        if(!allocationNoOpRcPtr)
         {
-            AllocationNoOpRcPtr allocationNoOpRcPtr = 
-                DynamicPtrCast<AllocationNoOp>(op);
-            
-            if(!allocationNoOpRcPtr)
-            {
-                return false;
-            }
-            
-            allocationNoOpRcPtr->getGpuAllocation(allocation);
-            return true;
+            return false;
         }
+        
+        allocationNoOpRcPtr->getGpuAllocation(allocation);
+        return true;
     }
     
     
     void PartitionGPUOps(OpRcPtrVec & gpuPreOps,
                          OpRcPtrVec & gpuLatticeOps,
                          OpRcPtrVec & gpuPostOps,
-                         const OpRcPtrVec & ops)
+                         const OpRcPtrVec & ops,
+                         bool lut1DTextures)
     {
         //
         // Partition the original, raw opvec into 3 segments for GPU Processing
@@ -201,7 +212,7 @@ OCIO_NAMESPACE_ENTER
         int gpuLut3DOpEndIndex = 0;
         GetGpuUnsupportedIndexRange(&gpuLut3DOpStartIndex,
                                     &gpuLut3DOpEndIndex,
-                                    ops);
+                                    ops, lut1DTextures);
         
         // Write the entire shader using only shader text (3d lut is unused)
         if(gpuLut3DOpStartIndex == -1 && gpuLut3DOpEndIndex == -1)
@@ -469,7 +480,8 @@ void CreateGenericScaleOp(OpRcPtrVec & ops)
     CreateScaleOp(ops, scale4, TRANSFORM_DIR_FORWARD);
 }
 
-void CreateGenericLutOp(OpRcPtrVec & ops)
+void CreateGenericLutOp(OpRcPtrVec & ops,
+                        TransformDirection direction = TRANSFORM_DIR_FORWARD)
 {
     // Make a lut that squares the input
     Lut1DRcPtr lut = Lut1D::Create();
@@ -493,7 +505,7 @@ void CreateGenericLutOp(OpRcPtrVec & ops)
         }
     }
     
-    CreateLut1DOp(ops, lut, INTERP_LINEAR, TRANSFORM_DIR_FORWARD);
+    CreateLut1DOp(ops, lut, INTERP_LINEAR, direction);
 }
 
 OIIO_ADD_TEST(NoOps, PartitionGPUOps)
@@ -638,4 +650,40 @@ OIIO_ADD_TEST(NoOps, PartitionGPUOps)
     }
 } // PartitionGPUOps
 
+OIIO_ADD_TEST(NoOps, PartitionGPUOpsLut1DTextures)
+{
+    {
+    OpRcPtrVec ops;
+    
+    CreateGenericAllocationOp(ops);
+    CreateGenericLutOp(ops);
+    CreateGenericScaleOp(ops);
+    
+    OpRcPtrVec gpuPreOps, gpuLatticeOps, gpuPostOps;
+    PartitionGPUOps(gpuPreOps, gpuLatticeOps, gpuPostOps, ops, true);
+    
+    OIIO_CHECK_EQUAL(gpuPreOps.size(), 3);
+    OIIO_CHECK_EQUAL(gpuLatticeOps.size(), 0);
+    OIIO_CHECK_EQUAL(gpuPostOps.size(), 0);
+    }
+    
+    {
+    // Inverse luts still need the lattice
+    OpRcPtrVec ops;
+    
+    CreateGenericAllocationOp(ops);
+    CreateGenericLutOp(ops);
+    CreateGenericScaleOp(ops);
+    CreateGenericLutOp(ops, TRANSFORM_DIR_INVERSE);
+    CreateGenericScaleOp(ops);
+    
+    OpRcPtrVec gpuPreOps, gpuLatticeOps, gpuPostOps;
+    PartitionGPUOps(gpuPreOps, gpuLatticeOps, gpuPostOps, ops, true);
+    
+    OIIO_CHECK_EQUAL(gpuPreOps.size(), 2);
+    OIIO_CHECK_EQUAL(gpuLatticeOps.size(), 6);
+    OIIO_CHECK_EQUAL(gpuPostOps.size(), 1);
+    }
+}
+
 #endif // OCIO_UNIT_TEST
@@ -41,6 +41,11 @@ OCIO_NAMESPACE_ENTER
     void CreateGpuAllocationNoOp(OpRcPtrVec & ops,
                                  const AllocationData & allocationData);
     
+    // If the op is an allocation no-op, get its allocation and return true.
+    
+    bool GetGpuAllocation(AllocationData & allocation,
+                          const OpRcPtr & op);
+    
     
     // Partition an opvec into 3 segments for GPU Processing
     //
@@ -49,11 +54,15 @@ OCIO_NAMESPACE_ENTER
     //
     // Additional ops will optinally be inserted to take into account
     // allocation transformations
+    //
+    // If lut1DTextures, the lut1d ops that can be sampled from a texture
+    // (see GetGpuLut1DTexture) count as supporting analytical generation.
     
     void PartitionGPUOps(OpRcPtrVec & gpuPreOps,
                          OpRcPtrVec & gpuLatticeOps,
                          OpRcPtrVec & gpuPostOps,
-                         const OpRcPtrVec & ops);
+                         const OpRcPtrVec & ops,
+                         bool lut1DTextures = false);
     
     void CreateFileNoOp(OpRcPtrVec & ops,
                         const std::string & fname);
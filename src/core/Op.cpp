@@ -52,6 +52,14 @@ OCIO_NAMESPACE_ENTER
         throw Exception(os.str().c_str());
     }
     
+    void Op::writeGpuShaderUniforms(std::ostream & shader,
+                                    const std::string & pixelName,
+                                    const GpuShaderDesc & shaderDesc,
+                                    GpuUniformVec & /*uniforms*/) const
+    {
+        writeGpuShader(shader, pixelName, shaderDesc);
+    }
+    
     std::ostream& operator<< (std::ostream & os, const Op & op)
     {
         os << op.getInfo();
@@ -32,6 +32,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "GpuShaderUtils.h"
+
 #include <sstream>
 #include <vector>
 
@@ -125,6 +127,16 @@ OCIO_NAMESPACE_ENTER
                                         const std::string & pixelName,
                                         const GpuShaderDesc & shaderDesc) const = 0;
             
+            // Same, with the parameters which change from grade to grade
+            // read from uniforms, added to 'uniforms'. Used when
+            // GpuShaderDesc::getUniformsEnabled, the text must then only
+            // depend on the type (and direction) of the op. Defaults to
+            // writeGpuShader.
+            virtual void writeGpuShaderUniforms(std::ostream & shader,
+                                                const std::string & pixelName,
+                                                const GpuShaderDesc & shaderDesc,
+                                                GpuUniformVec & uniforms) const;
+            
         private:
             Op& operator= (const Op &);
     };
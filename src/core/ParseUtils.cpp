@@ -26,7 +26,11 @@ THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <iostream>
+#include <locale>
 #include <set>
 #include <sstream>
 
@@ -207,6 +211,10 @@ OCIO_NAMESPACE_ENTER
         if(language == GPU_LANGUAGE_CG) return "cg";
         else if(language == GPU_LANGUAGE_GLSL_1_0) return "glsl_1.0";
         else if(language == GPU_LANGUAGE_GLSL_1_3) return "glsl_1.3";
+        else if(language == GPU_LANGUAGE_GLSL_3_3) return "glsl_3.3";
+        else if(language == GPU_LANGUAGE_GLSL_4_0) return "glsl_4.0";
+        else if(language == GPU_LANGUAGE_HLSL_DX11) return "hlsl_dx11";
+        else if(language == GPU_LANGUAGE_MSL) return "msl";
         return "unknown";
     }
     
@@ -216,6 +224,10 @@ OCIO_NAMESPACE_ENTER
         if(str == "cg") return GPU_LANGUAGE_CG;
         else if(str == "glsl_1.0") return GPU_LANGUAGE_GLSL_1_0;
         else if(str == "glsl_1.3") return GPU_LANGUAGE_GLSL_1_3;
+        else if(str == "glsl_3.3") return GPU_LANGUAGE_GLSL_3_3;
+        else if(str == "glsl_4.0") return GPU_LANGUAGE_GLSL_4_0;
+        else if(str == "hlsl_dx11") return GPU_LANGUAGE_HLSL_DX11;
+        else if(str == "msl") return GPU_LANGUAGE_MSL;
         return GPU_LANGUAGE_UNKNOWN;
     }
     
@@ -235,6 +247,29 @@ OCIO_NAMESPACE_ENTER
         return ENV_ENVIRONMENT_UNKNOWN;
     }
     
+    const char * CacheTypeToString(CacheType type)
+    {
+        if(type == CACHE_TYPE_FILE) return "file";
+        else if(type == CACHE_TYPE_FILE_HASH) return "filehash";
+        else if(type == CACHE_TYPE_CDL_FILE) return "cdlfile";
+        else if(type == CACHE_TYPE_PROCESSOR) return "processor";
+        else if(type == CACHE_TYPE_GPU_SHADER) return "gpushader";
+        else if(type == CACHE_TYPE_INVERSE_LUT3D) return "inverselut3d";
+        return "unknown";
+    }
+    
+    CacheType CacheTypeFromString(const char * s)
+    {
+        std::string str = pystring::lower(s);
+        if(str == "file") return CACHE_TYPE_FILE;
+        else if(str == "filehash") return CACHE_TYPE_FILE_HASH;
+        else if(str == "cdlfile") return CACHE_TYPE_CDL_FILE;
+        else if(str == "processor") return CACHE_TYPE_PROCESSOR;
+        else if(str == "gpushader") return CACHE_TYPE_GPU_SHADER;
+        else if(str == "inverselut3d") return CACHE_TYPE_INVERSE_LUT3D;
+        return CACHE_TYPE_UNKNOWN;
+    }
+    
     const char * ROLE_DEFAULT = "default";
     const char * ROLE_REFERENCE = "reference";
     const char * ROLE_DATA = "data";
@@ -317,13 +352,11 @@ OCIO_NAMESPACE_ENTER
         
         for(unsigned int i=0; i<lineParts.size(); i++)
         {
-            std::istringstream inputStringstream(lineParts[i]);
-            float x;
-            if(!(inputStringstream >> x))
+            const char * str = lineParts[i].c_str();
+            if(!ParseFloat(floatArray[i], str, str + lineParts[i].size()))
             {
                 return false;
             }
-            floatArray[i] = x;
         }
         
         return true;
@@ -337,18 +370,396 @@ OCIO_NAMESPACE_ENTER
         
         for(unsigned int i=0; i<lineParts.size(); i++)
         {
-            std::istringstream inputStringstream(lineParts[i]);
-            int x;
-            if(!(inputStringstream >> x))
+            const char * str = lineParts[i].c_str();
+            if(!ParseInt(intArray[i], str, str + lineParts[i].size()))
             {
                 return false;
             }
-            intArray[i] = x;
         }
         
         return true;
     }
     
+    namespace
+    {
+        // The powers of ten a float holds exactly
+        const float g_exactPowersOf10[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f,
+                                            1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+        const int g_maxExactPowerOf10 = 10;
+        
+        // The largest integer below which all integers are floats
+        const unsigned int g_maxExactFloatInt = 1u << 24;
+        
+        // Significant digits an unsigned int mantissa always holds
+        const int g_maxMantissaDigits = 9;
+        
+        inline bool IsDigit(char c)
+        {
+            return c >= '0' && c <= '9';
+        }
+        
+        inline bool IsSpace(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\n' ||
+                   c == '\r' || c == '\f' || c == '\v';
+        }
+        
+        // The general case, which is also the reference for the fast paths
+        template<typename T>
+        bool ParseWithStream(T & value, const char * str, const char * end,
+                             const char ** next)
+        {
+            std::istringstream istream(std::string(str, end));
+            istream.imbue(std::locale::classic());
+            T x;
+            if(!(istream >> x))
+            {
+                return false;
+            }
+            
+            value = x;
+            if(next)
+            {
+                std::streampos pos = istream.tellg();
+                *next = (pos == std::streampos(-1)) ? end :
+                    str + static_cast<std::streamoff>(pos);
+            }
+            return true;
+        }
+    }
+    
+    bool ParseFloat(float & value, const char * str, const char * end,
+                    const char ** next)
+    {
+        // value = +/- mantissa * 10^exponent, where the mantissa omits
+        // its trailing zeros (counted in 'zeros' until a digit follows)
+        const char * c = str;
+        bool negative = false;
+        if(c < end && (*c == '-' || *c == '+'))
+        {
+            negative = (*c == '-');
+            ++c;
+        }
+        
+        unsigned int mantissa = 0;
+        int digits = 0;
+        int zeros = 0;
+        int exponent = 0;
+        bool anyDigit = false;
+        bool fraction = false;
+        
+        for(; c < end; ++c)
+        {
+            if(*c == '.' && !fraction)
+            {
+                fraction = true;
+                continue;
+            }
+            if(!IsDigit(*c)) break;
+            
+            anyDigit = true;
+            if(fraction) --exponent;
+            
+            const unsigned int digit = static_cast<unsigned int>(*c - '0');
+            if(digit == 0)
+            {
+                if(mantissa != 0) ++zeros;
+                continue;
+            }
+            
+            digits += zeros + 1;
+            if(digits > g_maxMantissaDigits)
+            {
+                return ParseWithStream(value, str, end, next);
+            }
+            for(; zeros > 0; --zeros) mantissa *= 10;
+            mantissa = mantissa * 10 + digit;
+        }
+        exponent += zeros;
+        
+        if(c < end && (*c == 'e' || *c == 'E'))
+        {
+            ++c;
+            bool negativeExponent = false;
+            if(c < end && (*c == '-' || *c == '+'))
+            {
+                negativeExponent = (*c == '-');
+                ++c;
+            }
+            
+            int exp10 = 0;
+            int expDigits = 0;
+            for(; c < end && IsDigit(*c); ++c, ++expDigits)
+            {
+                if(expDigits < 4) exp10 = exp10 * 10 + (*c - '0');
+            }
+            if(expDigits == 0 || expDigits >= 4)
+            {
+                return ParseWithStream(value, str, end, next);
+            }
+            exponent += negativeExponent ? -exp10 : exp10;
+        }
+        
+        // Leave the unusual forms and the inexact cases to the stream
+        if(!anyDigit || (c < end && !IsSpace(*c)))
+        {
+            return ParseWithStream(value, str, end, next);
+        }
+        
+        float x = 0.0f;
+        if(mantissa != 0)
+        {
+            if(mantissa > g_maxExactFloatInt ||
+               exponent > g_maxExactPowerOf10 || exponent < -g_maxExactPowerOf10)
+            {
+                return ParseWithStream(value, str, end, next);
+            }
+            
+            // Both operands are exact, so the one rounding of the
+            // operation gives the correctly rounded result
+            x = static_cast<float>(mantissa);
+            if(exponent < 0) x /= g_exactPowersOf10[-exponent];
+            else x *= g_exactPowersOf10[exponent];
+        }
+        
+        value = negative ? -x : x;
+        if(next) *next = c;
+        return true;
+    }
+    
+    bool ParseInt(int & value, const char * str, const char * end,
+                  const char ** next)
+    {
+        const char * c = str;
+        bool negative = false;
+        if(c < end && (*c == '-' || *c == '+'))
+        {
+            negative = (*c == '-');
+            ++c;
+        }
+        
+        int x = 0;
+        int digits = 0;
+        for(; c < end && IsDigit(*c); ++c)
+        {
+            if(x != 0 && ++digits >= g_maxMantissaDigits)
+            {
+                return ParseWithStream(value, str, end, next);
+            }
+            x = x * 10 + (*c - '0');
+        }
+        
+        if(c == str || !IsDigit(c[-1]) || (c < end && !IsSpace(*c)))
+        {
+            return ParseWithStream(value, str, end, next);
+        }
+        
+        value = negative ? -x : x;
+        if(next) *next = c;
+        return true;
+    }
+    
+    namespace
+    {
+        // Write the digits of value, returns their count
+        int FormatDigits(char * buf, unsigned long value)
+        {
+            char digits[32];
+            int numDigits = 0;
+            do
+            {
+                digits[numDigits++] = static_cast<char>('0' + value % 10);
+                value /= 10;
+            }
+            while(value != 0);
+            
+            for(int i=0; i<numDigits; ++i)
+            {
+                buf[i] = digits[numDigits-1-i];
+            }
+            return numDigits;
+        }
+        
+        int FormatWithStream(char * buf, float value)
+        {
+            std::ostringstream os;
+            os.imbue(std::locale::classic());
+            os.setf(std::ios::fixed, std::ios::floatfield);
+            os.precision(6);
+            os << value;
+            
+            const std::string str = os.str();
+            const int size = static_cast<int>(
+                std::min(str.size(), static_cast<size_t>(FORMAT_FLOAT_MAX_CHARS)));
+            memcpy(buf, str.c_str(), size);
+            return size;
+        }
+    }
+    
+    int FormatFloatFixed6(char * buf, float value)
+    {
+        // The integer part must fit in an unsigned long. Others (and
+        // nan, inf) are left to the stream.
+        const double x = fabs(static_cast<double>(value));
+        if(!(x < 4294967295.0))
+        {
+            return FormatWithStream(buf, value);
+        }
+        
+        // With 24 bits of mantissa, the fraction of a float scaled by
+        // 10^6 is exact in a double, so it can be rounded as printf does:
+        // to nearest, ties to even. (As 10^6 is even, the parity of the
+        // whole scaled value is that of the scaled fraction.)
+        double intPart = floor(x);
+        const double scaledFrac = (x - intPart) * 1000000.0;
+        double frac = floor(scaledFrac);
+        const double rem = scaledFrac - frac;
+        if(rem > 0.5 || (rem == 0.5 && fmod(frac, 2.0) != 0.0))
+        {
+            frac += 1.0;
+            if(frac == 1000000.0)
+            {
+                frac = 0.0;
+                intPart += 1.0;
+            }
+        }
+        
+        int size = 0;
+        if(value < 0.0f || (value == 0.0f && 1.0f/value < 0.0f))
+        {
+            buf[size++] = '-';
+        }
+        size += FormatDigits(buf + size, static_cast<unsigned long>(intPart));
+        buf[size++] = '.';
+        
+        unsigned long digits = static_cast<unsigned long>(frac);
+        for(int i=6; i>0; --i)
+        {
+            buf[size + i - 1] = static_cast<char>('0' + digits % 10);
+            digits /= 10;
+        }
+        return size + 6;
+    }
+    
+    int FormatInt(char * buf, int value)
+    {
+        if(value < 0)
+        {
+            buf[0] = '-';
+            // Negate as unsigned, so INT_MIN is fine
+            return 1 + FormatDigits(buf + 1,
+                0ul - static_cast<unsigned long>(static_cast<long>(value)));
+        }
+        return FormatDigits(buf, static_cast<unsigned long>(value));
+    }
+    
+    ////////////////////////////////////////////////////////////////////////////
+    
+    LineTokenizer::LineTokenizer(std::istream & istream)
+    {
+        // Size the buffer from the stream when it can seek, then read
+        // in chunks whatever is left (or everything, if it cannot)
+        std::streampos begin = istream.tellg();
+        if(begin != std::streampos(-1) && istream.seekg(0, std::ios::end))
+        {
+            std::streampos end = istream.tellg();
+            istream.seekg(begin);
+            if(end != std::streampos(-1) && end > begin)
+            {
+                m_buffer.resize(static_cast<size_t>(end - begin));
+                istream.read(&m_buffer[0], static_cast<std::streamsize>(m_buffer.size()));
+                m_buffer.resize(static_cast<size_t>(istream.gcount()));
+            }
+        }
+        
+        if(!istream.eof())
+        {
+            istream.clear();
+            char chunk[16384];
+            while(istream.read(chunk, sizeof(chunk)) || istream.gcount() > 0)
+            {
+                m_buffer.insert(m_buffer.end(), chunk, chunk + istream.gcount());
+            }
+        }
+        
+        const char * data = m_buffer.empty() ? 0 : &m_buffer[0];
+        m_end = data + m_buffer.size();
+        m_next = data;
+        m_lineBegin = data;
+        m_lineEnd = data;
+        m_cursor = data;
+    }
+    
+    bool LineTokenizer::nextLine()
+    {
+        if(m_next == m_end)
+        {
+            m_lineBegin = m_lineEnd = m_cursor = m_end;
+            return false;
+        }
+        
+        m_lineBegin = m_next;
+        const char * eol = static_cast<const char *>(
+            memchr(m_next, '\n', static_cast<size_t>(m_end - m_next)));
+        if(eol)
+        {
+            m_lineEnd = eol;
+            m_next = eol + 1;
+        }
+        else
+        {
+            m_lineEnd = m_end;
+            m_next = m_end;
+        }
+        
+        if(m_lineEnd > m_lineBegin && m_lineEnd[-1] == '\r') --m_lineEnd;
+        m_cursor = m_lineBegin;
+        return true;
+    }
+    
+    bool LineTokenizer::nextNonEmptyLine()
+    {
+        while(nextLine())
+        {
+            for(const char * c = m_lineBegin; c < m_lineEnd; ++c)
+            {
+                if(!IsSpace(*c)) return true;
+            }
+        }
+        return false;
+    }
+    
+    bool LineTokenizer::nextToken(const char *& tokenBegin, const char *& tokenEnd)
+    {
+        while(m_cursor < m_lineEnd && IsSpace(*m_cursor)) ++m_cursor;
+        if(m_cursor == m_lineEnd) return false;
+        
+        tokenBegin = m_cursor;
+        while(m_cursor < m_lineEnd && !IsSpace(*m_cursor)) ++m_cursor;
+        tokenEnd = m_cursor;
+        return true;
+    }
+    
+    bool LineTokenizer::lineToFloats(float * values, int count)
+    {
+        m_cursor = m_lineBegin;
+        
+        const char * tokenBegin = 0;
+        const char * tokenEnd = 0;
+        const char * next = 0;
+        for(int i=0; i<count; ++i)
+        {
+            if(!nextToken(tokenBegin, tokenEnd) ||
+               !ParseFloat(values[i], tokenBegin, tokenEnd, &next) ||
+               next != tokenEnd)
+            {
+                return false;
+            }
+        }
+        
+        return !nextToken(tokenBegin, tokenEnd);
+    }
+    
     ////////////////////////////////////////////////////////////////////////////
     
     // read the next non empty line, and store it in 'line'
@@ -458,10 +869,330 @@ OCIO_NAMESPACE_EXIT
 
 #ifdef OCIO_UNIT_TEST
 
+#include <cstdio>
+#include <cstdlib>
+
 OCIO_NAMESPACE_USING
 
 #include "UnitTest.h"
 
+namespace
+{
+    // The stream parsing the lut readers relied on
+    template<typename T>
+    bool StreamParse(T & value, const std::string & str)
+    {
+        std::istringstream istream(str);
+        T x;
+        if(!(istream >> x)) return false;
+        value = x;
+        return true;
+    }
+    
+    bool SameFloatParse(const std::string & str)
+    {
+        float expected = 0.0f;
+        float value = 0.0f;
+        bool expectedSuccess = StreamParse(expected, str);
+        bool success = ParseFloat(value, str.c_str(), str.c_str() + str.size());
+        if(success != expectedSuccess) return false;
+        return !success || memcmp(&value, &expected, sizeof(float)) == 0;
+    }
+    
+    bool SameIntParse(const std::string & str)
+    {
+        int expected = 0;
+        int value = 0;
+        bool expectedSuccess = StreamParse(expected, str);
+        bool success = ParseInt(value, str.c_str(), str.c_str() + str.size());
+        return success == expectedSuccess && (!success || value == expected);
+    }
+}
+
+OIIO_ADD_TEST(ParseUtils, ParseFloat)
+{
+    const char * values[] = { "0", "-0", "+0", "1", "-1", "1.", ".5", "-.5",
+        "+.5", "0.5", "00012.500", "1e5", "1E-5", "-2.5e+3", "1e10", "1e-10",
+        "0.1", "0.2", "0.3", "0.7", "0.123456", "0.1234567", "1.00000005",
+        "16777216", "16777217", "123456789", "1234567890", "0.000001",
+        "3.40282347e+38", "1.17549435e-38", "1e-45", "1e39", "1e-50",
+        "1e", "1e+", "e5", ".", "-", "+", "", "abc", "nan", "inf",
+        "1.5x", "2.5 3.5", " 4.5", "1..2", "1.2.3", "0x10", "1e0000005",
+        "0.00000000000000000000000000001", "99999999999999999999", 0 };
+    
+    for(int i=0; values[i]; ++i)
+    {
+        if(!SameFloatParse(values[i]))
+        {
+            std::cerr << "ParseFloat mismatch on '" << values[i] << "'\n";
+            OIIO_CHECK_ASSERT(false);
+        }
+    }
+    
+    // The forms lut writers use, over a range of magnitudes and precisions
+    srand48(0);
+    char buffer[6][64];
+    int mismatches = 0;
+    for(int i=0; i<200000; ++i)
+    {
+        double x = drand48();
+        if(i % 3 == 1) x = (x - 0.5) * 4096.0;
+        if(i % 3 == 2) x = x * 1e-4;
+        
+        snprintf(buffer[0], sizeof(buffer[0]), "%.6f", x);
+        snprintf(buffer[1], sizeof(buffer[1]), "%.10f", x);
+        snprintf(buffer[2], sizeof(buffer[2]), "%.8g", x);
+        snprintf(buffer[3], sizeof(buffer[3]), "%.9g", x);
+        snprintf(buffer[4], sizeof(buffer[4]), "%.4e", x);
+        snprintf(buffer[5], sizeof(buffer[5]), "%f", x);
+        for(int f=0; f<6; ++f)
+        {
+            if(!SameFloatParse(buffer[f])) ++mismatches;
+        }
+    }
+    OIIO_CHECK_EQUAL(mismatches, 0);
+    
+    // The end of the parsed number
+    const char * str = "0.25, 1";
+    const char * next = 0;
+    float value = 0.0f;
+    OIIO_CHECK_ASSERT(ParseFloat(value, str, str + strlen(str), &next));
+    OIIO_CHECK_EQUAL(value, 0.25f);
+    OIIO_CHECK_EQUAL(next, str + 4);
+    
+    str = "0.75 1";
+    OIIO_CHECK_ASSERT(ParseFloat(value, str, str + strlen(str), &next));
+    OIIO_CHECK_EQUAL(value, 0.75f);
+    OIIO_CHECK_EQUAL(next, str + 4);
+}
+
+OIIO_ADD_TEST(ParseUtils, ParseInt)
+{
+    const char * values[] = { "0", "-0", "+7", "-7", "42", "0042", "123456789",
+        "1234567890", "2147483647", "2147483648", "-2147483648",
+        "-2147483649", "99999999999", "1.5", "1e3", "12x", " 3", "x3",
+        "-", "+", "", 0 };
+    
+    for(int i=0; values[i]; ++i)
+    {
+        if(!SameIntParse(values[i]))
+        {
+            std::cerr << "ParseInt mismatch on '" << values[i] << "'\n";
+            OIIO_CHECK_ASSERT(false);
+        }
+    }
+    
+    const char * str = "1023 511";
+    const char * next = 0;
+    int value = 0;
+    OIIO_CHECK_ASSERT(ParseInt(value, str, str + strlen(str), &next));
+    OIIO_CHECK_EQUAL(value, 1023);
+    OIIO_CHECK_EQUAL(next, str + 4);
+}
+
+OIIO_ADD_TEST(ParseUtils, FormatFloatFixed6)
+{
+    // Matches printf, which is what a fixed stream uses
+    std::vector<float> values;
+    const float special[] = { 0.0f, -0.0f, 1.0f, -1.0f, 0.5f, 1e-7f, -1e-7f,
+                              5e-7f, 0.0078125f, 0.0234375f, -0.0078125f,
+                              0.9999995f, 0.99999994f, 123.456789f,
+                              4294967040.0f, 4294967296.0f, 1e20f, -3e38f,
+                              1.4e-45f, 1.17549435e-38f };
+    values.insert(values.end(), special,
+                  special + sizeof(special)/sizeof(special[0]));
+    
+    // Every multiple of 2^-11 in [0,4) (with many ties in the 7th decimal),
+    // and pseudo random values over a wide range
+    for(int i=0; i<8192; ++i)
+    {
+        values.push_back(static_cast<float>(i) / 2048.0f);
+    }
+    unsigned int seed = 1;
+    for(int i=0; i<100000; ++i)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        // Random sign and mantissa, 2^-31 <= |x| < 2^33
+        unsigned int bits = (seed & 0x807fffffu) | ((96u + (seed >> 24) % 64u) << 23);
+        float x = 0.0f;
+        memcpy(&x, &bits, sizeof(float));
+        values.push_back(x);
+    }
+    
+    char buf[FORMAT_FLOAT_MAX_CHARS];
+    char expected[128];
+    int numMismatches = 0;
+    for(unsigned int i=0; i<values.size(); ++i)
+    {
+        int size = FormatFloatFixed6(buf, values[i]);
+        snprintf(expected, sizeof(expected), "%.6f", values[i]);
+        if(std::string(buf, size) != expected) ++numMismatches;
+    }
+    OIIO_CHECK_EQUAL(numMismatches, 0);
+    
+    int size = FormatFloatFixed6(buf, 0.0078125f);
+    OIIO_CHECK_EQUAL(std::string(buf, size), "0.007812");
+    size = FormatFloatFixed6(buf, -2.5f);
+    OIIO_CHECK_EQUAL(std::string(buf, size), "-2.500000");
+}
+
+OIIO_ADD_TEST(ParseUtils, FormatInt)
+{
+    char buf[FORMAT_FLOAT_MAX_CHARS];
+    const int values[] = { 0, 7, -7, 4095, 1000000, -2147483647 - 1, 2147483647 };
+    for(unsigned int i=0; i<sizeof(values)/sizeof(values[0]); ++i)
+    {
+        std::ostringstream os;
+        os << values[i];
+        int size = FormatInt(buf, values[i]);
+        OIIO_CHECK_EQUAL(std::string(buf, size), os.str());
+    }
+}
+
+OIIO_ADD_TEST(ParseUtils, LineTokenizer)
+{
+    std::istringstream istream;
+    istream.str("LUT_3D_SIZE 2\r\n\n  \t \n0.5 1e-2\t-3\r\n# comment\n1 2");
+    LineTokenizer tokenizer(istream);
+    
+    const char * begin = 0;
+    const char * end = 0;
+    float values[3];
+    
+    OIIO_CHECK_ASSERT(tokenizer.nextNonEmptyLine());
+    OIIO_CHECK_EQUAL(tokenizer.line(), "LUT_3D_SIZE 2");
+    OIIO_CHECK_ASSERT(!tokenizer.lineToFloats(values, 2));
+    tokenizer.rewindLine();
+    OIIO_CHECK_ASSERT(tokenizer.nextToken(begin, end));
+    OIIO_CHECK_EQUAL(std::string(begin, end), "LUT_3D_SIZE");
+    OIIO_CHECK_ASSERT(tokenizer.nextToken(begin, end));
+    OIIO_CHECK_EQUAL(std::string(begin, end), "2");
+    OIIO_CHECK_ASSERT(!tokenizer.nextToken(begin, end));
+    
+    OIIO_CHECK_ASSERT(tokenizer.nextLine());
+    OIIO_CHECK_EQUAL(tokenizer.line(), "");
+    
+    OIIO_CHECK_ASSERT(tokenizer.nextNonEmptyLine());
+    OIIO_CHECK_ASSERT(!tokenizer.lineToFloats(values, 2));
+    OIIO_CHECK_ASSERT(tokenizer.lineToFloats(values, 3));
+    OIIO_CHECK_EQUAL(values[0], 0.5f);
+    OIIO_CHECK_EQUAL(values[1], 0.01f);
+    OIIO_CHECK_EQUAL(values[2], -3.0f);
+    
+    OIIO_CHECK_ASSERT(tokenizer.nextNonEmptyLine());
+    OIIO_CHECK_ASSERT(!tokenizer.lineToFloats(values, 2));
+    
+    // The last line needs no end of line
+    OIIO_CHECK_ASSERT(tokenizer.nextNonEmptyLine());
+    OIIO_CHECK_ASSERT(tokenizer.lineToFloats(values, 2));
+    OIIO_CHECK_EQUAL(values[1], 2.0f);
+    OIIO_CHECK_ASSERT(!tokenizer.nextLine());
+    OIIO_CHECK_ASSERT(!tokenizer.nextNonEmptyLine());
+    
+    std::istringstream empty;
+    LineTokenizer emptyTokenizer(empty);
+    OIIO_CHECK_ASSERT(!emptyTokenizer.nextLine());
+}
+
+namespace
+{
+    // The data lines of a size^3 .cube lut
+    std::string CreateCubeLines(int size)
+    {
+        std::ostringstream os;
+        os.precision(6);
+        os.setf(std::ios::fixed, std::ios::floatfield);
+        for(int i=0; i<size*size*size; ++i)
+        {
+            os << static_cast<float>(i % size) / (size-1) << " ";
+            os << static_cast<float>((i / size) % size) / (size-1) << " ";
+            os << static_cast<float>(i / size / size) / (size-1) << "\n";
+        }
+        return os.str();
+    }
+    
+    // The per line parsing the lut readers used: split on whitespace,
+    // then a stream per value
+    void StreamParseLines(std::vector<float> & values, const std::string & text)
+    {
+        std::istringstream istream(text);
+        std::string line;
+        std::vector<std::string> parts;
+        std::vector<float> tmpfloats;
+        while(nextline(istream, line))
+        {
+            pystring::split(pystring::lower(pystring::strip(line)), parts);
+            
+            tmpfloats.resize(parts.size());
+            for(unsigned int i=0; i<parts.size(); ++i)
+            {
+                StreamParse(tmpfloats[i], parts[i]);
+            }
+            values.insert(values.end(), tmpfloats.begin(), tmpfloats.end());
+        }
+    }
+    
+    void TokenizeLines(std::vector<float> & values, const std::string & text)
+    {
+        std::istringstream istream(text);
+        LineTokenizer tokenizer(istream);
+        float triple[3];
+        while(tokenizer.nextNonEmptyLine())
+        {
+            if(tokenizer.lineToFloats(triple, 3))
+            {
+                values.insert(values.end(), triple, triple + 3);
+            }
+        }
+    }
+}
+
+OIIO_ADD_TEST(ParseUtils, TokenizerMatchesStreamParse)
+{
+    // The stream parsing and the tokenizer read the same values from the
+    // data lines of a 33x33x33 .cube lut.
+    const int size = 33;
+    const std::string text = CreateCubeLines(size);
+    
+    std::vector<float> expected;
+    expected.reserve(3*size*size*size);
+    StreamParseLines(expected, text);
+    
+    std::vector<float> values;
+    values.reserve(3*size*size*size);
+    TokenizeLines(values, text);
+    
+    OIIO_CHECK_ASSERT(values == expected);
+}
+
+OIIO_ADD_TEST(ParseUtils, Benchmark)
+{
+    // Prints the time the stream parsing and the tokenizer take on the
+    // data lines of a 65x65x65 .cube lut. Only run when benchmarks are
+    // enabled.
+    if(!BenchmarksEnabled()) return;
+    
+    const int size = 65;
+    const std::string text = CreateCubeLines(size);
+    
+    std::vector<float> expected;
+    expected.reserve(3*size*size*size);
+    double startTime = GetBenchmarkTime();
+    StreamParseLines(expected, text);
+    double streamTime = GetBenchmarkTime() - startTime;
+    
+    std::vector<float> values;
+    values.reserve(3*size*size*size);
+    startTime = GetBenchmarkTime();
+    TokenizeLines(values, text);
+    double tokenizerTime = GetBenchmarkTime() - startTime;
+    
+    OIIO_CHECK_ASSERT(values == expected);
+    
+    printf("ParseUtils 65^3 cube lines: stream %0.1f ms, tokenizer %0.1f ms\n",
+           streamTime * 1000.0, tokenizerTime * 1000.0);
+}
+
 OIIO_ADD_TEST(ParseUtils, StringToInt)
 {
     int ival = 0;
@@ -54,7 +54,73 @@ OCIO_NAMESPACE_ENTER
     
     bool StringVecToIntVec(std::vector<int> & intArray,
                            const std::vector<std::string> & lineParts);
+
+    // Parse the number at the start of [str, end), with the same results
+    // as 'istringstream >> value' but independent of the global locale.
+    // The plain decimal forms found in lut files are parsed directly
+    // (correctly rounded, as strtof), anything else goes through a stream.
+    // On success, if 'next' is given it is set past the parsed characters.
+
+    bool ParseFloat(float & value, const char * str, const char * end,
+                    const char ** next = 0);
+    bool ParseInt(int & value, const char * str, const char * end,
+                  const char ** next = 0);
+
+    // Format value as a stream with std::fixed and a precision of 6 does
+    // (i.e., as "%.6f"), in the classic locale, without going through a
+    // stream. buf must hold FORMAT_FLOAT_MAX_CHARS; the number of
+    // characters written is returned, and no terminating null is added.
+    
+    const int FORMAT_FLOAT_MAX_CHARS = 64;
+    int FormatFloatFixed6(char * buf, float value);
     
+    // Same, for an int written in decimal
+    int FormatInt(char * buf, int value);
+    
+    // Walks the lines, and the whitespace separated tokens of each line,
+    // of a text read into memory in one go. Lines and tokens are returned
+    // as pointers into the buffer, so reading a lut with it allocates
+    // nothing per line.
+
+    class LineTokenizer
+    {
+    public:
+        // Reads everything left in the stream
+        explicit LineTokenizer(std::istream & istream);
+
+        // Advance to the next line (blank ones included), false at the end
+        bool nextLine();
+
+        // Advance to the next line holding a token, false at the end
+        bool nextNonEmptyLine();
+
+        // The current line, without its end of line characters
+        const char * lineBegin() const { return m_lineBegin; }
+        const char * lineEnd() const { return m_lineEnd; }
+        std::string line() const { return std::string(m_lineBegin, m_lineEnd); }
+
+        // Get the next token of the current line, false if there is none
+        bool nextToken(const char *& tokenBegin, const char *& tokenEnd);
+
+        // Restart the tokens at the beginning of the current line
+        void rewindLine() { m_cursor = m_lineBegin; }
+
+        // Parse the whole current line as exactly 'count' numbers, each
+        // token being a complete number. On false the cursor is undefined.
+        bool lineToFloats(float * values, int count);
+
+    private:
+        LineTokenizer(const LineTokenizer &);
+        LineTokenizer & operator=(const LineTokenizer &);
+
+        std::vector<char> m_buffer;
+        const char * m_end;
+        const char * m_next;
+        const char * m_lineBegin;
+        const char * m_lineEnd;
+        const char * m_cursor;
+    };
+
     //////////////////////////////////////////////////////////////////////////
     
     // read the next non empty line, and store it in 'line'
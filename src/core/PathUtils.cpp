@@ -29,18 +29,22 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <fstream>
 #include <iostream>
 #include <limits>
+#include <map>
 #include <sstream>
+#include <vector>
 #include <sys/stat.h>
 #include <errno.h>
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "LruOrder.h"
 #include "Mutex.h"
 #include "PathUtils.h"
 #include "Platform.h"
 #include "pystring/pystring.h"
 
 #if !defined(WINDOWS)
+#include <dirent.h>
 #include <sys/param.h>
 #else
 #include <direct.h>
@@ -74,46 +78,122 @@ OCIO_NAMESPACE_ENTER
             return "";
         }
         
-        // We mutex both the main map and each item individually, so that
-        // the potentially slow stat calls dont block other lookups to already
-        // existing items. (The stat calls will block other lookups on the
-        // *same* file though).
+        // Lookups of files already in the map only take a read lock on it,
+        // so they do not block each other. Each item has its own mutex, so
+        // that the potentially slow stat calls dont block other lookups
+        // to already existing items. (The stat calls will block other
+        // lookups on the *same* file though).
         
         struct FileHashResult
         {
             Mutex mutex;
             std::string hash;
             bool ready;
+            // Set (atomically) once hash is final, after which it is read
+            // without the mutex
+            volatile long hashed;
+            // For the LRU eviction, the cache clock at the last lookup
+            volatile long lastUse;
             
             FileHashResult():
-                ready(false)
+                ready(false),
+                hashed(0),
+                lastUse(0)
             {}
         };
         
         typedef OCIO_SHARED_PTR<FileHashResult> FileHashResultPtr;
-        typedef std::map<std::string, FileHashResultPtr> FileCacheMap;
+        typedef LruOrder<std::string> FileCacheOrder;
+        
+        struct FileHashEntry
+        {
+            FileHashResultPtr result;
+            FileCacheOrder::Position order;
+        };
+        
+        typedef std::map<std::string, FileHashEntry> FileCacheMap;
         
         FileCacheMap g_fastFileHashCache;
-        Mutex g_fastFileHashCache_mutex;
+        FileCacheOrder g_fastFileHashCacheOrder;
+        size_t g_fastFileHashCacheBytes = 0;
+        volatile long g_fastFileHashCacheClock = 0;
+        volatile long g_fastFileHashCacheHits = 0;
+        long g_fastFileHashCacheMisses = 0;
+        long g_fastFileHashCacheEvictions = 0;
+        RWLock g_fastFileHashCache_lock;
+        
+        // The hash itself is a few dozen characters.
+        size_t GetFileHashEntrySize(const std::string & filename)
+        {
+            return sizeof(FileHashResult) + sizeof(FileCacheMap::value_type)
+                + filename.size() + 32;
+        }
+        
+        // You must manually acquire the fast file hash cache write lock
+        // before calling this. Evicts the least recently used entries,
+        // always keeping the most recent one.
+        void TrimPathCachesLocked()
+        {
+            size_t limit = GetCacheMemoryLimit();
+            
+            while(limit > 0 && g_fastFileHashCacheBytes > limit
+                  && g_fastFileHashCacheOrder.size() > 1)
+            {
+                FileCacheMap::iterator iter =
+                    g_fastFileHashCache.find(g_fastFileHashCacheOrder.back());
+                g_fastFileHashCacheBytes -= GetFileHashEntrySize(iter->first);
+                g_fastFileHashCacheOrder.erase(iter->second.order);
+                g_fastFileHashCache.erase(iter);
+                ++g_fastFileHashCacheEvictions;
+            }
+        }
     }
     
     std::string GetFastFileHash(const std::string & filename)
     {
         FileHashResultPtr fileHashResultPtr;
         {
-            AutoMutex lock(g_fastFileHashCache_mutex);
+            AutoReadLock lock(g_fastFileHashCache_lock);
+            FileCacheMap::iterator iter = g_fastFileHashCache.find(filename);
+            if(iter != g_fastFileHashCache.end())
+            {
+                AtomicAdd(&g_fastFileHashCacheHits, 1);
+                fileHashResultPtr = iter->second.result;
+            }
+        }
+        
+        if(!fileHashResultPtr)
+        {
+            AutoWriteLock lock(g_fastFileHashCache_lock);
+            // Another thread may have added it meanwhile
             FileCacheMap::iterator iter = g_fastFileHashCache.find(filename);
             if(iter != g_fastFileHashCache.end())
             {
-                fileHashResultPtr = iter->second;
+                AtomicAdd(&g_fastFileHashCacheHits, 1);
+                fileHashResultPtr = iter->second.result;
             }
             else
             {
+                ++g_fastFileHashCacheMisses;
                 fileHashResultPtr = FileHashResultPtr(new FileHashResult);
-                g_fastFileHashCache[filename] = fileHashResultPtr;
+                fileHashResultPtr->lastUse = AtomicAdd(&g_fastFileHashCacheClock, 1);
+                FileHashEntry & entry = g_fastFileHashCache[filename];
+                entry.result = fileHashResultPtr;
+                entry.order = g_fastFileHashCacheOrder.push(filename,
+                    &fileHashResultPtr->lastUse);
+                g_fastFileHashCacheBytes += GetFileHashEntrySize(filename);
+                TrimPathCachesLocked();
             }
         }
         
+        AtomicStore(&fileHashResultPtr->lastUse,
+                    AtomicAdd(&g_fastFileHashCacheClock, 1));
+        
+        if(AtomicLoad(&fileHashResultPtr->hashed))
+        {
+            return fileHashResultPtr->hash;
+        }
+        
         std::string hash;
         {
             AutoMutex lock(fileHashResultPtr->mutex);
@@ -121,6 +201,7 @@ OCIO_NAMESPACE_ENTER
             {
                 fileHashResultPtr->ready = true;
                 fileHashResultPtr->hash = ComputeHash(filename);
+                AtomicStore(&fileHashResultPtr->hashed, 1);
             }
             
             hash = fileHashResultPtr->hash;
@@ -135,10 +216,64 @@ OCIO_NAMESPACE_ENTER
         return (!hash.empty());
     }
     
+    bool GetDirectoryEntries(std::set<std::string> & entries,
+                             const std::string & dirname)
+    {
+        entries.clear();
+        
+#ifdef WINDOWS
+        std::string pattern = pystring::os::path::join(dirname, "*");
+        WIN32_FIND_DATAA data;
+        HANDLE handle = FindFirstFileA(pattern.c_str(), &data);
+        if(handle == INVALID_HANDLE_VALUE) return false;
+        
+        do
+        {
+            entries.insert(pystring::lower(data.cFileName));
+        }
+        while(FindNextFileA(handle, &data));
+        
+        FindClose(handle);
+#else
+        DIR * dir = opendir(dirname.c_str());
+        if(!dir) return false;
+        
+        while(struct dirent * entry = readdir(dir))
+        {
+            entries.insert(entry->d_name);
+        }
+        
+        closedir(dir);
+#endif
+        return true;
+    }
+    
     void ClearPathCaches()
     {
-        AutoMutex lock(g_fastFileHashCache_mutex);
+        AutoWriteLock lock(g_fastFileHashCache_lock);
         g_fastFileHashCache.clear();
+        g_fastFileHashCacheOrder.clear();
+        g_fastFileHashCacheBytes = 0;
+        AtomicStore(&g_fastFileHashCacheHits, 0);
+        g_fastFileHashCacheMisses = 0;
+        g_fastFileHashCacheEvictions = 0;
+    }
+    
+    void TrimPathCaches()
+    {
+        AutoWriteLock lock(g_fastFileHashCache_lock);
+        TrimPathCachesLocked();
+    }
+    
+    void GetPathCacheStats(long & entries, size_t & bytes,
+                           long & hits, long & misses, long & evictions)
+    {
+        AutoReadLock lock(g_fastFileHashCache_lock);
+        entries = (long)g_fastFileHashCache.size();
+        bytes = g_fastFileHashCacheBytes;
+        hits = AtomicLoad(&g_fastFileHashCacheHits);
+        misses = g_fastFileHashCacheMisses;
+        evictions = g_fastFileHashCacheEvictions;
     }
     
     namespace pystring
@@ -279,4 +414,47 @@ OIIO_ADD_TEST(PathUtils, EnvExpand)
     OIIO_CHECK_ASSERT( testresult == foo_result );
 }
 
+OIIO_ADD_TEST(PathUtils, FastFileHashCache)
+{
+    size_t oldLimit = OCIO::GetCacheMemoryLimit();
+    OCIO::SetCacheMemoryLimit(0);
+    OCIO::ClearAllCaches();
+    
+    // Missing files are cached as well, with an empty hash
+    for(int i=0; i<10; ++i)
+    {
+        std::ostringstream os;
+        os << "/ocio/missing/file" << i;
+        OIIO_CHECK_EQUAL(OCIO::GetFastFileHash(os.str()), "");
+    }
+    OCIO::GetFastFileHash("/ocio/missing/file0");
+    
+    long entries = 0, hits = 0, misses = 0, evictions = 0;
+    size_t bytes = 0;
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_FILE_HASH,
+                        entries, bytes, hits, misses, evictions);
+    OIIO_CHECK_EQUAL(entries, 10);
+    OIIO_CHECK_EQUAL(hits, 1);
+    OIIO_CHECK_EQUAL(misses, 10);
+    OIIO_CHECK_EQUAL(evictions, 0);
+    
+    OCIO::SetCacheMemoryLimit(bytes / 2);
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_FILE_HASH,
+                        entries, bytes, hits, misses, evictions);
+    OIIO_CHECK_EQUAL(entries, 5);
+    OIIO_CHECK_EQUAL(evictions, 5);
+    
+    // file0 was used last, file1 was evicted
+    OCIO::GetFastFileHash("/ocio/missing/file0");
+    OCIO::GetFastFileHash("/ocio/missing/file1");
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_FILE_HASH,
+                        entries, bytes, hits, misses, evictions);
+    OIIO_CHECK_EQUAL(hits, 2);
+    OIIO_CHECK_EQUAL(misses, 11);
+    OIIO_CHECK_EQUAL(entries, 5);
+    
+    OCIO::SetCacheMemoryLimit(oldLimit);
+    OCIO::ClearAllCaches();
+}
+
 #endif // OCIO_BUILD_TESTS
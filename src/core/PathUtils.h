@@ -33,6 +33,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <OpenColorIO/OpenColorIO.h>
 
 #include <map>
+#include <set>
+#include <string>
 
 OCIO_NAMESPACE_ENTER
 {
@@ -88,7 +90,22 @@ OCIO_NAMESPACE_ENTER
     // Currently, this checks the mtime and the inode number.
     std::string GetFastFileHash(const std::string & filename);
     
+    // Read the names of the entries (files and directories) of a
+    // directory, in one pass. Returns false if it cannot be read.
+    // On Windows, where file names are not case sensitive, the names are
+    // lower case.
+    bool GetDirectoryEntries(std::set<std::string> & entries,
+                             const std::string & dirname);
+    
     void ClearPathCaches();
+    
+    // Evicts the least recently used file hashes beyond the cache memory
+    // limit.
+    void TrimPathCaches();
+    
+    // The counters reported by GetCacheStats(CACHE_TYPE_FILE_HASH)
+    void GetPathCacheStats(long & entries, size_t & bytes,
+                           long & hits, long & misses, long & evictions);
 }
 OCIO_NAMESPACE_EXIT
 
@@ -127,7 +127,7 @@ OCIO_NAMESPACE_ENTER
 #define OCIO_LITTLE_ENDIAN 1  // This is correct on x86
 
     /*
-     * Mutex/SpinLock classes
+     * Mutex/SpinLock/Event/Semaphore classes
      */
 
 #ifdef WINDOWS
@@ -152,6 +152,54 @@ OCIO_NAMESPACE_ENTER
 	CRITICAL_SECTION _spinlock;
     };
 
+    // Many readers, or a single writer
+    class _RWLock {
+    public:
+	_RWLock()          { InitializeSRWLock(&_rwlock); }
+	~_RWLock()         { }
+	void readLock()    { AcquireSRWLockShared(&_rwlock); }
+	void readUnlock()  { ReleaseSRWLockShared(&_rwlock); }
+	void writeLock()   { AcquireSRWLockExclusive(&_rwlock); }
+	void writeUnlock() { ReleaseSRWLockExclusive(&_rwlock); }
+    private:
+	SRWLOCK _rwlock;
+    };
+
+    // Full memory barriers
+    inline long AtomicAdd(volatile long * value, long amount)
+    { return InterlockedExchangeAdd(value, amount) + amount; }
+    inline long AtomicLoad(volatile long * value)
+    { return InterlockedExchangeAdd(value, 0); }
+    inline void AtomicStore(volatile long * value, long newValue)
+    { InterlockedExchange(value, newValue); }
+    template<typename T>
+    inline T * AtomicLoadPtr(T * volatile * value)
+    { return static_cast<T *>(InterlockedCompareExchangePointer((PVOID volatile *) value, NULL, NULL)); }
+    template<typename T>
+    inline void AtomicStorePtr(T * volatile * value, T * newValue)
+    { InterlockedExchangePointer((PVOID volatile *) value, (PVOID) newValue); }
+
+    class _Event {
+    public:
+	_Event()       { _event = CreateEvent(NULL, TRUE, FALSE, NULL); }
+	~_Event()      { CloseHandle(_event); }
+	void set()     { SetEvent(_event); }
+	void wait()    { WaitForSingleObject(_event, INFINITE); }
+	bool isSet()   { return WaitForSingleObject(_event, 0) == WAIT_OBJECT_0; }
+    private:
+	HANDLE _event;
+    };
+
+    class _Semaphore {
+    public:
+	_Semaphore()   { _sem = CreateSemaphore(NULL, 0, MAXLONG, NULL); }
+	~_Semaphore()  { CloseHandle(_sem); }
+	void post()    { ReleaseSemaphore(_sem, 1, NULL); }
+	void wait()    { WaitForSingleObject(_sem, INFINITE); }
+    private:
+	HANDLE _sem;
+    };
+
 #else
     // assume linux/unix/posix
 
@@ -196,6 +244,74 @@ OCIO_NAMESPACE_ENTER
 	pthread_spinlock_t _spinlock;
     };
 #endif // __APPLE__
+
+    // Many readers, or a single writer
+    class _RWLock {
+    public:
+	_RWLock()          { pthread_rwlock_init(&_rwlock, 0); }
+	~_RWLock()         { pthread_rwlock_destroy(&_rwlock); }
+	void readLock()    { pthread_rwlock_rdlock(&_rwlock); }
+	void readUnlock()  { pthread_rwlock_unlock(&_rwlock); }
+	void writeLock()   { pthread_rwlock_wrlock(&_rwlock); }
+	void writeUnlock() { pthread_rwlock_unlock(&_rwlock); }
+    private:
+	pthread_rwlock_t _rwlock;
+    };
+
+    // Full memory barriers
+    inline long AtomicAdd(volatile long * value, long amount)
+    { return __sync_add_and_fetch(value, amount); }
+    inline long AtomicLoad(volatile long * value)
+    { return __sync_add_and_fetch(value, 0); }
+    inline void AtomicStore(volatile long * value, long newValue)
+    { __sync_synchronize(); (void)__sync_lock_test_and_set(value, newValue); }
+    template<typename T>
+    inline T * AtomicLoadPtr(T * volatile * value)
+    { return __sync_val_compare_and_swap(value, (T *) 0, (T *) 0); }
+    template<typename T>
+    inline void AtomicStorePtr(T * volatile * value, T * newValue)
+    { __sync_synchronize(); (void)__sync_lock_test_and_set(value, newValue); }
+
+    // A flag that threads can block on until it is set (once, for good)
+    class _Event {
+    public:
+	_Event() : _set(false) { pthread_mutex_init(&_mutex, 0);
+	                         pthread_cond_init(&_cond, 0); }
+	~_Event()     { pthread_cond_destroy(&_cond);
+	                pthread_mutex_destroy(&_mutex); }
+	void set()    { pthread_mutex_lock(&_mutex); _set = true;
+	                pthread_cond_broadcast(&_cond);
+	                pthread_mutex_unlock(&_mutex); }
+	void wait()   { pthread_mutex_lock(&_mutex);
+	                while(!_set) pthread_cond_wait(&_cond, &_mutex);
+	                pthread_mutex_unlock(&_mutex); }
+	bool isSet()  { pthread_mutex_lock(&_mutex); bool set = _set;
+	                pthread_mutex_unlock(&_mutex); return set; }
+    private:
+	pthread_mutex_t _mutex;
+	pthread_cond_t _cond;
+	bool _set;
+    };
+
+    // A counter that wait() blocks on until it is positive, then decrements
+    class _Semaphore {
+    public:
+	_Semaphore() : _count(0) { pthread_mutex_init(&_mutex, 0);
+	                           pthread_cond_init(&_cond, 0); }
+	~_Semaphore() { pthread_cond_destroy(&_cond);
+	                pthread_mutex_destroy(&_mutex); }
+	void post()   { pthread_mutex_lock(&_mutex); ++_count;
+	                pthread_cond_signal(&_cond);
+	                pthread_mutex_unlock(&_mutex); }
+	void wait()   { pthread_mutex_lock(&_mutex);
+	                while(_count == 0) pthread_cond_wait(&_cond, &_mutex);
+	                --_count;
+	                pthread_mutex_unlock(&_mutex); }
+    private:
+	pthread_mutex_t _mutex;
+	pthread_cond_t _cond;
+	long _count;
+    };
 #endif // WINDOWS
 
 }
@@ -0,0 +1,315 @@
+/*
+Copyright (c) 2003-2010 Sony Pictures Imageworks Inc., et al.
+All Rights Reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Sony Pictures Imageworks nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include <sstream>
+
+#include "FileTransform.h"
+#include "Logging.h"
+#include "Mutex.h"
+#include "Prefetch.h"
+#include "Threading.h"
+
+OCIO_NAMESPACE_ENTER
+{
+    struct PrefetchState
+    {
+        std::vector<std::string> filepaths;
+        int numFiles;
+        
+        Mutex errorsMutex;
+        std::vector<std::string> errors;
+        
+        Event done;
+        
+        PrefetchState() : numFiles(0) { }
+    };
+    
+    namespace
+    {
+        class LoadFilesBody : public ParallelForBody
+        {
+        public:
+            LoadFilesBody(PrefetchState & state) :
+                m_state(state)
+            { }
+            
+            virtual void run(int /*workerIndex*/, long itemBegin, long itemEnd) const
+            {
+                for(long i=itemBegin; i<itemEnd; ++i)
+                {
+                    try
+                    {
+                        PrefetchFile(m_state.filepaths[i]);
+                    }
+                    catch(std::exception & e)
+                    {
+                        AutoMutex lock(m_state.errorsMutex);
+                        m_state.errors.push_back(e.what());
+                    }
+                }
+            }
+            
+        private:
+            PrefetchState & m_state;
+            
+            LoadFilesBody& operator= (const LoadFilesBody &);
+        };
+        
+        // Loading is file access and parsing, so this does not follow the
+        // number of threads used by apply, only what the host can run.
+        
+        int GetPrefetchNumWorkers(long numFiles)
+        {
+            TaskExecutor * executor = GetTaskExecutor();
+            int numWorkers = executor ? executor->getConcurrency() : GetNumProcessors();
+            if(numFiles < static_cast<long>(numWorkers))
+            {
+                numWorkers = static_cast<int>(numFiles);
+            }
+            return numWorkers < 1 ? 1 : numWorkers;
+        }
+        
+        void PrefetchThreadMain(void * arg)
+        {
+            PrefetchStateRcPtr * statePtr = static_cast<PrefetchStateRcPtr *>(arg);
+            PrefetchStateRcPtr state = *statePtr;
+            delete statePtr;
+            
+            const long numFiles = static_cast<long>(state->filepaths.size());
+            try
+            {
+                ParallelFor(LoadFilesBody(*state), numFiles, 1,
+                            GetPrefetchNumWorkers(numFiles));
+            }
+            catch(std::exception & e)
+            {
+                AutoMutex lock(state->errorsMutex);
+                state->errors.push_back(e.what());
+            }
+            
+            if(IsDebugLoggingEnabled())
+            {
+                AutoMutex lock(state->errorsMutex);
+                std::ostringstream os;
+                os << "Prefetched " << state->numFiles << " files, ";
+                os << state->errors.size() << " failed.";
+                LogDebug(os.str());
+            }
+            
+            state->done.set();
+        }
+    }
+    
+    Prefetch::Impl::Impl() :
+        m_state(new PrefetchState)
+    { }
+    
+    Prefetch::Impl::~Impl()
+    { }
+    
+    void Prefetch::Impl::start(const std::vector<std::string> & filepaths,
+                               const std::vector<std::string> & errors)
+    {
+        m_state->filepaths = filepaths;
+        m_state->errors = errors;
+        m_state->numFiles = static_cast<int>(filepaths.size() + errors.size());
+        
+        if(filepaths.empty())
+        {
+            m_state->done.set();
+            return;
+        }
+        
+        // If no thread can be started, load on the calling thread instead
+        PrefetchStateRcPtr * statePtr = new PrefetchStateRcPtr(m_state);
+        if(!StartDetachedThread(PrefetchThreadMain, statePtr))
+        {
+            PrefetchThreadMain(statePtr);
+        }
+    }
+    
+    bool Prefetch::Impl::isDone() const
+    {
+        return m_state->done.isSet();
+    }
+    
+    void Prefetch::Impl::wait() const
+    {
+        m_state->done.wait();
+    }
+    
+    int Prefetch::Impl::getNumFiles() const
+    {
+        return m_state->numFiles;
+    }
+    
+    int Prefetch::Impl::getNumFailed() const
+    {
+        wait();
+        AutoMutex lock(m_state->errorsMutex);
+        return static_cast<int>(m_state->errors.size());
+    }
+    
+    const char * Prefetch::Impl::getFailure(int index) const
+    {
+        wait();
+        AutoMutex lock(m_state->errorsMutex);
+        if(index < 0 || index >= static_cast<int>(m_state->errors.size()))
+        {
+            return "";
+        }
+        return m_state->errors[index].c_str();
+    }
+    
+    ///////////////////////////////////////////////////////////////////////////
+    
+    Prefetch::Prefetch()
+    : m_impl(new Prefetch::Impl)
+    {
+    }
+    
+    Prefetch::~Prefetch()
+    {
+        delete m_impl;
+        m_impl = NULL;
+    }
+    
+    void Prefetch::deleter(Prefetch* c)
+    {
+        delete c;
+    }
+    
+    bool Prefetch::isDone() const
+    {
+        return getImpl()->isDone();
+    }
+    
+    void Prefetch::wait() const
+    {
+        getImpl()->wait();
+    }
+    
+    int Prefetch::getNumFiles() const
+    {
+        return getImpl()->getNumFiles();
+    }
+    
+    int Prefetch::getNumFailed() const
+    {
+        return getImpl()->getNumFailed();
+    }
+    
+    const char * Prefetch::getFailure(int index) const
+    {
+        return getImpl()->getFailure(index);
+    }
+}
+OCIO_NAMESPACE_EXIT
+
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef OCIO_UNIT_TEST
+
+namespace OCIO = OCIO_NAMESPACE;
+#include "UnitTest.h"
+
+namespace
+{
+    std::string CubeText(float scale)
+    {
+        std::ostringstream os;
+        os << "LUT_1D_SIZE 2\n";
+        os << "0.0 0.0 0.0\n";
+        os << scale << " " << scale << " " << scale << "\n";
+        return os.str();
+    }
+}
+
+OIIO_ADD_TEST(Prefetch, LoadsConfigFiles)
+{
+    OCIO::TempDirectory dir("prefetch");
+    dir.writeFile("a.cube", CubeText(0.5f));
+    dir.writeFile("b.cube", CubeText(2.0f));
+    
+    OCIO::ClearAllCaches();
+    
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    config->setWorkingDir(dir.getPath().c_str());
+    
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    group->push_back(OCIO::CreateFileTransform("b.cube"));
+    group->push_back(OCIO::CreateFileTransform("a.cube"));
+    
+    config->addColorSpace(OCIO::CreateColorSpace("a", OCIO::CreateFileTransform("a.cube")));
+    config->addColorSpace(OCIO::CreateColorSpace("ab", group));
+    config->addColorSpace(OCIO::CreateColorSpace("missing",
+                                                 OCIO::CreateFileTransform("missing.cube")));
+    
+    OCIO::LookRcPtr look = OCIO::Look::Create();
+    look->setName("look");
+    look->setTransform(OCIO::CreateFileTransform("look.cube"));
+    config->addLook(look);
+    
+    OCIO::ConstPrefetchRcPtr prefetch = config->prefetch();
+    prefetch->wait();
+    OIIO_CHECK_ASSERT(prefetch->isDone());
+    OIIO_CHECK_EQUAL(prefetch->getNumFiles(), 4);
+    OIIO_CHECK_EQUAL(prefetch->getNumFailed(), 2);
+    OIIO_CHECK_ASSERT(std::string(prefetch->getFailure(0)).find("missing.cube") != std::string::npos ||
+                      std::string(prefetch->getFailure(1)).find("missing.cube") != std::string::npos);
+    OIIO_CHECK_EQUAL(std::string(prefetch->getFailure(2)), "");
+    
+    // The processors find the files in the file cache
+    long entries = 0, hits = 0, misses = 0, evictions = 0;
+    size_t bytes = 0;
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_FILE,
+                        entries, bytes, hits, misses, evictions);
+    const long prefetchHits = hits;
+    const long prefetchMisses = misses;
+    
+    float rgb[3] = { 1.0f, 1.0f, 1.0f };
+    config->getProcessor(OCIO::CreateFileTransform("a.cube"))->applyRGB(rgb);
+    OIIO_CHECK_CLOSE(rgb[0], 0.5f, 1e-6f);
+    
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_FILE,
+                        entries, bytes, hits, misses, evictions);
+    OIIO_CHECK_ASSERT(hits > prefetchHits);
+    OIIO_CHECK_EQUAL(misses, prefetchMisses);
+    
+    // An empty config is done straight away
+    OCIO::ConstPrefetchRcPtr emptyPrefetch = OCIO::Config::Create()->prefetch();
+    OIIO_CHECK_ASSERT(emptyPrefetch->isDone());
+    OIIO_CHECK_EQUAL(emptyPrefetch->getNumFiles(), 0);
+    OIIO_CHECK_EQUAL(emptyPrefetch->getNumFailed(), 0);
+    
+    OCIO::ClearAllCaches();
+}
+
+#endif // OCIO_UNIT_TEST
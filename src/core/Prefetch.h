@@ -0,0 +1,72 @@
+/*
+Copyright (c) 2003-2010 Sony Pictures Imageworks Inc., et al.
+All Rights Reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Sony Pictures Imageworks nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef INCLUDED_OCIO_PREFETCH_H
+#define INCLUDED_OCIO_PREFETCH_H
+
+#include <string>
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+OCIO_NAMESPACE_ENTER
+{
+    // The files and results of a prefetch, shared with the background
+    // thread (which may outlive the handle).
+    struct PrefetchState;
+    typedef OCIO_SHARED_PTR<PrefetchState> PrefetchStateRcPtr;
+    
+    class Prefetch::Impl
+    {
+    public:
+        Impl();
+        ~Impl();
+        
+        // Load the resolved files in the background. 'errors' are those of
+        // the files that could not be resolved, reported as failures.
+        void start(const std::vector<std::string> & filepaths,
+                   const std::vector<std::string> & errors);
+        
+        bool isDone() const;
+        void wait() const;
+        
+        int getNumFiles() const;
+        int getNumFailed() const;
+        const char * getFailure(int index) const;
+        
+    private:
+        PrefetchStateRcPtr m_state;
+        
+        Impl(const Impl &);
+        Impl& operator= (const Impl &);
+    };
+}
+OCIO_NAMESPACE_EXIT
+
+#endif
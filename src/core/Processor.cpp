@@ -32,14 +32,19 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "GpuShaderUtils.h"
 #include "HashUtils.h"
 #include "Logging.h"
+#include "Lut1DOp.h"
 #include "Lut3DOp.h"
+#include "MathUtils.h"
 #include "NoOps.h"
 #include "OpBuilders.h"
 #include "Processor.h"
 #include "ScanlineHelper.h"
+#include "Threading.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstring>
+#include <limits>
 #include <sstream>
 
 OCIO_NAMESPACE_ENTER
@@ -174,6 +179,12 @@ OCIO_NAMESPACE_ENTER
     {
         getImpl()->apply(img);
     }
+    
+    void Processor::apply(const ImageDesc& srcImg, ImageDesc& dstImg) const
+    {
+        getImpl()->apply(srcImg, dstImg);
+    }
+    
     void Processor::applyRGB(float * pixel) const
     {
         getImpl()->applyRGB(pixel);
@@ -189,6 +200,19 @@ OCIO_NAMESPACE_ENTER
         return getImpl()->getCpuCacheID();
     }
     
+    ConstProcessorRcPtr Processor::getBakedProcessor(float maxError,
+                                                     int lut3DEdgeLen) const
+    {
+        ProcessorRcPtr processor = Processor::Create();
+        processor->getImpl()->bake(*getImpl(), maxError, lut3DEdgeLen);
+        return processor;
+    }
+    
+    bool Processor::isCpuBaked() const
+    {
+        return getImpl()->isCpuBaked();
+    }
+    
     const char * Processor::getGpuShaderText(const GpuShaderDesc & shaderDesc) const
     {
         return getImpl()->getGpuShaderText(shaderDesc);
@@ -209,6 +233,102 @@ OCIO_NAMESPACE_ENTER
         return getImpl()->getGpuLut3DCacheID(shaderDesc);
     }
     
+    namespace
+    {
+        const GpuLut1DTexture & GetGpuLut1DTextureAt(
+            const std::vector<GpuLut1DTexture> & lut1DTextures, int index)
+        {
+            if(index<0 || index>=(int) lut1DTextures.size())
+            {
+                std::ostringstream os;
+                os << "Invalid 1D lut texture index " << index << ", ";
+                os << lut1DTextures.size() << " textures are used.";
+                throw Exception(os.str().c_str());
+            }
+            
+            return lut1DTextures[index];
+        }
+        
+        const GpuUniform & GetGpuUniformAt(const GpuUniformVec & uniforms, int index)
+        {
+            if(index<0 || index>=(int) uniforms.size())
+            {
+                std::ostringstream os;
+                os << "Invalid shader uniform index " << index << ", ";
+                os << uniforms.size() << " uniforms are used.";
+                throw Exception(os.str().c_str());
+            }
+            
+            return uniforms[index];
+        }
+    }
+    
+    int Processor::getNumGpuLut1DTextures(const GpuShaderDesc & shaderDesc) const
+    {
+        return getImpl()->getNumGpuLut1DTextures(shaderDesc);
+    }
+    
+    const char * Processor::getGpuLut1DTextureName(const GpuShaderDesc & shaderDesc,
+                                                   int index) const
+    {
+        ConstGpuLut1DTexturesRcPtr lut1DTextures = getImpl()->getGpuLut1DTextures(shaderDesc);
+        return GetGpuLut1DTextureAt(*lut1DTextures, index).name.c_str();
+    }
+    
+    void Processor::getGpuLut1DTextureSize(int * width, int * height,
+                                           const GpuShaderDesc & shaderDesc,
+                                           int index) const
+    {
+        ConstGpuLut1DTexturesRcPtr lut1DTextures = getImpl()->getGpuLut1DTextures(shaderDesc);
+        const GpuLut1DTexture & texture = GetGpuLut1DTextureAt(*lut1DTextures, index);
+        if(width) *width = texture.width;
+        if(height) *height = texture.height;
+    }
+    
+    void Processor::getGpuLut1DTexture(float * lut1d, const GpuShaderDesc & shaderDesc,
+                                       int index) const
+    {
+        ConstGpuLut1DTexturesRcPtr lut1DTextures = getImpl()->getGpuLut1DTextures(shaderDesc);
+        const GpuLut1DTexture & texture = GetGpuLut1DTextureAt(*lut1DTextures, index);
+        if(!lut1d) return;
+        memcpy(lut1d, &texture.values[0], sizeof(float) * texture.values.size());
+    }
+    
+    const char * Processor::getGpuLut1DTextureCacheID(const GpuShaderDesc & shaderDesc,
+                                                      int index) const
+    {
+        ConstGpuLut1DTexturesRcPtr lut1DTextures = getImpl()->getGpuLut1DTextures(shaderDesc);
+        return GetGpuLut1DTextureAt(*lut1DTextures, index).cacheID.c_str();
+    }
+    
+    int Processor::getNumGpuUniforms(const GpuShaderDesc & shaderDesc) const
+    {
+        return getImpl()->getNumGpuUniforms(shaderDesc);
+    }
+    
+    const char * Processor::getGpuUniformName(const GpuShaderDesc & shaderDesc,
+                                              int index) const
+    {
+        ConstGpuUniformsRcPtr uniforms = getImpl()->getGpuUniforms(shaderDesc);
+        return GetGpuUniformAt(*uniforms, index).name.c_str();
+    }
+    
+    GpuUniformType Processor::getGpuUniformType(const GpuShaderDesc & shaderDesc,
+                                                int index) const
+    {
+        ConstGpuUniformsRcPtr uniforms = getImpl()->getGpuUniforms(shaderDesc);
+        return GetGpuUniformAt(*uniforms, index).type;
+    }
+    
+    void Processor::getGpuUniformValue(float * values, const GpuShaderDesc & shaderDesc,
+                                       int index) const
+    {
+        ConstGpuUniformsRcPtr uniforms = getImpl()->getGpuUniforms(shaderDesc);
+        const GpuUniform & uniform = GetGpuUniformAt(*uniforms, index);
+        if(!values) return;
+        memcpy(values, &uniform.values[0], sizeof(float) * uniform.values.size());
+    }
+    
     
     
     //////////////////////////////////////////////////////////////////////////
@@ -219,7 +339,9 @@ OCIO_NAMESPACE_ENTER
     {
         void WriteShaderHeader(std::ostream & shader,
                                const std::string & pixelName,
-                               const GpuShaderDesc & shaderDesc)
+                               const GpuShaderDesc & shaderDesc,
+                               const std::vector<GpuLut1DTexture> & lut1DTextures,
+                               const GpuUniformVec & uniforms)
         {
             if(!shader) return;
             
@@ -227,41 +349,76 @@ OCIO_NAMESPACE_ENTER
             
             shader << "\n// Generated by OpenColorIO\n\n";
             
-            GpuLanguage lang = shaderDesc.getLanguage();
+            const GpuShaderWriter & writer = GetGpuShaderWriter(shaderDesc.getLanguage());
             
-            std::string fcnName = shaderDesc.getFunctionName();
+            writer.writeDeclarations(shader, uniforms);
             
-            if(lang == GPU_LANGUAGE_CG)
-            {
-                shader << "half4 " << fcnName << "(in half4 inPixel," << "\n";
-                shader << "    const uniform sampler3D " << lut3dName << ") \n";
-            }
-            else if(lang == GPU_LANGUAGE_GLSL_1_0)
-            {
-                shader << "vec4 " << fcnName << "(vec4 inPixel, \n";
-                shader << "    sampler3D " << lut3dName << ") \n";
-            }
-            else if(lang == GPU_LANGUAGE_GLSL_1_3)
+            GpuShaderSamplerVec samplers;
+            GpuShaderSampler sampler;
+            sampler.name = lut3dName;
+            sampler.dimensions = 3;
+            samplers.push_back(sampler);
+            for(unsigned int i=0; i<lut1DTextures.size(); ++i)
             {
-                shader << "vec4 " << fcnName << "(in vec4 inPixel, \n";
-                shader << "    const sampler3D " << lut3dName << ") \n";
+                sampler.name = lut1DTextures[i].name;
+                sampler.dimensions = (lut1DTextures[i].height == 1) ? 1 : 2;
+                samplers.push_back(sampler);
             }
-            else throw Exception("Unsupported shader language.");
+            
+            writer.writeFunctionBegin(shader, shaderDesc.getFunctionName(),
+                                      samplers, uniforms);
             
             shader << "{" << "\n";
+            shader << writer.halfType(4) << " " << pixelName << " = inPixel; \n";
+        }
+        
+        
+        // The 1D luts that can be sampled from textures use the next one
+        // of lut1DTextures, if any, the other ops write their own code
+        // (adding to uniforms if they are enabled).
+        void WriteOpGpuShader(std::ostream & shader,
+                              const std::string & pixelName,
+                              const OpRcPtr & op,
+                              const GpuShaderDesc & shaderDesc,
+                              const std::vector<GpuLut1DTexture> & lut1DTextures,
+                              int & lut1DTextureIndex,
+                              GpuUniformVec & uniforms)
+        {
+            Lut1DRcPtr lut;
+            Interpolation interpolation;
+            if(!GetGpuLut1DTexture(lut, interpolation, op))
+            {
+                if(shaderDesc.getUniformsEnabled())
+                {
+                    op->writeGpuShaderUniforms(shader, pixelName, shaderDesc, uniforms);
+                }
+                else
+                {
+                    op->writeGpuShader(shader, pixelName, shaderDesc);
+                }
+                return;
+            }
             
-            if(lang == GPU_LANGUAGE_CG)
+            if(lut1DTextureIndex >= (int) lut1DTextures.size())
             {
-                shader << "half4 " << pixelName << " = inPixel; \n";
+                throw Exception("Missing 1D lut texture for the gpu shader.");
             }
-            else if(lang == GPU_LANGUAGE_GLSL_1_0 || lang == GPU_LANGUAGE_GLSL_1_3)
+            const GpuLut1DTexture & texture = lut1DTextures[lut1DTextureIndex++];
+            
+            float domainScale[3];
+            for(int c=0; c<3; ++c)
             {
-                shader << "vec4 " << pixelName << " = inPixel; \n";
+                domainScale[c] = 1.0f / (lut->from_max[c] - lut->from_min[c]);
             }
-            else throw Exception("Unsupported shader language.");
+            
+            Write_applyLut1D_rgb(shader, pixelName, texture.name,
+                                 lut->from_min, domainScale,
+                                 (int) lut->luts[0].size(),
+                                 texture.width, texture.height,
+                                 interpolation == INTERP_NEAREST,
+                                 shaderDesc.getLanguage());
         }
         
-        
         void WriteShaderFooter(std::ostream & shader,
                                const std::string & pixelName,
                                const GpuShaderDesc & /*shaderDesc*/)
@@ -275,13 +432,90 @@ OCIO_NAMESPACE_ENTER
     //////////////////////////////////////////////////////////////////////////
     
     
+    namespace
+    {
+        // Keep the gpu results of this many shader descriptions
+        const unsigned int MAX_GPU_SHADER_RESULTS = 4;
+        
+        // Over all processors
+        volatile long g_gpuShaderCacheEntries = 0;
+        volatile long g_gpuShaderCacheBytes = 0;
+        volatile long g_gpuShaderCacheHits = 0;
+        volatile long g_gpuShaderCacheMisses = 0;
+        volatile long g_gpuShaderCacheEvictions = 0;
+    }
+    
+    size_t GpuShaderResults::getMemorySize() const
+    {
+        size_t size = sizeof(GpuShaderResults) + shaderDescCacheID.capacity();
+        if(shader) size += shader->capacity();
+        if(shaderCacheID) size += shaderCacheID->capacity();
+        if(lut3DCacheID) size += lut3DCacheID->capacity();
+        if(lut3D) size += lut3D->capacity() * sizeof(float);
+        if(lut1DTextures)
+        {
+            for(unsigned int i=0; i<lut1DTextures->size(); ++i)
+            {
+                size += sizeof(GpuLut1DTexture)
+                        + (*lut1DTextures)[i].values.capacity() * sizeof(float);
+            }
+        }
+        if(uniforms)
+        {
+            for(unsigned int i=0; i<uniforms->size(); ++i)
+            {
+                size += sizeof(GpuUniform) + (*uniforms)[i].name.capacity()
+                        + (*uniforms)[i].values.capacity() * sizeof(float);
+            }
+        }
+        return size;
+    }
+    
+    void GetGpuShaderCacheStats(long & entries, size_t & bytes,
+                                long & hits, long & misses, long & evictions)
+    {
+        entries = AtomicLoad(&g_gpuShaderCacheEntries);
+        bytes = (size_t) AtomicLoad(&g_gpuShaderCacheBytes);
+        hits = AtomicLoad(&g_gpuShaderCacheHits);
+        misses = AtomicLoad(&g_gpuShaderCacheMisses);
+        evictions = AtomicLoad(&g_gpuShaderCacheEvictions);
+    }
+    
+    void ClearGpuShaderCacheStats()
+    {
+        AtomicStore(&g_gpuShaderCacheHits, 0);
+        AtomicStore(&g_gpuShaderCacheMisses, 0);
+        AtomicStore(&g_gpuShaderCacheEvictions, 0);
+    }
+    
     Processor::Impl::Impl():
-        m_metadata(ProcessorMetadata::Create())
+        m_metadata(ProcessorMetadata::Create()),
+        m_cpuBaked(false),
+        m_hasGpuLut1DTextureOps(false),
+        m_gpuResultsTable(0),
+        m_gpuResultsReaders(0),
+        m_gpuResultsClock(0)
     {
     }
     
     Processor::Impl::~Impl()
-    { }
+    {
+        if(m_gpuResultsTable)
+        {
+            const GpuShaderResultsTable & table = *m_gpuResultsTable;
+            for(unsigned int i=0; i<table.size(); ++i)
+            {
+                AtomicAdd(&g_gpuShaderCacheEntries, -1);
+                AtomicAdd(&g_gpuShaderCacheBytes, -(long) table[i]->getMemorySize());
+            }
+            delete m_gpuResultsTable;
+        }
+        
+        for(unsigned int i=0; i<m_retiredGpuResultsTables.size(); ++i)
+        {
+            delete m_retiredGpuResultsTables[i];
+        }
+    }
     
     bool Processor::Impl::isNoOp() const
     {
@@ -303,43 +537,235 @@ OCIO_NAMESPACE_ENTER
         return m_metadata;
     }
     
-    void Processor::Impl::apply(ImageDesc& img) const
+    namespace
+    {
+        // For multithreaded apply, the image is split into bands of this
+        // many pixels (in scanline order), which are the unit of work that
+        // the workers take from (and steal from) each other.
+        const long PIXELS_PER_BAND = 16384;
+        
+        void ApplyOpsToScanlines(const CpuProgram & program,
+                                 ScanlineHelper & scanlineHelper)
+        {
+            float * rgbaBuffer = 0;
+            long numPixels = 0;
+            
+            while(true)
+            {
+                scanlineHelper.prepRGBAScanline(&rgbaBuffer, &numPixels);
+                if(numPixels == 0) break;
+                if(!rgbaBuffer)
+                    throw Exception("Cannot apply transform; null image.");
+                
+                program.apply(rgbaBuffer, numPixels);
+                
+                scanlineHelper.finishRGBAScanline();
+            }
+        }
+        
+        ScanlineHelper * CreateScanlineHelper(const GenericImageDesc * srcImg,
+                                              const GenericImageDesc & dstImg)
+        {
+            if(srcImg) return new ScanlineHelper(*srcImg, dstImg);
+            return new ScanlineHelper(dstImg);
+        }
+        
+        // Each worker lazily gets its own ScanlineHelper (and so its own
+        // packing buffer), which is reused for all the bands it processes.
+        // srcImg is NULL when processing in place.
+        
+        class ApplyImageBody : public ParallelForBody
+        {
+        public:
+            ApplyImageBody(const CpuProgram & program,
+                           const GenericImageDesc * srcImg,
+                           const GenericImageDesc & dstImg,
+                           int numWorkers) :
+                m_program(program),
+                m_srcImg(srcImg),
+                m_dstImg(dstImg),
+                m_helpers(numWorkers, static_cast<ScanlineHelper*>(0))
+            { }
+            
+            ~ApplyImageBody()
+            {
+                for(unsigned int i=0; i<m_helpers.size(); ++i)
+                {
+                    delete m_helpers[i];
+                }
+            }
+            
+            virtual void run(int workerIndex, long bandBegin, long bandEnd) const
+            {
+                ScanlineHelper *& scanlineHelper = m_helpers[workerIndex];
+                if(!scanlineHelper)
+                {
+                    scanlineHelper = CreateScanlineHelper(m_srcImg, m_dstImg);
+                }
+                
+                scanlineHelper->setPixelRange(bandBegin * PIXELS_PER_BAND,
+                                              bandEnd * PIXELS_PER_BAND);
+                ApplyOpsToScanlines(m_program, *scanlineHelper);
+            }
+            
+        private:
+            const CpuProgram & m_program;
+            const GenericImageDesc * m_srcImg;
+            const GenericImageDesc & m_dstImg;
+            mutable std::vector<ScanlineHelper*> m_helpers;
+            
+            ApplyImageBody(const ApplyImageBody &);
+            ApplyImageBody& operator= (const ApplyImageBody &);
+        };
+        
+        void ApplyToImage(const CpuProgram & program,
+                          const GenericImageDesc * srcImg,
+                          const GenericImageDesc & dstImg)
+        {
+            long numBands = (dstImg.width * dstImg.height + PIXELS_PER_BAND - 1)
+                            / PIXELS_PER_BAND;
+            int numWorkers = GetParallelForNumWorkers(numBands);
+            
+            if(numWorkers <= 1)
+            {
+                if(srcImg)
+                {
+                    ScanlineHelper scanlineHelper(*srcImg, dstImg);
+                    ApplyOpsToScanlines(program, scanlineHelper);
+                }
+                else
+                {
+                    ScanlineHelper scanlineHelper(dstImg);
+                    ApplyOpsToScanlines(program, scanlineHelper);
+                }
+                return;
+            }
+            
+            ApplyImageBody body(program, srcImg, dstImg, numWorkers);
+            ParallelFor(body, numBands, 1, numWorkers);
+        }
+    }
+    
+    namespace
     {
-        if(m_cpuOps.empty()) return;
+        // The lattice is baked in blocks of this many points, small enough
+        // for a block to stay in cache from the identity to the rgb output.
+        const long GPU_LUT3D_BLOCK_SIZE = 4096;
         
-        ScanlineHelper scanlineHelper(img);
-        float * rgbaBuffer = 0;
-        long numPixels = 0;
+        // Each worker fills a scratch rgba block of its own with lattice
+        // points, runs the lattice ops on it, and writes the rgb results
+        // straight to the 3D lut. (Same values as GenerateIdentityLut3D
+        // then applying the ops to the whole rgba lattice.)
         
-        while(true)
+        class GpuLut3DBody : public ParallelForBody
         {
-            scanlineHelper.prepRGBAScanline(&rgbaBuffer, &numPixels);
-            if(numPixels == 0) break;
-            if(!rgbaBuffer)
-                throw Exception("Cannot apply transform; null image.");
+        public:
+            GpuLut3DBody(float * lut3d, int edgeLen,
+                         const CpuProgram & program,
+                         int numWorkers) :
+                m_lut3d(lut3d),
+                m_edgeLen(edgeLen),
+                m_program(program),
+                m_scratch(numWorkers)
+            { }
             
-            for(OpRcPtrVec::size_type i=0, size = m_cpuOps.size(); i<size; ++i)
+            virtual void run(int workerIndex, long blockBegin, long blockEnd) const
             {
-                m_cpuOps[i]->apply(rgbaBuffer, numPixels);
+                std::vector<float> & scratch = m_scratch[workerIndex];
+                scratch.resize(4 * GPU_LUT3D_BLOCK_SIZE);
+                
+                const long edgeLen = m_edgeLen;
+                const long numPoints = edgeLen * edgeLen * edgeLen;
+                const float c = 1.0f / ((float)m_edgeLen - 1.0f);
+                
+                for(long block=blockBegin; block<blockEnd; ++block)
+                {
+                    const long begin = block * GPU_LUT3D_BLOCK_SIZE;
+                    const long end = std::min(begin + GPU_LUT3D_BLOCK_SIZE, numPoints);
+                    
+                    float * rgba = &scratch[0];
+                    for(long i=begin; i<end; ++i, rgba+=4)
+                    {
+                        rgba[0] = (float)(i%edgeLen) * c;
+                        rgba[1] = (float)((i/edgeLen)%edgeLen) * c;
+                        rgba[2] = (float)((i/edgeLen/edgeLen)%edgeLen) * c;
+                        rgba[3] = 0.0f;
+                    }
+                    
+                    m_program.apply(&scratch[0], end - begin);
+                    
+                    rgba = &scratch[0];
+                    float * rgb = m_lut3d + 3 * begin;
+                    for(long i=begin; i<end; ++i, rgba+=4, rgb+=3)
+                    {
+                        rgb[0] = rgba[0];
+                        rgb[1] = rgba[1];
+                        rgb[2] = rgba[2];
+                    }
+                }
             }
             
-            scanlineHelper.finishRGBAScanline();
+        private:
+            float * m_lut3d;
+            int m_edgeLen;
+            const CpuProgram & m_program;
+            mutable std::vector< std::vector<float> > m_scratch;
+            
+            GpuLut3DBody(const GpuLut3DBody &);
+            GpuLut3DBody& operator= (const GpuLut3DBody &);
+        };
+        
+        // Bake the lattice ops (compiled in program) into an rgb 3D lut,
+        // in the LUT3DORDER_FAST_RED order.
+        void BakeGpuLut3D(float * lut3d, int edgeLen, const CpuProgram & program)
+        {
+            const long numPoints = (long)edgeLen * edgeLen * edgeLen;
+            const long numBlocks = (numPoints + GPU_LUT3D_BLOCK_SIZE - 1)
+                                   / GPU_LUT3D_BLOCK_SIZE;
+            const int numWorkers = GetParallelForNumWorkers(numBlocks);
+            
+            GpuLut3DBody body(lut3d, edgeLen, program, numWorkers);
+            ParallelFor(body, numBlocks, 1, numWorkers);
+        }
+    }
+    
+    void Processor::Impl::apply(ImageDesc& img) const
+    {
+        if(m_cpuProgram.empty()) return;
+        
+        GenericImageDesc genericImg;
+        genericImg.init(img);
+        
+        ApplyToImage(m_cpuProgram, NULL, genericImg);
+    }
+    
+    void Processor::Impl::apply(const ImageDesc& srcImg, ImageDesc& dstImg) const
+    {
+        if(&srcImg == &dstImg)
+        {
+            apply(dstImg);
+            return;
         }
+        
+        // Even for a no-op, the pixels are copied (and converted)
+        GenericImageDesc genericSrcImg;
+        genericSrcImg.init(srcImg);
+        GenericImageDesc genericDstImg;
+        genericDstImg.init(dstImg);
+        
+        ApplyToImage(m_cpuProgram, &genericSrcImg, genericDstImg);
     }
     
     void Processor::Impl::applyRGB(float * pixel) const
     {
-        if(m_cpuOps.empty()) return;
+        if(m_cpuProgram.empty()) return;
         
         // We need to allocate a temp array as the pixel must be 4 floats in size
         // (otherwise, sse loads will potentially fail)
         
         float rgbaBuffer[4] = { pixel[0], pixel[1], pixel[2], 0.0f };
         
-        for(OpRcPtrVec::size_type i=0, size = m_cpuOps.size(); i<size; ++i)
-        {
-            m_cpuOps[i]->apply(rgbaBuffer, 1);
-        }
+        m_cpuProgram.apply(rgbaBuffer, 1);
         
         pixel[0] = rgbaBuffer[0];
         pixel[1] = rgbaBuffer[1];
@@ -348,10 +774,7 @@ OCIO_NAMESPACE_ENTER
     
     void Processor::Impl::applyRGBA(float * pixel) const
     {
-        for(OpRcPtrVec::size_type i=0, size = m_cpuOps.size(); i<size; ++i)
-        {
-            m_cpuOps[i]->apply(pixel, 1);
-        }
+        m_cpuProgram.apply(pixel, 1);
     }
     
     const char * Processor::Impl::getCpuCacheID() const
@@ -360,16 +783,18 @@ OCIO_NAMESPACE_ENTER
         
         if(!m_cpuCacheID.empty()) return m_cpuCacheID.c_str();
         
-        if(m_cpuOps.empty())
+        const OpRcPtrVec & ops = m_cpuBaked ? m_cpuBakedOps : m_cpuOps;
+        
+        if(ops.empty())
         {
             m_cpuCacheID = "<NOOP>";
         }
         else
         {
             std::ostringstream cacheid;
-            for(OpRcPtrVec::size_type i=0, size = m_cpuOps.size(); i<size; ++i)
+            for(OpRcPtrVec::size_type i=0, size = ops.size(); i<size; ++i)
             {
-                cacheid << m_cpuOps[i]->getCacheID() << " ";
+                cacheid << ops[i]->getCacheID() << " ";
             }
             std::string fullstr = cacheid.str();
             
@@ -379,6 +804,11 @@ OCIO_NAMESPACE_ENTER
         return m_cpuCacheID.c_str();
     }
     
+    bool Processor::Impl::isCpuBaked() const
+    {
+        return m_cpuBaked;
+    }
+    
     
     ///////////////////////////////////////////////////////////////////////////
     
@@ -387,192 +817,506 @@ OCIO_NAMESPACE_ENTER
     
     const char * Processor::Impl::getGpuShaderText(const GpuShaderDesc & shaderDesc) const
     {
-        AutoMutex lock(m_resultsCacheMutex);
+        const std::string key = shaderDesc.getCacheID();
         
-        if(m_lastShaderDesc != shaderDesc.getCacheID())
+        ConstGpuShaderResultsRcPtr results = findGpuResults(key);
+        if(results && results->shader)
         {
-            m_lastShaderDesc = shaderDesc.getCacheID();
-            m_shader = "";
-            m_shaderCacheID = "";
-            m_lut3D.clear();
-            m_lut3DCacheID = "";
+            AtomicAdd(&g_gpuShaderCacheHits, 1);
+            return results->shader->c_str();
         }
         
-        if(m_shader.empty())
+        AtomicAdd(&g_gpuShaderCacheMisses, 1);
+        
+        GpuLut1DTexturesRcPtr lut1DTextures(new std::vector<GpuLut1DTexture>);
+        calcGpuLut1DTextures(*lut1DTextures, shaderDesc);
+        GpuUniformsRcPtr uniforms(new GpuUniformVec);
+        std::ostringstream shader;
+        calcGpuShaderText(shader, shaderDesc, *lut1DTextures, *uniforms);
+        
+        if(IsDebugLoggingEnabled())
         {
-            std::ostringstream shader;
-            calcGpuShaderText(shader, shaderDesc);
-            m_shader = shader.str();
-            
-            if(IsDebugLoggingEnabled())
-            {
-                LogDebug("GPU Shader");
-                LogDebug(m_shader);
-            }
+            LogDebug("GPU Shader");
+            LogDebug(shader.str());
         }
         
-        return m_shader.c_str();
+        AutoMutex lock(m_gpuResultsMutex);
+        
+        GpuShaderResultsRcPtr newResults = copyGpuResults(key);
+        setGpuShaderText(*newResults, shader.str(), lut1DTextures, uniforms);
+        publishGpuResults(newResults);
+        
+        return newResults->shader->c_str();
     }
     
     const char * Processor::Impl::getGpuShaderTextCacheID(const GpuShaderDesc & shaderDesc) const
     {
-        AutoMutex lock(m_resultsCacheMutex);
+        const std::string key = shaderDesc.getCacheID();
         
-        if(m_lastShaderDesc != shaderDesc.getCacheID())
+        ConstGpuShaderResultsRcPtr results = findGpuResults(key);
+        if(results && results->shaderCacheID)
         {
-            m_lastShaderDesc = shaderDesc.getCacheID();
-            m_shader = "";
-            m_shaderCacheID = "";
-            m_lut3D.clear();
-            m_lut3DCacheID = "";
+            return results->shaderCacheID->c_str();
         }
         
-        if(m_shader.empty())
+        // The text is kept as well, along with what was built for it
+        std::string shader;
+        GpuLut1DTexturesRcPtr lut1DTextures;
+        GpuUniformsRcPtr uniforms;
+        if(results && results->shader)
+        {
+            shader = *results->shader;
+        }
+        else
         {
-            std::ostringstream shader;
-            calcGpuShaderText(shader, shaderDesc);
-            m_shader = shader.str();
+            lut1DTextures = GpuLut1DTexturesRcPtr(new std::vector<GpuLut1DTexture>);
+            calcGpuLut1DTextures(*lut1DTextures, shaderDesc);
+            uniforms = GpuUniformsRcPtr(new GpuUniformVec);
+            std::ostringstream os;
+            calcGpuShaderText(os, shaderDesc, *lut1DTextures, *uniforms);
+            shader = os.str();
         }
         
-        if(m_shaderCacheID.empty())
+        const std::string shaderCacheID = CacheIDHash(shader.c_str(), (int)shader.size());
+        
+        AutoMutex lock(m_gpuResultsMutex);
+        
+        GpuShaderResultsRcPtr newResults = copyGpuResults(key);
+        if(lut1DTextures)
+        {
+            setGpuShaderText(*newResults, shader, lut1DTextures, uniforms);
+        }
+        if(!newResults->shaderCacheID)
         {
-            m_shaderCacheID = CacheIDHash(m_shader.c_str(), (int)m_shader.size());
+            newResults->shaderCacheID = ConstStringRcPtr(new std::string(shaderCacheID));
         }
+        publishGpuResults(newResults);
         
-        return m_shaderCacheID.c_str();
+        return newResults->shaderCacheID->c_str();
     }
     
     
     const char * Processor::Impl::getGpuLut3DCacheID(const GpuShaderDesc & shaderDesc) const
     {
-        AutoMutex lock(m_resultsCacheMutex);
+        const std::string key = shaderDesc.getCacheID();
         
-        if(m_lastShaderDesc != shaderDesc.getCacheID())
+        ConstGpuShaderResultsRcPtr results = findGpuResults(key);
+        if(results && results->lut3DCacheID)
         {
-            m_lastShaderDesc = shaderDesc.getCacheID();
-            m_shader = "";
-            m_shaderCacheID = "";
-            m_lut3D.clear();
-            m_lut3DCacheID = "";
+            return results->lut3DCacheID->c_str();
         }
         
-        if(m_lut3DCacheID.empty())
+        const std::string cacheID = calcGpuLut3DCacheID(shaderDesc);
+        
+        AutoMutex lock(m_gpuResultsMutex);
+        
+        GpuShaderResultsRcPtr newResults = copyGpuResults(key);
+        if(!newResults->lut3DCacheID)
         {
-            if(m_gpuOpsCpuLatticeProcess.empty())
-            {
-                m_lut3DCacheID = "<NULL>";
-            }
-            else
-            {
-                std::ostringstream cacheid;
-                for(OpRcPtrVec::size_type i=0, size = m_gpuOpsCpuLatticeProcess.size(); i<size; ++i)
-                {
-                    cacheid << m_gpuOpsCpuLatticeProcess[i]->getCacheID() << " ";
-                }
-                // Also, add a hash of the shader description
-                cacheid << shaderDesc.getCacheID();
-                std::string fullstr = cacheid.str();
-                m_lut3DCacheID = CacheIDHash(fullstr.c_str(), (int)fullstr.size());
-            }
+            newResults->lut3DCacheID = ConstStringRcPtr(new std::string(cacheID));
         }
+        publishGpuResults(newResults);
         
-        return m_lut3DCacheID.c_str();
+        return newResults->lut3DCacheID->c_str();
     }
     
     void Processor::Impl::getGpuLut3D(float* lut3d, const GpuShaderDesc & shaderDesc) const
     {
         if(!lut3d) return;
         
-        AutoMutex lock(m_resultsCacheMutex);
-        
-        if(m_lastShaderDesc != shaderDesc.getCacheID())
-        {
-            m_lastShaderDesc = shaderDesc.getCacheID();
-            m_shader = "";
-            m_shaderCacheID = "";
-            m_lut3D.clear();
-            m_lut3DCacheID = "";
-        }
-        
         int lut3DEdgeLen = shaderDesc.getLut3DEdgeLen();
         int lut3DNumPixels = lut3DEdgeLen*lut3DEdgeLen*lut3DEdgeLen;
+        if(lut3DNumPixels <= 0) return;
         
         // Can we write the entire shader using only shader text?
         // If so, the lut3D is not needed so clear it.
         // This is preferable to identity, as it lets people notice if
         // it's accidentally being used.
-        if(m_gpuOpsCpuLatticeProcess.empty())
+        if(getGpuLatticeOps(shaderDesc).empty())
         {
             memset(lut3d, 0, sizeof(float) * 3 * lut3DNumPixels);
             return;
         }
         
-        if(m_lut3D.empty())
+        const std::string key = shaderDesc.getCacheID();
+        
+        ConstGpuShaderResultsRcPtr results = findGpuResults(key);
+        if(results && results->lut3D)
         {
-            // Allocate 3dlut image, RGBA
-            m_lut3D.resize(lut3DNumPixels*4);
-            GenerateIdentityLut3D(&m_lut3D[0], lut3DEdgeLen, 4, LUT3DORDER_FAST_RED);
-            
-            // Apply the lattice ops to it
-            for(int i=0; i<(int)m_gpuOpsCpuLatticeProcess.size(); ++i)
-            {
-                m_gpuOpsCpuLatticeProcess[i]->apply(&m_lut3D[0], lut3DNumPixels);
-            }
-            
-            // Convert the RGBA image to an RGB image, in place.
-            // Of course, this only works because we're doing it from left to right
-            // so old pixels are read before they're written over
-            // TODO: is this bad for memory access patterns?
-            //       see if this is faster with a 2nd temp float array
-            
-            for(int i=1; i<lut3DNumPixels; ++i) // skip the 1st pixel, it's ok.
-            {
-                m_lut3D[3*i+0] = m_lut3D[4*i+0];
-                m_lut3D[3*i+1] = m_lut3D[4*i+1];
-                m_lut3D[3*i+2] = m_lut3D[4*i+2];
-            }
+            AtomicAdd(&g_gpuShaderCacheHits, 1);
+            memcpy(lut3d, &(*results->lut3D)[0], sizeof(float) * 3 * lut3DNumPixels);
+            return;
+        }
+        
+        AtomicAdd(&g_gpuShaderCacheMisses, 1);
+        
+        // Two threads asking for the same new lut both bake it, and the
+        // first one in is kept.
+        OCIO_SHARED_PTR<std::vector<float> > values(new std::vector<float>(3 * lut3DNumPixels));
+        BakeGpuLut3D(&(*values)[0], lut3DEdgeLen,
+                     useGpuLut1DTextures(shaderDesc) ? m_gpuTexLatticeProgram
+                                                     : m_gpuLatticeProgram);
+        const std::string cacheID = calcGpuLut3DCacheID(shaderDesc);
+        
+        AutoMutex lock(m_gpuResultsMutex);
+        
+        GpuShaderResultsRcPtr newResults = copyGpuResults(key);
+        if(!newResults->lut3D) newResults->lut3D = values;
+        if(!newResults->lut3DCacheID)
+        {
+            newResults->lut3DCacheID = ConstStringRcPtr(new std::string(cacheID));
         }
+        publishGpuResults(newResults);
         
-        // Copy to the destination
-        memcpy(lut3d, &m_lut3D[0], sizeof(float) * 3 * lut3DNumPixels);
+        memcpy(lut3d, &(*newResults->lut3D)[0], sizeof(float) * 3 * lut3DNumPixels);
     }
     
-    
-    
-    ///////////////////////////////////////////////////////////////////////////
-    
-    
-    
-    void Processor::Impl::addColorSpaceConversion(const Config & config,
-                                 const ConstContextRcPtr & context,
-                                 const ConstColorSpaceRcPtr & srcColorSpace,
-                                 const ConstColorSpaceRcPtr & dstColorSpace)
+    int Processor::Impl::getNumGpuLut1DTextures(const GpuShaderDesc & shaderDesc) const
     {
-        BuildColorSpaceOps(m_cpuOps, config, context, srcColorSpace, dstColorSpace);
+        return (int) getGpuLut1DTextures(shaderDesc)->size();
     }
     
+    ConstGpuLut1DTexturesRcPtr Processor::Impl::getGpuLut1DTextures(
+        const GpuShaderDesc & shaderDesc) const
+    {
+        const std::string key = shaderDesc.getCacheID();
+        
+        ConstGpuShaderResultsRcPtr results = findGpuResults(key);
+        if(results && results->lut1DTextures)
+        {
+            return results->lut1DTextures;
+        }
+        
+        GpuLut1DTexturesRcPtr lut1DTextures(new std::vector<GpuLut1DTexture>);
+        calcGpuLut1DTextures(*lut1DTextures, shaderDesc);
+        
+        AutoMutex lock(m_gpuResultsMutex);
+        
+        GpuShaderResultsRcPtr newResults = copyGpuResults(key);
+        if(!newResults->lut1DTextures)
+        {
+            newResults->lut1DTextures = lut1DTextures;
+        }
+        publishGpuResults(newResults);
+        
+        return newResults->lut1DTextures;
+    }
     
-    void Processor::Impl::addTransform(const Config & config,
-                      const ConstContextRcPtr & context,
-                      const ConstTransformRcPtr& transform,
-                      TransformDirection direction)
+    int Processor::Impl::getNumGpuUniforms(const GpuShaderDesc & shaderDesc) const
     {
-        BuildOps(m_cpuOps, config, context, transform, direction);
+        if(!shaderDesc.getUniformsEnabled()) return 0;
+        return (int) getGpuUniforms(shaderDesc)->size();
     }
     
-    void Processor::Impl::finalize()
+    ConstGpuUniformsRcPtr Processor::Impl::getGpuUniforms(
+        const GpuShaderDesc & shaderDesc) const
     {
-        // Pull out metadata, before the no-ops are removed.
-        for(unsigned int i=0; i<m_cpuOps.size(); ++i)
+        const std::string key = shaderDesc.getCacheID();
+        
+        ConstGpuShaderResultsRcPtr results = findGpuResults(key);
+        if(results && results->uniforms)
         {
-            m_cpuOps[i]->dumpMetadata(m_metadata);
+            return results->uniforms;
         }
         
-        // GPU Process setup
-        //
-        // Partition the original, raw opvec into 3 segments for GPU Processing
-        //
-        // Interior index range does not support the gpu shader.
+        // The uniforms come out of writing the shader text, which is kept
+        // as well
+        GpuLut1DTexturesRcPtr lut1DTextures(new std::vector<GpuLut1DTexture>);
+        calcGpuLut1DTextures(*lut1DTextures, shaderDesc);
+        GpuUniformsRcPtr uniforms(new GpuUniformVec);
+        std::ostringstream shader;
+        calcGpuShaderText(shader, shaderDesc, *lut1DTextures, *uniforms);
+        
+        AutoMutex lock(m_gpuResultsMutex);
+        
+        GpuShaderResultsRcPtr newResults = copyGpuResults(key);
+        setGpuShaderText(*newResults, shader.str(), lut1DTextures, uniforms);
+        publishGpuResults(newResults);
+        
+        return newResults->uniforms;
+    }
+    
+    bool Processor::Impl::useGpuLut1DTextures(const GpuShaderDesc & shaderDesc) const
+    {
+        return m_hasGpuLut1DTextureOps && shaderDesc.getLut1DTexturesEnabled();
+    }
+    
+    const OpRcPtrVec & Processor::Impl::getGpuPreOps(const GpuShaderDesc & shaderDesc) const
+    {
+        if(shaderDesc.getUniformsEnabled())
+        {
+            return useGpuLut1DTextures(shaderDesc) ? m_gpuTexUniformOpsHwPreProcess
+                                                   : m_gpuUniformOpsHwPreProcess;
+        }
+        return useGpuLut1DTextures(shaderDesc) ? m_gpuTexOpsHwPreProcess : m_gpuOpsHwPreProcess;
+    }
+    
+    const OpRcPtrVec & Processor::Impl::getGpuLatticeOps(const GpuShaderDesc & shaderDesc) const
+    {
+        return useGpuLut1DTextures(shaderDesc) ? m_gpuTexOpsCpuLatticeProcess : m_gpuOpsCpuLatticeProcess;
+    }
+    
+    const OpRcPtrVec & Processor::Impl::getGpuPostOps(const GpuShaderDesc & shaderDesc) const
+    {
+        if(shaderDesc.getUniformsEnabled())
+        {
+            return useGpuLut1DTextures(shaderDesc) ? m_gpuTexUniformOpsHwPostProcess
+                                                   : m_gpuUniformOpsHwPostProcess;
+        }
+        return useGpuLut1DTextures(shaderDesc) ? m_gpuTexOpsHwPostProcess : m_gpuOpsHwPostProcess;
+    }
+    
+    std::string Processor::Impl::calcGpuLut3DCacheID(const GpuShaderDesc & shaderDesc) const
+    {
+        const OpRcPtrVec & latticeOps = getGpuLatticeOps(shaderDesc);
+        if(latticeOps.empty()) return "<NULL>";
+        
+        std::ostringstream cacheid;
+        for(OpRcPtrVec::size_type i=0, size = latticeOps.size(); i<size; ++i)
+        {
+            cacheid << latticeOps[i]->getCacheID() << " ";
+        }
+        // Also, add a hash of the shader description
+        cacheid << shaderDesc.getCacheID();
+        std::string fullstr = cacheid.str();
+        return CacheIDHash(fullstr.c_str(), (int)fullstr.size());
+    }
+    
+    void Processor::Impl::calcGpuLut1DTextures(std::vector<GpuLut1DTexture> & lut1DTextures,
+                                               const GpuShaderDesc & shaderDesc) const
+    {
+        lut1DTextures.clear();
+        
+        if(!useGpuLut1DTextures(shaderDesc)) return;
+        
+        const int maxWidth = shaderDesc.getLut1DTextureMaxWidth();
+        if(maxWidth < 1)
+        {
+            std::ostringstream os;
+            os << "Invalid 1D lut texture max width " << maxWidth << ".";
+            throw Exception(os.str().c_str());
+        }
+        
+        OpRcPtrVec ops = getGpuPreOps(shaderDesc);
+        const OpRcPtrVec & postOps = getGpuPostOps(shaderDesc);
+        ops.insert(ops.end(), postOps.begin(), postOps.end());
+        
+        for(unsigned int i=0; i<ops.size(); ++i)
+        {
+            Lut1DRcPtr lut;
+            Interpolation interpolation;
+            if(!GetGpuLut1DTexture(lut, interpolation, ops[i])) continue;
+            
+            const int length = (int) lut->luts[0].size();
+            
+            GpuLut1DTexture texture;
+            std::ostringstream name;
+            name << "lut1d_" << lut1DTextures.size();
+            texture.name = name.str();
+            texture.width = std::min(length, maxWidth);
+            texture.height = (length + texture.width - 1) / texture.width;
+            
+            // The last row is padded with the last entry
+            texture.values.resize(3 * texture.width * texture.height);
+            for(int j=0; j<texture.width * texture.height; ++j)
+            {
+                const int entry = std::min(j, length-1);
+                texture.values[3*j+0] = lut->luts[0][entry];
+                texture.values[3*j+1] = lut->luts[1][entry];
+                texture.values[3*j+2] = lut->luts[2][entry];
+            }
+            
+            std::ostringstream cacheid;
+            cacheid << lut->getCacheID() << " " << texture.width << " " << texture.height;
+            const std::string fullstr = cacheid.str();
+            texture.cacheID = CacheIDHash(fullstr.c_str(), (int)fullstr.size());
+            
+            lut1DTextures.push_back(texture);
+        }
+    }
+    
+    void Processor::Impl::setGpuShaderText(GpuShaderResults & results,
+                                           const std::string & shader,
+                                           const GpuLut1DTexturesRcPtr & lut1DTextures,
+                                           const GpuUniformsRcPtr & uniforms) const
+    {
+        if(!results.shader)
+        {
+            results.shader = ConstStringRcPtr(new std::string(shader));
+        }
+        if(!results.lut1DTextures)
+        {
+            results.lut1DTextures = lut1DTextures;
+        }
+        if(!results.uniforms)
+        {
+            results.uniforms = uniforms;
+        }
+    }
+    
+    ConstGpuShaderResultsRcPtr Processor::Impl::findGpuResults(const std::string & shaderDescCacheID) const
+    {
+        ConstGpuShaderResultsRcPtr results;
+        
+        // A table may only be deleted once it is retired and no lookup is
+        // counted, so this one stays alive until the count is dropped.
+        AtomicAdd(&m_gpuResultsReaders, 1);
+        const GpuShaderResultsTable * table = AtomicLoadPtr(&m_gpuResultsTable);
+        if(table)
+        {
+            for(unsigned int i=0; i<table->size(); ++i)
+            {
+                if((*table)[i]->shaderDescCacheID == shaderDescCacheID)
+                {
+                    results = (*table)[i];
+                    break;
+                }
+            }
+        }
+        AtomicAdd(&m_gpuResultsReaders, -1);
+        
+        if(results)
+        {
+            AtomicStore(&results->lastUse, AtomicAdd(&m_gpuResultsClock, 1));
+        }
+        return results;
+    }
+    
+    GpuShaderResultsRcPtr Processor::Impl::copyGpuResults(const std::string & shaderDescCacheID) const
+    {
+        if(m_gpuResultsTable)
+        {
+            const GpuShaderResultsTable & table = *m_gpuResultsTable;
+            for(unsigned int i=0; i<table.size(); ++i)
+            {
+                if(table[i]->shaderDescCacheID == shaderDescCacheID)
+                {
+                    return GpuShaderResultsRcPtr(new GpuShaderResults(*table[i]));
+                }
+            }
+        }
+        
+        GpuShaderResultsRcPtr results(new GpuShaderResults);
+        results->shaderDescCacheID = shaderDescCacheID;
+        return results;
+    }
+    
+    void Processor::Impl::publishGpuResults(const GpuShaderResultsRcPtr & results) const
+    {
+        GpuShaderResultsTable * oldTable = m_gpuResultsTable;
+        GpuShaderResultsTable * newTable = new GpuShaderResultsTable;
+        
+        long memorySize = (long) results->getMemorySize();
+        bool replaced = false;
+        if(oldTable)
+        {
+            for(unsigned int i=0; i<oldTable->size(); ++i)
+            {
+                const ConstGpuShaderResultsRcPtr & old = (*oldTable)[i];
+                if(old->shaderDescCacheID == results->shaderDescCacheID)
+                {
+                    memorySize -= (long) old->getMemorySize();
+                    replaced = true;
+                }
+                else
+                {
+                    newTable->push_back(old);
+                }
+            }
+        }
+        
+        if(!replaced)
+        {
+            // Make room by evicting the least recently used results. They
+            // are retired rather than deleted, as strings were handed out
+            // from them, but their 3D lut (only ever copied out) goes.
+            if(newTable->size() >= MAX_GPU_SHADER_RESULTS)
+            {
+                GpuShaderResultsTable::iterator oldest = newTable->begin();
+                for(GpuShaderResultsTable::iterator it = newTable->begin();
+                    it != newTable->end(); ++it)
+                {
+                    if(AtomicLoad(&(*it)->lastUse) < AtomicLoad(&(*oldest)->lastUse))
+                    {
+                        oldest = it;
+                    }
+                }
+                
+                GpuShaderResultsRcPtr retired(new GpuShaderResults(**oldest));
+                retired->lut3D = ConstFloatVecRcPtr();
+                m_retiredGpuResults.push_back(retired);
+                
+                AtomicAdd(&g_gpuShaderCacheEntries, -1);
+                AtomicAdd(&g_gpuShaderCacheBytes, -(long) (*oldest)->getMemorySize());
+                AtomicAdd(&g_gpuShaderCacheEvictions, 1);
+                newTable->erase(oldest);
+            }
+            
+            AtomicAdd(&g_gpuShaderCacheEntries, 1);
+        }
+        
+        AtomicStore(&results->lastUse, AtomicAdd(&m_gpuResultsClock, 1));
+        newTable->push_back(results);
+        AtomicAdd(&g_gpuShaderCacheBytes, memorySize);
+        
+        AtomicStorePtr(&m_gpuResultsTable, newTable);
+        if(oldTable) m_retiredGpuResultsTables.push_back(oldTable);
+        
+        // A lookup counted from now on can only load the new table, so
+        // with none counted the retired ones can no longer be seen.
+        if(AtomicLoad(&m_gpuResultsReaders) == 0)
+        {
+            for(unsigned int i=0; i<m_retiredGpuResultsTables.size(); ++i)
+            {
+                delete m_retiredGpuResultsTables[i];
+            }
+            m_retiredGpuResultsTables.clear();
+        }
+    }
+    
+    
+    
+    ///////////////////////////////////////////////////////////////////////////
+    
+    
+    
+    void Processor::Impl::addColorSpaceConversion(const Config & config,
+                                 const ConstContextRcPtr & context,
+                                 const ConstColorSpaceRcPtr & srcColorSpace,
+                                 const ConstColorSpaceRcPtr & dstColorSpace)
+    {
+        BuildColorSpaceOps(m_cpuOps, config, context, srcColorSpace, dstColorSpace);
+    }
+    
+    
+    void Processor::Impl::addTransform(const Config & config,
+                      const ConstContextRcPtr & context,
+                      const ConstTransformRcPtr& transform,
+                      TransformDirection direction)
+    {
+        BuildOps(m_cpuOps, config, context, transform, direction);
+    }
+    
+    void Processor::Impl::finalize()
+    {
+        // Pull out metadata, before the no-ops are removed.
+        for(unsigned int i=0; i<m_cpuOps.size(); ++i)
+        {
+            m_cpuOps[i]->dumpMetadata(m_metadata);
+        }
+        
+        // The allocation of the source color space (if any) is the
+        // shaper for baking, see bake().
+        if(!m_cpuOps.empty())
+        {
+            GetGpuAllocation(m_cpuAllocation, m_cpuOps[0]);
+        }
+        
+        // GPU Process setup
+        //
+        // Partition the original, raw opvec into 3 segments for GPU Processing
+        //
+        // Interior index range does not support the gpu shader.
         // This is used to bound our analytical shader text generation
         // start index and end index are inclusive.
         
@@ -581,6 +1325,13 @@ OCIO_NAMESPACE_ENTER
                         m_gpuOpsHwPostProcess,
                         m_cpuOps);
         
+        // The ops are shared with the optimized stages, finalizing them
+        // twice does no harm
+        m_gpuUniformOpsHwPreProcess = m_gpuOpsHwPreProcess;
+        m_gpuUniformOpsHwPostProcess = m_gpuOpsHwPostProcess;
+        FinalizeOpVec(m_gpuUniformOpsHwPreProcess, false);
+        FinalizeOpVec(m_gpuUniformOpsHwPostProcess, false);
+        
         LogDebug("GPU Ops: Pre-3DLUT");
         FinalizeOpVec(m_gpuOpsHwPreProcess);
         
@@ -590,51 +1341,1617 @@ OCIO_NAMESPACE_ENTER
         LogDebug("GPU Ops: Post-3DLUT");
         FinalizeOpVec(m_gpuOpsHwPostProcess);
         
+        m_gpuLatticeProgram.compile(m_gpuOpsCpuLatticeProcess);
+        
+        // If there are 1D luts in the lattice that could be sampled from
+        // textures instead, set up that partition too.
+        m_hasGpuLut1DTextureOps = false;
+        for(unsigned int i=0; i<m_gpuOpsCpuLatticeProcess.size(); ++i)
+        {
+            Lut1DRcPtr lut;
+            Interpolation interpolation;
+            if(GetGpuLut1DTexture(lut, interpolation, m_gpuOpsCpuLatticeProcess[i]))
+            {
+                m_hasGpuLut1DTextureOps = true;
+                break;
+            }
+        }
+        
+        if(m_hasGpuLut1DTextureOps)
+        {
+            PartitionGPUOps(m_gpuTexOpsHwPreProcess,
+                            m_gpuTexOpsCpuLatticeProcess,
+                            m_gpuTexOpsHwPostProcess,
+                            m_cpuOps, true);
+            
+            m_gpuTexUniformOpsHwPreProcess = m_gpuTexOpsHwPreProcess;
+            m_gpuTexUniformOpsHwPostProcess = m_gpuTexOpsHwPostProcess;
+            FinalizeOpVec(m_gpuTexUniformOpsHwPreProcess, false);
+            FinalizeOpVec(m_gpuTexUniformOpsHwPostProcess, false);
+            
+            LogDebug("GPU Ops, with 1D lut textures: Pre-3DLUT");
+            FinalizeOpVec(m_gpuTexOpsHwPreProcess);
+            
+            LogDebug("GPU Ops, with 1D lut textures: 3DLUT");
+            FinalizeOpVec(m_gpuTexOpsCpuLatticeProcess);
+            
+            LogDebug("GPU Ops, with 1D lut textures: Post-3DLUT");
+            FinalizeOpVec(m_gpuTexOpsHwPostProcess);
+            
+            m_gpuTexLatticeProgram.compile(m_gpuTexOpsCpuLatticeProcess);
+        }
+        
         LogDebug("CPU Ops");
         FinalizeOpVec(m_cpuOps);
+        
+        m_cpuProgram.compile(m_cpuOps);
     }
     
-    void Processor::Impl::calcGpuShaderText(std::ostream & shader,
-                                            const GpuShaderDesc & shaderDesc) const
+    namespace
     {
-        std::string pixelName = "out_pixel";
-        std::string lut3dName = "lut3d";
+        // The pixels of a block are checked against the shaper range
+        // together, and the ones outside of it go through the exact ops
+        // together.
+        const long BAKED_PIXELS_PER_BLOCK = 64;
+        
+        // The baked shaper + 3D lut, except for the pixels the shaper maps
+        // outside of 0-1 (or to nan), which the lut would clamp, and those
+        // with an alpha outside of 0-1, which the bake did not measure:
+        // these are processed by the exact ops instead. Used when the lut
+        // does not match the exact ops outside of the allocation, see
+        // bake().
+        class BakedFallbackOp : public Op
+        {
+        public:
+            // The ops must be finalized.
+            BakedFallbackOp(const OpRcPtrVec & shaperOps,
+                            const OpRcPtrVec & lutOps,
+                            const OpRcPtrVec & exactOps);
+            virtual ~BakedFallbackOp();
+            
+            virtual OpRcPtr clone() const;
+            
+            virtual std::string getInfo() const;
+            virtual std::string getCacheID() const;
+            
+            virtual bool isNoOp() const;
+            virtual bool isSameType(const OpRcPtr & op) const;
+            virtual bool isInverse(const OpRcPtr & op) const;
+            virtual bool hasChannelCrosstalk() const;
+            virtual void finalize();
+            virtual void apply(float* rgbaBuffer, long numPixels) const;
+            
+            virtual bool supportsGpuShader() const;
+            virtual void writeGpuShader(std::ostream & shader,
+                                        const std::string & pixelName,
+                                        const GpuShaderDesc & shaderDesc) const;
+            
+        private:
+            OpRcPtrVec m_shaperOps;
+            OpRcPtrVec m_lutOps;
+            OpRcPtrVec m_exactOps;
+            
+            CpuProgram m_shaperProgram;
+            CpuProgram m_lutProgram;
+            CpuProgram m_exactProgram;
+            
+            std::string m_cacheID;
+        };
         
-        WriteShaderHeader(shader, pixelName, shaderDesc);
+        typedef OCIO_SHARED_PTR<BakedFallbackOp> BakedFallbackOpRcPtr;
         
         
-        for(unsigned int i=0; i<m_gpuOpsHwPreProcess.size(); ++i)
+        BakedFallbackOp::BakedFallbackOp(const OpRcPtrVec & shaperOps,
+                                         const OpRcPtrVec & lutOps,
+                                         const OpRcPtrVec & exactOps):
+                                            Op(),
+                                            m_shaperOps(shaperOps),
+                                            m_lutOps(lutOps),
+                                            m_exactOps(exactOps)
         {
-            m_gpuOpsHwPreProcess[i]->writeGpuShader(shader, pixelName, shaderDesc);
         }
         
-        if(!m_gpuOpsCpuLatticeProcess.empty())
+        OpRcPtr BakedFallbackOp::clone() const
         {
-            // Sample the 3D LUT.
-            int lut3DEdgeLen = shaderDesc.getLut3DEdgeLen();
-            shader << pixelName << ".rgb = ";
-            Write_sampleLut3D_rgb(shader, pixelName,
-                                  lut3dName, lut3DEdgeLen,
-                                  shaderDesc.getLanguage());
+            OpRcPtr op = OpRcPtr(new BakedFallbackOp(m_shaperOps, m_lutOps, m_exactOps));
+            return op;
         }
-#ifdef __APPLE__
-        else
+        
+        BakedFallbackOp::~BakedFallbackOp()
+        { }
+        
+        std::string BakedFallbackOp::getInfo() const
         {
-            // Force a no-op sampling of the 3d lut on OSX to work around a segfault.
-            int lut3DEdgeLen = shaderDesc.getLut3DEdgeLen();
-            shader << "// OSX segfault work-around: Force a no-op sampling of the 3d lut.\n";
-            Write_sampleLut3D_rgb(shader, pixelName,
-                                  lut3dName, lut3DEdgeLen,
-                                  shaderDesc.getLanguage());
+            return "<BakedFallbackOp>";
         }
-#endif // __APPLE__
-        for(unsigned int i=0; i<m_gpuOpsHwPostProcess.size(); ++i)
+        
+        std::string BakedFallbackOp::getCacheID() const
         {
-            m_gpuOpsHwPostProcess[i]->writeGpuShader(shader, pixelName, shaderDesc);
+            return m_cacheID;
         }
         
-        WriteShaderFooter(shader, pixelName, shaderDesc);
+        bool BakedFallbackOp::isNoOp() const
+        {
+            return false;
+        }
+        
+        bool BakedFallbackOp::isSameType(const OpRcPtr & op) const
+        {
+            BakedFallbackOpRcPtr typedRcPtr = DynamicPtrCast<BakedFallbackOp>(op);
+            if(!typedRcPtr) return false;
+            return true;
+        }
+        
+        bool BakedFallbackOp::isInverse(const OpRcPtr & /*op*/) const
+        {
+            return false;
+        }
+        
+        bool BakedFallbackOp::hasChannelCrosstalk() const
+        {
+            return true;
+        }
+        
+        void BakedFallbackOp::finalize()
+        {
+            m_shaperProgram.compile(m_shaperOps);
+            m_lutProgram.compile(m_lutOps);
+            m_exactProgram.compile(m_exactOps);
+            
+            std::ostringstream cacheIDStream;
+            cacheIDStream << "<BakedFallbackOp ";
+            for(OpRcPtrVec::size_type i=0; i<m_shaperOps.size(); ++i)
+            {
+                cacheIDStream << m_shaperOps[i]->getCacheID() << " ";
+            }
+            for(OpRcPtrVec::size_type i=0; i<m_lutOps.size(); ++i)
+            {
+                cacheIDStream << m_lutOps[i]->getCacheID() << " ";
+            }
+            cacheIDStream << "exact ";
+            for(OpRcPtrVec::size_type i=0; i<m_exactOps.size(); ++i)
+            {
+                cacheIDStream << m_exactOps[i]->getCacheID() << " ";
+            }
+            cacheIDStream << ">";
+            m_cacheID = cacheIDStream.str();
+        }
+        
+        void BakedFallbackOp::apply(float* rgbaBuffer, long numPixels) const
+        {
+            float source[4*BAKED_PIXELS_PER_BLOCK];
+            long outside[BAKED_PIXELS_PER_BLOCK];
+            
+            for(long pixelIndex=0; pixelIndex<numPixels; pixelIndex+=BAKED_PIXELS_PER_BLOCK)
+            {
+                float* block = rgbaBuffer + 4*pixelIndex;
+                const long blockPixels = std::min(BAKED_PIXELS_PER_BLOCK, numPixels - pixelIndex);
+                memcpy(source, block, 4*blockPixels*sizeof(float));
+                
+                m_shaperProgram.apply(block, blockPixels);
+                
+                long numOutside = 0;
+                for(long i=0; i<blockPixels; ++i)
+                {
+                    const float * pixel = block + 4*i;
+                    if(!(pixel[0] >= 0.0f && pixel[0] <= 1.0f &&
+                         pixel[1] >= 0.0f && pixel[1] <= 1.0f &&
+                         pixel[2] >= 0.0f && pixel[2] <= 1.0f &&
+                         pixel[3] >= 0.0f && pixel[3] <= 1.0f))
+                    {
+                        outside[numOutside++] = i;
+                    }
+                }
+                
+                m_lutProgram.apply(block, blockPixels);
+                
+                if(numOutside == 0) continue;
+                
+                // Pack the source of the outside pixels (outside[i] >= i),
+                // and write back their exact result.
+                for(long i=0; i<numOutside; ++i)
+                {
+                    if(outside[i] != i)
+                    {
+                        memcpy(source + 4*i, source + 4*outside[i], 4*sizeof(float));
+                    }
+                }
+                
+                m_exactProgram.apply(source, numOutside);
+                
+                for(long i=0; i<numOutside; ++i)
+                {
+                    memcpy(block + 4*outside[i], source + 4*i, 4*sizeof(float));
+                }
+            }
+        }
+        
+        bool BakedFallbackOp::supportsGpuShader() const
+        {
+            return false;
+        }
+        
+        void BakedFallbackOp::writeGpuShader(std::ostream & /*shader*/,
+                                             const std::string & /*pixelName*/,
+                                             const GpuShaderDesc & /*shaderDesc*/) const
+        {
+            throw Exception("BakedFallbackOp does not support analytical shader generation.");
+        }
+        
+        // The largest absolute difference over all channels. A nan in only
+        // one of the buffers counts as an infinite error.
+        
+        float GetMaxError(const std::vector<float> & a,
+                          const std::vector<float> & b)
+        {
+            float maxError = 0.0f;
+            
+            for(unsigned int i=0; i<a.size(); ++i)
+            {
+                if(isnan(a[i]) || isnan(b[i]))
+                {
+                    if(isnan(a[i]) != isnan(b[i]))
+                        return std::numeric_limits<float>::infinity();
+                    continue;
+                }
+                
+                maxError = std::max(maxError, fabsf(a[i] - b[i]));
+            }
+            
+            return maxError;
+        }
     }
     
-}
-OCIO_NAMESPACE_EXIT
+    void Processor::Impl::bake(const Impl & processor, float maxError,
+                               int lut3DEdgeLen)
+    {
+        if(lut3DEdgeLen < 2)
+        {
+            std::ostringstream os;
+            os << "Cannot bake processor, invalid 3D lut edge length ";
+            os << lut3DEdgeLen << ".";
+            throw Exception(os.str().c_str());
+        }
+        
+        // The finalized ops are never modified, so they can be shared
+        m_metadata = processor.m_metadata;
+        m_cpuOps = processor.m_cpuOps;
+        m_cpuAllocation = processor.m_cpuAllocation;
+        m_gpuOpsHwPreProcess = processor.m_gpuOpsHwPreProcess;
+        m_gpuOpsCpuLatticeProcess = processor.m_gpuOpsCpuLatticeProcess;
+        m_gpuOpsHwPostProcess = processor.m_gpuOpsHwPostProcess;
+        m_gpuLatticeProgram = processor.m_gpuLatticeProgram;
+        m_hasGpuLut1DTextureOps = processor.m_hasGpuLut1DTextureOps;
+        m_gpuTexOpsHwPreProcess = processor.m_gpuTexOpsHwPreProcess;
+        m_gpuTexOpsCpuLatticeProcess = processor.m_gpuTexOpsCpuLatticeProcess;
+        m_gpuTexOpsHwPostProcess = processor.m_gpuTexOpsHwPostProcess;
+        m_gpuTexLatticeProgram = processor.m_gpuTexLatticeProgram;
+        m_gpuUniformOpsHwPreProcess = processor.m_gpuUniformOpsHwPreProcess;
+        m_gpuUniformOpsHwPostProcess = processor.m_gpuUniformOpsHwPostProcess;
+        m_gpuTexUniformOpsHwPreProcess = processor.m_gpuTexUniformOpsHwPreProcess;
+        m_gpuTexUniformOpsHwPostProcess = processor.m_gpuTexUniformOpsHwPostProcess;
+        
+        m_cpuBakedOps.clear();
+        m_cpuBaked = false;
+        m_cpuProgram.compile(m_cpuOps);
+        
+        if(IsOpVecNoOp(m_cpuOps)) return;
+        
+        // The shaper maps the allocation of the source color space to
+        // 0-1, which is covered by the lattice.
+        OpRcPtrVec shaperOps;
+        CreateAllocationOps(shaperOps, m_cpuAllocation, TRANSFORM_DIR_FORWARD);
+        OpRcPtrVec invShaperOps;
+        CreateAllocationOps(invShaperOps, m_cpuAllocation, TRANSFORM_DIR_INVERSE);
+        FinalizeOpVec(invShaperOps);
+        
+        CpuProgram invShaper;
+        invShaper.compile(invShaperOps);
+        
+        // Sample the exact ops at the lattice points
+        int lut3DNumPixels = lut3DEdgeLen*lut3DEdgeLen*lut3DEdgeLen;
+        
+        std::vector<float> lattice(lut3DNumPixels*4);
+        GenerateIdentityLut3D(&lattice[0], lut3DEdgeLen, 4, LUT3DORDER_FAST_RED);
+        invShaper.apply(&lattice[0], lut3DNumPixels);
+        processor.m_cpuProgram.apply(&lattice[0], lut3DNumPixels);
+        
+        Lut3DRcPtr lut = Lut3D::Create();
+        lut->size[0] = lut3DEdgeLen;
+        lut->size[1] = lut3DEdgeLen;
+        lut->size[2] = lut3DEdgeLen;
+        lut->lut.resize(lut3DNumPixels*3);
+        for(int i=0; i<lut3DNumPixels; ++i)
+        {
+            lut->lut[3*i+0] = lattice[4*i+0];
+            lut->lut[3*i+1] = lattice[4*i+1];
+            lut->lut[3*i+2] = lattice[4*i+2];
+        }
+        
+        FinalizeOpVec(shaperOps);
+        OpRcPtrVec lutOps;
+        CreateLut3DOp(lutOps, lut, INTERP_TETRAHEDRAL, TRANSFORM_DIR_FORWARD);
+        FinalizeOpVec(lutOps);
+        
+        OpRcPtrVec bakedOps = shaperOps;
+        bakedOps.insert(bakedOps.end(), lutOps.begin(), lutOps.end());
+        
+        CpuProgram bakedProgram;
+        bakedProgram.compile(bakedOps);
+        
+        // Measure the error at the cell centers (in shaper space), where
+        // the interpolation is the furthest from the lattice points, and
+        // at the same positions on the faces, edges and corners of the
+        // range. The alpha varies as well, as it must pass through
+        // unchanged.
+        int numCells = lut3DEdgeLen - 1;
+        int numSteps = numCells + 2;
+        int numTestPixels = numSteps*numSteps*numSteps;
+        
+        std::vector<float> coords(numSteps);
+        coords[0] = 0.0f;
+        for(int i=0; i<numCells; ++i)
+        {
+            coords[i+1] = ((float)i + 0.5f) / (float)numCells;
+        }
+        coords[numSteps-1] = 1.0f;
+        
+        std::vector<float> exact(numTestPixels*4);
+        for(int b=0, i=0; b<numSteps; ++b)
+        {
+            for(int g=0; g<numSteps; ++g)
+            {
+                for(int r=0; r<numSteps; ++r, ++i)
+                {
+                    exact[4*i+0] = coords[r];
+                    exact[4*i+1] = coords[g];
+                    exact[4*i+2] = coords[b];
+                    exact[4*i+3] = (float)(i % 5) / 4.0f;
+                }
+            }
+        }
+        invShaper.apply(&exact[0], numTestPixels);
+        
+        std::vector<float> baked(exact);
+        processor.m_cpuProgram.apply(&exact[0], numTestPixels);
+        bakedProgram.apply(&baked[0], numTestPixels);
+        
+        float error = GetMaxError(exact, baked);
+        
+        std::ostringstream os;
+        os << "Baked CPU Ops: 3D lut edge length " << lut3DEdgeLen;
+        os << ", max error " << error << " (allowed " << maxError << ")";
+        
+        if(!(error <= maxError))
+        {
+            os << ", using the exact ops.";
+            LogDebug(os.str());
+            return;
+        }
+        
+        // The lut clamps the colors outside of the allocation, and passes
+        // any alpha through. Unless that is within the error too, the
+        // colors (and alphas) outside of the measured range are processed
+        // by the exact ops.
+        const float outsideCoords[5] = { -0.5f, -0.05f, 0.5f, 1.05f, 1.5f };
+        std::vector<float> outsideExact;
+        for(int b=0; b<5; ++b)
+        {
+            for(int g=0; g<5; ++g)
+            {
+                for(int r=0; r<5; ++r)
+                {
+                    if(r == 2 && g == 2 && b == 2) continue;
+                    outsideExact.push_back(outsideCoords[r]);
+                    outsideExact.push_back(outsideCoords[g]);
+                    outsideExact.push_back(outsideCoords[b]);
+                    outsideExact.push_back(outsideCoords[(r+2*g+3*b) % 5]);
+                }
+            }
+        }
+        const long numOutsidePixels = (long)outsideExact.size() / 4;
+        invShaper.apply(&outsideExact[0], numOutsidePixels);
+        
+        std::vector<float> outsideBaked(outsideExact);
+        processor.m_cpuProgram.apply(&outsideExact[0], numOutsidePixels);
+        bakedProgram.apply(&outsideBaked[0], numOutsidePixels);
+        
+        float outsideError = GetMaxError(outsideExact, outsideBaked);
+        os << ", outside of the allocation " << outsideError;
+        
+        if(!(outsideError <= maxError))
+        {
+            os << ", using the exact ops there.";
+            
+            bakedOps.clear();
+            bakedOps.push_back(OpRcPtr(
+                new BakedFallbackOp(shaperOps, lutOps, processor.m_cpuOps)));
+            FinalizeOpVec(bakedOps, false);
+        }
+        
+        LogDebug(os.str());
+        
+        m_cpuBakedOps = bakedOps;
+        m_cpuBaked = true;
+        m_cpuProgram.compile(m_cpuBakedOps);
+    }
+    
+    void Processor::Impl::calcGpuShaderText(std::ostream & shader,
+                                            const GpuShaderDesc & shaderDesc,
+                                            const std::vector<GpuLut1DTexture> & lut1DTextures,
+                                            GpuUniformVec & uniforms) const
+    {
+        std::string pixelName = "out_pixel";
+        std::string lut3dName = "lut3d";
+        
+        // The uniforms are declared ahead of the function, so the body
+        // is written first
+        std::ostringstream body;
+        
+        const OpRcPtrVec & preOps = getGpuPreOps(shaderDesc);
+        const OpRcPtrVec & postOps = getGpuPostOps(shaderDesc);
+        int lut1DTextureIndex = 0;
+        
+        for(unsigned int i=0; i<preOps.size(); ++i)
+        {
+            WriteOpGpuShader(body, pixelName, preOps[i], shaderDesc,
+                             lut1DTextures, lut1DTextureIndex, uniforms);
+        }
+        
+        if(!getGpuLatticeOps(shaderDesc).empty())
+        {
+            // Sample the 3D LUT.
+            int lut3DEdgeLen = shaderDesc.getLut3DEdgeLen();
+            body << pixelName << ".rgb = ";
+            Write_sampleLut3D_rgb(body, pixelName,
+                                  lut3dName, lut3DEdgeLen,
+                                  shaderDesc.getLanguage());
+        }
+#ifdef __APPLE__
+        else
+        {
+            // Force a no-op sampling of the 3d lut on OSX to work around a segfault.
+            int lut3DEdgeLen = shaderDesc.getLut3DEdgeLen();
+            body << "// OSX segfault work-around: Force a no-op sampling of the 3d lut.\n";
+            Write_sampleLut3D_rgb(body, pixelName,
+                                  lut3dName, lut3DEdgeLen,
+                                  shaderDesc.getLanguage());
+        }
+#endif // __APPLE__
+        for(unsigned int i=0; i<postOps.size(); ++i)
+        {
+            WriteOpGpuShader(body, pixelName, postOps[i], shaderDesc,
+                             lut1DTextures, lut1DTextureIndex, uniforms);
+        }
+        
+        WriteShaderHeader(shader, pixelName, shaderDesc, lut1DTextures, uniforms);
+        shader << body.str();
+        WriteShaderFooter(shader, pixelName, shaderDesc);
+    }
+    
+}
+OCIO_NAMESPACE_EXIT
+
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef OCIO_UNIT_TEST
+
+namespace OCIO = OCIO_NAMESPACE;
+#include "UnitTest.h"
+#include "Lut3DOp.h"
+#include "PathUtils.h"
+#include "pystring/pystring.h"
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+OIIO_ADD_TEST(Processor, ApplyOutOfPlace)
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    OCIO::MatrixTransformRcPtr transform = OCIO::MatrixTransform::Create();
+    float m44[16] = { 0.5f, 0.1f, 0.2f, 0.0f,
+                      0.3f, 0.6f, 0.1f, 0.0f,
+                      0.0f, 0.2f, 0.7f, 0.0f,
+                      0.0f, 0.0f, 0.0f, 1.0f };
+    float offset4[4] = { 0.01f, 0.02f, 0.03f, 0.0f };
+    transform->setValue(m44, offset4);
+    OCIO::ConstProcessorRcPtr processor =
+        config->getProcessor(transform, OCIO::TRANSFORM_DIR_FORWARD);
+    
+    const long width = 517;
+    const long height = 93;
+    const long numPixels = width*height;
+    
+    // Planar rgb float source
+    std::vector<float> planar(numPixels*3);
+    for(long i=0; i<numPixels*3; ++i)
+    {
+        planar[i] = (float)(i % 1013) / 1013.0f;
+    }
+    const std::vector<float> original(planar);
+    OCIO::PlanarImageDesc srcImg(&planar[0], &planar[numPixels],
+                                 &planar[2*numPixels], NULL, width, height);
+    
+    std::vector<float> expected(numPixels*4);
+    for(long i=0; i<numPixels; ++i)
+    {
+        expected[4*i] = planar[i];
+        expected[4*i+1] = planar[numPixels+i];
+        expected[4*i+2] = planar[2*numPixels+i];
+        expected[4*i+3] = 0.0f;
+    }
+    OCIO::PackedImageDesc expectedImg(&expected[0], width, height, 4);
+    processor->apply(expectedImg);
+    
+    int oldNumThreads = OCIO::GetNumThreads();
+    
+    for(int numThreads=1; numThreads<=4; numThreads+=3)
+    {
+        OCIO::SetNumThreads(numThreads);
+        
+        // To packed rgba float (processed directly in the destination)
+        std::vector<float> packed(numPixels*4, -1.0f);
+        OCIO::PackedImageDesc packedImg(&packed[0], width, height, 4);
+        processor->apply(srcImg, packedImg);
+        
+        // To 16-bit rgb, with a padded x stride
+        std::vector<unsigned short> packed16(numPixels*4, 0x1234);
+        OCIO::PackedImageDesc packed16Img(&packed16[0], width, height, 3,
+                                          OCIO::BIT_DEPTH_UINT16,
+                                          OCIO::AutoStride,
+                                          4*sizeof(unsigned short));
+        processor->apply(srcImg, packed16Img);
+        
+        for(long i=0; i<numPixels*4; ++i)
+        {
+            OIIO_CHECK_EQUAL(packed[i], expected[i]);
+            
+            if(i%4 == 3)
+            {
+                OIIO_CHECK_EQUAL(packed16[i], 0x1234);
+            }
+            else
+            {
+                float v = std::min(std::max(expected[i], 0.0f), 1.0f);
+                OIIO_CHECK_EQUAL(packed16[i], (unsigned short)(v*65535.0f + 0.5f));
+            }
+        }
+        
+        for(long i=0; i<numPixels*3; ++i)
+        {
+            OIIO_CHECK_EQUAL(planar[i], original[i]);
+        }
+    }
+    
+    OCIO::SetNumThreads(oldNumThreads);
+    
+    // A no-op still copies the pixels
+    OCIO::ConstProcessorRcPtr noOp =
+        config->getProcessor(OCIO::MatrixTransform::Create(), OCIO::TRANSFORM_DIR_FORWARD);
+    OIIO_CHECK_ASSERT(noOp->isNoOp());
+    std::vector<float> copy(numPixels*3, -1.0f);
+    OCIO::PlanarImageDesc copyImg(&copy[0], &copy[numPixels],
+                                  &copy[2*numPixels], NULL, width, height);
+    noOp->apply(srcImg, copyImg);
+    OIIO_CHECK_ASSERT(copy == original);
+    
+    // The dimensions must match
+    std::vector<float> small(4*4);
+    OCIO::PackedImageDesc smallImg(&small[0], 2, 2, 4);
+    OIIO_CHECK_THOW(processor->apply(srcImg, smallImg), OCIO::Exception);
+}
+
+OIIO_ADD_TEST(Processor, BakedProcessor)
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    float value[4] = { 2.2f, 2.0f, 1.8f, 1.0f };
+    exponent->setValue(value);
+    group->push_back(exponent);
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    float m44[16] = { 0.5f, 0.1f, 0.2f, 0.0f,
+                      0.3f, 0.6f, 0.1f, 0.0f,
+                      0.0f, 0.2f, 0.7f, 0.0f,
+                      0.0f, 0.0f, 0.0f, 1.0f };
+    float offset4[4] = { 0.01f, 0.02f, 0.03f, 0.0f };
+    matrix->setValue(m44, offset4);
+    group->push_back(matrix);
+    
+    OCIO::ConstProcessorRcPtr processor =
+        config->getProcessor(group, OCIO::TRANSFORM_DIR_FORWARD);
+    OIIO_CHECK_ASSERT(!processor->isCpuBaked());
+    
+    const long numPixels = 1000;
+    std::vector<float> src(numPixels*4);
+    for(long i=0; i<numPixels*4; ++i)
+    {
+        src[i] = (float)((i*7919) % 1009) / 1008.0f;
+    }
+    
+    std::vector<float> expected(src);
+    OCIO::PackedImageDesc expectedImg(&expected[0], numPixels, 1, 4);
+    processor->apply(expectedImg);
+    
+    // Within the tolerance, the 3D lut is used
+    OCIO::ConstProcessorRcPtr baked = processor->getBakedProcessor(1e-3f, 33);
+    OIIO_CHECK_ASSERT(baked->isCpuBaked());
+    OIIO_CHECK_NE(std::string(baked->getCpuCacheID()),
+                  std::string(processor->getCpuCacheID()));
+    
+    std::vector<float> result(src);
+    OCIO::PackedImageDesc resultImg(&result[0], numPixels, 1, 4);
+    baked->apply(resultImg);
+    
+    bool exact = true;
+    for(long i=0; i<numPixels*4; ++i)
+    {
+        OIIO_CHECK_CLOSE(result[i], expected[i], 1e-3f);
+        if(result[i] != expected[i]) exact = false;
+    }
+    OIIO_CHECK_ASSERT(!exact);
+    
+    // The lut clamps the colors outside of the allocation (0-1 here) and
+    // passes the alpha through, which the exact ops do not, so the pixels
+    // outside of the range go through the exact ops
+    std::vector<float> outside(numPixels*4);
+    for(long i=0; i<numPixels*4; ++i)
+    {
+        outside[i] = (float)((i*7919) % 1009) / 504.0f - 0.5f;
+    }
+    
+    std::vector<float> outsideExpected(outside);
+    OCIO::PackedImageDesc outsideExpectedImg(&outsideExpected[0], numPixels, 1, 4);
+    processor->apply(outsideExpectedImg);
+    
+    std::vector<float> outsideResult(outside);
+    OCIO::PackedImageDesc outsideResultImg(&outsideResult[0], numPixels, 1, 4);
+    baked->apply(outsideResultImg);
+    
+    long numOutside = 0;
+    for(long i=0; i<numPixels; ++i)
+    {
+        const float * pixel = &outside[4*i];
+        const bool inside = pixel[0] >= 0.0f && pixel[0] <= 1.0f
+            && pixel[1] >= 0.0f && pixel[1] <= 1.0f
+            && pixel[2] >= 0.0f && pixel[2] <= 1.0f
+            && pixel[3] >= 0.0f && pixel[3] <= 1.0f;
+        if(!inside) ++numOutside;
+        
+        for(int c=0; c<4; ++c)
+        {
+            if(inside)
+            {
+                OIIO_CHECK_CLOSE(outsideResult[4*i+c], outsideExpected[4*i+c], 1e-3f);
+            }
+            else
+            {
+                OIIO_CHECK_EQUAL(outsideResult[4*i+c], outsideExpected[4*i+c]);
+            }
+        }
+    }
+    OIIO_CHECK_ASSERT(numOutside > 0 && numOutside < numPixels);
+    
+    // Otherwise, the exact ops are used
+    OCIO::ConstProcessorRcPtr notBaked = processor->getBakedProcessor(1e-7f, 9);
+    OIIO_CHECK_ASSERT(!notBaked->isCpuBaked());
+    OIIO_CHECK_EQUAL(std::string(notBaked->getCpuCacheID()),
+                     std::string(processor->getCpuCacheID()));
+    
+    result = src;
+    notBaked->apply(resultImg);
+    OIIO_CHECK_ASSERT(result == expected);
+    
+    OIIO_CHECK_THOW(processor->getBakedProcessor(1e-3f, 1), OCIO::Exception);
+}
+
+namespace
+{
+    // A spi1d lut in a temporary directory, removed with the object, for
+    // the gpu tests to load through a FileTransform
+    class TempLut1DFile
+    {
+    public:
+        TempLut1DFile(const float * values, int size, float domainMax)
+        : m_dir("processor")
+        {
+            std::ostringstream lut;
+            lut << "Version 1\nFrom 0.0 " << domainMax << "\n";
+            lut << "Length " << size << "\nComponents 1\n{\n";
+            for(int i=0; i<size; ++i) lut << values[i] << "\n";
+            lut << "}\n";
+            m_path = m_dir.writeFile("lut.spi1d", lut.str());
+        }
+        
+        // Applies the lut with linear interpolation
+        OCIO::FileTransformRcPtr createTransform() const
+        {
+            return OCIO::CreateFileTransform(m_path);
+        }
+        
+    private:
+        TempLut1DFile(const TempLut1DFile &);
+        TempLut1DFile & operator= (const TempLut1DFile &);
+        
+        OCIO::TempDirectory m_dir;
+        std::string m_path;
+    };
+    
+    const float LUT1D_VALUES[5] = { 0.0f, 0.1f, 0.3f, 0.6f, 1.0f };
+}
+
+OIIO_ADD_TEST(Processor, GpuLut1DTextures)
+{
+    const float * values = LUT1D_VALUES;
+    TempLut1DFile lutFile(values, 5, 2.0f);
+    
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    OCIO::FileTransformRcPtr file = lutFile.createTransform();
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    float m44[16] = { 2.0f, 0.0f, 0.0f, 0.0f,
+                      0.0f, 2.0f, 0.0f, 0.0f,
+                      0.0f, 0.0f, 2.0f, 0.0f,
+                      0.0f, 0.0f, 0.0f, 1.0f };
+    matrix->setValue(m44, 0);
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    group->push_back(file);
+    group->push_back(matrix);
+    
+    OCIO::ConstProcessorRcPtr processor = config->getProcessor(group);
+    
+    OCIO::GpuShaderDesc shaderDesc;
+    shaderDesc.setLanguage(OCIO::GPU_LANGUAGE_GLSL_1_3);
+    shaderDesc.setFunctionName("OCIODisplay");
+    shaderDesc.setLut3DEdgeLen(8);
+    
+    // Off by default: the lut is baked in the lattice
+    OIIO_CHECK_ASSERT(!shaderDesc.getLut1DTexturesEnabled());
+    OIIO_CHECK_EQUAL(processor->getNumGpuLut1DTextures(shaderDesc), 0);
+    OIIO_CHECK_NE(std::string(processor->getGpuLut3DCacheID(shaderDesc)), "<NULL>");
+    std::string shader = processor->getGpuShaderText(shaderDesc);
+    OIIO_CHECK_ASSERT(shader.find("lut1d") == std::string::npos);
+    
+    shaderDesc.setLut1DTexturesEnabled(true);
+    OIIO_CHECK_EQUAL(processor->getNumGpuLut1DTextures(shaderDesc), 1);
+    OIIO_CHECK_EQUAL(std::string(processor->getGpuLut3DCacheID(shaderDesc)), "<NULL>");
+    OIIO_CHECK_EQUAL(std::string(processor->getGpuLut1DTextureName(shaderDesc, 0)), "lut1d_0");
+    
+    int width = 0, height = 0;
+    processor->getGpuLut1DTextureSize(&width, &height, shaderDesc, 0);
+    OIIO_CHECK_EQUAL(width, 5);
+    OIIO_CHECK_EQUAL(height, 1);
+    
+    std::vector<float> texture(3 * width * height);
+    processor->getGpuLut1DTexture(&texture[0], shaderDesc, 0);
+    for(int i=0; i<5; ++i)
+    {
+        OIIO_CHECK_EQUAL(texture[3*i+0], values[i]);
+        OIIO_CHECK_EQUAL(texture[3*i+2], values[i]);
+    }
+    
+    shader = processor->getGpuShaderText(shaderDesc);
+    OIIO_CHECK_ASSERT(shader.find("const sampler3D lut3d,\n    const sampler1D lut1d_0) \n")
+                      != std::string::npos);
+    OIIO_CHECK_ASSERT(shader.find("texture1D(lut1d_0, lut1d_index.g).g") != std::string::npos);
+    // The matrix is still applied after the lut
+    OIIO_CHECK_ASSERT(shader.find("texture1D") < shader.find("mat4"));
+    const std::string cacheID1D = processor->getGpuLut1DTextureCacheID(shaderDesc, 0);
+    
+    // Longer luts are stored in rows
+    shaderDesc.setLut1DTextureMaxWidth(2);
+    processor->getGpuLut1DTextureSize(&width, &height, shaderDesc, 0);
+    OIIO_CHECK_EQUAL(width, 2);
+    OIIO_CHECK_EQUAL(height, 3);
+    texture.resize(3 * width * height);
+    processor->getGpuLut1DTexture(&texture[0], shaderDesc, 0);
+    OIIO_CHECK_EQUAL(texture[3*4+1], values[4]);
+    OIIO_CHECK_EQUAL(texture[3*5+1], values[4]);
+    OIIO_CHECK_NE(std::string(processor->getGpuLut1DTextureCacheID(shaderDesc, 0)), cacheID1D);
+    shader = processor->getGpuShaderText(shaderDesc);
+    OIIO_CHECK_ASSERT(shader.find("const sampler2D lut1d_0) \n") != std::string::npos);
+    OIIO_CHECK_ASSERT(shader.find("texture2D(lut1d_0") != std::string::npos);
+    
+    OIIO_CHECK_THOW(processor->getGpuLut1DTextureName(shaderDesc, 1), OCIO::Exception);
+    
+    // The nearest lookup picks the same entry as the cpu: the index, here
+    // 2*x, is rounded to the closest entry of the texture
+    file->setInterpolation(OCIO::INTERP_NEAREST);
+    OCIO::ConstProcessorRcPtr nearest = config->getProcessor(file);
+    OCIO::GpuShaderDesc nearestDesc;
+    nearestDesc.setLanguage(OCIO::GPU_LANGUAGE_GLSL_1_3);
+    nearestDesc.setFunctionName("OCIODisplay");
+    nearestDesc.setLut1DTexturesEnabled(true);
+    OIIO_CHECK_EQUAL(nearest->getNumGpuLut1DTextures(nearestDesc), 1);
+    shader = nearest->getGpuShaderText(nearestDesc);
+    OIIO_CHECK_ASSERT(shader.find("lut1d_index = floor(lut1d_index + 0.5);")
+                      != std::string::npos);
+    
+    nearest->getGpuLut1DTextureSize(&width, &height, nearestDesc, 0);
+    texture.resize(3 * width * height);
+    nearest->getGpuLut1DTexture(&texture[0], nearestDesc, 0);
+    
+    const float inputs[6] = { 0.0f, 0.35f, 0.65f, 1.1f, 1.85f, 2.0f };
+    for(int i=0; i<6; ++i)
+    {
+        float index = std::max(0.0f, std::min(inputs[i] / 2.0f, 1.0f)) * 4.0f;
+        index = floorf(index + 0.5f);
+        
+        float rgb[3] = { inputs[i], inputs[i], inputs[i] };
+        nearest->applyRGB(rgb);
+        for(int c=0; c<3; ++c)
+        {
+            OIIO_CHECK_EQUAL(rgb[c], texture[3*(int)index+c]);
+        }
+    }
+    
+    // Inverse luts still need the lattice
+    file->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    processor = config->getProcessor(file);
+    OIIO_CHECK_EQUAL(processor->getNumGpuLut1DTextures(shaderDesc), 0);
+    OIIO_CHECK_NE(std::string(processor->getGpuLut3DCacheID(shaderDesc)), "<NULL>");
+    
+    OCIO::ClearAllCaches();
+}
+
+OIIO_ADD_TEST(Processor, GpuLut3D)
+{
+    TempLut1DFile lutFile(LUT1D_VALUES, 5, 1.0f);
+    
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    OCIO::FileTransformRcPtr file = lutFile.createTransform();
+    OCIO::ConstProcessorRcPtr processor = config->getProcessor(file);
+    
+    OCIO::GpuShaderDesc shaderDesc;
+    shaderDesc.setLanguage(OCIO::GPU_LANGUAGE_GLSL_1_3);
+    shaderDesc.setFunctionName("OCIODisplay");
+    
+    const int numThreads = OCIO::GetNumThreads();
+    
+    // More than one bake block, to cover the split across workers
+    for(int edgeLen=17; edgeLen<=33; edgeLen+=16)
+    {
+        shaderDesc.setLut3DEdgeLen(edgeLen);
+        const int numPoints = edgeLen*edgeLen*edgeLen;
+        
+        // The lattice points, through the cpu path
+        std::vector<float> expected(3*numPoints);
+        OCIO::GenerateIdentityLut3D(&expected[0], edgeLen, 3, OCIO::LUT3DORDER_FAST_RED);
+        for(int i=0; i<numPoints; ++i)
+        {
+            processor->applyRGB(&expected[3*i]);
+        }
+        
+        std::vector<float> serial(3*numPoints);
+        OCIO::SetNumThreads(1);
+        processor->getGpuLut3D(&serial[0], shaderDesc);
+        for(int i=0; i<3*numPoints; ++i)
+        {
+            OIIO_CHECK_CLOSE(serial[i], expected[i], 1e-6f);
+        }
+        
+        // A new processor, as the lut is cached
+        OCIO::SetNumThreads(4);
+        OCIO::ClearAllCaches();
+        OCIO::ConstProcessorRcPtr threaded = config->getProcessor(file);
+        std::vector<float> parallel(3*numPoints);
+        threaded->getGpuLut3D(&parallel[0], shaderDesc);
+        OIIO_CHECK_ASSERT(parallel == serial);
+        OIIO_CHECK_EQUAL(std::string(threaded->getGpuLut3DCacheID(shaderDesc)),
+                         std::string(processor->getGpuLut3DCacheID(shaderDesc)));
+    }
+    OCIO::SetNumThreads(numThreads);
+    
+    // Going back to a previous description gives the same lut
+    std::vector<float> lut17(3*17*17*17), again(3*17*17*17);
+    shaderDesc.setLut3DEdgeLen(17);
+    processor->getGpuLut3D(&lut17[0], shaderDesc);
+    const std::string cacheID17 = processor->getGpuLut3DCacheID(shaderDesc);
+    shaderDesc.setLut3DEdgeLen(33);
+    OIIO_CHECK_NE(std::string(processor->getGpuLut3DCacheID(shaderDesc)), cacheID17);
+    shaderDesc.setLut3DEdgeLen(17);
+    processor->getGpuLut3D(&again[0], shaderDesc);
+    OIIO_CHECK_ASSERT(again == lut17);
+    OIIO_CHECK_EQUAL(std::string(processor->getGpuLut3DCacheID(shaderDesc)), cacheID17);
+    
+    OCIO::ClearAllCaches();
+}
+
+OIIO_ADD_TEST(Processor, GpuShaderCache)
+{
+    TempLut1DFile lutFile(LUT1D_VALUES, 5, 1.0f);
+    
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    OCIO::FileTransformRcPtr file = lutFile.createTransform();
+    OCIO::ConstProcessorRcPtr processor = config->getProcessor(file);
+    
+    long entries0 = 0, entries = 0, hits = 0, misses = 0, evictions = 0;
+    size_t bytes0 = 0, bytes = 0;
+    OCIO::ClearAllCaches();
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_GPU_SHADER,
+                        entries0, bytes0, hits, misses, evictions);
+    OIIO_CHECK_EQUAL(hits, 0);
+    OIIO_CHECK_EQUAL(misses, 0);
+    
+    // A viewer and a thumbnail renderer sharing the processor
+    OCIO::GpuShaderDesc viewer;
+    viewer.setLanguage(OCIO::GPU_LANGUAGE_GLSL_1_3);
+    viewer.setFunctionName("viewer");
+    viewer.setLut3DEdgeLen(32);
+    OCIO::GpuShaderDesc thumbnail;
+    thumbnail.setLanguage(OCIO::GPU_LANGUAGE_GLSL_1_0);
+    thumbnail.setFunctionName("thumbnail");
+    thumbnail.setLut3DEdgeLen(16);
+    
+    const std::string viewerShader = processor->getGpuShaderText(viewer);
+    const std::string thumbnailShader = processor->getGpuShaderText(thumbnail);
+    OIIO_CHECK_NE(viewerShader, thumbnailShader);
+    std::vector<float> viewerLut(3*32*32*32), thumbnailLut(3*16*16*16);
+    processor->getGpuLut3D(&viewerLut[0], viewer);
+    processor->getGpuLut3D(&thumbnailLut[0], thumbnail);
+    
+    std::vector<float> lut;
+    for(int i=0; i<10; ++i)
+    {
+        OIIO_CHECK_EQUAL(std::string(processor->getGpuShaderText(viewer)), viewerShader);
+        lut.resize(viewerLut.size());
+        processor->getGpuLut3D(&lut[0], viewer);
+        OIIO_CHECK_ASSERT(lut == viewerLut);
+        
+        OIIO_CHECK_EQUAL(std::string(processor->getGpuShaderText(thumbnail)), thumbnailShader);
+        lut.resize(thumbnailLut.size());
+        processor->getGpuLut3D(&lut[0], thumbnail);
+        OIIO_CHECK_ASSERT(lut == thumbnailLut);
+    }
+    
+    // Each shader and lut was only built once
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_GPU_SHADER,
+                        entries, bytes, hits, misses, evictions);
+    OIIO_CHECK_EQUAL(misses, 4);
+    OIIO_CHECK_EQUAL(hits, 40);
+    OIIO_CHECK_EQUAL(evictions, 0);
+    OIIO_CHECK_EQUAL(entries, entries0 + 2);
+    OIIO_CHECK_ASSERT(bytes >= bytes0 + sizeof(float) * (viewerLut.size() + thumbnailLut.size()));
+    
+    // Only a few descriptions are kept per processor, but the strings
+    // handed out for the others stay valid
+    const char * viewerText = processor->getGpuShaderText(viewer);
+    const char * viewerLutID = processor->getGpuLut3DCacheID(viewer);
+    const std::string viewerLutIDCopy = viewerLutID;
+    const char * names[4] = { "a", "b", "c", "d" };
+    for(int i=0; i<4; ++i)
+    {
+        OCIO::GpuShaderDesc other;
+        other.setLanguage(OCIO::GPU_LANGUAGE_GLSL_1_3);
+        other.setFunctionName(names[i]);
+        other.setLut3DEdgeLen(8);
+        processor->getGpuShaderText(other);
+    }
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_GPU_SHADER,
+                        entries, bytes, hits, misses, evictions);
+    OIIO_CHECK_EQUAL(misses, 8);
+    OIIO_CHECK_EQUAL(evictions, 2);
+    OIIO_CHECK_EQUAL(entries, entries0 + 4);
+    OIIO_CHECK_EQUAL(std::string(viewerText), viewerShader);
+    OIIO_CHECK_EQUAL(std::string(viewerLutID), viewerLutIDCopy);
+    
+    // The text written for its cache id is kept as well
+    OCIO::GpuShaderDesc other;
+    other.setLanguage(OCIO::GPU_LANGUAGE_GLSL_1_3);
+    other.setFunctionName("e");
+    other.setLut3DEdgeLen(8);
+    long hits0 = 0;
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_GPU_SHADER,
+                        entries, bytes, hits0, misses, evictions);
+    OIIO_CHECK_ASSERT(std::string(processor->getGpuShaderTextCacheID(other)) != "");
+    processor->getGpuShaderText(other);
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_GPU_SHADER,
+                        entries, bytes, hits, misses, evictions);
+    OIIO_CHECK_EQUAL(hits, hits0 + 1);
+    OIIO_CHECK_EQUAL(misses, 8);
+    
+    // The results are released with the processor
+    processor.reset();
+    OCIO::ClearAllCaches();
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_GPU_SHADER,
+                        entries, bytes, hits, misses, evictions);
+    OIIO_CHECK_EQUAL(entries, entries0);
+    OIIO_CHECK_EQUAL(bytes, bytes0);
+}
+
+namespace
+{
+    // Asks for the shader text and lut of more descriptions than a
+    // processor keeps, so lookups run while results are being evicted.
+    class GpuShaderCacheBody : public OCIO::ParallelForBody
+    {
+    public:
+        GpuShaderCacheBody(const OCIO::ConstProcessorRcPtr & processor,
+                           const std::vector<OCIO::GpuShaderDesc> & descs,
+                           const std::vector<std::string> & shaders,
+                           const std::vector<float> & lut) :
+            m_processor(processor),
+            m_descs(descs),
+            m_shaders(shaders),
+            m_lut(lut)
+        { }
+        
+        virtual void run(int /*workerIndex*/, long itemBegin, long itemEnd) const
+        {
+            std::vector<float> lut(m_lut.size());
+            for(long i=itemBegin; i<itemEnd; ++i)
+            {
+                const size_t index = (size_t) i % m_descs.size();
+                const char * shader = m_processor->getGpuShaderText(m_descs[index]);
+                m_processor->getGpuLut3D(&lut[0], m_descs[index]);
+                if(m_shaders[index] != shader || lut != m_lut)
+                {
+                    throw OCIO::Exception("Unexpected gpu results.");
+                }
+            }
+        }
+    
+    private:
+        OCIO::ConstProcessorRcPtr m_processor;
+        const std::vector<OCIO::GpuShaderDesc> & m_descs;
+        const std::vector<std::string> & m_shaders;
+        const std::vector<float> & m_lut;
+        
+        GpuShaderCacheBody& operator= (const GpuShaderCacheBody &);
+    };
+}
+
+OIIO_ADD_TEST(Processor, GpuShaderCacheConcurrent)
+{
+    TempLut1DFile lutFile(LUT1D_VALUES, 5, 1.0f);
+    
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    OCIO::ConstProcessorRcPtr processor = config->getProcessor(lutFile.createTransform());
+    
+    const char * names[6] = { "a", "b", "c", "d", "e", "f" };
+    std::vector<OCIO::GpuShaderDesc> descs(6);
+    std::vector<std::string> shaders;
+    for(unsigned int i=0; i<descs.size(); ++i)
+    {
+        descs[i].setLanguage(OCIO::GPU_LANGUAGE_GLSL_1_3);
+        descs[i].setFunctionName(names[i]);
+        descs[i].setLut3DEdgeLen(8);
+        shaders.push_back(processor->getGpuShaderText(descs[i]));
+    }
+    std::vector<float> lut(3*8*8*8);
+    processor->getGpuLut3D(&lut[0], descs[0]);
+    
+    GpuShaderCacheBody body(processor, descs, shaders, lut);
+    OIIO_CHECK_NO_THOW(OCIO::ParallelFor(body, 600, 1, 4));
+}
+
+namespace
+{
+    // The checks a shader compiler would fail first on: unbalanced
+    // brackets, and names which belong to another language
+    
+    bool IsBalanced(const std::string & text)
+    {
+        std::string open;
+        for(std::string::size_type i=0; i<text.size(); ++i)
+        {
+            const char c = text[i];
+            if(c == '(' || c == '{') open += c;
+            else if(c == ')' || c == '}')
+            {
+                if(open.empty()) return false;
+                if(open[open.size()-1] != (c == ')' ? '(' : '{')) return false;
+                open.erase(open.size()-1);
+            }
+        }
+        return open.empty();
+    }
+    
+    bool HasToken(const std::string & text, const std::string & token)
+    {
+        std::string::size_type pos = text.find(token);
+        while(pos != std::string::npos)
+        {
+            const std::string::size_type end = pos + token.size();
+            const bool startsWord = (pos == 0) ||
+                !(isalnum((unsigned char) text[pos-1]) || text[pos-1] == '_');
+            const bool endsWord = (end == text.size()) ||
+                !(isalnum((unsigned char) text[end]) || text[end] == '_');
+            if(startsWord && endsWord) return true;
+            pos = text.find(token, pos + 1);
+        }
+        return false;
+    }
+    
+    struct ShaderLanguageTest
+    {
+        OCIO::GpuLanguage language;
+        // The start of the function
+        const char * signature;
+        // The lookups of the 3D lut, of a 1D and of a 2D texture
+        const char * lookups[3];
+        // Names the text must use, and must not use, ' ' separated
+        const char * expected;
+        const char * unexpected;
+    };
+    
+    void SplitTokens(std::vector<std::string> & tokens, const char * str)
+    {
+        std::istringstream is(str);
+        std::string token;
+        while(is >> token) tokens.push_back(token);
+    }
+    
+    bool IsProgramOnPath(const std::string & name)
+    {
+        const char * path = std::getenv("PATH");
+        if(!path) return false;
+        
+#ifdef WINDOWS
+        const std::string separator = ";";
+        const std::string filename = name + ".exe";
+#else
+        const std::string separator = ":";
+        const std::string filename = name;
+#endif
+        std::vector<std::string> dirs;
+        OCIO::pystring::split(path, dirs, separator);
+        for(unsigned int i=0; i<dirs.size(); ++i)
+        {
+            if(!dirs[i].empty() &&
+               OCIO::FileExists(OCIO::pystring::os::path::join(dirs[i], filename)))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    // The offline compilers of the shading languages that are installed:
+    // glslangValidator for GLSL, dxc for HLSL and metal (through xcrun)
+    // for MSL. The text of the languages without a compiler is only
+    // checked by the tests above.
+    
+    struct ShaderCompilers
+    {
+        bool glsl;
+        bool hlsl;
+        bool msl;
+        
+        ShaderCompilers() :
+            glsl(IsProgramOnPath("glslangValidator")),
+            hlsl(IsProgramOnPath("dxc")),
+            msl(IsProgramOnPath("xcrun") &&
+                std::system("xcrun -sdk macosx -f metal > /dev/null 2>&1") == 0)
+        { }
+    };
+    
+    // A fragment shader entry point calling the function written for
+    // shaderDesc, passing it a texture (and sampler) for each of the
+    // lut3d and 1D lut textures, and literal values for the uniforms
+    // the language passes as parameters.
+    
+    std::string CreateShaderEntryPoint(const OCIO::ConstProcessorRcPtr & processor,
+                                       const OCIO::GpuShaderDesc & shaderDesc)
+    {
+        const OCIO::GpuLanguage language = shaderDesc.getLanguage();
+        const bool isGlsl = language == OCIO::GPU_LANGUAGE_GLSL_1_0 ||
+                            language == OCIO::GPU_LANGUAGE_GLSL_1_3 ||
+                            language == OCIO::GPU_LANGUAGE_GLSL_3_3 ||
+                            language == OCIO::GPU_LANGUAGE_GLSL_4_0;
+        
+        std::vector<int> dimensions(1, 3);
+        for(int i=0; i<processor->getNumGpuLut1DTextures(shaderDesc); ++i)
+        {
+            int width = 0, height = 0;
+            processor->getGpuLut1DTextureSize(&width, &height, shaderDesc, i);
+            dimensions.push_back(height == 1 ? 1 : 2);
+        }
+        
+        std::ostringstream globals;
+        std::ostringstream params;
+        std::ostringstream call;
+        call << shaderDesc.getFunctionName() << "(";
+        call << (isGlsl ? "vec4" : "float4") << "(0.5, 0.5, 0.5, 1.0)";
+        
+        for(unsigned int i=0; i<dimensions.size(); ++i)
+        {
+            if(isGlsl)
+            {
+                globals << "uniform sampler" << dimensions[i] << "D ocio_tex" << i << ";\n";
+                call << ", ocio_tex" << i;
+            }
+            else if(language == OCIO::GPU_LANGUAGE_HLSL_DX11)
+            {
+                globals << "Texture" << dimensions[i] << "D ocio_tex" << i << ";\n";
+                globals << "SamplerState ocio_sampler" << i << ";\n";
+                call << ", ocio_tex" << i << ", ocio_sampler" << i;
+            }
+            else
+            {
+                params << ",\n    texture" << dimensions[i] << "d<float> ocio_tex" << i;
+                params << " [[texture(" << i << ")]]";
+                params << ",\n    sampler ocio_sampler" << i << " [[sampler(" << i << ")]]";
+                call << ", ocio_tex" << i << ", ocio_sampler" << i;
+            }
+        }
+        
+        if(language == OCIO::GPU_LANGUAGE_MSL)
+        {
+            for(int i=0; i<processor->getNumGpuUniforms(shaderDesc); ++i)
+            {
+                call << ((processor->getGpuUniformType(shaderDesc, i) == OCIO::GPU_UNIFORM_FLOAT4X4)
+                         ? ", float4x4(1.0)" : ", float4(1.0)");
+            }
+        }
+        call << ")";
+        
+        std::ostringstream os;
+        os << globals.str();
+        if(language == OCIO::GPU_LANGUAGE_GLSL_1_0)
+        {
+            os << "void main()\n{\n    gl_FragColor = " << call.str() << ";\n}\n";
+        }
+        else if(isGlsl)
+        {
+            os << "out vec4 ocio_color;\n";
+            os << "void main()\n{\n    ocio_color = " << call.str() << ";\n}\n";
+        }
+        else if(language == OCIO::GPU_LANGUAGE_HLSL_DX11)
+        {
+            os << "float4 ocio_main(float4 position : SV_Position) : SV_Target\n";
+            os << "{\n    return " << call.str() << ";\n}\n";
+        }
+        else
+        {
+            os << "fragment float4 ocio_main(float4 position [[position]]" << params.str() << ")\n";
+            os << "{\n    return " << call.str() << ";\n}\n";
+        }
+        return os.str();
+    }
+    
+    // Compile the shader text with the offline compiler of its language.
+    // Returns false (and does nothing) if there is no compiler for it.
+    // Otherwise, the compiler output is printed if it fails.
+    
+    bool CompileShader(bool & compiled, OCIO::TempDirectory & dir,
+                       const ShaderCompilers & compilers,
+                       const OCIO::ConstProcessorRcPtr & processor,
+                       const OCIO::GpuShaderDesc & shaderDesc,
+                       const std::string & shader)
+    {
+        const std::string program = shader + CreateShaderEntryPoint(processor, shaderDesc);
+        const std::string logPath = dir.getFilePath("compile.log");
+        
+        std::string command;
+        switch(shaderDesc.getLanguage())
+        {
+            case OCIO::GPU_LANGUAGE_GLSL_1_0:
+            case OCIO::GPU_LANGUAGE_GLSL_1_3:
+            case OCIO::GPU_LANGUAGE_GLSL_3_3:
+            case OCIO::GPU_LANGUAGE_GLSL_4_0:
+            {
+                if(!compilers.glsl) return false;
+                
+                const OCIO::GpuLanguage language = shaderDesc.getLanguage();
+                const char * version =
+                    (language == OCIO::GPU_LANGUAGE_GLSL_1_0) ? "110" :
+                    (language == OCIO::GPU_LANGUAGE_GLSL_1_3) ? "130" :
+                    (language == OCIO::GPU_LANGUAGE_GLSL_3_3) ? "330 core" : "400 core";
+                const std::string path = dir.writeFile("shader.frag",
+                    std::string("#version ") + version + "\n" + program);
+                command = "glslangValidator \"" + path + "\"";
+                break;
+            }
+            case OCIO::GPU_LANGUAGE_HLSL_DX11:
+            {
+                if(!compilers.hlsl) return false;
+                
+                const std::string path = dir.writeFile("shader.hlsl", program);
+                command = "dxc -T ps_6_0 -E ocio_main \"" + path + "\"";
+                break;
+            }
+            case OCIO::GPU_LANGUAGE_MSL:
+            {
+                if(!compilers.msl) return false;
+                
+                const std::string path = dir.writeFile("shader.metal", program);
+                command = "xcrun -sdk macosx metal -c \"" + path + "\" -o \""
+                          + dir.getFilePath("shader.air") + "\"";
+                break;
+            }
+            default:
+                return false;
+        }
+        
+        compiled = std::system((command + " > \"" + logPath + "\" 2>&1").c_str()) == 0;
+        if(!compiled)
+        {
+            std::ifstream log(logPath.c_str());
+            std::cerr << OCIO::GpuLanguageToString(shaderDesc.getLanguage());
+            std::cerr << " shader does not compile:\n" << program << "\n";
+            std::cerr << log.rdbuf() << "\n";
+        }
+        return true;
+    }
+}
+
+OIIO_ADD_TEST(Processor, GpuShaderLanguages)
+{
+    TempLut1DFile lutFile(LUT1D_VALUES, 5, 1.0f);
+    
+    // A lut which is either sampled from a texture or baked into the 3D
+    // lut, then an op of each kind writing shader text
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    OCIO::FileTransformRcPtr file = lutFile.createTransform();
+    group->push_back(file);
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    float exp4[4] = { 2.2f, 2.2f, 2.2f, 1.0f };
+    exponent->setValue(exp4);
+    group->push_back(exponent);
+    OCIO::LogTransformRcPtr log = OCIO::LogTransform::Create();
+    group->push_back(log);
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    float m44[16] = { 0.9f, 0.1f, 0.0f, 0.0f,
+                      0.0f, 0.8f, 0.2f, 0.0f,
+                      0.1f, 0.0f, 0.9f, 0.0f,
+                      0.0f, 0.0f, 0.0f, 1.0f };
+    float offset4[4] = { 0.01f, 0.02f, 0.03f, 0.0f };
+    matrix->setValue(m44, offset4);
+    group->push_back(matrix);
+    OCIO::ConstProcessorRcPtr processor = config->getProcessor(group);
+    
+    const ShaderCompilers compilers;
+    OCIO::TempDirectory compileDir("shaders");
+    
+    const ShaderLanguageTest tests[7] = {
+        { OCIO::GPU_LANGUAGE_CG,
+          "half4 f(in half4 inPixel,\n    const uniform sampler3D lut3d",
+          { "tex3D", "tex1D", "tex2D" },
+          "half4 half3 half4x4 mul",
+          "vec4 mat4 float4x4 texture texture3D Sample sample mix" },
+        { OCIO::GPU_LANGUAGE_GLSL_1_0,
+          "vec4 f(vec4 inPixel, \n    sampler3D lut3d",
+          { "texture3D", "texture1D", "texture2D" },
+          "vec4 vec3 mat4",
+          "half4 float4 float4x4 texture tex3D Sample sample lerp mul const" },
+        { OCIO::GPU_LANGUAGE_GLSL_1_3,
+          "vec4 f(in vec4 inPixel, \n    const sampler3D lut3d",
+          { "texture3D", "texture1D", "texture2D" },
+          "vec4 vec3 mat4",
+          "half4 float4 float4x4 texture tex3D Sample sample lerp mul" },
+        { OCIO::GPU_LANGUAGE_GLSL_3_3,
+          "vec4 f(in vec4 inPixel, \n    sampler3D lut3d",
+          { "texture", "texture", "texture" },
+          "vec4 vec3 mat4",
+          "half4 float4 float4x4 texture1D texture2D texture3D tex3D Sample sample lerp mul const" },
+        { OCIO::GPU_LANGUAGE_GLSL_4_0,
+          "vec4 f(in vec4 inPixel, \n    sampler3D lut3d",
+          { "texture", "texture", "texture" },
+          "vec4 vec3 mat4",
+          "half4 float4 float4x4 texture1D texture2D texture3D tex3D Sample sample lerp mul const" },
+        { OCIO::GPU_LANGUAGE_HLSL_DX11,
+          "float4 f(in float4 inPixel,\n    Texture3D lut3d, SamplerState lut3dSampler",
+          { "Sample", "Sample", "Sample" },
+          "float4 float3 float4x4 mul",
+          "half4 vec4 vec3 mat4 texture texture3D tex3D sample mix" },
+        { OCIO::GPU_LANGUAGE_MSL,
+          "float4 f(float4 inPixel,\n    texture3d<float> lut3d, sampler lut3dSampler",
+          { "sample", "sample", "sample" },
+          "float4 float3 float4x4 metal_stdlib",
+          "half4 vec4 vec3 mat4 texture texture3D tex3D Sample lerp mul uniform" },
+    };
+    
+    for(int t=0; t<7; ++t)
+    {
+        const ShaderLanguageTest & test = tests[t];
+        
+        std::vector<std::string> unexpected;
+        SplitTokens(unexpected, test.unexpected);
+        
+        // The 3D lut, a 1D texture, then a 2D texture for the 1D lut,
+        // without and with uniforms
+        for(int variant=0; variant<6; ++variant)
+        {
+            OCIO::GpuShaderDesc shaderDesc;
+            shaderDesc.setLanguage(test.language);
+            shaderDesc.setFunctionName("f");
+            shaderDesc.setLut3DEdgeLen(16);
+            shaderDesc.setLut1DTexturesEnabled(variant % 3 != 0);
+            shaderDesc.setLut1DTextureMaxWidth(variant % 3 == 2 ? 2 : 4096);
+            shaderDesc.setUniformsEnabled(variant >= 3);
+            
+            const std::string shader = processor->getGpuShaderText(shaderDesc);
+            
+            std::vector<std::string> expected;
+            SplitTokens(expected, test.expected);
+            expected.push_back(test.lookups[variant % 3]);
+            
+            OIIO_CHECK_NE(shader.find(test.signature), std::string::npos);
+            OIIO_CHECK_ASSERT(IsBalanced(shader));
+            for(unsigned int i=0; i<expected.size(); ++i)
+            {
+                if(!HasToken(shader, expected[i]))
+                {
+                    std::cerr << OCIO::GpuLanguageToString(test.language);
+                    std::cerr << " shader without " << expected[i] << ":\n" << shader;
+                }
+                OIIO_CHECK_ASSERT(HasToken(shader, expected[i]));
+            }
+            for(unsigned int i=0; i<unexpected.size(); ++i)
+            {
+                if(HasToken(shader, unexpected[i]))
+                {
+                    std::cerr << OCIO::GpuLanguageToString(test.language);
+                    std::cerr << " shader with " << unexpected[i] << ":\n" << shader;
+                }
+                OIIO_CHECK_ASSERT(!HasToken(shader, unexpected[i]));
+            }
+            
+            if(variant % 3 != 0)
+            {
+                OIIO_CHECK_EQUAL(processor->getNumGpuLut1DTextures(shaderDesc), 1);
+                OIIO_CHECK_NE(shader.find("lut1d_0"), std::string::npos);
+            }
+            if(variant >= 3)
+            {
+                OIIO_CHECK_ASSERT(processor->getNumGpuUniforms(shaderDesc) > 0);
+                OIIO_CHECK_ASSERT(HasToken(shader, processor->getGpuUniformName(shaderDesc, 0)));
+            }
+            
+            // The compilers that are installed accept the text
+            bool compiled = false;
+            if(CompileShader(compiled, compileDir, compilers,
+                             processor, shaderDesc, shader))
+            {
+                OIIO_CHECK_ASSERT(compiled);
+            }
+        }
+    }
+    
+    OCIO::GpuShaderDesc shaderDesc;
+    shaderDesc.setLanguage(OCIO::GPU_LANGUAGE_UNKNOWN);
+    OIIO_CHECK_THOW(processor->getGpuShaderText(shaderDesc), OCIO::Exception);
+}
+
+namespace
+{
+    OCIO::ConstProcessorRcPtr CreateGradeProcessor(float slope, float offset,
+                                                   float power)
+    {
+        OCIO::ConfigRcPtr config = OCIO::Config::Create();
+        OCIO::CDLTransformRcPtr cdl = OCIO::CDLTransform::Create();
+        float slope3[3] = { slope, slope * 0.9f, slope * 1.1f };
+        float offset3[3] = { offset, 0.0f, -offset };
+        float power3[3] = { power, power, 1.0f };
+        cdl->setSlope(slope3);
+        cdl->setOffset(offset3);
+        cdl->setPower(power3);
+        cdl->setSat(0.8f);
+        return config->getProcessor(cdl);
+    }
+}
+
+OIIO_ADD_TEST(Processor, GpuUniforms)
+{
+    OCIO::GpuShaderDesc shaderDesc;
+    shaderDesc.setLanguage(OCIO::GPU_LANGUAGE_GLSL_1_3);
+    shaderDesc.setFunctionName("grade");
+    shaderDesc.setLut3DEdgeLen(32);
+    
+    OCIO::ConstProcessorRcPtr processor1 = CreateGradeProcessor(1.2f, 0.1f, 1.5f);
+    OCIO::ConstProcessorRcPtr processor2 = CreateGradeProcessor(0.7f, 0.05f, 0.8f);
+    
+    // Off by default: the values are in the text
+    OIIO_CHECK_EQUAL(processor1->getNumGpuUniforms(shaderDesc), 0);
+    OIIO_CHECK_NE(std::string(processor1->getGpuShaderTextCacheID(shaderDesc)),
+                  std::string(processor2->getGpuShaderTextCacheID(shaderDesc)));
+    const std::string constantShader = processor1->getGpuShaderText(shaderDesc);
+    OIIO_CHECK_EQUAL(constantShader.find("uniform"), std::string::npos);
+    
+    // The grades only differ by their values, so share the text
+    shaderDesc.setUniformsEnabled(true);
+    const std::string shader = processor1->getGpuShaderText(shaderDesc);
+    OIIO_CHECK_EQUAL(shader, std::string(processor2->getGpuShaderText(shaderDesc)));
+    OIIO_CHECK_EQUAL(std::string(processor1->getGpuShaderTextCacheID(shaderDesc)),
+                     std::string(processor2->getGpuShaderTextCacheID(shaderDesc)));
+    OIIO_CHECK_NE(shader, constantShader);
+    
+    // Scale + offset, power, then saturation
+    OIIO_CHECK_EQUAL(processor1->getNumGpuUniforms(shaderDesc), 5);
+    OIIO_CHECK_EQUAL(processor2->getNumGpuUniforms(shaderDesc), 5);
+    
+    const char * names[5] = { "grade_matrix0", "grade_offset1", "grade_exponent2",
+                              "grade_matrix3", "grade_offset4" };
+    const OCIO::GpuUniformType types[5] = { OCIO::GPU_UNIFORM_FLOAT4X4,
+                                            OCIO::GPU_UNIFORM_FLOAT4,
+                                            OCIO::GPU_UNIFORM_FLOAT4,
+                                            OCIO::GPU_UNIFORM_FLOAT4X4,
+                                            OCIO::GPU_UNIFORM_FLOAT4 };
+    for(int i=0; i<5; ++i)
+    {
+        OIIO_CHECK_EQUAL(std::string(processor1->getGpuUniformName(shaderDesc, i)),
+                         std::string(names[i]));
+        OIIO_CHECK_EQUAL(processor1->getGpuUniformType(shaderDesc, i), types[i]);
+        
+        std::string declaration = std::string("uniform ") +
+            (types[i] == OCIO::GPU_UNIFORM_FLOAT4X4 ? "mat4 " : "vec4 ") + names[i] + ";";
+        OIIO_CHECK_NE(shader.find(declaration), std::string::npos);
+    }
+    // An exponent of 1.0 leaves negative values unchanged, as on the cpu
+    // where the op is optimized out
+    OIIO_CHECK_NE(shader.find("if(!all(equal(grade_exponent2, vec4(1.0, 1.0, 1.0, 1.0))))"),
+                  std::string::npos);
+    OIIO_CHECK_THOW(processor1->getGpuUniformName(shaderDesc, 5), OCIO::Exception);
+    OIIO_CHECK_THOW(processor1->getGpuUniformName(shaderDesc, -1), OCIO::Exception);
+    
+    float m44[16];
+    processor2->getGpuUniformValue(m44, shaderDesc, 0);
+    OIIO_CHECK_CLOSE(m44[0], 0.7f, 1e-6f);
+    OIIO_CHECK_CLOSE(m44[5], 0.63f, 1e-6f);
+    OIIO_CHECK_CLOSE(m44[10], 0.77f, 1e-6f);
+    OIIO_CHECK_EQUAL(m44[1], 0.0f);
+    
+    float v4[4];
+    processor2->getGpuUniformValue(v4, shaderDesc, 1);
+    OIIO_CHECK_CLOSE(v4[0], 0.05f, 1e-6f);
+    OIIO_CHECK_EQUAL(v4[1], 0.0f);
+    OIIO_CHECK_CLOSE(v4[2], -0.05f, 1e-6f);
+    
+    processor1->getGpuUniformValue(v4, shaderDesc, 2);
+    OIIO_CHECK_CLOSE(v4[0], 1.5f, 1e-6f);
+    OIIO_CHECK_CLOSE(v4[1], 1.5f, 1e-6f);
+    OIIO_CHECK_CLOSE(v4[2], 1.0f, 1e-6f);
+    processor2->getGpuUniformValue(v4, shaderDesc, 2);
+    OIIO_CHECK_CLOSE(v4[0], 0.8f, 1e-6f);
+    
+    // The uniforms are also there for Cg
+    shaderDesc.setLanguage(OCIO::GPU_LANGUAGE_CG);
+    const std::string cgShader = processor1->getGpuShaderText(shaderDesc);
+    OIIO_CHECK_NE(cgShader.find("uniform half4x4 grade_matrix0;"), std::string::npos);
+    OIIO_CHECK_NE(cgShader.find("mul( grade_matrix0, "), std::string::npos);
+    OIIO_CHECK_EQUAL(processor1->getNumGpuUniforms(shaderDesc), 5);
+    
+    // HLSL constant buffers are column major unless told otherwise
+    shaderDesc.setLanguage(OCIO::GPU_LANGUAGE_HLSL_DX11);
+    const std::string hlslShader = processor1->getGpuShaderText(shaderDesc);
+    OIIO_CHECK_NE(hlslShader.find("uniform row_major float4x4 grade_matrix0;"),
+                  std::string::npos);
+    OIIO_CHECK_NE(hlslShader.find("uniform float4 grade_offset1;"), std::string::npos);
+    OIIO_CHECK_NE(hlslShader.find("mul(grade_matrix0, "), std::string::npos);
+    OIIO_CHECK_NE(hlslShader.find("if(!all(grade_exponent2 == float4(1.0, 1.0, 1.0, 1.0)))"),
+                  std::string::npos);
+    
+    // An identity grade keeps its ops, so that the text does not change
+    // when it is adjusted
+    shaderDesc.setLanguage(OCIO::GPU_LANGUAGE_GLSL_1_3);
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    OCIO::CDLTransformRcPtr cdl = OCIO::CDLTransform::Create();
+    OCIO::ConstProcessorRcPtr identity = config->getProcessor(cdl);
+    OIIO_CHECK_ASSERT(identity->isNoOp());
+    OIIO_CHECK_EQUAL(identity->getNumGpuUniforms(shaderDesc), 5);
+    const std::string identityCacheID = identity->getGpuShaderTextCacheID(shaderDesc);
+    float slope3[3] = { 1.2f, 1.0f, 0.9f };
+    float power3[3] = { 1.0f, 1.1f, 1.0f };
+    cdl->setSlope(slope3);
+    cdl->setPower(power3);
+    OCIO::ConstProcessorRcPtr graded = config->getProcessor(cdl);
+    OIIO_CHECK_ASSERT(!graded->isNoOp());
+    OIIO_CHECK_EQUAL(std::string(graded->getGpuShaderTextCacheID(shaderDesc)), identityCacheID);
+    
+    // Without uniforms, the identity is still optimized out
+    shaderDesc.setUniformsEnabled(false);
+    const std::string identityShader = identity->getGpuShaderText(shaderDesc);
+    OIIO_CHECK_EQUAL(identityShader.find("pow("), std::string::npos);
+    OIIO_CHECK_EQUAL(identityShader.find("mat4"), std::string::npos);
+    OIIO_CHECK_NE(std::string(graded->getGpuShaderTextCacheID(shaderDesc)),
+                  std::string(identity->getGpuShaderTextCacheID(shaderDesc)));
+}
+
+#endif // OCIO_UNIT_TEST
@@ -30,16 +30,85 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef INCLUDED_OCIO_PROCESSOR_H
 #define INCLUDED_OCIO_PROCESSOR_H
 
+#include <map>
 #include <sstream>
+#include <string>
+#include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "CpuProgram.h"
+#include "GpuShaderUtils.h"
 #include "Mutex.h"
 #include "Op.h"
 #include "PrivateTypes.h"
 
 OCIO_NAMESPACE_ENTER
 {
+    // A 1D lut of the gpu path, sampled from a texture
+    // (see GpuShaderDesc::setLut1DTexturesEnabled)
+    struct GpuLut1DTexture
+    {
+        std::string name;
+        int width;
+        int height;
+        std::vector<float> values;
+        std::string cacheID;
+    };
+    
+    typedef OCIO_SHARED_PTR<std::vector<GpuLut1DTexture> > GpuLut1DTexturesRcPtr;
+    typedef OCIO_SHARED_PTR<const std::vector<GpuLut1DTexture> > ConstGpuLut1DTexturesRcPtr;
+    typedef OCIO_SHARED_PTR<GpuUniformVec> GpuUniformsRcPtr;
+    typedef OCIO_SHARED_PTR<const GpuUniformVec> ConstGpuUniformsRcPtr;
+    
+    typedef OCIO_SHARED_PTR<const std::string> ConstStringRcPtr;
+    typedef OCIO_SHARED_PTR<const std::vector<float> > ConstFloatVecRcPtr;
+    
+    // The gpu path results for one GpuShaderDesc, each built when it is
+    // first asked for (a NULL value is not built yet). Published results
+    // are never changed: building more of them publishes a copy, which
+    // shares what was built before. The strings handed out by the gpu
+    // getters point into these.
+    struct GpuShaderResults
+    {
+        std::string shaderDescCacheID;
+        
+        ConstStringRcPtr shader;
+        ConstStringRcPtr shaderCacheID;
+        // rgb
+        ConstFloatVecRcPtr lut3D;
+        ConstStringRcPtr lut3DCacheID;
+        ConstGpuLut1DTexturesRcPtr lut1DTextures;
+        // Built with the shader text
+        ConstGpuUniformsRcPtr uniforms;
+        
+        // Stamped by each lookup, for evicting the least recently used
+        mutable volatile long lastUse;
+        
+        GpuShaderResults():
+            lastUse(0)
+        {}
+        
+        // An estimate of the memory held
+        size_t getMemorySize() const;
+    };
+    
+    typedef OCIO_SHARED_PTR<GpuShaderResults> GpuShaderResultsRcPtr;
+    typedef OCIO_SHARED_PTR<const GpuShaderResults> ConstGpuShaderResultsRcPtr;
+    
+    // The results of the last few shader descriptions of a processor, as
+    // published to the gpu getters. Never changed once published either.
+    typedef std::vector<ConstGpuShaderResultsRcPtr> GpuShaderResultsTable;
+    
+    // The counters reported by GetCacheStats(CACHE_TYPE_GPU_SHADER), over
+    // the gpu results of all the processors.
+    void GetGpuShaderCacheStats(long & entries, size_t & bytes,
+                                long & hits, long & misses, long & evictions);
+    
+    // Reset the hits, misses and evictions. (The results themselves
+    // belong to the processors.)
+    void ClearGpuShaderCacheStats();
+    
     class Processor::Impl
     {
     private:
@@ -47,6 +116,18 @@ OCIO_NAMESPACE_ENTER
         
         OpRcPtrVec m_cpuOps;
         
+        // m_cpuOps (or m_cpuBakedOps), compiled at finalize for apply
+        CpuProgram m_cpuProgram;
+        
+        // The allocation of the source color space, used as the shaper
+        // when baking the cpu path.
+        AllocationData m_cpuAllocation;
+        
+        // The cpu path baked into a shaper + 3D lut, if it was within
+        // the requested error (see Processor::getBakedProcessor).
+        OpRcPtrVec m_cpuBakedOps;
+        bool m_cpuBaked;
+        
         // These 3 op vecs represent the 3 stages in our gpu pipe.
         // 1) preprocess shader text
         // 2) 3d lut process lookup
@@ -55,19 +136,45 @@ OCIO_NAMESPACE_ENTER
         OpRcPtrVec m_gpuOpsHwPreProcess;
         OpRcPtrVec m_gpuOpsCpuLatticeProcess;
         OpRcPtrVec m_gpuOpsHwPostProcess;
+        // m_gpuOpsCpuLatticeProcess, compiled for baking the 3D lut
+        CpuProgram m_gpuLatticeProgram;
         
-        mutable std::string m_cpuCacheID;
+        // The same 3 stages, with the 1D luts that can be sampled from
+        // textures applied by the shader text. Only set up if there are
+        // such luts in the lattice ops above.
+        bool m_hasGpuLut1DTextureOps;
+        OpRcPtrVec m_gpuTexOpsHwPreProcess;
+        OpRcPtrVec m_gpuTexOpsCpuLatticeProcess;
+        OpRcPtrVec m_gpuTexOpsHwPostProcess;
+        CpuProgram m_gpuTexLatticeProgram;
         
-        // Cache the last last queried value,
-        // for the specified shader description
-        mutable std::string m_lastShaderDesc;
-        mutable std::string m_shader;
-        mutable std::string m_shaderCacheID;
-        mutable std::vector<float> m_lut3D;
-        mutable std::string m_lut3DCacheID;
+        // The pre and post stages of both, as partitioned but not
+        // optimized, for the shader text with uniforms: removing no-ops
+        // and combining ops would make the text depend on the values.
+        OpRcPtrVec m_gpuUniformOpsHwPreProcess;
+        OpRcPtrVec m_gpuUniformOpsHwPostProcess;
+        OpRcPtrVec m_gpuTexUniformOpsHwPreProcess;
+        OpRcPtrVec m_gpuTexUniformOpsHwPostProcess;
+        
+        mutable std::string m_cpuCacheID;
         
         mutable Mutex m_resultsCacheMutex;
         
+        // The gpu results, so that processors shared by several shader
+        // descriptions do not keep rebuilding them. Lookups are lock free:
+        // they read the published table while counted in
+        // m_gpuResultsReaders. Results are built without holding any lock,
+        // then published in a new table under m_gpuResultsMutex. Replaced
+        // tables are retired, and only deleted once no lookup is counted.
+        // Evicted results are retired for the lifetime of the processor,
+        // as the gpu getters hand out pointers into them.
+        mutable GpuShaderResultsTable * volatile m_gpuResultsTable;
+        mutable volatile long m_gpuResultsReaders;
+        mutable volatile long m_gpuResultsClock;
+        mutable Mutex m_gpuResultsMutex;
+        mutable std::vector<GpuShaderResultsTable *> m_retiredGpuResultsTables;
+        mutable std::vector<ConstGpuShaderResultsRcPtr> m_retiredGpuResults;
+        
     public:
         Impl();
         ~Impl();
@@ -78,17 +185,27 @@ OCIO_NAMESPACE_ENTER
         ConstProcessorMetadataRcPtr getMetadata() const;
         
         void apply(ImageDesc& img) const;
+        void apply(const ImageDesc& srcImg, ImageDesc& dstImg) const;
         
         void applyRGB(float * pixel) const;
         void applyRGBA(float * pixel) const;
         const char * getCpuCacheID() const;
         
+        bool isCpuBaked() const;
+        
         const char * getGpuShaderText(const GpuShaderDesc & gpuDesc) const;
         const char * getGpuShaderTextCacheID(const GpuShaderDesc & shaderDesc) const;
         
         void getGpuLut3D(float* lut3d, const GpuShaderDesc & shaderDesc) const;
         const char * getGpuLut3DCacheID(const GpuShaderDesc & shaderDesc) const;
         
+        int getNumGpuLut1DTextures(const GpuShaderDesc & shaderDesc) const;
+        ConstGpuLut1DTexturesRcPtr getGpuLut1DTextures(
+            const GpuShaderDesc & shaderDesc) const;
+        
+        int getNumGpuUniforms(const GpuShaderDesc & shaderDesc) const;
+        ConstGpuUniformsRcPtr getGpuUniforms(const GpuShaderDesc & shaderDesc) const;
+        
         ////////////////////////////////////////////
         //
         // Builder functions, Not exposed
@@ -105,8 +222,44 @@ OCIO_NAMESPACE_ENTER
         
         void finalize();
         
+        // Set up as a copy of the finalized processor, with its cpu
+        // path baked if within maxError.
+        void bake(const Impl & processor, float maxError, int lut3DEdgeLen);
+        
+        // The uniforms read by the text are added to 'uniforms' (only
+        // with GpuShaderDesc::getUniformsEnabled)
         void calcGpuShaderText(std::ostream & shader,
-                               const GpuShaderDesc & shaderDesc) const;
+                               const GpuShaderDesc & shaderDesc,
+                               const std::vector<GpuLut1DTexture> & lut1DTextures,
+                               GpuUniformVec & uniforms) const;
+    
+    private:
+        bool useGpuLut1DTextures(const GpuShaderDesc & shaderDesc) const;
+        const OpRcPtrVec & getGpuPreOps(const GpuShaderDesc & shaderDesc) const;
+        const OpRcPtrVec & getGpuLatticeOps(const GpuShaderDesc & shaderDesc) const;
+        const OpRcPtrVec & getGpuPostOps(const GpuShaderDesc & shaderDesc) const;
+        
+        std::string calcGpuLut3DCacheID(const GpuShaderDesc & shaderDesc) const;
+        void calcGpuLut1DTextures(std::vector<GpuLut1DTexture> & lut1DTextures,
+                                  const GpuShaderDesc & shaderDesc) const;
+        
+        // Lock free, returns NULL if there are no results for the
+        // description yet
+        ConstGpuShaderResultsRcPtr findGpuResults(const std::string & shaderDescCacheID) const;
+        // Expects m_gpuResultsMutex to be held. Returns a copy of the
+        // published results for the description (or new empty ones), to
+        // build on and publish.
+        GpuShaderResultsRcPtr copyGpuResults(const std::string & shaderDescCacheID) const;
+        // Expects m_gpuResultsMutex to be held. Publishes the results in
+        // place of those for the same description, or else of the least
+        // recently used ones.
+        void publishGpuResults(const GpuShaderResultsRcPtr & results) const;
+        // Keeps the text along with the textures and uniforms it was
+        // written with, where not built yet.
+        void setGpuShaderText(GpuShaderResults & results,
+                              const std::string & shader,
+                              const GpuLut1DTexturesRcPtr & lut1DTextures,
+                              const GpuUniformsRcPtr & uniforms) const;
     
     };
     
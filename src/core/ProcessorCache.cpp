@@ -0,0 +1,476 @@
+/*
+Copyright (c) 2003-2010 Sony Pictures Imageworks Inc., et al.
+All Rights Reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Sony Pictures Imageworks nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "LruOrder.h"
+#include "Mutex.h"
+#include "ParseUtils.h"
+#include "ProcessorCache.h"
+
+OCIO_NAMESPACE_ENTER
+{
+    namespace
+    {
+        const char * OCIO_PROCESSOR_CACHE_SIZE_ENVVAR = "OCIO_PROCESSOR_CACHE_SIZE";
+        const int OCIO_DEFAULT_PROCESSOR_CACHE_SIZE = 128;
+        
+        // Lookups only take a read lock, so they do not block each other.
+        // Instead of reordering a list, a hit stamps its entry with the
+        // cache clock, which the (rare) evictions catch up with.
+        typedef LruOrder<std::string> ProcessorCacheOrder;
+        
+        struct ProcessorCacheEntry
+        {
+            ConstProcessorRcPtr processor;
+            volatile long lastUse;
+            ProcessorCacheOrder::Position order;
+            
+            ProcessorCacheEntry():
+                lastUse(0)
+            {}
+        };
+        
+        typedef std::map<std::string, ProcessorCacheEntry> ProcessorCacheMap;
+        
+        RWLock g_processorCacheLock;
+        ProcessorCacheMap g_processorCache;
+        ProcessorCacheOrder g_processorCacheOrder;
+        volatile long g_processorCacheClock = 0;
+        volatile long g_processorCacheHits = 0;
+        volatile long g_processorCacheMisses = 0;
+        long g_processorCacheEvictions = 0;
+        
+        int g_processorCacheSize = OCIO_DEFAULT_PROCESSOR_CACHE_SIZE;
+        bool g_initialized = false;
+        bool g_processorCacheSizeOverride = false;
+        
+        // You must manually acquire the processor cache lock before calling
+        // this. This will set g_processorCacheSize, g_initialized,
+        // g_processorCacheSizeOverride
+        void InitProcessorCache()
+        {
+            if(g_initialized) return;
+            
+            g_initialized = true;
+            
+            char* sizestr = std::getenv(OCIO_PROCESSOR_CACHE_SIZE_ENVVAR);
+            if(sizestr)
+            {
+                int size = 0;
+                if(StringToInt(&size, sizestr, true) && size >= 0)
+                {
+                    g_processorCacheSizeOverride = true;
+                    g_processorCacheSize = size;
+                }
+                else
+                {
+                    std::cerr << "[OpenColorIO Warning]: Invalid $OCIO_PROCESSOR_CACHE_SIZE specified. ";
+                    std::cerr << "Options: 0 (disabled), or a positive number of processors." << std::endl;
+                }
+            }
+        }
+        
+        // You must manually acquire the processor cache write lock before
+        // calling this. Evicts the least recently used processors.
+        void TrimProcessorCache()
+        {
+            while(g_processorCacheOrder.size() > (size_t)g_processorCacheSize)
+            {
+                ProcessorCacheMap::iterator iter =
+                    g_processorCache.find(g_processorCacheOrder.back());
+                g_processorCacheOrder.erase(iter->second.order);
+                g_processorCache.erase(iter);
+                ++g_processorCacheEvictions;
+            }
+        }
+    }
+    
+    int GetProcessorCacheSize()
+    {
+        AutoWriteLock lock(g_processorCacheLock);
+        InitProcessorCache();
+        
+        return g_processorCacheSize;
+    }
+    
+    void SetProcessorCacheSize(int size)
+    {
+        AutoWriteLock lock(g_processorCacheLock);
+        InitProcessorCache();
+        
+        // As with the logging level, calls to SetProcessorCacheSize are
+        // ignored if OCIO_PROCESSOR_CACHE_SIZE is specified.
+        
+        if(!g_processorCacheSizeOverride)
+        {
+            g_processorCacheSize = size < 0 ? 0 : size;
+            TrimProcessorCache();
+        }
+    }
+    
+    void GetProcessorCacheStats(long & entries, size_t & bytes,
+                                long & hits, long & misses, long & evictions)
+    {
+        AutoReadLock lock(g_processorCacheLock);
+        
+        entries = (long)g_processorCache.size();
+        bytes = 0;
+        hits = AtomicLoad(&g_processorCacheHits);
+        misses = AtomicLoad(&g_processorCacheMisses);
+        evictions = g_processorCacheEvictions;
+    }
+    
+    ConstProcessorRcPtr GetCachedProcessor(const std::string & key)
+    {
+        AutoReadLock lock(g_processorCacheLock);
+        
+        ProcessorCacheMap::iterator iter = g_processorCache.find(key);
+        if(iter == g_processorCache.end())
+        {
+            AtomicAdd(&g_processorCacheMisses, 1);
+            return ConstProcessorRcPtr();
+        }
+        
+        AtomicAdd(&g_processorCacheHits, 1);
+        AtomicStore(&iter->second.lastUse, AtomicAdd(&g_processorCacheClock, 1));
+        return iter->second.processor;
+    }
+    
+    void AddCachedProcessor(const std::string & key,
+                            const ConstProcessorRcPtr & processor)
+    {
+        AutoWriteLock lock(g_processorCacheLock);
+        InitProcessorCache();
+        
+        if(g_processorCacheSize == 0) return;
+        
+        // Another thread may have built the same processor meanwhile,
+        // in which case it is replaced.
+        ProcessorCacheMap::iterator iter = g_processorCache.find(key);
+        if(iter == g_processorCache.end())
+        {
+            iter = g_processorCache.insert(
+                std::make_pair(key, ProcessorCacheEntry())).first;
+            iter->second.lastUse = AtomicAdd(&g_processorCacheClock, 1);
+            iter->second.order = g_processorCacheOrder.push(key,
+                &iter->second.lastUse);
+        }
+        else
+        {
+            AtomicStore(&iter->second.lastUse,
+                        AtomicAdd(&g_processorCacheClock, 1));
+        }
+        iter->second.processor = processor;
+        
+        TrimProcessorCache();
+    }
+    
+    void ClearProcessorCache()
+    {
+        AutoWriteLock lock(g_processorCacheLock);
+        
+        g_processorCache.clear();
+        g_processorCacheOrder.clear();
+        AtomicStore(&g_processorCacheHits, 0);
+        AtomicStore(&g_processorCacheMisses, 0);
+        g_processorCacheEvictions = 0;
+    }
+}
+OCIO_NAMESPACE_EXIT
+
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef OCIO_UNIT_TEST
+
+namespace OCIO = OCIO_NAMESPACE;
+#include "UnitTest.h"
+#include "CPUInfo.h"
+
+OIIO_ADD_TEST(ProcessorCache, GetProcessor)
+{
+    int oldSize = OCIO::GetProcessorCacheSize();
+    OCIO::SetProcessorCacheSize(2);
+    OCIO::ClearAllCaches();
+    
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    float value[4] = { 2.2f, 2.2f, 2.2f, 1.0f };
+    exponent->setValue(value);
+    
+    long entries = 0, hits = 0, misses = 0, evictions = 0;
+    size_t bytes = 0;
+    
+    OCIO::ConstProcessorRcPtr p1 = config->getProcessor(exponent);
+    OCIO::ConstProcessorRcPtr p2 = config->getProcessor(exponent);
+    OIIO_CHECK_ASSERT(p1 == p2);
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_PROCESSOR,
+                        entries, bytes, hits, misses, evictions);
+    OIIO_CHECK_EQUAL(hits, 1);
+    OIIO_CHECK_EQUAL(misses, 1);
+    
+    // An equal transform hits as well
+    OCIO::ExponentTransformRcPtr exponent2 = OCIO::ExponentTransform::Create();
+    exponent2->setValue(value);
+    OIIO_CHECK_ASSERT(config->getProcessor(exponent2) == p1);
+    
+    // The direction, the values (to full precision) and the config are
+    // all part of the key
+    OIIO_CHECK_ASSERT(config->getProcessor(exponent,
+        OCIO::TRANSFORM_DIR_INVERSE) != p1);
+    value[0] = 2.2000003f;
+    exponent2->setValue(value);
+    OCIO::ConstProcessorRcPtr p3 = config->getProcessor(exponent2);
+    OIIO_CHECK_ASSERT(p3 != p1);
+    
+    OCIO::ConfigRcPtr config2 = OCIO::Config::Create();
+    config2->setDescription("Another config");
+    OIIO_CHECK_ASSERT(config2->getProcessor(exponent) != p1);
+    
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_PROCESSOR,
+                        entries, bytes, hits, misses, evictions);
+    OIIO_CHECK_EQUAL(hits, 2);
+    OIIO_CHECK_EQUAL(misses, 4);
+    
+    // Only the 2 most recently used processors are kept
+    OIIO_CHECK_ASSERT(config->getProcessor(exponent2) == p3);
+    OIIO_CHECK_ASSERT(config->getProcessor(exponent) != p1);
+    OIIO_CHECK_ASSERT(config->getProcessor(exponent2) == p3);
+    
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_PROCESSOR,
+                        entries, bytes, hits, misses, evictions);
+    OIIO_CHECK_EQUAL(entries, 2);
+    OIIO_CHECK_EQUAL(misses, 5);
+    OIIO_CHECK_EQUAL(evictions, 3);
+    
+    // The SIMD level the kernels are selected for
+    OCIO::SIMDLevel oldLevel = OCIO::GetSIMDLevel();
+    if(oldLevel != OCIO::SIMD_LEVEL_NONE)
+    {
+        OCIO::SetSIMDLevel(OCIO::SIMD_LEVEL_NONE);
+        OIIO_CHECK_ASSERT(config->getProcessor(exponent2) != p3);
+        OCIO::SetSIMDLevel(oldLevel);
+        OIIO_CHECK_ASSERT(config->getProcessor(exponent2) == p3);
+    }
+    
+    // Disabled
+    OCIO::SetProcessorCacheSize(0);
+    OIIO_CHECK_ASSERT(config->getProcessor(exponent2) != p3);
+    OCIO::SetProcessorCacheSize(2);
+    
+    OCIO::ClearAllCaches();
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_PROCESSOR,
+                        entries, bytes, hits, misses, evictions);
+    OIIO_CHECK_EQUAL(hits, 0);
+    OIIO_CHECK_EQUAL(misses, 0);
+    OIIO_CHECK_ASSERT(config->getProcessor(exponent2) != p3);
+    
+    OCIO::SetProcessorCacheSize(oldSize);
+}
+
+OIIO_ADD_TEST(ProcessorCache, ColorSpaces)
+{
+    OCIO::ClearAllCaches();
+    
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    
+    OCIO::ColorSpaceRcPtr raw = OCIO::ColorSpace::Create();
+    raw->setName("raw");
+    config->addColorSpace(raw);
+    
+    OCIO::ColorSpaceRcPtr lin = OCIO::ColorSpace::Create();
+    lin->setName("lin");
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    float value[4] = { 2.2f, 2.2f, 2.2f, 1.0f };
+    exponent->setValue(value);
+    lin->setTransform(exponent, OCIO::COLORSPACE_DIR_TO_REFERENCE);
+    config->addColorSpace(lin);
+    
+    OCIO::ConstProcessorRcPtr p1 = config->getProcessor("lin", "raw");
+    OIIO_CHECK_ASSERT(config->getProcessor("lin", "raw") == p1);
+    OIIO_CHECK_ASSERT(config->getProcessor("raw", "lin") != p1);
+    
+    // A color space that is not part of the config (with the same name)
+    OCIO::ColorSpaceRcPtr lin2 = lin->createEditableCopy();
+    value[0] = 2.4f;
+    exponent->setValue(value);
+    lin2->setTransform(exponent, OCIO::COLORSPACE_DIR_TO_REFERENCE);
+    OIIO_CHECK_ASSERT(config->getProcessor(lin2, config->getColorSpace("raw")) != p1);
+    
+    // Editing the config changes its cache id
+    config->addColorSpace(lin2);
+    OIIO_CHECK_ASSERT(config->getProcessor("lin", "raw") != p1);
+}
+
+#include <algorithm>
+
+#include "Threading.h"
+
+namespace
+{
+    // Each item is one getProcessor call on the shared config
+    class GetProcessorBody : public OCIO::ParallelForBody
+    {
+    public:
+        GetProcessorBody(const OCIO::ConstConfigRcPtr & config,
+                         std::vector<OCIO::ConstProcessorRcPtr> & processors) :
+            m_config(config),
+            m_processors(processors)
+        { }
+        
+        void run(int /*workerIndex*/, long itemBegin, long itemEnd) const
+        {
+            for(long i=itemBegin; i<itemEnd; ++i)
+            {
+                m_processors[i] = m_config->getProcessor("lin", "raw");
+            }
+        }
+        
+    private:
+        OCIO::ConstConfigRcPtr m_config;
+        std::vector<OCIO::ConstProcessorRcPtr> & m_processors;
+        
+        GetProcessorBody& operator= (const GetProcessorBody &);
+    };
+    
+    // A config with a "lin" color space that reads a lut, to "raw"
+    OCIO::ConfigRcPtr CreateLutConfig(OCIO::TempDirectory & dir)
+    {
+        const std::string lutPath = dir.writeFile("lut.cube",
+            "LUT_1D_SIZE 2\n0.0 0.0 0.0\n1.0 1.0 1.0\n");
+        
+        OCIO::ConfigRcPtr config = OCIO::Config::Create();
+        config->addColorSpace(OCIO::CreateColorSpace("raw", OCIO::ConstTransformRcPtr()));
+        config->addColorSpace(OCIO::CreateColorSpace("lin", OCIO::CreateFileTransform(lutPath)));
+        return config;
+    }
+}
+
+OIIO_ADD_TEST(ProcessorCache, ConcurrentGetProcessor)
+{
+    // Several threads building the same processor, which reads a lut,
+    // from a shared config: first through the processor cache, then
+    // without it (so every call goes to the file cache).
+    OCIO::TempDirectory dir("processorcache");
+    OCIO::ConfigRcPtr config = CreateLutConfig(dir);
+    
+    const int oldSize = OCIO::GetProcessorCacheSize();
+    OCIO::SetProcessorCacheSize(128);
+    OCIO::ClearAllCaches();
+    
+    const int numThreads = 4;
+    const long numCalls = 2000;
+    std::vector<OCIO::ConstProcessorRcPtr> processors(numCalls);
+    GetProcessorBody body(config, processors);
+    
+    OCIO::ConstProcessorRcPtr expected = config->getProcessor("lin", "raw");
+    OCIO::ParallelFor(body, numCalls, 16, numThreads);
+    
+    bool allSame = true;
+    for(long i=0; i<numCalls; ++i)
+    {
+        if(processors[i] != expected) allSame = false;
+    }
+    OIIO_CHECK_ASSERT(allSame);
+    
+    OCIO::SetProcessorCacheSize(0);
+    const long numUncachedCalls = numCalls / 10;
+    OCIO::ParallelFor(body, numUncachedCalls, 16, numThreads);
+    
+    bool allBuilt = true;
+    for(long i=0; i<numUncachedCalls; ++i)
+    {
+        if(!processors[i] || processors[i] == expected) allBuilt = false;
+    }
+    OIIO_CHECK_ASSERT(allBuilt);
+    
+    // The lut was only read once
+    long entries = 0, hits = 0, misses = 0, evictions = 0;
+    size_t bytes = 0;
+    OCIO::GetCacheStats(OCIO::CACHE_TYPE_FILE, entries, bytes, hits, misses, evictions);
+    OIIO_CHECK_EQUAL(misses, 1);
+    OIIO_CHECK_EQUAL(hits, numUncachedCalls);
+    
+    OCIO::SetProcessorCacheSize(oldSize);
+    OCIO::ClearAllCaches();
+}
+
+OIIO_ADD_TEST(ProcessorCache, ContentionBenchmark)
+{
+    // Prints the getProcessor throughput of 1, 2, 4, ... threads (up to
+    // the number of cores) sharing a config, through the processor cache
+    // and without it. Only run when benchmarks are enabled.
+    if(!OCIO::BenchmarksEnabled()) return;
+    
+    OCIO::TempDirectory dir("processorcache");
+    OCIO::ConfigRcPtr config = CreateLutConfig(dir);
+    
+    const int oldSize = OCIO::GetProcessorCacheSize();
+    OCIO::ClearAllCaches();
+    
+    const long numCalls = 20000;
+    const long numUncachedCalls = numCalls / 10;
+    std::vector<OCIO::ConstProcessorRcPtr> processors(numCalls);
+    GetProcessorBody body(config, processors);
+    
+    const int numProcessors = OCIO::GetNumProcessors();
+    for(int numThreads=1; ; numThreads*=2)
+    {
+        if(numThreads > numProcessors) numThreads = numProcessors;
+        
+        OCIO::SetProcessorCacheSize(128);
+        config->getProcessor("lin", "raw");
+        double startTime = OCIO::GetBenchmarkTime();
+        OCIO::ParallelFor(body, numCalls, 64, numThreads);
+        double cachedTime = std::max(OCIO::GetBenchmarkTime() - startTime, 1e-6);
+        
+        OCIO::SetProcessorCacheSize(0);
+        startTime = OCIO::GetBenchmarkTime();
+        OCIO::ParallelFor(body, numUncachedCalls, 64, numThreads);
+        double uncachedTime = std::max(OCIO::GetBenchmarkTime() - startTime, 1e-6);
+        
+        printf("ProcessorCache %d threads: cached getProcessor %0.0f calls/s, "
+               "uncached %0.0f calls/s\n", numThreads,
+               numCalls / cachedTime, numUncachedCalls / uncachedTime);
+        
+        if(numThreads == numProcessors) break;
+    }
+    
+    OCIO::SetProcessorCacheSize(oldSize);
+    OCIO::ClearAllCaches();
+}
+
+#endif // OCIO_UNIT_TEST
@@ -0,0 +1,64 @@
+/*
+Copyright (c) 2003-2010 Sony Pictures Imageworks Inc., et al.
+All Rights Reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Sony Pictures Imageworks nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef INCLUDED_OCIO_PROCESSORCACHE_H
+#define INCLUDED_OCIO_PROCESSORCACHE_H
+
+#include <string>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+OCIO_NAMESPACE_ENTER
+{
+    // A process-wide LRU cache of finalized processors, used by
+    // Config::getProcessor so that identical requests (e.g., from many
+    // nodes of a host application) share one processor instead of
+    // rebuilding and re-optimizing the ops each time.
+    //
+    // The key must identify everything the processor was built from; see
+    // Config::getProcessor. Both functions are thread safe.
+    
+    // Returns a null pointer (and counts a miss) if the key is not cached.
+    ConstProcessorRcPtr GetCachedProcessor(const std::string & key);
+    
+    // Evicts the least recently used processors beyond the cache size.
+    void AddCachedProcessor(const std::string & key,
+                            const ConstProcessorRcPtr & processor);
+    
+    // Also resets the hit / miss / eviction counters.
+    void ClearProcessorCache();
+    
+    // The counters reported by GetCacheStats(CACHE_TYPE_PROCESSOR). The
+    // size of processors is not tracked, so bytes is always 0.
+    void GetProcessorCacheStats(long & entries, size_t & bytes,
+                                long & hits, long & misses, long & evictions);
+}
+OCIO_NAMESPACE_EXIT
+
+#endif
@@ -32,6 +32,76 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef USE_SSE
 #include <xmmintrin.h>
+#include <emmintrin.h>
+
+// Kernels for instruction sets beyond the SSE2 baseline are compiled
+// per function with the target attribute, and only called if the cpu
+// supports them (see CPUInfo.h). This does not require building the
+// library with -mavx2 (etc.), which would make it unusable on older cpus.
+// FMA contraction is disabled so the results match the scalar code bit
+// for bit: per function with gcc, and for the rest of each file using
+// the kernels with clang, which has no optimize attribute.
+
+#if defined(__clang__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#pragma clang fp contract(off)
+#define OCIO_USE_AVX
+#define OCIO_TARGET_AVX2 __attribute__((target("avx2")))
+#define OCIO_TARGET_AVX512 __attribute__((target("avx512f")))
+#define OCIO_TARGET_F16C __attribute__((target("avx2,f16c")))
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define OCIO_USE_AVX
+#define OCIO_TARGET_AVX2 \
+    __attribute__((target("avx2"), optimize("fp-contract=off")))
+#define OCIO_TARGET_AVX512 \
+    __attribute__((target("avx512f"), optimize("fp-contract=off")))
+#define OCIO_TARGET_F16C \
+    __attribute__((target("avx2,f16c"), optimize("fp-contract=off")))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <immintrin.h>
+#define OCIO_USE_AVX
+#define OCIO_TARGET_AVX2
+#define OCIO_TARGET_AVX512
+#define OCIO_TARGET_F16C
 #endif
 
+#ifdef OCIO_USE_AVX
+#include <OpenColorIO/OpenColorIO.h>
+
+OCIO_NAMESPACE_ENTER
+{
+    // Same as _MM_TRANSPOSE4_PS, within each 128-bit lane
+    
+    OCIO_TARGET_AVX2
+    inline void Transpose4_AVX2(__m256 & r0, __m256 & r1, __m256 & r2, __m256 & r3)
+    {
+        __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+        __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+        __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+        __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+        r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1,0,1,0));
+        r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3,2,3,2));
+        r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1,0,1,0));
+        r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3,2,3,2));
+    }
+    
+    OCIO_TARGET_AVX512
+    inline void Transpose4_AVX512(__m512 & r0, __m512 & r1, __m512 & r2, __m512 & r3)
+    {
+        __m512 t0 = _mm512_unpacklo_ps(r0, r1);
+        __m512 t1 = _mm512_unpackhi_ps(r0, r1);
+        __m512 t2 = _mm512_unpacklo_ps(r2, r3);
+        __m512 t3 = _mm512_unpackhi_ps(r2, r3);
+        r0 = _mm512_shuffle_ps(t0, t2, _MM_SHUFFLE(1,0,1,0));
+        r1 = _mm512_shuffle_ps(t0, t2, _MM_SHUFFLE(3,2,3,2));
+        r2 = _mm512_shuffle_ps(t1, t3, _MM_SHUFFLE(1,0,1,0));
+        r3 = _mm512_shuffle_ps(t1, t3, _MM_SHUFFLE(3,2,3,2));
+    }
+}
+OCIO_NAMESPACE_EXIT
+#endif // OCIO_USE_AVX
+
+#endif // USE_SSE
+
 #endif
@@ -29,6 +29,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <OpenColorIO/OpenColorIO.h>
 #include "ScanlineHelper.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
 #include <sstream>
@@ -43,15 +44,63 @@ OCIO_NAMESPACE_ENTER
     ////////////////////////////////////////////////////////////////////////////
     
     ScanlineHelper::ScanlineHelper(ImageDesc& img):
+                                   m_imagePixelIndex(0),
+                                   m_imagePixelEnd(0),
+                                   m_numPixelsCopied(0),
                                    m_buffer(0),
+                                   m_inPlaceMode(false),
+                                   m_outOfPlace(false)
+        {
+            m_srcImg.init(img);
+            m_dstImg = m_srcImg;
+            init();
+        }
+        
+        ScanlineHelper::ScanlineHelper(const GenericImageDesc& img):
+                                   m_srcImg(img),
+                                   m_dstImg(img),
                                    m_imagePixelIndex(0),
+                                   m_imagePixelEnd(0),
                                    m_numPixelsCopied(0),
-                                   m_yIndex(0),
-                                   m_inPlaceMode(false)
+                                   m_buffer(0),
+                                   m_inPlaceMode(false),
+                                   m_outOfPlace(false)
+        {
+            init();
+        }
+        
+        ScanlineHelper::ScanlineHelper(const GenericImageDesc& srcImg,
+                                       const GenericImageDesc& dstImg):
+                                   m_srcImg(srcImg),
+                                   m_dstImg(dstImg),
+                                   m_imagePixelIndex(0),
+                                   m_imagePixelEnd(0),
+                                   m_numPixelsCopied(0),
+                                   m_buffer(0),
+                                   m_inPlaceMode(false),
+                                   m_outOfPlace(true)
+        {
+            if(m_srcImg.width != m_dstImg.width ||
+               m_srcImg.height != m_dstImg.height)
+            {
+                std::ostringstream os;
+                os << "Cannot apply transform; the source and destination ";
+                os << "images have different dimensions (";
+                os << m_srcImg.width << "x" << m_srcImg.height << " vs ";
+                os << m_dstImg.width << "x" << m_dstImg.height << ").";
+                throw Exception(os.str().c_str());
+            }
+            
+            init();
+        }
+        
+        void ScanlineHelper::init()
         {
-            m_img.init(img);
+            m_imagePixelEnd = m_dstImg.width * m_dstImg.height;
             
-            if(m_img.isPackedRGBA())
+            // If the dst image is float rgba, the src pixels are packed
+            // straight into it, and processed there.
+            if(m_dstImg.isPackedRGBA() && m_dstImg.bitDepth == BIT_DEPTH_F32)
             {
                 m_inPlaceMode = true;
             }
@@ -69,31 +118,54 @@ OCIO_NAMESPACE_ENTER
             free(m_buffer);
         }
         
+        void ScanlineHelper::setPixelRange(long pixelBegin, long pixelEnd)
+        {
+            m_imagePixelIndex = std::max(0L, pixelBegin);
+            m_imagePixelEnd = std::min(m_dstImg.width * m_dstImg.height, pixelEnd);
+            m_numPixelsCopied = 0;
+        }
+        
         // Copy from the src image to our scanline, in our preferred
         // pixel layout.
         
         void ScanlineHelper::prepRGBAScanline(float** buffer, long* numPixels)
         {
+            if(m_imagePixelIndex >= m_imagePixelEnd)
+            {
+                m_numPixelsCopied = 0;
+                *numPixels = 0;
+                return;
+            }
+            
             if(m_inPlaceMode)
             {
-                // TODO: what if scanline is too short, or too long?
-                if(m_yIndex >= m_img.height)
-                {
-                    *numPixels = 0;
-                    return;
-                }
+                // Process (up to) the remainder of the current row in place
+                long yIndex = m_imagePixelIndex / m_dstImg.width;
+                long xIndex = m_imagePixelIndex % m_dstImg.width;
                 
-                char* rowPtr = reinterpret_cast<char*>(m_img.rData);
-                rowPtr += m_img.yStrideBytes*m_yIndex;
+                char* rowPtr = m_dstImg.rData;
+                rowPtr += m_dstImg.yStrideBytes*yIndex + m_dstImg.xStrideBytes*xIndex;
                 
                 *buffer = reinterpret_cast<float*>(rowPtr);
-                *numPixels = m_img.width;
+                *numPixels = std::min(m_dstImg.width - xIndex,
+                                      m_imagePixelEnd - m_imagePixelIndex);
+                m_numPixelsCopied = static_cast<int>(*numPixels);
+                
+                if(m_outOfPlace)
+                {
+                    PackRGBAFromImageDesc(m_srcImg, *buffer,
+                                          &m_numPixelsCopied,
+                                          m_numPixelsCopied,
+                                          m_imagePixelIndex);
+                }
             }
             else
             {
-                PackRGBAFromImageDesc(m_img, m_buffer,
+                long outputBufferSize = std::min(static_cast<long>(PIXELS_PER_LINE),
+                                                 m_imagePixelEnd - m_imagePixelIndex);
+                PackRGBAFromImageDesc(m_srcImg, m_buffer,
                                       &m_numPixelsCopied,
-                                      PIXELS_PER_LINE,
+                                      static_cast<int>(outputBufferSize),
                                       m_imagePixelIndex);
                 *buffer = m_buffer;
                 *numPixels = m_numPixelsCopied;
@@ -105,18 +177,15 @@ OCIO_NAMESPACE_ENTER
         
         void ScanlineHelper::finishRGBAScanline()
         {
-            if(m_inPlaceMode)
+            if(!m_inPlaceMode)
             {
-                m_yIndex += 1;
-            }
-            else
-            {
-                UnpackRGBAToImageDesc(m_img,
+                UnpackRGBAToImageDesc(m_dstImg,
                                       m_buffer,
                                       m_numPixelsCopied,
                                       m_imagePixelIndex);
-                m_imagePixelIndex += m_numPixelsCopied;
             }
+            
+            m_imagePixelIndex += m_numPixelsCopied;
         }
 
 }
@@ -42,9 +42,24 @@ OCIO_NAMESPACE_ENTER
         public:
         
         ScanlineHelper(ImageDesc& img);
+        ScanlineHelper(const GenericImageDesc& img);
+        
+        // Out of place: the pixels are read from srcImg, and the results
+        // written to dstImg. Both must have the same dimensions, and
+        // must not overlap.
+        
+        ScanlineHelper(const GenericImageDesc& srcImg,
+                       const GenericImageDesc& dstImg);
         
         ~ScanlineHelper();
         
+        // Restrict processing to the pixels [pixelBegin, pixelEnd), in
+        // scanline order, and rewind to pixelBegin. By default the whole
+        // image is processed. Used to hand out bands of the image to
+        // separate workers, each owning its own helper.
+        
+        void setPixelRange(long pixelBegin, long pixelEnd);
+        
         // Copy from the src image to our scanline, in our preferred
         // pixel layout. Return the number of pixels to process;
         
@@ -56,18 +71,24 @@ OCIO_NAMESPACE_ENTER
         void finishRGBAScanline();
         
         private:
-            GenericImageDesc m_img;
+            GenericImageDesc m_srcImg;
+            GenericImageDesc m_dstImg;
             
-            // Copy mode
-            float* m_buffer;
             long m_imagePixelIndex;
+            long m_imagePixelEnd;
             int m_numPixelsCopied;
             
-            // In place mode
-            int m_yIndex;
+            // Copy mode
+            float* m_buffer;
             
+            // The pixels are processed directly in the dst image
             bool m_inPlaceMode;
             
+            // The src and dst images are not the same
+            bool m_outOfPlace;
+            
+            void init();
+            
             ScanlineHelper(const ScanlineHelper &);
             ScanlineHelper& operator= (const ScanlineHelper &);
     };
@@ -0,0 +1,843 @@
+/*
+Copyright (c) 2003-2010 Sony Pictures Imageworks Inc., et al.
+All Rights Reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Sony Pictures Imageworks nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Mutex.h"
+#include "ParseUtils.h"
+#include "Threading.h"
+
+#ifndef WINDOWS
+#include <unistd.h>
+#endif
+
+OCIO_NAMESPACE_ENTER
+{
+    ParallelTask::~ParallelTask()
+    { }
+    
+    TaskExecutor::~TaskExecutor()
+    { }
+    
+    namespace
+    {
+        const char * OCIO_NUM_THREADS_ENVVAR = "OCIO_NUM_THREADS";
+        const int OCIO_DEFAULT_NUM_THREADS = 1;
+        
+        Mutex g_threadingMutex;
+        int g_numThreads = OCIO_DEFAULT_NUM_THREADS;
+        bool g_initialized = false;
+        bool g_numThreadsOverride = false;
+        TaskExecutor * g_taskExecutor = 0;
+        
+        // The number of SerialScopes alive on this thread
+#ifdef WINDOWS
+        __declspec(thread) int g_serialScopeDepth = 0;
+#else
+        __thread int g_serialScopeDepth = 0;
+#endif
+        
+        // You must manually acquire the threading mutex before calling this.
+        // This will set g_numThreads, g_initialized, g_numThreadsOverride
+        void InitThreading()
+        {
+            if(g_initialized) return;
+            
+            g_initialized = true;
+            
+            char* numstr = std::getenv(OCIO_NUM_THREADS_ENVVAR);
+            if(numstr)
+            {
+                int numThreads = 0;
+                if(StringToInt(&numThreads, numstr, true) && numThreads >= 0)
+                {
+                    g_numThreadsOverride = true;
+                    g_numThreads = numThreads;
+                }
+                else
+                {
+                    std::cerr << "[OpenColorIO Warning]: Invalid $OCIO_NUM_THREADS specified. ";
+                    std::cerr << "Options: 0 (one per core), or a positive thread count." << std::endl;
+                }
+            }
+        }
+    }
+    
+    int GetNumThreads()
+    {
+        AutoMutex lock(g_threadingMutex);
+        InitThreading();
+        
+        return g_numThreads;
+    }
+    
+    void SetNumThreads(int numThreads)
+    {
+        AutoMutex lock(g_threadingMutex);
+        InitThreading();
+        
+        // As with the logging level, calls to SetNumThreads are ignored if
+        // OCIO_NUM_THREADS is specified, so that the thread count can be
+        // controlled by the environment (e.g., a farm wrapper) regardless
+        // of what the application asks for.
+        
+        if(!g_numThreadsOverride)
+        {
+            g_numThreads = numThreads < 0 ? 0 : numThreads;
+        }
+    }
+    
+    void SetTaskExecutor(TaskExecutor * executor)
+    {
+        AutoMutex lock(g_threadingMutex);
+        g_taskExecutor = executor;
+    }
+    
+    TaskExecutor * GetTaskExecutor()
+    {
+        AutoMutex lock(g_threadingMutex);
+        return g_taskExecutor;
+    }
+    
+    int GetNumProcessors()
+    {
+#ifdef WINDOWS
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        int numProcessors = static_cast<int>(info.dwNumberOfProcessors);
+#else
+        int numProcessors = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+#endif
+        return numProcessors < 1 ? 1 : numProcessors;
+    }
+    
+    SerialScope::SerialScope()
+    {
+        ++g_serialScopeDepth;
+    }
+    
+    SerialScope::~SerialScope()
+    {
+        --g_serialScopeDepth;
+    }
+    
+    int GetParallelForNumWorkers(long numItems)
+    {
+        if(g_serialScopeDepth > 0) return 1;
+        
+        int numWorkers = 1;
+        
+        TaskExecutor * executor = GetTaskExecutor();
+        if(executor)
+        {
+            numWorkers = executor->getConcurrency();
+        }
+        else
+        {
+            numWorkers = GetNumThreads();
+            if(numWorkers == 0) numWorkers = GetNumProcessors();
+        }
+        
+        if(numItems < static_cast<long>(numWorkers))
+        {
+            numWorkers = static_cast<int>(numItems);
+        }
+        
+        return numWorkers < 1 ? 1 : numWorkers;
+    }
+    
+    namespace
+    {
+        // The items not yet started by a worker. The owner pops grains from
+        // the front, thieves split off the back.
+        
+        struct WorkRange
+        {
+            SpinLock lock;
+            long begin;
+            long end;
+            
+            WorkRange() : begin(0), end(0) { }
+        };
+        
+        class WorkStealingScheduler
+        {
+        public:
+            WorkStealingScheduler(const ParallelForBody & body, long numItems,
+                                  long grainSize, int numWorkers) :
+                m_body(body),
+                m_grainSize(grainSize < 1 ? 1 : grainSize),
+                m_numWorkers(numWorkers),
+                m_ranges(new WorkRange[numWorkers]),
+                m_failed(false)
+            {
+                for(int i=0; i<m_numWorkers; ++i)
+                {
+                    m_ranges[i].begin = numItems * i / m_numWorkers;
+                    m_ranges[i].end = numItems * (i+1) / m_numWorkers;
+                }
+            }
+            
+            ~WorkStealingScheduler()
+            {
+                delete [] m_ranges;
+            }
+            
+            int getNumWorkers() const { return m_numWorkers; }
+            
+            void runWorker(int workerIndex)
+            {
+                try
+                {
+                    long itemBegin = 0, itemEnd = 0;
+                    while(popFront(workerIndex, &itemBegin, &itemEnd) ||
+                          steal(workerIndex, &itemBegin, &itemEnd))
+                    {
+                        m_body.run(workerIndex, itemBegin, itemEnd);
+                    }
+                }
+                catch(std::exception & e)
+                {
+                    fail(e.what());
+                }
+                catch(...)
+                {
+                    fail("Unknown error in parallel apply.");
+                }
+            }
+            
+            // Rethrow the first error reported by a worker, if any
+            void throwIfFailed()
+            {
+                AutoMutex lock(m_errorMutex);
+                if(m_failed)
+                {
+                    throw Exception(m_errorText.c_str());
+                }
+            }
+            
+        private:
+            const ParallelForBody & m_body;
+            long m_grainSize;
+            int m_numWorkers;
+            WorkRange * m_ranges;
+            
+            Mutex m_errorMutex;
+            bool m_failed;
+            std::string m_errorText;
+            
+            bool popFront(int workerIndex, long * itemBegin, long * itemEnd)
+            {
+                WorkRange & range = m_ranges[workerIndex];
+                AutoSpin lock(range.lock);
+                if(range.begin >= range.end) return false;
+                
+                *itemBegin = range.begin;
+                *itemEnd = std::min(range.begin + m_grainSize, range.end);
+                range.begin = *itemEnd;
+                return true;
+            }
+            
+            // Steal the back half of the largest remaining range, keep the
+            // first grain of it and publish the rest as our own range
+            // (so that it can be stolen again in turn).
+            
+            bool steal(int workerIndex, long * itemBegin, long * itemEnd)
+            {
+                while(true)
+                {
+                    int victim = -1;
+                    long victimRemaining = 0;
+                    
+                    for(int i=0; i<m_numWorkers; ++i)
+                    {
+                        if(i == workerIndex) continue;
+                        
+                        AutoSpin lock(m_ranges[i].lock);
+                        long remaining = m_ranges[i].end - m_ranges[i].begin;
+                        if(remaining > victimRemaining)
+                        {
+                            victim = i;
+                            victimRemaining = remaining;
+                        }
+                    }
+                    
+                    if(victim < 0) return false;
+                    
+                    long stolenBegin = 0, stolenEnd = 0;
+                    {
+                        WorkRange & range = m_ranges[victim];
+                        AutoSpin lock(range.lock);
+                        long remaining = range.end - range.begin;
+                        
+                        // The victim made progress in the meantime, retry.
+                        if(remaining <= 0) continue;
+                        
+                        long numStolen = std::max(remaining / 2,
+                                                  std::min(remaining, m_grainSize));
+                        stolenEnd = range.end;
+                        stolenBegin = range.end - numStolen;
+                        range.end = stolenBegin;
+                    }
+                    
+                    *itemBegin = stolenBegin;
+                    *itemEnd = std::min(stolenBegin + m_grainSize, stolenEnd);
+                    
+                    WorkRange & ownRange = m_ranges[workerIndex];
+                    AutoSpin lock(ownRange.lock);
+                    ownRange.begin = *itemEnd;
+                    ownRange.end = stolenEnd;
+                    return true;
+                }
+            }
+            
+            // Record the error, and drop all outstanding work so the
+            // other workers finish early.
+            
+            void fail(const char * errorText)
+            {
+                {
+                    AutoMutex lock(m_errorMutex);
+                    if(!m_failed)
+                    {
+                        m_failed = true;
+                        m_errorText = errorText;
+                    }
+                }
+                
+                for(int i=0; i<m_numWorkers; ++i)
+                {
+                    AutoSpin lock(m_ranges[i].lock);
+                    m_ranges[i].begin = m_ranges[i].end;
+                }
+            }
+            
+            WorkStealingScheduler(const WorkStealingScheduler &);
+            WorkStealingScheduler& operator= (const WorkStealingScheduler &);
+        };
+        
+        // Adapts the scheduler workers to the public executor interface.
+        
+        class WorkerTask : public ParallelTask
+        {
+        public:
+            WorkerTask(WorkStealingScheduler & scheduler) :
+                m_scheduler(scheduler)
+            { }
+            
+            virtual void execute(int index) const
+            {
+                m_scheduler.runWorker(index);
+            }
+            
+        private:
+            WorkStealingScheduler & m_scheduler;
+            
+            WorkerTask& operator= (const WorkerTask &);
+        };
+        
+        // A ParallelFor waiting for helpers from the worker pool. It lives
+        // on the stack of the calling thread, which withdraws it from the
+        // pool before returning.
+        
+        struct PoolJob
+        {
+            WorkStealingScheduler * scheduler;
+            int numWorkers;
+            int nextWorkerIndex;     // The next index handed to a pool thread
+            Semaphore finished;      // Posted by each pool thread that helped
+            
+            PoolJob() : scheduler(0), numWorkers(0), nextWorkerIndex(1) { }
+        };
+        
+        // Threads that are started on first use and then kept waiting for
+        // jobs, so that an apply call does not pay for starting threads.
+        // The pool grows to the largest number of helpers asked for, and is
+        // never destroyed (its threads may still be waiting at exit).
+        
+        class WorkerPool
+        {
+        public:
+            WorkerPool() : m_numThreads(0) { }
+            
+            // Run workers [1, numWorkers) on pool threads, and worker 0 on
+            // the calling thread. Helpers that have not started by the time
+            // worker 0 runs dry are withdrawn: their range has been stolen by
+            // then. Waiting only on helpers that did start means a
+            // ParallelFor nested in a pool thread cannot deadlock.
+            
+            void run(WorkStealingScheduler & scheduler)
+            {
+                PoolJob job;
+                job.scheduler = &scheduler;
+                job.numWorkers = scheduler.getNumWorkers();
+                
+                int numHelpers = job.numWorkers - 1;
+                {
+                    AutoMutex lock(m_mutex);
+                    startThreads(numHelpers);
+                    m_jobs.push_back(&job);
+                }
+                for(int i=0; i<numHelpers; ++i) m_wakeup.post();
+                
+                scheduler.runWorker(0);
+                
+                int numStarted = 0;
+                {
+                    AutoMutex lock(m_mutex);
+                    std::deque<PoolJob *>::iterator iter =
+                        std::find(m_jobs.begin(), m_jobs.end(), &job);
+                    if(iter != m_jobs.end()) m_jobs.erase(iter);
+                    numStarted = job.nextWorkerIndex - 1;
+                }
+                for(int i=0; i<numStarted; ++i) job.finished.wait();
+            }
+            
+            static void ThreadMain(void * arg)
+            {
+                static_cast<WorkerPool *>(arg)->serve();
+            }
+            
+        private:
+            Mutex m_mutex;
+            Semaphore m_wakeup;
+            std::deque<PoolJob *> m_jobs;
+            int m_numThreads;
+            
+            // You must manually acquire m_mutex before calling this.
+            // If a thread cannot be started, the workers that did start
+            // simply steal its range.
+            void startThreads(int numThreads)
+            {
+                while(m_numThreads < numThreads &&
+                      StartDetachedThread(&WorkerPool::ThreadMain, this))
+                {
+                    ++m_numThreads;
+                }
+            }
+            
+            void serve()
+            {
+                while(true)
+                {
+                    m_wakeup.wait();
+                    
+                    PoolJob * job = 0;
+                    int workerIndex = 0;
+                    {
+                        AutoMutex lock(m_mutex);
+                        
+                        // The job this wakeup was posted for may already
+                        // have been withdrawn.
+                        if(m_jobs.empty()) continue;
+                        
+                        job = m_jobs.front();
+                        workerIndex = job->nextWorkerIndex++;
+                        if(job->nextWorkerIndex >= job->numWorkers)
+                        {
+                            m_jobs.pop_front();
+                        }
+                    }
+                    
+                    job->scheduler->runWorker(workerIndex);
+                    job->finished.post();
+                }
+            }
+            
+            WorkerPool(const WorkerPool &);
+            WorkerPool& operator= (const WorkerPool &);
+        };
+        
+        WorkerPool * g_workerPool = 0;
+        
+        WorkerPool & GetWorkerPool()
+        {
+            AutoMutex lock(g_threadingMutex);
+            if(!g_workerPool) g_workerPool = new WorkerPool;
+            return *g_workerPool;
+        }
+    }
+    
+    void ParallelFor(const ParallelForBody & body, long numItems,
+                     long grainSize, int numWorkers)
+    {
+        if(numItems <= 0) return;
+        
+        if(numWorkers <= 1 || g_serialScopeDepth > 0)
+        {
+            body.run(0, 0, numItems);
+            return;
+        }
+        
+        WorkStealingScheduler scheduler(body, numItems, grainSize, numWorkers);
+        
+        TaskExecutor * executor = GetTaskExecutor();
+        if(executor)
+        {
+            WorkerTask task(scheduler);
+            executor->run(task, numWorkers);
+            
+            // Pick up anything the executor may have skipped.
+            scheduler.runWorker(0);
+        }
+        else
+        {
+            GetWorkerPool().run(scheduler);
+        }
+        
+        scheduler.throwIfFailed();
+    }
+    
+    namespace
+    {
+        struct DetachedThreadData
+        {
+            void (*func)(void *);
+            void * arg;
+        };
+        
+#ifdef WINDOWS
+        unsigned __stdcall DetachedThreadMain(void * arg)
+#else
+        extern "C" void * DetachedThreadMain(void * arg)
+#endif
+        {
+            DetachedThreadData * data = static_cast<DetachedThreadData *>(arg);
+            void (*func)(void *) = data->func;
+            void * funcArg = data->arg;
+            delete data;
+            
+            func(funcArg);
+            return 0;
+        }
+    }
+    
+    bool StartDetachedThread(void (*func)(void *), void * arg)
+    {
+        DetachedThreadData * data = new DetachedThreadData;
+        data->func = func;
+        data->arg = arg;
+        
+#ifdef WINDOWS
+        HANDLE thread = (HANDLE)_beginthreadex(NULL, 0, DetachedThreadMain,
+                                               data, 0, NULL);
+        if(thread)
+        {
+            CloseHandle(thread);
+            return true;
+        }
+#else
+        pthread_attr_t attr;
+        pthread_attr_init(&attr);
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+        
+        pthread_t thread;
+        bool started = (pthread_create(&thread, &attr, DetachedThreadMain, data) == 0);
+        pthread_attr_destroy(&attr);
+        if(started) return true;
+#endif
+        
+        delete data;
+        return false;
+    }
+}
+OCIO_NAMESPACE_EXIT
+
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef OCIO_UNIT_TEST
+
+namespace OCIO = OCIO_NAMESPACE;
+#include "UnitTest.h"
+
+namespace
+{
+    class CountItemsBody : public OCIO::ParallelForBody
+    {
+    public:
+        CountItemsBody(long numItems) :
+            m_counts(numItems, 0)
+        { }
+        
+        virtual void run(int /*workerIndex*/, long itemBegin, long itemEnd) const
+        {
+            for(long i=itemBegin; i<itemEnd; ++i)
+            {
+                // Make the front of the range much slower than the back,
+                // so the workers have to steal to finish.
+                if(i < (long)m_counts.size()/8)
+                {
+                    volatile double x = 0.0;
+                    for(int j=0; j<20000; ++j) x += (double)j;
+                }
+                m_counts[i] += 1;
+            }
+        }
+        
+        mutable std::vector<int> m_counts;
+    };
+    
+    class ThrowingBody : public OCIO::ParallelForBody
+    {
+    public:
+        virtual void run(int /*workerIndex*/, long itemBegin, long itemEnd) const
+        {
+            for(long i=itemBegin; i<itemEnd; ++i)
+            {
+                if(i == 37) throw OCIO::Exception("Item 37 failed.");
+            }
+        }
+    };
+    
+    class WorkerIndexBody : public OCIO::ParallelForBody
+    {
+    public:
+        WorkerIndexBody() :
+            m_maxWorkerIndex(0)
+        { }
+        
+        virtual void run(int workerIndex, long /*itemBegin*/, long /*itemEnd*/) const
+        {
+            OCIO::AutoMutex lock(m_mutex);
+            m_maxWorkerIndex = std::max(m_maxWorkerIndex, workerIndex);
+        }
+        
+        mutable OCIO::Mutex m_mutex;
+        mutable int m_maxWorkerIndex;
+    };
+    
+    // Runs a ParallelFor of its own for each range, as BakeLut3D calling
+    // Processor::apply would.
+    class NestedBody : public OCIO::ParallelForBody
+    {
+    public:
+        NestedBody(long numInnerItems) :
+            m_numInnerItems(numInnerItems)
+        { }
+        
+        virtual void run(int /*workerIndex*/, long itemBegin, long itemEnd) const
+        {
+            for(long i=itemBegin; i<itemEnd; ++i)
+            {
+                CountItemsBody inner(m_numInnerItems);
+                OCIO::ParallelFor(inner, m_numInnerItems, 1, 4);
+                for(long j=0; j<m_numInnerItems; ++j)
+                {
+                    if(inner.m_counts[j] != 1)
+                    {
+                        throw OCIO::Exception("Inner item not run once.");
+                    }
+                }
+            }
+        }
+        
+    private:
+        long m_numInnerItems;
+    };
+    
+    // Runs the workers one after the other, as a trivial host pool would.
+    class SerialExecutor : public OCIO::TaskExecutor
+    {
+    public:
+        SerialExecutor() : numRuns(0) { }
+        
+        virtual int getConcurrency() const { return 3; }
+        
+        virtual void run(const OCIO::ParallelTask & task, int numItems)
+        {
+            ++numRuns;
+            for(int i=0; i<numItems; ++i) task.execute(i);
+        }
+        
+        int numRuns;
+    };
+}
+
+OIIO_ADD_TEST(Threading, ParallelForItems)
+{
+    const long numItems = 1000;
+    const int numWorkers = 4;
+    
+    CountItemsBody body(numItems);
+    OCIO::ParallelFor(body, numItems, 3, numWorkers);
+    
+    for(long i=0; i<numItems; ++i)
+    {
+        OIIO_CHECK_EQUAL(body.m_counts[i], 1);
+    }
+    
+    // Serial
+    CountItemsBody serialBody(numItems);
+    OCIO::ParallelFor(serialBody, numItems, 3, 1);
+    for(long i=0; i<numItems; ++i)
+    {
+        OIIO_CHECK_EQUAL(serialBody.m_counts[i], 1);
+    }
+    
+    // More workers than items
+    CountItemsBody smallBody(3);
+    OCIO::ParallelFor(smallBody, 3, 1, 8);
+    for(long i=0; i<3; ++i)
+    {
+        OIIO_CHECK_EQUAL(smallBody.m_counts[i], 1);
+    }
+}
+
+OIIO_ADD_TEST(Threading, ParallelForRepeated)
+{
+    // The pool threads are reused from one call to the next
+    for(int n=0; n<200; ++n)
+    {
+        CountItemsBody body(64);
+        OCIO::ParallelFor(body, 64, 1, 1 + n%8);
+        for(long i=0; i<64; ++i)
+        {
+            OIIO_CHECK_EQUAL(body.m_counts[i], 1);
+        }
+    }
+}
+
+OIIO_ADD_TEST(Threading, ParallelForNested)
+{
+    // The pool threads may all be busy running the outer workers
+    NestedBody body(40);
+    OIIO_CHECK_NO_THOW(OCIO::ParallelFor(body, 16, 1, 4));
+}
+
+OIIO_ADD_TEST(Threading, SerialScope)
+{
+    int oldNumThreads = OCIO::GetNumThreads();
+    OCIO::SetNumThreads(4);
+    OIIO_CHECK_EQUAL(OCIO::GetParallelForNumWorkers(100), 4);
+    {
+        OCIO::SerialScope serial;
+        OIIO_CHECK_EQUAL(OCIO::GetParallelForNumWorkers(100), 1);
+        
+        // Worker 0 is the calling thread
+        WorkerIndexBody body;
+        OCIO::ParallelFor(body, 100, 1, 4);
+        OIIO_CHECK_EQUAL(body.m_maxWorkerIndex, 0);
+    }
+    OIIO_CHECK_EQUAL(OCIO::GetParallelForNumWorkers(100), 4);
+    OCIO::SetNumThreads(oldNumThreads);
+}
+
+OIIO_ADD_TEST(Threading, ParallelForException)
+{
+    ThrowingBody body;
+    OIIO_CHECK_THOW(OCIO::ParallelFor(body, 100, 1, 4), OCIO::Exception);
+    OIIO_CHECK_THOW(OCIO::ParallelFor(body, 100, 1, 1), OCIO::Exception);
+}
+
+OIIO_ADD_TEST(Threading, TaskExecutor)
+{
+    SerialExecutor executor;
+    OCIO::SetTaskExecutor(&executor);
+    OIIO_CHECK_EQUAL(OCIO::GetTaskExecutor(), &executor);
+    OIIO_CHECK_EQUAL(OCIO::GetParallelForNumWorkers(100), 3);
+    OIIO_CHECK_EQUAL(OCIO::GetParallelForNumWorkers(2), 2);
+    
+    const long numItems = 500;
+    CountItemsBody body(numItems);
+    OCIO::ParallelFor(body, numItems, 7, 3);
+    OCIO::SetTaskExecutor(NULL);
+    
+    OIIO_CHECK_EQUAL(executor.numRuns, 1);
+    for(long i=0; i<numItems; ++i)
+    {
+        OIIO_CHECK_EQUAL(body.m_counts[i], 1);
+    }
+}
+
+OIIO_ADD_TEST(Threading, ProcessorApply)
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    OCIO::MatrixTransformRcPtr transform = OCIO::MatrixTransform::Create();
+    float m44[16] = { 0.5f, 0.1f, 0.2f, 0.0f,
+                      0.3f, 0.6f, 0.1f, 0.0f,
+                      0.0f, 0.2f, 0.7f, 0.0f,
+                      0.0f, 0.0f, 0.0f, 1.0f };
+    float offset4[4] = { 0.01f, 0.02f, 0.03f, 0.0f };
+    transform->setValue(m44, offset4);
+    OCIO::ConstProcessorRcPtr processor =
+        config->getProcessor(transform, OCIO::TRANSFORM_DIR_FORWARD);
+    
+    // Odd sizes, so that bands do not line up with the scanlines
+    const long width = 517;
+    const long height = 93;
+    const long numPixels = width*height;
+    
+    std::vector<float> packed(numPixels*4);
+    for(long i=0; i<numPixels*4; ++i)
+    {
+        packed[i] = (float)(i % 1013) / 1013.0f;
+    }
+    std::vector<float> planar(numPixels*3);
+    for(long i=0; i<numPixels; ++i)
+    {
+        planar[i] = packed[4*i];
+        planar[numPixels+i] = packed[4*i+1];
+        planar[2*numPixels+i] = packed[4*i+2];
+    }
+    std::vector<float> expected(packed);
+    
+    int oldNumThreads = OCIO::GetNumThreads();
+    
+    OCIO::SetNumThreads(1);
+    OCIO::PackedImageDesc expectedImg(&expected[0], width, height, 4);
+    processor->apply(expectedImg);
+    
+    OCIO::SetNumThreads(4);
+    OCIO::PackedImageDesc packedImg(&packed[0], width, height, 4);
+    processor->apply(packedImg);
+    OCIO::PlanarImageDesc planarImg(&planar[0], &planar[numPixels],
+                                    &planar[2*numPixels], NULL, width, height);
+    processor->apply(planarImg);
+    
+    OCIO::SetNumThreads(oldNumThreads);
+    
+    for(long i=0; i<numPixels; ++i)
+    {
+        OIIO_CHECK_EQUAL(packed[4*i], expected[4*i]);
+        OIIO_CHECK_EQUAL(packed[4*i+1], expected[4*i+1]);
+        OIIO_CHECK_EQUAL(packed[4*i+2], expected[4*i+2]);
+        OIIO_CHECK_EQUAL(packed[4*i+3], expected[4*i+3]);
+        OIIO_CHECK_EQUAL(planar[i], expected[4*i]);
+        OIIO_CHECK_EQUAL(planar[numPixels+i], expected[4*i+1]);
+        OIIO_CHECK_EQUAL(planar[2*numPixels+i], expected[4*i+2]);
+    }
+}
+
+#endif // OCIO_UNIT_TEST
@@ -0,0 +1,91 @@
+/*
+Copyright (c) 2003-2010 Sony Pictures Imageworks Inc., et al.
+All Rights Reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Sony Pictures Imageworks nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef INCLUDED_OCIO_THREADING_H
+#define INCLUDED_OCIO_THREADING_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+OCIO_NAMESPACE_ENTER
+{
+    // The body of a ParallelFor. run() is called with consecutive
+    // ranges of items; workerIndex is stable for a given worker, and in
+    // [0, numWorkers), so it may be used to index per-worker scratch memory.
+    // Exceptions thrown from run() are rethrown on the calling thread.
+    
+    class ParallelForBody
+    {
+    public:
+        virtual ~ParallelForBody() { }
+        virtual void run(int workerIndex, long itemBegin, long itemEnd) const = 0;
+    };
+    
+    // Number of processors reported by the OS (at least 1).
+    int GetNumProcessors();
+    
+    // The number of workers ParallelFor would use for numItems,
+    // based on the registered TaskExecutor or GetNumThreads().
+    int GetParallelForNumWorkers(long numItems);
+    
+    // Process items [0, numItems) on numWorkers workers.
+    // Each worker starts out owning an equal contiguous range of items,
+    // which it consumes from the front, grainSize items at a time. A worker
+    // that runs dry steals the back half of the largest remaining range,
+    // so uneven workloads still balance.
+    // Worker 0 runs on the calling thread, the others on the registered
+    // TaskExecutor, or else on a pool of threads kept between calls.
+    // With numWorkers <= 1, the body is run serially on the calling thread.
+    
+    void ParallelFor(const ParallelForBody & body, long numItems,
+                     long grainSize, int numWorkers);
+    
+    // While a SerialScope is alive, ParallelFor runs serially on the thread
+    // that created it, and GetParallelForNumWorkers returns 1 there. Work
+    // already split across workers of its own (such as BakeLut3D) can then
+    // call Processor::apply on each worker without starting more.
+    
+    class SerialScope
+    {
+    public:
+        SerialScope();
+        ~SerialScope();
+        
+    private:
+        SerialScope(const SerialScope &);
+        SerialScope& operator= (const SerialScope &);
+    };
+    
+    // Run func(arg) on a new thread, which is never joined.
+    // Returns false (and runs nothing) if the thread cannot be created.
+    
+    bool StartDetachedThread(void (*func)(void *), void * arg);
+}
+OCIO_NAMESPACE_EXIT
+
+#endif
@@ -33,6 +33,172 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma GCC visibility push(default)
 #include <unittest.h> // OIIO unit tests header
 #pragma GCC visibility pop
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+
+#include "PathUtils.h"
+#include "Platform.h"
+#include "pystring/pystring.h"
+
+#ifdef WINDOWS
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+OCIO_NAMESPACE_ENTER
+{
+    // A new directory in the temporary directory of the system, removed
+    // along with everything in it when the object goes, for the tests
+    // that need files on disk.
+    class TempDirectory
+    {
+    public:
+        explicit TempDirectory(const std::string & prefix)
+        {
+#ifdef WINDOWS
+            char dir[MAX_PATH+1];
+            const DWORD dirSize = GetTempPathA(MAX_PATH+1, dir);
+            static int counter = 0;
+            for(int attempt=0; attempt<100 && m_path.empty(); ++attempt)
+            {
+                std::ostringstream path;
+                path << std::string(dir, dirSize) << "ocio_" << prefix << "_";
+                path << _getpid() << "_" << counter++;
+                if(_mkdir(path.str().c_str()) == 0) m_path = path.str();
+            }
+#else
+            const char * dir = std::getenv("TMPDIR");
+            std::string path = pystring::os::path::join((dir && *dir) ? dir : "/tmp",
+                                                        "ocio_" + prefix + "_XXXXXX");
+            if(mkdtemp(&path[0])) m_path = path;
+#endif
+            if(m_path.empty())
+            {
+                throw Exception("Could not create a temporary directory.");
+            }
+        }
+        
+        ~TempDirectory()
+        {
+            RemoveAll(m_path);
+        }
+        
+        const std::string & getPath() const
+        {
+            return m_path;
+        }
+        
+        std::string getFilePath(const std::string & name) const
+        {
+            return pystring::os::path::join(m_path, name);
+        }
+        
+        // Writes the file in the directory, as is, and returns its path
+        std::string writeFile(const std::string & name,
+                              const std::string & contents) const
+        {
+            const std::string path = getFilePath(name);
+            std::ofstream file(path.c_str(), std::ios_base::out | std::ios_base::binary);
+            file << contents;
+            return path;
+        }
+        
+        // Creates a directory in the directory, and returns its path
+        std::string createDirectory(const std::string & name) const
+        {
+            const std::string path = getFilePath(name);
+#ifdef WINDOWS
+            _mkdir(path.c_str());
+#else
+            mkdir(path.c_str(), 0700);
+#endif
+            return path;
+        }
+        
+    private:
+        TempDirectory(const TempDirectory &);
+        TempDirectory & operator= (const TempDirectory &);
+        
+        static void RemoveAll(const std::string & path)
+        {
+            std::set<std::string> entries;
+            if(!GetDirectoryEntries(entries, path))
+            {
+                std::remove(path.c_str());
+                return;
+            }
+            
+            for(std::set<std::string>::const_iterator iter = entries.begin();
+                iter != entries.end(); ++iter)
+            {
+                if(*iter == "." || *iter == "..") continue;
+                RemoveAll(pystring::os::path::join(path, *iter));
+            }
+#ifdef WINDOWS
+            _rmdir(path.c_str());
+#else
+            rmdir(path.c_str());
+#endif
+        }
+        
+        std::string m_path;
+    };
+    
+    inline FileTransformRcPtr CreateFileTransform(const std::string & src,
+        Interpolation interpolation = INTERP_LINEAR)
+    {
+        FileTransformRcPtr transform = FileTransform::Create();
+        transform->setSrc(src.c_str());
+        transform->setInterpolation(interpolation);
+        return transform;
+    }
+    
+    inline ColorSpaceRcPtr CreateColorSpace(const char * name,
+        const ConstTransformRcPtr & transform,
+        ColorSpaceDirection dir = COLORSPACE_DIR_TO_REFERENCE)
+    {
+        ColorSpaceRcPtr cs = ColorSpace::Create();
+        cs->setName(name);
+        if(transform) cs->setTransform(transform, dir);
+        return cs;
+    }
+    
+    // Benchmarks print timings rather than check anything, so they only
+    // run when the OCIO_UNIT_TEST_BENCHMARKS environment variable is set
+    // (to anything but 0).
+    inline bool BenchmarksEnabled()
+    {
+        const char * value = std::getenv("OCIO_UNIT_TEST_BENCHMARKS");
+        return value && *value && std::string(value) != "0";
+    }
+    
+    // Wall clock time, in seconds
+    inline double GetBenchmarkTime()
+    {
+#ifdef WINDOWS
+        LARGE_INTEGER frequency, counter;
+        QueryPerformanceFrequency(&frequency);
+        QueryPerformanceCounter(&counter);
+        return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+        timeval t;
+        gettimeofday(&t, 0);
+        return (double)t.tv_sec + (double)t.tv_usec / 1000000.0;
+#endif
+    }
+}
+OCIO_NAMESPACE_EXIT
+
 #endif // OCIO_UNIT_TEST
 
 #endif // INCLUDED_OCIO_UNITTEST_H
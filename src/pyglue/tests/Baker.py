@@ -79,6 +79,6 @@ END METADATA
         self.assertEqual(2, bakee.getCubeSize())
         output = bakee.bake()
         self.assertEqual(self.EXPECTED_LUT, output)
-        self.assertEqual(6, bakee.getNumFormats())
-        self.assertEqual("cinespace", bakee.getFormatNameByIndex(2))
+        self.assertEqual(8, bakee.getNumFormats())
+        self.assertEqual("cinespace", bakee.getFormatNameByIndex(4))
         self.assertEqual("3dl", bakee.getFormatExtensionByIndex(1))
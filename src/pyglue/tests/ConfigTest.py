@@ -78,9 +78,9 @@ out_pixel = pow(max(out_pixel, vec4(0, 0, 0, 0)), vec4(0.909091, 0.909091, 0.909
 out_pixel = out_pixel * mat4(1.11111, -2, -3, -4, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1);
 out_pixel = vec4(4.68889, -2.3, -0.4, -0) + out_pixel;
 out_pixel = pow(max(out_pixel, vec4(0, 0, 0, 0)), vec4(0.454545, 0.454545, 0.454545, 1));
-// OSX segfault work-around: Force a no-op sampling of the 3d lut.
+""" + ("""// OSX segfault work-around: Force a no-op sampling of the 3d lut.
 texture3D(lut3d, 0.96875 * out_pixel.rgb + 0.015625).rgb;
-return out_pixel;
+""" if sys.platform == "darwin" else "") + """return out_pixel;
 }
 
 """